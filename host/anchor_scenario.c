@@ -0,0 +1,454 @@
+/**
+ * Simulator Scenario Scripts Implementation (host)
+ *
+ * Author: Colin Bitterfield
+ * Email: colin@bitterfield.com
+ * Date Created: 2026-10-18
+ * Date Updated: 2026-10-18
+ * Version: 0.3.0
+ *
+ * Changelog:
+ * - 0.3.0 (2026-10-18): drag <kn> [<to>]
+ * - 0.2.0 (2026-10-18): expect header line and anchor_scenario_check()
+ */
+
+#include "anchor_scenario.h"
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <math.h>
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+#define DEG_TO_RAD      (M_PI / 180.0)
+#define RAD_TO_DEG      (180.0 / M_PI)
+#define DAY_MS          86400000u
+#define MAX_TOKENS      8
+
+static double wrap360(double deg) {
+    deg = fmod(deg, 360.0);
+    return deg < 0.0 ? deg + 360.0 : deg;
+}
+
+/**
+ * Value of a ramp at a time
+ */
+static float ramp_at(const scenario_ramp_t *r, uint32_t t_ms) {
+    if (r->t1_ms <= r->t0_ms || t_ms >= r->t1_ms) {
+        return r->to;
+    }
+    if (t_ms <= r->t0_ms) {
+        return r->from;
+    }
+    return r->from + (r->to - r->from) * (float)(t_ms - r->t0_ms) / (float)(r->t1_ms - r->t0_ms);
+}
+
+/**
+ * Start a ramp from the value it has now
+ */
+static void ramp_start(scenario_ramp_t *r, float to, uint32_t t_ms, uint32_t dur_ms) {
+    r->from = ramp_at(r, t_ms);
+    r->to = to;
+    r->t0_ms = t_ms;
+    r->t1_ms = t_ms + dur_ms;
+}
+
+/**
+ * Start a direction ramp the short way round (an exact 180 veers)
+ */
+static void ramp_start_dir(scenario_ramp_t *r, float to_deg, uint32_t t_ms, uint32_t dur_ms) {
+    float from = (float)wrap360(ramp_at(r, t_ms));
+    float delta = (float)wrap360(to_deg - from);
+    if (delta > 180.0f) {
+        delta -= 360.0f;
+    }
+    r->from = from;
+    r->to = from + delta;
+    r->t0_ms = t_ms;
+    r->t1_ms = t_ms + dur_ms;
+}
+
+static bool fail(anchor_scenario_t *sc, const char *what, const char *tok) {
+    snprintf(sc->error, sizeof(sc->error), "line %lu: %s%s%s", (unsigned long)sc->line_no, what,
+             tok ? " " : "", tok ? tok : "");
+    sc->pending = false;
+    return false;
+}
+
+static bool parse_num(const char *tok, float *out) {
+    char *end;
+    if (tok == NULL) {
+        return false;
+    }
+    *out = strtof(tok, &end);
+    return end != tok && *end == '\0' && isfinite(*out);
+}
+
+/**
+ * Duration with an optional s, m or h suffix
+ */
+static bool parse_duration(const char *tok, uint32_t *out_ms) {
+    char *end;
+    if (tok == NULL) {
+        return false;
+    }
+    double v = strtod(tok, &end);
+    double scale = 1000.0;
+    if (end == tok || v < 0.0) {
+        return false;
+    }
+    if (*end == 'h') {
+        scale = 3600000.0;
+        end++;
+    } else if (*end == 'm') {
+        scale = 60000.0;
+        end++;
+    } else if (*end == 's') {
+        end++;
+    }
+    if (*end != '\0' || v * scale > 30.0 * DAY_MS) {
+        return false;
+    }
+    *out_ms = (uint32_t)(v * scale + 0.5);
+    return true;
+}
+
+/**
+ * Clock time HH:MM[:SS] (seconds after midnight)
+ */
+static bool parse_clock(const char *tok, uint32_t *out_s) {
+    unsigned int h, m, s = 0;
+    int used = 0;
+    if (sscanf(tok, "%2u:%2u%n", &h, &m, &used) != 2) {
+        return false;
+    }
+    if (tok[used] == ':') {
+        int more = 0;
+        if (sscanf(tok + used, ":%2u%n", &s, &more) != 1) {
+            return false;
+        }
+        used += more;
+    }
+    if (tok[used] != '\0' || h > 23 || m > 59 || s > 59) {
+        return false;
+    }
+    *out_s = h * 3600u + m * 60u + s;
+    return true;
+}
+
+/**
+ * Split a line into tokens, dropping any comment
+ */
+static int tokenize(char *line, char **tok) {
+    char *hash = strchr(line, '#');
+    if (hash) {
+        *hash = '\0';
+    }
+    int n = 0;
+    char *save = NULL;
+    for (char *p = strtok_r(line, " \t\r\n", &save); p && n < MAX_TOKENS; p = strtok_r(NULL, " \t\r\n", &save)) {
+        tok[n++] = p;
+    }
+    return n;
+}
+
+/**
+ * Header line (before the first timed line)
+ */
+static bool header_line(anchor_scenario_t *sc, char **tok, int n) {
+    float v;
+    if (strcmp(tok[0], "name") == 0 && n == 2) {
+        snprintf(sc->name, sizeof(sc->name), "%s", tok[1]);
+    } else if (strcmp(tok[0], "start") == 0 && n == 2) {
+        if (!parse_clock(tok[1], &sc->start_s)) {
+            return fail(sc, "bad time", tok[1]);
+        }
+    } else if (strcmp(tok[0], "rode") == 0 && n == 2) {
+        if (!parse_num(tok[1], &v) || v <= 0.0f) {
+            return fail(sc, "bad rode", tok[1]);
+        }
+        sc->rode_m = v;
+    } else if (strcmp(tok[0], "depth") == 0 && n == 2) {
+        if (!parse_num(tok[1], &v) || v <= 0.0f) {
+            return fail(sc, "bad depth", tok[1]);
+        }
+        sc->depth_m = v;
+    } else if (strcmp(tok[0], "expect") == 0) {
+        if (n == 2 && strcmp(tok[1], "no-alarm") == 0) {
+            sc->expect = SCENARIO_EXPECT_NO_ALARM;
+        } else if (n >= 2 && strcmp(tok[1], "alarm") == 0 &&
+                   (n == 2 || (n == 4 && strcmp(tok[2], "within") == 0 &&
+                               parse_duration(tok[3], &sc->expect_within_ms) &&
+                               sc->expect_within_ms > 0))) {
+            sc->expect = SCENARIO_EXPECT_ALARM;
+        } else {
+            return fail(sc, "usage:", "expect no-alarm | expect alarm [within <dur>]");
+        }
+    } else {
+        return fail(sc, "bad header line:", tok[0]);
+    }
+    return true;
+}
+
+/**
+ * Read up to the next timed line and make it the pending line
+ */
+static bool read_next(anchor_scenario_t *sc) {
+    char buf[SCENARIO_LINE_MAX];
+    char *tok[MAX_TOKENS];
+    sc->pending = false;
+
+    while (fgets(sc->line, sizeof(sc->line), sc->f) != NULL) {
+        sc->line_no++;
+        if (strchr(sc->line, '\n') == NULL && !feof(sc->f)) {
+            return fail(sc, "line too long", NULL);
+        }
+        memcpy(buf, sc->line, sizeof(buf));
+        int n = tokenize(buf, tok);
+        if (n == 0) {
+            continue;
+        }
+        if (!isdigit((unsigned char)tok[0][0])) {
+            if (sc->timed) {
+                return fail(sc, "header line after the first timed line:", tok[0]);
+            }
+            if (!header_line(sc, tok, n)) {
+                return false;
+            }
+            continue;
+        }
+
+        uint32_t clock_s;
+        if (!parse_clock(tok[0], &clock_s)) {
+            return fail(sc, "bad time", tok[0]);
+        }
+        uint32_t rel_ms = ((clock_s + 86400u - sc->start_s) % 86400u) * 1000u;
+        uint32_t t_ms = sc->day_ms + rel_ms;
+        if (t_ms < sc->last_ms) {
+            sc->day_ms += DAY_MS;
+            t_ms += DAY_MS;
+        }
+        sc->pending_ms = t_ms;
+        sc->last_ms = t_ms;
+        sc->timed = true;
+        sc->pending = true;
+        return true;
+    }
+    if (ferror(sc->f)) {
+        return fail(sc, "read error", NULL);
+    }
+    if (sc->end_ms == UINT32_MAX) {
+        return fail(sc, "no end line", NULL);
+    }
+    return true;
+}
+
+/**
+ * Apply the pending line at its time
+ */
+static bool apply_line(anchor_scenario_t *sc) {
+    char buf[SCENARIO_LINE_MAX];
+    char *tok[MAX_TOKENS];
+    memcpy(buf, sc->line, sizeof(buf));
+    int n = tokenize(buf, tok);
+    uint32_t t = sc->pending_ms;
+    float a, b, c, d;
+    uint32_t dur = 0, every, len;
+
+    if (n < 2) {
+        return fail(sc, "missing command", NULL);
+    }
+    const char *cmd = tok[1];
+    if (strcmp(cmd, "wind") == 0 || strcmp(cmd, "current") == 0) {
+        if (!(n == 4 || (n == 6 && strcmp(tok[4], "over") == 0)) ||
+            !parse_num(tok[2], &a) || !parse_num(tok[3], &b) || a < 0.0f ||
+            (n == 6 && !parse_duration(tok[5], &dur))) {
+            return fail(sc, "usage: HH:MM", cmd[0] == 'w' ? "wind <kn> <from> [over <dur>]"
+                                                          : "current <kn> <to> [over <dur>]");
+        }
+        bool wind = (cmd[0] == 'w');
+        ramp_start(wind ? &sc->wind_kn : &sc->current_kn, a, t, dur);
+        ramp_start_dir(wind ? &sc->wind_dir : &sc->current_dir, b, t, dur);
+    } else if (strcmp(cmd, "gust") == 0) {
+        if (n == 3 && parse_num(tok[2], &a) && a == 0.0f) {
+            sc->gust_kn = 0.0f;
+            return true;
+        }
+        if (n != 5 || !parse_num(tok[2], &a) || a < 0.0f || !parse_duration(tok[3], &every) ||
+            !parse_duration(tok[4], &len) || len == 0 || len > every) {
+            return fail(sc, "usage: HH:MM", "gust <kn> <every> <len>");
+        }
+        sc->gust_kn = a;
+        sc->gust_every_ms = every;
+        sc->gust_len_ms = len;
+        sc->gust_t0_ms = t;
+    } else if (strcmp(cmd, "tide") == 0) {
+        if (n != 6 || !parse_num(tok[2], &a) || a < 0.0f || !parse_duration(tok[3], &every) ||
+            every == 0 || !parse_num(tok[4], &c) || c < 0.0f || !parse_num(tok[5], &d)) {
+            return fail(sc, "usage: HH:MM", "tide <range_m> <period> <kn> <flood_to>");
+        }
+        sc->tide_range_m = a;
+        sc->tide_period_ms = every;
+        sc->tide_kn = c;
+        sc->tide_flood_deg = d;
+        sc->tide_t0_ms = t;
+    } else if (strcmp(cmd, "drag") == 0) {
+        if ((n != 3 && n != 4) || !parse_num(tok[2], &a) || a < 0.0f ||
+            (n == 4 && (!parse_num(tok[3], &c) || c < 0.0f))) {
+            return fail(sc, "usage: HH:MM", "drag <drift_kn> [<to>]");
+        }
+        sc->drag_kn = a;
+        sc->drag_to_deg = (n == 4) ? (float)wrap360(c) : -1.0f;
+    } else if (strcmp(cmd, "end") == 0 && n == 2) {
+        sc->end_ms = t;
+    } else {
+        return fail(sc, "unknown command", cmd);
+    }
+    return true;
+}
+
+static bool scenario_begin(anchor_scenario_t *sc, FILE *f, bool own) {
+    memset(sc, 0, sizeof(anchor_scenario_t));
+    sc->f = f;
+    sc->own_file = own;
+    sc->end_ms = UINT32_MAX;
+    snprintf(sc->name, sizeof(sc->name), "scenario");
+    return read_next(sc);
+}
+
+/**
+ * Open a scenario file and read its header
+ */
+bool anchor_scenario_open(anchor_scenario_t *sc, const char *path) {
+    FILE *f = fopen(path, "r");
+    if (f == NULL) {
+        memset(sc, 0, sizeof(anchor_scenario_t));
+        snprintf(sc->error, sizeof(sc->error), "cannot open %s", path);
+        return false;
+    }
+    return scenario_begin(sc, f, true);
+}
+
+/**
+ * Read a scenario from an open stream
+ */
+bool anchor_scenario_attach(anchor_scenario_t *sc, FILE *f) {
+    return scenario_begin(sc, f, false);
+}
+
+/**
+ * Close the scenario file
+ */
+void anchor_scenario_close(anchor_scenario_t *sc) {
+    if (sc->f && sc->own_file) {
+        fclose(sc->f);
+    }
+    sc->f = NULL;
+    sc->pending = false;
+}
+
+/**
+ * Conditions at a time
+ */
+bool anchor_scenario_at(anchor_scenario_t *sc, uint32_t t_ms, scenario_state_t *out) {
+    if (sc->error[0] != '\0') {
+        return false;
+    }
+    while (sc->pending && sc->pending_ms <= t_ms) {
+        if (!apply_line(sc) || !read_next(sc)) {
+            return false;
+        }
+    }
+    if (t_ms >= sc->end_ms) {
+        return false;
+    }
+
+    // Wind plus a raised-cosine gust at the start of each gust period
+    float wind = ramp_at(&sc->wind_kn, t_ms);
+    if (sc->gust_kn > 0.0f && t_ms >= sc->gust_t0_ms) {
+        uint32_t phase = (t_ms - sc->gust_t0_ms) % sc->gust_every_ms;
+        if (phase < sc->gust_len_ms) {
+            wind += sc->gust_kn * 0.5f * (1.0f - (float)cos(2.0 * M_PI * phase / sc->gust_len_ms));
+        }
+    }
+
+    // Steady current plus the tidal stream: flooding while the tide rises, slack at high and low water
+    double cur = ramp_at(&sc->current_kn, t_ms);
+    double cur_rad = ramp_at(&sc->current_dir, t_ms) * DEG_TO_RAD;
+    double ce = cur * sin(cur_rad);
+    double cn = cur * cos(cur_rad);
+    double depth = sc->depth_m;     // 0 = not scripted
+    if (sc->tide_period_ms > 0 && t_ms >= sc->tide_t0_ms) {
+        double ph = 2.0 * M_PI * (double)(t_ms - sc->tide_t0_ms) / sc->tide_period_ms;
+        double flood = -sc->tide_kn * sin(ph);     // < 0: ebb
+        ce += flood * sin(sc->tide_flood_deg * DEG_TO_RAD);
+        cn += flood * cos(sc->tide_flood_deg * DEG_TO_RAD);
+        depth += 0.5 * sc->tide_range_m * cos(ph);
+    }
+
+    out->wind_kn = wind;
+    out->wind_from_deg = (float)wrap360(ramp_at(&sc->wind_dir, t_ms));
+    out->current_kn = (float)hypot(ce, cn);
+    out->current_to_deg = (float)wrap360(atan2(ce, cn) * RAD_TO_DEG);
+    out->depth_m = (sc->depth_m > 0.0f) ? (float)(depth > 0.1 ? depth : 0.1) : 0.0f;
+    out->drag_kn = sc->drag_kn;
+    out->drag_to_deg = sc->drag_to_deg;
+    return true;
+}
+
+/**
+ * Apply conditions to the simulator
+ */
+void anchor_scenario_apply(const scenario_state_t *st, anchor_sim_t *sim) {
+    anchor_sim_set_wind(sim, st->wind_kn, st->wind_from_deg);
+    anchor_sim_set_current(sim, st->current_kn, st->current_to_deg);
+    if (st->depth_m > 0.0f) {
+        anchor_sim_set_depth(sim, st->depth_m);
+    }
+    if (st->drag_kn > 0.0f) {
+        sim->cfg.drift_kn = st->drag_kn;
+        sim->cfg.drag_to_deg = st->drag_to_deg;
+    }
+    anchor_sim_set_drag(sim, st->drag_kn > 0.0f);
+}
+
+/**
+ * Check a night's outcome against the script's expect line
+ */
+bool anchor_scenario_check(const anchor_scenario_t *sc, uint32_t alarm_ms, uint32_t drag_ms,
+                           char *why, size_t len) {
+    uint32_t from_ms = (drag_ms == UINT32_MAX) ? 0 : drag_ms;
+
+    switch (sc->expect) {
+        case SCENARIO_EXPECT_NO_ALARM:
+            if (alarm_ms != 0) {
+                snprintf(why, len, "expected no alarm, alarm at t=%.0f s", alarm_ms / 1000.0);
+                return false;
+            }
+            snprintf(why, len, "expected no alarm");
+            return true;
+        case SCENARIO_EXPECT_ALARM:
+            if (alarm_ms == 0) {
+                snprintf(why, len, "expected an alarm, none raised");
+                return false;
+            }
+            if (alarm_ms < from_ms) {
+                snprintf(why, len, "expected an alarm after the drag at t=%.0f s, alarm at t=%.0f s",
+                         from_ms / 1000.0, alarm_ms / 1000.0);
+                return false;
+            }
+            if (sc->expect_within_ms > 0 && alarm_ms - from_ms > sc->expect_within_ms) {
+                snprintf(why, len, "expected an alarm within %.0f s, took %.0f s",
+                         sc->expect_within_ms / 1000.0, (alarm_ms - from_ms) / 1000.0);
+                return false;
+            }
+            snprintf(why, len, "expected an alarm, %.0f s after %s", (alarm_ms - from_ms) / 1000.0,
+                     (drag_ms == UINT32_MAX) ? "the start" : "the drag");
+            return true;
+        default:
+            snprintf(why, len, "no expected outcome");
+            return true;
+    }
+}
@@ -0,0 +1,164 @@
+/**
+ * Simulator Scenario Scripts (host)
+ *
+ * Author: Colin Bitterfield
+ * Email: colin@bitterfield.com
+ * Date Created: 2026-10-18
+ * Date Updated: 2026-10-18
+ * Version: 0.3.0
+ *
+ * Changelog:
+ * - 0.3.0 (2026-10-18): drag takes an optional direction
+ * - 0.2.0 (2026-10-18): expect header line (expected outcome, alarm latency bound)
+ *
+ * Time-varying conditions for anchor_sim.c, one command per line:
+ *
+ *   name squall-0300               # Header lines come first
+ *   start 22:00                    # Clock time of t = 0 (default 00:00)
+ *   rode 30                        # Rode paid out (m)
+ *   depth 5                        # Depth at the anchor, mean tide (m)
+ *   expect alarm within 2m         # Outcome: alarm within 2 min of the drag (or: expect no-alarm)
+ *   22:00 wind 10 225              # Wind 10 kn from 225 from now on
+ *   03:00 wind 38 45 over 2m       # Ramp to 38 kn from 045 over 2 minutes
+ *   03:00 gust 12 45s 15s          # +12 kn gusts, one every 45 s lasting 15 s (0 = stop)
+ *   18:00 current 1.5 90 over 30m  # Current 1.5 kn setting to 090
+ *   19:00 tide 3 12.42h 2 45       # 3 m range, 12.42 h period, 2 kn flood to 045, high water now
+ *   03:05 drag 1.2                 # Anchor breaks out: drift 1.2 kn (0 = holding)
+ *   03:05 drag 0.5 90              # Anchor drags toward 090 whatever the boat's drift
+ *   08:00 end
+ *
+ * Times are clock times and must not go backwards; a time earlier than the
+ * line before it is on the next day, so a script can run for days. Durations
+ * take s, m or h (plain numbers are seconds). Directions ramp the short way
+ * round; an exact 180 degree shift veers. '#' starts a comment. The script
+ * finishes with an end line.
+ *
+ * The expect line states what the engine must do with the night:
+ * "expect no-alarm" for a holding anchor, or "expect alarm [within <dur>]".
+ * An expected alarm must not come before the anchor starts dragging, and
+ * with "within" it must come no later than that after the drag starts (or
+ * after the start, in a script without a drag line).
+ *
+ * The script is read as the simulation advances: a line is parsed when its
+ * time comes and a ramp runs from the value at that moment. Nothing looks
+ * ahead and nothing is precomputed, so the state is a few channels and one
+ * pending line whatever the length of the script.
+ */
+
+#ifndef ANCHOR_SCENARIO_H
+#define ANCHOR_SCENARIO_H
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "anchor_sim.h"
+
+#define SCENARIO_LINE_MAX       160
+#define SCENARIO_NAME_LEN       32
+#define SCENARIO_ERROR_LEN      96
+
+// Expected outcome (expect header line)
+typedef enum {
+    SCENARIO_EXPECT_NONE = 0,   // Not stated
+    SCENARIO_EXPECT_NO_ALARM,   // Anchor holds, no alarm all night
+    SCENARIO_EXPECT_ALARM       // Alarm, not before the drag (within expect_within_ms of it if set)
+} scenario_expect_t;
+
+// One ramped value
+typedef struct {
+    float from, to;
+    uint32_t t0_ms, t1_ms;      // Ramp from t0 to t1 (t1 <= t0: step)
+} scenario_ramp_t;
+
+// Conditions at one instant
+typedef struct {
+    float wind_kn;              // Including gusts
+    float wind_from_deg;
+    float current_kn;           // Steady current plus tidal stream
+    float current_to_deg;
+    float depth_m;              // Including tide
+    float drag_kn;              // 0 = anchor holding
+    float drag_to_deg;          // < 0 = the way the boat drifts
+} scenario_state_t;
+
+typedef struct {
+    FILE *f;
+    bool own_file;
+    char name[SCENARIO_NAME_LEN];
+    uint32_t start_s;           // Clock time of t = 0 (seconds after midnight)
+    float rode_m;               // 0 = not set by the script
+    float depth_m;
+    scenario_expect_t expect;
+    uint32_t expect_within_ms;  // Latency bound of an expected alarm (0 = none)
+    uint32_t end_ms;            // UINT32_MAX until an "end" line is read
+    // Pending line (next in time)
+    char line[SCENARIO_LINE_MAX];
+    bool pending;
+    bool timed;                 // A timed line has been read (header over)
+    uint32_t pending_ms;
+    uint32_t last_ms;           // Time of the latest line
+    uint32_t day_ms;            // Whole days rolled over so far (ms)
+    uint32_t line_no;
+    // Channels
+    scenario_ramp_t wind_kn, wind_dir, current_kn, current_dir;
+    float gust_kn;
+    uint32_t gust_every_ms, gust_len_ms, gust_t0_ms;
+    float tide_range_m, tide_kn, tide_flood_deg;
+    uint32_t tide_period_ms, tide_t0_ms;
+    float drag_kn;
+    float drag_to_deg;
+    char error[SCENARIO_ERROR_LEN];     // Set when a call fails
+} anchor_scenario_t;
+
+/**
+ * Open a scenario file and read its header
+ * @param sc Scenario
+ * @param path File path
+ * @return false on error (sc->error says why)
+ */
+bool anchor_scenario_open(anchor_scenario_t *sc, const char *path);
+
+/**
+ * Read a scenario from an open stream (not closed by anchor_scenario_close())
+ * @param sc Scenario
+ * @param f Stream positioned at the start of the script
+ * @return false on error (sc->error says why)
+ */
+bool anchor_scenario_attach(anchor_scenario_t *sc, FILE *f);
+
+/**
+ * Close the scenario file
+ * @param sc Scenario
+ */
+void anchor_scenario_close(anchor_scenario_t *sc);
+
+/**
+ * Conditions at a time - O(lines due) per call
+ * Calls must not go back in time.
+ * @param sc Scenario
+ * @param t_ms Time since the start (milliseconds)
+ * @param out Conditions output
+ * @return false at or past the end, or on a script error (sc->error set)
+ */
+bool anchor_scenario_at(anchor_scenario_t *sc, uint32_t t_ms, scenario_state_t *out);
+
+/**
+ * Apply conditions to the simulator
+ * @param st Conditions from anchor_scenario_at()
+ * @param sim Simulator
+ */
+void anchor_scenario_apply(const scenario_state_t *st, anchor_sim_t *sim);
+
+/**
+ * Check a night's outcome against the script's expect line
+ * @param sc Scenario
+ * @param alarm_ms Time of the first alarm (0 = no alarm)
+ * @param drag_ms Time the anchor started dragging (UINT32_MAX = never)
+ * @param why Output: what was expected and what happened
+ * @param len Size of why
+ * @return false if the outcome does not match (true if nothing was expected)
+ */
+bool anchor_scenario_check(const anchor_scenario_t *sc, uint32_t alarm_ms, uint32_t drag_ms,
+                           char *why, size_t len);
+
+#endif // ANCHOR_SCENARIO_H
@@ -0,0 +1,393 @@
+/**
+ * Anchoring Simulator Implementation (host)
+ *
+ * Author: Colin Bitterfield
+ * Email: colin@bitterfield.com
+ * Date Created: 2026-10-18
+ * Version: 0.1.0
+ */
+
+#include "anchor_sim.h"
+#include "anchor_ingest.h"
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+#define DEG_TO_RAD      (M_PI / 180.0)
+#define RAD_TO_DEG      (180.0 / M_PI)
+
+static double sim_uniform(anchor_sim_t *sim) {
+    sim->rng ^= sim->rng << 13;
+    sim->rng ^= sim->rng >> 17;
+    sim->rng ^= sim->rng << 5;
+    return (sim->rng + 0.5) / 4294967296.0;
+}
+
+static double sim_gauss(anchor_sim_t *sim) {
+    return sqrt(-2.0 * log(sim_uniform(sim))) * cos(2.0 * M_PI * sim_uniform(sim));
+}
+
+static double sim_wrap360(double deg) {
+    deg = fmod(deg, 360.0);
+    return deg < 0.0 ? deg + 360.0 : deg;
+}
+
+/**
+ * Combined pull of wind and current on the boat (knots of wind, direction it pulls to)
+ */
+static double sim_pull(const anchor_sim_t *sim, double *to_rad) {
+    double down = (sim->cfg.wind_from_deg + 180.0) * DEG_TO_RAD;
+    double set = sim->cfg.current_to_deg * DEG_TO_RAD;
+    double stream = SIM_CURRENT_FORCE * sim->cfg.current_kn;
+    double pe = sim->cfg.wind_kn * sin(down) + stream * sin(set);
+    double pn = sim->cfg.wind_kn * cos(down) + stream * cos(set);
+    *to_rad = (sim->cfg.current_kn > 0.0f) ? atan2(pe, pn) : down;
+    return (sim->cfg.current_kn > 0.0f) ? hypot(pe, pn) : sim->cfg.wind_kn;
+}
+
+/**
+ * Drift velocity (docs/wind_drift_ui_logic.md): downwind at wind speed, else the drift setting
+ */
+static void sim_drift(const anchor_sim_t *sim, double *ve, double *vn) {
+    double to_rad, kn;
+    double pull = sim_pull(sim, &to_rad);
+    if (pull > 0.0) {
+        kn = (sim->cfg.drift_kn > 0.0f) ? sim->cfg.drift_kn : sim->cfg.wind_kn;
+    } else {
+        to_rad = sim->cfg.drift_to_deg * DEG_TO_RAD;
+        kn = sim->cfg.drift_kn;
+    }
+    *ve = kn * SIM_KNOTS_TO_MPS * sin(to_rad);
+    *vn = kn * SIM_KNOTS_TO_MPS * cos(to_rad);
+}
+
+/**
+ * Default configuration
+ */
+void anchor_sim_default_config(sim_config_t *cfg) {
+    memset(cfg, 0, sizeof(sim_config_t));
+    cfg->seed = 1;
+    cfg->lat = 41.0;
+    cfg->lon = -71.0;
+    cfg->rode_m = 30.0f;
+    cfg->course_deg = 0.0f;
+    cfg->wind_kn = 15.0f;
+    cfg->wind_from_deg = 0.0f;
+    cfg->drag_factor = 0.5f;
+    cfg->drag_to_deg = -1.0f;
+    cfg->depth_m = 6.0f;
+    cfg->noise_m = 1.0f;
+    cfg->step_ms = 1000;
+    cfg->start_utc = SIM_START_UTC;
+}
+
+/**
+ * Start a simulation at the drop
+ */
+void anchor_sim_init(anchor_sim_t *sim, const sim_config_t *cfg) {
+    memset(sim, 0, sizeof(anchor_sim_t));
+    sim->cfg = *cfg;
+    sim->rng = cfg->seed ? cfg->seed : 1;
+    geo_ref_init(&sim->world, cfg->lat, cfg->lon);
+    sim->phase = SIM_PHASE_DROP;
+    sim->slack = 1.0;
+    sim->heading_deg = cfg->course_deg;
+    sim->depth_m = cfg->depth_m;
+}
+
+/**
+ * Change the true wind
+ */
+void anchor_sim_set_wind(anchor_sim_t *sim, float wind_kn, float from_deg) {
+    sim->cfg.wind_kn = wind_kn;
+    sim->cfg.wind_from_deg = from_deg;
+}
+
+/**
+ * Change the water current
+ */
+void anchor_sim_set_current(anchor_sim_t *sim, float current_kn, float to_deg) {
+    sim->cfg.current_kn = current_kn;
+    sim->cfg.current_to_deg = to_deg;
+}
+
+/**
+ * Change the water depth at the anchor
+ */
+void anchor_sim_set_depth(anchor_sim_t *sim, float depth_m) {
+    sim->cfg.depth_m = depth_m;
+}
+
+/**
+ * Start or stop drift mode with anchor
+ */
+void anchor_sim_set_drag(anchor_sim_t *sim, bool dragging) {
+    sim->dragging = dragging;
+}
+
+/**
+ * Advance the model by one step
+ */
+void anchor_sim_step(anchor_sim_t *sim) {
+    const sim_config_t *cfg = &sim->cfg;
+    double dt = cfg->step_ms / 1000.0;
+    double wind = cfg->wind_kn;
+    double down = (cfg->wind_from_deg + 180.0) * DEG_TO_RAD;
+
+    sim->t_ms += cfg->step_ms;
+    sim->prev_e = sim->boat_e;
+    sim->prev_n = sim->boat_n;
+
+    if (sim->dragging) {
+        double ve, vn;
+        sim_drift(sim, &ve, &vn);
+        if (cfg->drag_to_deg >= 0.0f) {
+            double v = hypot(ve, vn);
+            ve = v * sin(cfg->drag_to_deg * DEG_TO_RAD);
+            vn = v * cos(cfg->drag_to_deg * DEG_TO_RAD);
+        }
+        sim->anchor_e += ve * cfg->drag_factor * dt;
+        sim->anchor_n += vn * cfg->drag_factor * dt;
+    }
+
+    if (sim->phase == SIM_PHASE_DROP) {
+        // Fall back downwind at wind speed, or astern at 0.5 kn in a calm
+        double dir = (wind > 0.0) ? down : (cfg->course_deg + 180.0) * DEG_TO_RAD;
+        double v = ((wind > 0.0) ? wind : SIM_DROP_BACK_KN) * SIM_KNOTS_TO_MPS;
+        sim->boat_e += v * sin(dir) * dt;
+        sim->boat_n += v * cos(dir) * dt;
+        sim->heading_deg = (float)sim_wrap360(dir * RAD_TO_DEG + 180.0);
+
+        double de = sim->boat_e - sim->anchor_e, dn = sim->boat_n - sim->anchor_n;
+        if (hypot(de, dn) >= cfg->rode_m) {
+            sim->phase = SIM_PHASE_SWING;
+            sim->angle = atan2(de, dn);
+            sim->angle_vel = 0.0;
+        }
+    } else {
+        // Random yaw force: first-order process, stronger in more wind
+        double sigma = SIM_RANDOM_FORCE_STD * (wind > SIM_CALM_KN ? wind : SIM_CALM_KN);
+        sim->yaw_force_kn += -sim->yaw_force_kn * dt / SIM_GUST_TAU_S
+                             + sigma * sqrt(2.0 * dt / SIM_GUST_TAU_S) * sim_gauss(sim);
+
+        // Pendulum: wind (and stream) pull the boat away from the anchor, damping and yaw force
+        double pull_to;
+        double pull = sim_pull(sim, &pull_to);
+        double force = pull * sin(pull_to - sim->angle) + sim->yaw_force_kn;
+        double accel = SIM_WIND_FORCE * force / cfg->rode_m - SIM_DAMPING * sim->angle_vel;
+        sim->angle_vel += accel * dt;
+        sim->angle += sim->angle_vel * dt;
+        sim->angle = fmod(sim->angle, 2.0 * M_PI);
+
+        // Chain pull: the rode straightens under load and surges back and forth
+        double target = (pull < SIM_TAUT_KN) ? pull / SIM_TAUT_KN : 1.0;
+        double k = SIM_CHAIN_PULL * (1.0 + pull);
+        sim->slack += k * (target - sim->slack) * dt + SIM_SURGE_STD * sqrt(2.0 * k * dt) * sim_gauss(sim);
+        if (sim->slack < 0.0) sim->slack = 0.0;
+        if (sim->slack > 1.0) sim->slack = 1.0;
+
+        double dist = cfg->rode_m * (0.7 + 0.3 * sim->slack);
+        sim->boat_e = sim->anchor_e + dist * sin(sim->angle);
+        sim->boat_n = sim->anchor_n + dist * cos(sim->angle);
+        sim->heading_deg = (float)sim_wrap360(sim->angle * RAD_TO_DEG + 180.0);     // Bow to the anchor
+    }
+
+    // Reported position: gaussian noise, more of it in a seaway
+    double noise = cfg->noise_m * (1.0 + wind / 30.0);
+    sim->fix_e = sim->boat_e + noise * sim_gauss(sim);
+    sim->fix_n = sim->boat_n + noise * sim_gauss(sim);
+    sim->depth_m = cfg->depth_m + (float)(SIM_DEPTH_NOISE_M * sim_gauss(sim));
+    sim->sid++;
+}
+
+/**
+ * Latest reported position
+ */
+void anchor_sim_fix(const anchor_sim_t *sim, double *lat, double *lon) {
+    geo_from_enu(&sim->world, (float)sim->fix_e, (float)sim->fix_n, lat, lon);
+}
+
+/**
+ * True anchor position
+ */
+void anchor_sim_anchor(const anchor_sim_t *sim, double *lat, double *lon) {
+    geo_from_enu(&sim->world, (float)sim->anchor_e, (float)sim->anchor_n, lat, lon);
+}
+
+static void put_u16(uint8_t *p, uint16_t v) { p[0] = v & 0xFF; p[1] = v >> 8; }
+static void put_u32(uint8_t *p, uint32_t v) { put_u16(p, v & 0xFFFF); put_u16(p + 2, v >> 16); }
+static void put_u64(uint8_t *p, uint64_t v) { put_u32(p, (uint32_t)v); put_u32(p + 4, (uint32_t)(v >> 32)); }
+
+/**
+ * Speed and course over ground from the last step (true motion)
+ */
+static void sim_sog_cog(const anchor_sim_t *sim, double *sog_mps, double *cog_deg) {
+    double de = sim->boat_e - sim->prev_e, dn = sim->boat_n - sim->prev_n;
+    *sog_mps = hypot(de, dn) / (sim->cfg.step_ms / 1000.0);
+    *cog_deg = sim_wrap360(atan2(de, dn) * RAD_TO_DEG);
+}
+
+/**
+ * Apparent wind angle off the bow (boat speed ignored - it is swinging, not sailing)
+ */
+static double sim_apparent_deg(const anchor_sim_t *sim) {
+    return sim_wrap360(sim->cfg.wind_from_deg - sim->heading_deg);
+}
+
+/**
+ * Emit this step's NMEA 2000 frames
+ */
+int anchor_sim_emit_n2k(anchor_sim_t *sim, sim_frame_fn fn, void *ctx) {
+    uint8_t d[N2K_FAST_PACKET_MAX];
+    double lat, lon;
+    int frames = 0;
+    anchor_sim_fix(sim, &lat, &lon);
+
+    // 129025 Position, Rapid Update
+    put_u32(d, (uint32_t)(int32_t)llround(lat * 1e7));
+    put_u32(d + 4, (uint32_t)(int32_t)llround(lon * 1e7));
+    fn(ctx, anchor_ingest_n2k_id(N2K_PGN_POSITION_RAPID, 2, SIM_N2K_SOURCE), d, 8);
+    frames++;
+
+    // 129029 GNSS Position Data (43 bytes, fast packet)
+    uint32_t utc_s = sim->cfg.start_utc + sim->t_ms / 1000;
+    memset(d, 0xFF, 43);
+    d[0] = sim->sid;
+    put_u16(d + 1, (uint16_t)(utc_s / 86400));
+    put_u32(d + 3, (utc_s % 86400) * 10000u + (sim->t_ms % 1000) * 10u);
+    put_u64(d + 7, (uint64_t)(int64_t)llround(lat * 1e16));
+    put_u64(d + 15, (uint64_t)(int64_t)llround(lon * 1e16));
+    put_u64(d + 23, 0);             // Altitude
+    d[31] = 0x00 | (1 << 4);        // GPS, GNSS fix
+    d[32] = 0xFC;                   // Integrity: no checking
+    d[33] = 10;                     // Satellites
+    put_u16(d + 34, 80);            // HDOP 0.8
+    put_u16(d + 36, 150);           // PDOP 1.5
+    put_u32(d + 38, 0);             // Geoidal separation
+    d[42] = 0;                      // Reference stations
+    uint32_t id = anchor_ingest_n2k_id(N2K_PGN_GNSS_POSITION, 3, SIM_N2K_SOURCE);
+    uint8_t seq = (uint8_t)(sim->fast_seq++ & 0x7);
+    uint8_t f[8];
+    int sent = 0;
+    for (uint8_t counter = 0; sent < 43; counter++) {
+        memset(f, 0xFF, sizeof(f));
+        f[0] = (uint8_t)((seq << 5) | counter);
+        int off = 1;
+        if (counter == 0) {
+            f[1] = 43;
+            off = 2;
+        }
+        int n = (43 - sent < 8 - off) ? 43 - sent : 8 - off;
+        memcpy(f + off, d + sent, n);
+        sent += n;
+        fn(ctx, id, f, 8);
+        frames++;
+    }
+
+    // 127250 Vessel Heading (true)
+    memset(d, 0xFF, 8);
+    d[0] = sim->sid;
+    put_u16(d + 1, (uint16_t)lround(sim->heading_deg * DEG_TO_RAD * 1e4));
+    put_u16(d + 3, 0x7FFF);         // Deviation: n/a
+    put_u16(d + 5, 0x7FFF);         // Variation: n/a
+    d[7] = 0xFC | 0;                // Reference: true
+    fn(ctx, anchor_ingest_n2k_id(N2K_PGN_VESSEL_HEADING, 2, SIM_N2K_SOURCE), d, 8);
+    frames++;
+
+    // 130306 Wind Data (apparent)
+    memset(d, 0xFF, 8);
+    d[0] = sim->sid;
+    put_u16(d + 1, (uint16_t)lround(sim->cfg.wind_kn * SIM_KNOTS_TO_MPS * 100.0));
+    put_u16(d + 3, (uint16_t)lround(sim_apparent_deg(sim) * DEG_TO_RAD * 1e4));
+    d[5] = 0xF8 | 2;                // Reference: apparent
+    fn(ctx, anchor_ingest_n2k_id(N2K_PGN_WIND_DATA, 2, SIM_N2K_SOURCE), d, 8);
+    frames++;
+
+    // 128267 Water Depth (below transducer, no offset)
+    memset(d, 0xFF, 8);
+    d[0] = sim->sid;
+    put_u32(d + 1, (uint32_t)lround(sim->depth_m * 100.0));
+    put_u16(d + 5, 0);
+    d[7] = 10;                      // Range 100 m
+    fn(ctx, anchor_ingest_n2k_id(N2K_PGN_WATER_DEPTH, 3, SIM_N2K_SOURCE), d, 8);
+    frames++;
+
+    return frames;
+}
+
+/**
+ * Append "*hh" to a sentence and deliver it
+ */
+static void sim_sentence(char *s, size_t size, sim_sentence_fn fn, void *ctx) {
+    uint8_t sum = 0;
+    size_t n = strlen(s);
+    for (size_t i = 1; i < n; i++) {
+        sum ^= (uint8_t)s[i];
+    }
+    snprintf(s + n, size - n, "*%02X", sum);
+    fn(ctx, s);
+}
+
+/**
+ * Format ddmm.mmmmm / dddmm.mmmmm plus hemisphere
+ */
+static void sim_coord(char *out, size_t size, double deg, int deg_digits, char pos, char neg) {
+    char hemi = deg < 0.0 ? neg : pos;
+    deg = fabs(deg);
+    int whole = (int)deg;
+    snprintf(out, size, "%0*d%08.5f,%c", deg_digits, whole, (deg - whole) * 60.0, hemi);
+}
+
+/**
+ * Civil date from days since 1970-01-01
+ */
+static void sim_civil(uint32_t days, int *y, int *m, int *d) {
+    int z = (int)days + 719468;
+    int era = z / 146097;
+    int doe = z - era * 146097;
+    int yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+    int doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+    int mp = (5 * doy + 2) / 153;
+    *d = doy - (153 * mp + 2) / 5 + 1;
+    *m = mp < 10 ? mp + 3 : mp - 9;
+    *y = yoe + era * 400 + (*m <= 2);
+}
+
+/**
+ * Emit this step's NMEA 0183 sentences
+ */
+int anchor_sim_emit_0183(anchor_sim_t *sim, sim_sentence_fn fn, void *ctx) {
+    char s[128];                    // Sentences stay under INGEST_SENTENCE_MAX
+    char la[24], lo[24];
+    double lat, lon, sog, cog;
+    int y, mo, dd;
+
+    anchor_sim_fix(sim, &lat, &lon);
+    sim_coord(la, sizeof(la), lat, 2, 'N', 'S');
+    sim_coord(lo, sizeof(lo), lon, 3, 'E', 'W');
+    sim_sog_cog(sim, &sog, &cog);
+    uint32_t utc_s = sim->cfg.start_utc + sim->t_ms / 1000;
+    uint32_t tod = utc_s % 86400;
+    sim_civil(utc_s / 86400, &y, &mo, &dd);
+
+    snprintf(s, sizeof(s), "$GPRMC,%02u%02u%02u.%02u,A,%s,%s,%.1f,%.1f,%02d%02d%02d,,,A",
+             (unsigned int)(tod / 3600), (unsigned int)(tod / 60 % 60), (unsigned int)(tod % 60),
+             (unsigned int)(sim->t_ms % 1000 / 10), la, lo, sog / SIM_KNOTS_TO_MPS, cog,
+             dd, mo, y % 100);
+    sim_sentence(s, sizeof(s), fn, ctx);
+
+    snprintf(s, sizeof(s), "$HEHDT,%.1f,T", sim->heading_deg);
+    sim_sentence(s, sizeof(s), fn, ctx);
+
+    snprintf(s, sizeof(s), "$WIMWV,%.1f,R,%.1f,N,A", sim_apparent_deg(sim), sim->cfg.wind_kn);
+    sim_sentence(s, sizeof(s), fn, ctx);
+
+    snprintf(s, sizeof(s), "$SDDPT,%.2f,0.0,", sim->depth_m);
+    sim_sentence(s, sizeof(s), fn, ctx);
+
+    return 4;
+}
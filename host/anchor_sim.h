@@ -0,0 +1,194 @@
+/**
+ * Anchoring Simulator (host)
+ *
+ * Author: Colin Bitterfield
+ * Email: colin@bitterfield.com
+ * Date Created: 2026-10-18
+ * Date Updated: 2026-10-18
+ * Version: 0.2.0
+ *
+ * Changelog:
+ * - 0.2.0 (2026-10-18): drag_to_deg - a drag in a set direction
+ *
+ * C port of the boat model in docs/anchoring_mode_specification.md:
+ * - Drop: the boat falls back downwind at wind speed (0.5 kn astern in a
+ *   calm) until the rode is out, then starts swinging.
+ * - Swing: a damped pendulum about the anchor. The wind pulls the boat
+ *   downwind, a random yaw force (a gust-like first-order process scaled by
+ *   the wind) pushes it off, and the chain pulls it between 0.7 and 1.0 of
+ *   the rode. Reported fixes carry gaussian noise (+-2 m at 2 sigma).
+ *   A water current pulls like SIM_CURRENT_FORCE knots of wind per knot, so
+ *   the boat lies to the sum of wind and stream (wind against tide).
+ * - Drift with anchor: the anchor drags at drag_factor x the drift velocity
+ *   (wind + 180 at wind speed, or the drift setting in a calm - see
+ *   docs/wind_drift_ui_logic.md; with a current, the way wind and stream
+ *   pull together) and the boat keeps swinging around it. With drag_to_deg
+ *   set, the anchor drags that way instead (down a slope, across the lie).
+ *
+ * Each step emits what the boat's instruments would send - NMEA 2000 CAN
+ * frames (129025, 129029 as a fast packet, 127250, 130306, 128267) or NMEA
+ * 0183 sentences (RMC, HDT, MWV, DPT) - so they can be pushed through
+ * anchor_ingest.c into the engine exactly as on the target. There is no
+ * wall-clock in the model; a 12 h night runs in well under a second.
+ * All randomness comes from one seeded xorshift generator, so a seed
+ * replays the same night bit for bit.
+ */
+
+#ifndef ANCHOR_SIM_H
+#define ANCHOR_SIM_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "anchor_geo.h"
+
+// Physics constants (docs/anchoring_mode_specification.md)
+#define SIM_KNOTS_TO_MPS        0.514444
+#define SIM_DAMPING             0.1     // Swing damping (1/s)
+#define SIM_RANDOM_FORCE_STD    0.5     // Random yaw force (fraction of the wind force)
+#define SIM_WIND_FORCE          0.01    // Wind (knots) to angular acceleration x rode
+#define SIM_CHAIN_PULL          0.005   // Chain pull rate per knot of wind (1/s)
+#define SIM_CALM_KN             1.0     // Random yaw force floor in a calm
+#define SIM_GUST_TAU_S          15.0    // Correlation time of the random yaw force
+#define SIM_TAUT_KN             20.0    // Wind that holds the rode bar-taut
+#define SIM_SURGE_STD           0.15    // Surge on the rode (fraction of 0.3 x rode)
+#define SIM_DROP_BACK_KN        0.5     // Falling back astern in a calm
+#define SIM_DEPTH_NOISE_M       0.05    // Sounder noise
+#define SIM_CURRENT_FORCE       10.0    // Knots of wind that pull like one knot of current
+
+#define SIM_N2K_SOURCE          35      // Source address of the simulated instruments
+#define SIM_START_UTC           1792360800u     // 2026-10-18 22:00:00 UTC
+
+typedef enum {
+    SIM_PHASE_DROP = 0,         // Falling back until the rode is out
+    SIM_PHASE_SWING             // Lying to the anchor
+} sim_phase_t;
+
+typedef struct {
+    uint32_t seed;              // RNG seed (0 is replaced by 1)
+    double lat;                 // Anchor drop position (degrees)
+    double lon;
+    float rode_m;               // Rode paid out
+    float course_deg;           // Course at the drop (backs down opposite to it in a calm)
+    float wind_kn;              // True wind speed
+    float wind_from_deg;        // True wind direction (from)
+    float drift_kn;             // Drift speed (0 = wind speed, or none in a calm)
+    float drift_to_deg;         // Drift direction in a calm (to)
+    float drag_factor;          // Anchor speed / drift speed while dragging
+    float drag_to_deg;          // Drag direction (to), < 0 = the way the boat drifts
+    float current_kn;           // Water current
+    float current_to_deg;       // Current direction (to)
+    float depth_m;              // Water depth at the anchor
+    float noise_m;              // Fix noise (1 sigma per axis at 0 kn)
+    uint32_t step_ms;           // Model step and fix interval
+    uint32_t start_utc;         // UTC seconds at t = 0 (GNSS date and time fields)
+} sim_config_t;
+
+typedef struct {
+    sim_config_t cfg;
+    geo_ref_t world;            // ENU frame at the drop position
+    uint32_t rng;
+    uint32_t t_ms;              // Simulated time
+    sim_phase_t phase;
+    bool dragging;              // Drift mode with anchor
+    double anchor_e, anchor_n;  // True anchor position (ENU)
+    double boat_e, boat_n;      // True boat position
+    double prev_e, prev_n;      // Boat position one step ago (SOG/COG)
+    double angle;               // Bearing anchor -> boat (radians)
+    double angle_vel;           // Swing rate (rad/s)
+    double yaw_force_kn;        // Random yaw force
+    double slack;               // Chain lie: 0 = 0.7 x rode, 1 = full rode
+    double fix_e, fix_n;        // Latest reported (noisy) position
+    float heading_deg;          // True heading
+    float depth_m;              // Latest sounding
+    uint8_t sid;                // N2K sequence id
+    uint8_t fast_seq;           // Fast-packet sequence counter
+} anchor_sim_t;
+
+// Receives one CAN frame (29-bit id) or one NMEA 0183 sentence (no line ending)
+typedef void (*sim_frame_fn)(void *ctx, uint32_t can_id, const uint8_t *data, uint8_t len);
+typedef void (*sim_sentence_fn)(void *ctx, const char *sentence);
+
+/**
+ * Default configuration: 30 m rode in 15 kn from the north, 1 Hz fixes
+ * @param cfg Configuration to fill
+ */
+void anchor_sim_default_config(sim_config_t *cfg);
+
+/**
+ * Start a simulation at the drop (t = 0, boat over the anchor)
+ * @param sim Simulator
+ * @param cfg Configuration (copied)
+ */
+void anchor_sim_init(anchor_sim_t *sim, const sim_config_t *cfg);
+
+/**
+ * Change the true wind
+ * @param sim Simulator
+ * @param wind_kn Wind speed (knots)
+ * @param from_deg Wind direction (from, degrees true)
+ */
+void anchor_sim_set_wind(anchor_sim_t *sim, float wind_kn, float from_deg);
+
+/**
+ * Change the water current
+ * @param sim Simulator
+ * @param current_kn Current speed (knots)
+ * @param to_deg Current direction (to, degrees true)
+ */
+void anchor_sim_set_current(anchor_sim_t *sim, float current_kn, float to_deg);
+
+/**
+ * Change the water depth at the anchor (tide)
+ * @param sim Simulator
+ * @param depth_m Water depth (metres)
+ */
+void anchor_sim_set_depth(anchor_sim_t *sim, float depth_m);
+
+/**
+ * Start or stop drift mode with anchor (the anchor drags)
+ * @param sim Simulator
+ * @param dragging true to drag
+ */
+void anchor_sim_set_drag(anchor_sim_t *sim, bool dragging);
+
+/**
+ * Advance the model by one step (cfg.step_ms) and take a new fix
+ * @param sim Simulator
+ */
+void anchor_sim_step(anchor_sim_t *sim);
+
+/**
+ * Latest reported (noisy) position
+ * @param sim Simulator
+ * @param lat Latitude output (degrees)
+ * @param lon Longitude output (degrees)
+ */
+void anchor_sim_fix(const anchor_sim_t *sim, double *lat, double *lon);
+
+/**
+ * True anchor position
+ * @param sim Simulator
+ * @param lat Latitude output (degrees)
+ * @param lon Longitude output (degrees)
+ */
+void anchor_sim_anchor(const anchor_sim_t *sim, double *lat, double *lon);
+
+/**
+ * Emit this step's NMEA 2000 frames (129025, 129029, 127250, 130306, 128267)
+ * @param sim Simulator
+ * @param fn Frame callback
+ * @param ctx Callback context
+ * @return Frames emitted
+ */
+int anchor_sim_emit_n2k(anchor_sim_t *sim, sim_frame_fn fn, void *ctx);
+
+/**
+ * Emit this step's NMEA 0183 sentences (RMC, HDT, MWV, DPT)
+ * @param sim Simulator
+ * @param fn Sentence callback
+ * @param ctx Callback context
+ * @return Sentences emitted
+ */
+int anchor_sim_emit_0183(anchor_sim_t *sim, sim_sentence_fn fn, void *ctx);
+
+#endif // ANCHOR_SIM_H
@@ -0,0 +1,288 @@
+/**
+ * Anchoring Simulator CLI (host)
+ *
+ * Author: Colin Bitterfield
+ * Email: colin@bitterfield.com
+ * Date Created: 2026-10-18
+ * Date Updated: 2026-10-18
+ * Version: 0.2.0
+ *
+ * Changelog:
+ * - 0.2.0 (2026-10-18): Check the scenario's expect line, exit 1 on a mismatch
+ *
+ * Runs one simulated night: the boat model in anchor_sim.c emits NMEA 2000
+ * frames or NMEA 0183 sentences, anchor_ingest.c decodes them and the engine
+ * watches the anchor, just as on the target. The anchor is set at the drop.
+ *
+ *   anchor_sim_cli --hours 12 --seed 7 --wind 20 --format 0183
+ *   anchor_sim_cli --drag-at 3600 --drift-kn 0.6      # anchor drags after 1 h
+ *   anchor_sim_cli --dump --rate 1000 | canplayer ...  # candump -L log at 1000x
+ *   anchor_sim_cli --scenario host/scenarios/squall-0300.scn
+ *
+ * A scenario script (anchor_scenario.h) sets the rode, depth and night length
+ * and drives wind, current, tide and dragging step by step; --wind, --hours
+ * and --drag-at are then ignored. When the script has an expect line, the
+ * first alarm is checked against it and a mismatch exits with status 1.
+ * Without --rate the night runs as fast as the host allows. The summary
+ * (first alarm, decode counts, speed-up over real time) goes to stdout, or
+ * to stderr with --dump.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <getopt.h>
+#include <time.h>
+#include "anchor_sim.h"
+#include "anchor_scenario.h"
+#include "anchor_ingest.h"
+#include "anchor_engine.h"
+
+typedef struct {
+    anchor_engine_t eng;
+    anchor_ingest_t ingest;
+    bool dump;
+    uint32_t t_ms;              // Simulated time of the frames being fed
+    uint32_t fixes;
+    uint32_t first_alarm_ms;    // 0 = no alarm
+    uint32_t first_alarm_flags;
+    float max_dist_m;
+} run_t;
+
+static void sink_fix(void *ctx, double lat, double lon, uint32_t t_ms) {
+    run_t *run = ctx;
+    anchor_fix_t fix = { .lat = lat, .lon = lon, .t_ms = t_ms };
+    uint32_t flags = anchor_engine_update(&run->eng, &fix);
+    run->fixes++;
+    if (run->eng.dist_m > run->max_dist_m) {
+        run->max_dist_m = run->eng.dist_m;
+    }
+    if (flags && run->first_alarm_ms == 0) {
+        run->first_alarm_ms = t_ms;
+        run->first_alarm_flags = flags;
+    }
+}
+
+static void sink_heading(void *ctx, float heading_deg, uint32_t t_ms) {
+    anchor_engine_update_heading(&((run_t *)ctx)->eng, heading_deg, t_ms);
+}
+
+static void sink_wind(void *ctx, float speed_mps, float angle_deg, bool relative, uint32_t t_ms) {
+    anchor_engine_update_wind(&((run_t *)ctx)->eng, speed_mps, angle_deg, relative, t_ms);
+}
+
+static void sink_depth(void *ctx, float depth_m, uint32_t t_ms) {
+    anchor_engine_update_depth(&((run_t *)ctx)->eng, depth_m, t_ms);
+}
+
+static void on_frame(void *ctx, uint32_t can_id, const uint8_t *data, uint8_t len) {
+    run_t *run = ctx;
+    if (run->dump) {
+        printf("(%u.%06u) can0 %08X#", (unsigned int)(run->t_ms / 1000),
+               (unsigned int)(run->t_ms % 1000) * 1000u, (unsigned int)can_id);
+        for (int i = 0; i < len; i++) {
+            printf("%02X", data[i]);
+        }
+        putchar('\n');
+    }
+    anchor_ingest_n2k_frame(&run->ingest, can_id, data, len, run->t_ms);
+}
+
+static void on_sentence(void *ctx, const char *sentence) {
+    run_t *run = ctx;
+    if (run->dump) {
+        printf("%s\r\n", sentence);
+    }
+    anchor_ingest_0183_bytes(&run->ingest, sentence, strlen(sentence), run->t_ms);
+    anchor_ingest_0183_bytes(&run->ingest, "\r\n", 2, run->t_ms);
+}
+
+static double wall_s(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static void usage(const char *prog) {
+    fprintf(stderr,
+            "usage: %s [options]\n"
+            "  --seed N         RNG seed (1)\n"
+            "  --hours H        night length (12)\n"
+            "  --rode M         rode paid out (30)\n"
+            "  --radius M       alarm radius (rode + 10)\n"
+            "  --wind KN        true wind speed (15)\n"
+            "  --wind-dir DEG   true wind direction, from (0)\n"
+            "  --drag-at S      anchor starts dragging after S seconds (never)\n"
+            "  --drift-kn KN    drift speed while dragging (wind speed)\n"
+            "  --format F       n2k or 0183 (n2k)\n"
+            "  --pgn P          position PGN for fixes: 129029 or 129025 (129029)\n"
+            "  --dump           print frames (candump -L) or sentences to stdout\n"
+            "  --rate X         pace output at X times real time (0 = unpaced)\n"
+            "  --scenario FILE  drive the night from a scenario script\n",
+            prog);
+}
+
+int main(int argc, char **argv) {
+    static const struct option options[] = {
+        { "seed",     required_argument, NULL, 's' },
+        { "hours",    required_argument, NULL, 'h' },
+        { "rode",     required_argument, NULL, 'r' },
+        { "radius",   required_argument, NULL, 'R' },
+        { "wind",     required_argument, NULL, 'w' },
+        { "wind-dir", required_argument, NULL, 'd' },
+        { "drag-at",  required_argument, NULL, 'a' },
+        { "drift-kn", required_argument, NULL, 'k' },
+        { "format",   required_argument, NULL, 'f' },
+        { "pgn",      required_argument, NULL, 'p' },
+        { "dump",     no_argument,       NULL, 'D' },
+        { "rate",     required_argument, NULL, 'x' },
+        { "scenario", required_argument, NULL, 'S' },
+        { NULL, 0, NULL, 0 }
+    };
+
+    sim_config_t cfg;
+    anchor_sim_default_config(&cfg);
+    double hours = 12.0, rate = 0.0, drag_at_s = -1.0;
+    float radius_m = 0.0f;
+    bool use_0183 = false;
+    uint32_t position_pgn = N2K_PGN_GNSS_POSITION;
+    const char *scenario_path = NULL;
+    static anchor_scenario_t scenario;
+    static run_t run;
+
+    int opt;
+    while ((opt = getopt_long(argc, argv, "", options, NULL)) != -1) {
+        switch (opt) {
+            case 's': cfg.seed = (uint32_t)strtoul(optarg, NULL, 0); break;
+            case 'h': hours = atof(optarg); break;
+            case 'r': cfg.rode_m = (float)atof(optarg); break;
+            case 'R': radius_m = (float)atof(optarg); break;
+            case 'w': cfg.wind_kn = (float)atof(optarg); break;
+            case 'd': cfg.wind_from_deg = (float)atof(optarg); break;
+            case 'a': drag_at_s = atof(optarg); break;
+            case 'k': cfg.drift_kn = (float)atof(optarg); break;
+            case 'f': use_0183 = (strcmp(optarg, "0183") == 0); break;
+            case 'p': position_pgn = (uint32_t)strtoul(optarg, NULL, 0); break;
+            case 'D': run.dump = true; break;
+            case 'x': rate = atof(optarg); break;
+            case 'S': scenario_path = optarg; break;
+            default:
+                usage(argv[0]);
+                return 2;
+        }
+    }
+    if (position_pgn != N2K_PGN_GNSS_POSITION && position_pgn != N2K_PGN_POSITION_RAPID) {
+        usage(argv[0]);
+        return 2;
+    }
+
+    scenario_state_t cond;
+    if (scenario_path != NULL) {
+        if (!anchor_scenario_open(&scenario, scenario_path) || !anchor_scenario_at(&scenario, 0, &cond)) {
+            fprintf(stderr, "%s: %s\n", scenario_path,
+                    scenario.error[0] ? scenario.error : "ends before it starts");
+            return 1;
+        }
+        if (scenario.rode_m > 0.0f) {
+            cfg.rode_m = scenario.rode_m;
+        }
+        cfg.wind_kn = cond.wind_kn;
+        cfg.wind_from_deg = cond.wind_from_deg;
+        cfg.current_kn = cond.current_kn;
+        cfg.current_to_deg = cond.current_to_deg;
+        if (cond.depth_m > 0.0f) {
+            cfg.depth_m = cond.depth_m;
+        }
+        drag_at_s = -1.0;
+    }
+
+    anchor_config_t ecfg;
+    anchor_engine_default_config(&ecfg);
+    ecfg.radius_m = (radius_m > 0.0f) ? radius_m : cfg.rode_m + 10.0f;
+    ecfg.rode_m = cfg.rode_m;
+    anchor_engine_init(&run.eng, &ecfg);
+
+    ingest_sink_t sink = { sink_fix, sink_heading, sink_wind, sink_depth, &run };
+    anchor_ingest_init(&run.ingest, &sink);
+    run.ingest.position_pgn = position_pgn;
+
+    anchor_sim_t sim;
+    anchor_sim_init(&sim, &cfg);
+    anchor_engine_set_anchor(&run.eng, cfg.lat, cfg.lon, 0);    // Anchor set at the drop
+
+    FILE *out = run.dump ? stderr : stdout;
+    uint32_t end_ms = (uint32_t)(hours * 3600000.0);
+    uint32_t emitted = 0;
+    bool dragged = false;
+    uint32_t drag_ms = UINT32_MAX;      // Drag onset
+    double start = wall_s();
+
+    if (scenario_path != NULL) {
+        end_ms = UINT32_MAX;        // Until the script's end line
+    }
+    while (sim.t_ms < end_ms) {
+        if (scenario_path != NULL) {
+            if (!anchor_scenario_at(&scenario, sim.t_ms, &cond)) {
+                break;
+            }
+            anchor_scenario_apply(&cond, &sim);
+            dragged |= sim.dragging;
+        }
+        if (drag_at_s >= 0.0 && !sim.dragging && sim.t_ms >= drag_at_s * 1000.0) {
+            anchor_sim_set_drag(&sim, true);
+            dragged = true;
+        }
+        if (sim.dragging && drag_ms == UINT32_MAX) {
+            drag_ms = sim.t_ms;
+        }
+        anchor_sim_step(&sim);
+        run.t_ms = sim.t_ms;
+        emitted += use_0183 ? anchor_sim_emit_0183(&sim, on_sentence, &run)
+                            : anchor_sim_emit_n2k(&sim, on_frame, &run);
+
+        if (rate > 0.0) {
+            double ahead = sim.t_ms / 1000.0 / rate - (wall_s() - start);
+            if (ahead > 0.001) {
+                struct timespec ts = { (time_t)ahead, (long)((ahead - (time_t)ahead) * 1e9) };
+                nanosleep(&ts, NULL);
+            }
+        }
+    }
+
+    double elapsed = wall_s() - start;
+    double sim_s = sim.t_ms / 1000.0;
+    if (scenario.error[0] != '\0') {
+        fprintf(stderr, "%s: %s\n", scenario_path, scenario.error);
+        anchor_scenario_close(&scenario);
+        return 1;
+    }
+    anchor_scenario_close(&scenario);
+    if (scenario_path != NULL) {
+        fprintf(out, "scenario %s\n", scenario.name);
+    }
+    uint32_t decoded = run.ingest.messages + run.ingest.sentences;
+    fprintf(out, "seed %u: %.1f h, %s, rode %.0f m, wind %.0f kn from %.0f, radius %.0f m%s\n",
+            (unsigned int)cfg.seed, sim_s / 3600.0, use_0183 ? "NMEA 0183" : "NMEA 2000",
+            cfg.rode_m, cfg.wind_kn, cfg.wind_from_deg, ecfg.radius_m,
+            dragged ? ", dragging" : "");
+    fprintf(out, "  %lu %s, %lu decoded, %lu errors, %lu fixes\n", (unsigned long)emitted,
+            use_0183 ? "sentences" : "frames", (unsigned long)decoded,
+            (unsigned long)run.ingest.errors, (unsigned long)run.fixes);
+    if (run.first_alarm_ms != 0) {
+        fprintf(out, "  first alarm at t=%.0f s (%.2f h), flags 0x%02lx\n", run.first_alarm_ms / 1000.0,
+                run.first_alarm_ms / 3600000.0, (unsigned long)run.first_alarm_flags);
+    } else {
+        fprintf(out, "  no alarm\n");
+    }
+    fprintf(out, "  end state %s, max distance %.1f m, reanchors %lu\n",
+            anchor_engine_state_name(run.eng.state), run.max_dist_m, (unsigned long)run.eng.reanchors);
+    fprintf(out, "  wall %.3f s, %.0fx real time\n", elapsed, elapsed > 0.0 ? sim_s / elapsed : 0.0);
+
+    if (scenario_path != NULL && scenario.expect != SCENARIO_EXPECT_NONE) {
+        char why[128];
+        bool met = anchor_scenario_check(&scenario, run.first_alarm_ms, drag_ms, why, sizeof(why));
+        fprintf(out, "  %s: %s\n", met ? "PASS" : "FAIL", why);
+        return met ? 0 : 1;
+    }
+    return 0;
+}
@@ -0,0 +1,180 @@
+/**
+ * RGB565 Blend Kernel Benchmark (host)
+ *
+ * Author: Colin Bitterfield
+ * Email: colin@bitterfield.com
+ * Date Created: 2026-10-18
+ * Date Updated: 2026-10-18
+ * Version: 0.1.1
+ *
+ * Changelog:
+ * - 0.1.1 (2026-10-18): Header says what the host numbers can and cannot show
+ *
+ * Measures MPixels/s of the lvgl_blend.c kernels against the plain loops
+ * LVGL 8.4 runs: solid fill, opaque copy and A8 glyph fill. Each is timed
+ * on a full 800x480 frame and on glyph-sized 12x16 rectangles. First every
+ * kernel is run against its _c twin on random rectangles (odd strides,
+ * unaligned starts, byte-symmetric and other colors), and the frames must
+ * match exactly. The mix must also leave the background alone at mask 0
+ * (the A8 kernel skips those pixels). The benchmark mask is glyph-like:
+ * empty runs, solid strokes and 4 bpp edges, not noise.
+ *
+ * On the host both sides use libc, so the numbers show the loop changes
+ * only. The esp-dsp figures and the START/INFO redraw times need the
+ * target: the boot benchmark in main.c (ENABLE_BLEND_BENCHMARK). ui_sim
+ * --screens with and without --no-blend-hooks times the redraws on the
+ * host, again with libc on both sides.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <time.h>
+#include "lvgl_blend.h"
+
+#define FRAME_W         800
+#define FRAME_H         480
+#define GLYPH_W         12
+#define GLYPH_H         16
+#define RANDOM_CASES    2000
+#define BENCH_MIN_S     0.25
+
+static uint16_t s_src[FRAME_W * FRAME_H];
+static uint16_t s_dst[FRAME_W * FRAME_H];
+static uint16_t s_ref[FRAME_W * FRAME_H];
+static uint8_t s_mask[FRAME_W * FRAME_H];
+
+typedef enum {
+    KERNEL_FILL = 0,
+    KERNEL_COPY,
+    KERNEL_FILL_A8,
+    KERNEL_COUNT
+} kernel_t;
+
+static const char *const s_kernel_names[KERNEL_COUNT] = { "fill", "copy", "A8 glyph fill" };
+
+static double now_s(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+/**
+ * Run one kernel (fast = lvgl_blend, else the plain loop) on a w x h rectangle at (x, y)
+ */
+static void run(kernel_t k, bool fast, uint16_t *dst, int x, int y, int w, int h, uint16_t color) {
+    uint16_t *d = dst + y * FRAME_W + x;
+    const uint16_t *s = s_src + y * FRAME_W + x;
+    const uint8_t *m = s_mask + y * FRAME_W + x;
+
+    switch (k) {
+        case KERNEL_FILL:
+            (fast ? lvgl_blend_fill : lvgl_blend_fill_c)(d, FRAME_W, w, h, color);
+            break;
+        case KERNEL_COPY:
+            (fast ? lvgl_blend_copy : lvgl_blend_copy_c)(d, FRAME_W, s, FRAME_W, w, h);
+            break;
+        default:
+            (fast ? lvgl_blend_fill_a8 : lvgl_blend_fill_a8_c)(d, FRAME_W, m, FRAME_W, w, h, color);
+            break;
+    }
+}
+
+static int check_mix(void) {
+    static const uint16_t fgs[] = { 0x0000, 0xFFFF, 0xF800, 0x07E0, 0x001F, 0x4A69 };
+    for (size_t i = 0; i < sizeof(fgs) / sizeof(fgs[0]); i++) {
+        for (uint32_t bg = 0; bg <= 0xFFFF; bg++) {
+            if (lvgl_blend_mix(fgs[i], (uint16_t)bg, 0) != bg ||
+                lvgl_blend_mix(fgs[i], (uint16_t)bg, 255) != fgs[i]) {
+                printf("MISMATCH: mix of %04x over %04x at mask 0/255\n", fgs[i], (unsigned int)bg);
+                return 1;
+            }
+        }
+    }
+    return 0;
+}
+
+static int check_kernels(void) {
+    static const uint16_t colors[] = { 0x0000, 0xFFFF, 0x2121, 0x4A69, 0xFFE0, 0x07FF };
+    int failures = 0;
+
+    for (int i = 0; i < RANDOM_CASES && failures < 5; i++) {
+        kernel_t k = (kernel_t)(rand() % KERNEL_COUNT);
+        int w = 1 + rand() % (rand() % 4 == 0 ? FRAME_W : 64);
+        int h = 1 + rand() % (rand() % 4 == 0 ? FRAME_H : 32);
+        int x = rand() % (FRAME_W - w + 1);
+        int y = rand() % (FRAME_H - h + 1);
+        uint16_t color = colors[rand() % (int)(sizeof(colors) / sizeof(colors[0]))];
+
+        for (int p = 0; p < FRAME_W * FRAME_H; p++) {
+            s_dst[p] = (uint16_t)(p * 40503u);
+        }
+        memcpy(s_ref, s_dst, sizeof(s_dst));
+        run(k, true, s_dst, x, y, w, h, color);
+        run(k, false, s_ref, x, y, w, h, color);
+        if (memcmp(s_dst, s_ref, sizeof(s_dst)) != 0) {
+            printf("MISMATCH: %s %dx%d at %d,%d color %04x\n", s_kernel_names[k], w, h, x, y, color);
+            failures++;
+        }
+    }
+    return failures;
+}
+
+/**
+ * MPixels/s of one kernel over full frames or glyph-sized rectangles
+ */
+static double bench(kernel_t k, bool fast, bool glyphs) {
+    long iterations = 0;
+    double pixels = 0;
+    double start = now_s();
+    double elapsed;
+    do {
+        if (glyphs) {
+            for (int y = 0; y + GLYPH_H <= FRAME_H; y += GLYPH_H * 4) {
+                for (int x = 1; x + GLYPH_W <= FRAME_W; x += GLYPH_W + 1) {
+                    run(k, fast, s_dst, x, y, GLYPH_W, GLYPH_H, 0x4A69);
+                    pixels += GLYPH_W * GLYPH_H;
+                }
+            }
+        } else {
+            run(k, fast, s_dst, 0, 0, FRAME_W, FRAME_H, 0x4A69);
+            pixels += FRAME_W * FRAME_H;
+        }
+        iterations++;
+        elapsed = now_s() - start;
+    } while (elapsed < BENCH_MIN_S);
+    return pixels / elapsed / 1e6;
+}
+
+int main(void) {
+    srand(1);
+    for (int i = 0; i < FRAME_W * FRAME_H; i++) {
+        s_src[i] = (uint16_t)rand();
+    }
+    // Glyph-like coverage: empty runs, solid strokes, 4 bpp anti-aliased edges
+    for (int y = 0; y < FRAME_H; y++) {
+        for (int x = 0; x < FRAME_W; x++) {
+            int d = ((x % 13) * (x % 13) + (y % 17) * (y % 17)) % 24;
+            int level = d < 8 ? 0 : d < 12 ? (d - 7) * 3 : d < 20 ? 15 : (24 - d) * 3;
+            s_mask[y * FRAME_W + x] = (uint8_t)(level * 17);
+        }
+    }
+
+    int failures = check_mix() + check_kernels();
+
+    printf("Blend kernels, MPixels/s (%dx%d frame, %dx%d glyph rectangles)\n\n",
+           FRAME_W, FRAME_H, GLYPH_W, GLYPH_H);
+    printf("%-14s %-7s %10s %10s %8s\n", "kernel", "area", "plain", "lvgl_blend", "speedup");
+    for (int k = 0; k < KERNEL_COUNT; k++) {
+        for (int glyphs = 0; glyphs < 2; glyphs++) {
+            double plain = bench((kernel_t)k, false, glyphs);
+            double fast = bench((kernel_t)k, true, glyphs);
+            printf("%-14s %-7s %10.1f %10.1f %7.2fx\n", s_kernel_names[k], glyphs ? "glyphs" : "frame",
+                   plain, fast, fast / plain);
+        }
+    }
+
+    printf("\n%s\n", failures == 0 ? "All kernels match the plain loops" : "FAILED");
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,216 @@
+/**
+ * Dirty Rectangle Tracker Checks (host)
+ *
+ * Author: Colin Bitterfield
+ * Email: colin@bitterfield.com
+ * Date Created: 2026-10-18
+ * Version: 0.1.0
+ *
+ * Checks the merge, clip and split rules of lvgl_dirty.c on an 800x480
+ * screen with 32-pixel column alignment (the firmware's settings):
+ * - fixed cases: clipping, alignment, nesting, neighbours, crossing
+ *   strips, a full list, bands and narrow areas
+ * - random frames (seeded): every redrawn pixel must be covered by the
+ *   tracked areas and again by the copy jobs, with every area on screen,
+ *   aligned and within LVGL_DIRTY_MAX
+ * Prints each failed expectation and exits non-zero if any fails.
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include "lvgl_dirty.h"
+
+#define SCREEN_W        800
+#define SCREEN_H        480
+#define BAND_MIN_W      (SCREEN_W / 2)
+#define RANDOM_FRAMES   5000
+
+static int s_failures = 0;
+static uint32_t s_rng = 1;
+static uint8_t s_drawn[SCREEN_H][SCREEN_W];
+static uint8_t s_copied[SCREEN_H][SCREEN_W];
+
+#define EXPECT(cond, ...) do { \
+    if (!(cond)) { printf("  FAIL line %d: ", __LINE__); printf(__VA_ARGS__); printf("\n"); s_failures++; } \
+} while (0)
+
+static uint32_t rng_next(void) {
+    s_rng = s_rng * 1664525u + 1013904223u;
+    return s_rng >> 8;
+}
+
+static int rng_range(int lo, int hi) {
+    return lo + (int)(rng_next() % (uint32_t)(hi - lo + 1));
+}
+
+static bool has_rect(const lvgl_dirty_t *d, int x1, int y1, int x2, int y2) {
+    for (int i = 0; i < d->count; i++) {
+        const lvgl_dirty_rect_t *r = &d->rect[i];
+        if (r->x1 == x1 && r->y1 == y1 && r->x2 == x2 && r->y2 == y2) return true;
+    }
+    return false;
+}
+
+static void paint(uint8_t map[SCREEN_H][SCREEN_W], const lvgl_dirty_rect_t *r, int n) {
+    for (int i = 0; i < n; i++) {
+        for (int y = r[i].y1; y <= r[i].y2; y++) {
+            memset(&map[y][r[i].x1], 1, (size_t)(r[i].x2 - r[i].x1 + 1));
+        }
+    }
+}
+
+/**
+ * Every drawn pixel copied
+ */
+static bool covers(void) {
+    for (int y = 0; y < SCREEN_H; y++) {
+        for (int x = 0; x < SCREEN_W; x++) {
+            if (s_drawn[y][x] && !s_copied[y][x]) return false;
+        }
+    }
+    return true;
+}
+
+static void check_fixed(void) {
+    lvgl_dirty_t d;
+    lvgl_dirty_rect_t bands[LVGL_DIRTY_MAX];
+    lvgl_dirty_rect_t narrow[LVGL_DIRTY_MAX];
+    int nb;
+    int nn;
+
+    printf("== fixed cases\n");
+    lvgl_dirty_init(&d, SCREEN_W, SCREEN_H, LVGL_DIRTY_ALIGN_PX);
+
+    // Clipping
+    EXPECT(!lvgl_dirty_add(&d, 900, 10, 950, 20), "off-screen area accepted");
+    EXPECT(lvgl_dirty_add(&d, -20, 470, 10, 500), "partly visible area rejected");
+    EXPECT(d.count == 1 && has_rect(&d, 0, 470, 31, 479), "clip/align of (-20,470)-(10,500)");
+
+    // Alignment and nesting
+    lvgl_dirty_clear(&d);
+    lvgl_dirty_add(&d, 33, 10, 40, 20);
+    EXPECT(has_rect(&d, 32, 10, 63, 20), "alignment of (33,10)-(40,20)");
+    lvgl_dirty_add(&d, 0, 0, 199, 99);
+    lvgl_dirty_add(&d, 50, 50, 60, 60);
+    EXPECT(d.count == 1 && has_rect(&d, 0, 0, 223, 99), "nested areas: %d areas", d.count);
+
+    // Same-height neighbours join, crossing strips do not
+    lvgl_dirty_clear(&d);
+    lvgl_dirty_add(&d, 0, 100, 31, 139);
+    lvgl_dirty_add(&d, 32, 100, 95, 139);
+    EXPECT(d.count == 1 && has_rect(&d, 0, 100, 95, 139), "neighbours: %d areas", d.count);
+    lvgl_dirty_clear(&d);
+    lvgl_dirty_add(&d, 0, 200, 799, 209);
+    lvgl_dirty_add(&d, 384, 0, 415, 479);
+    EXPECT(d.count == 2 && lvgl_dirty_pixels(&d) == 800 * 10 + 32 * 480,
+           "crossing strips: %d areas, %u px", d.count, (unsigned int)lvgl_dirty_pixels(&d));
+
+    // A full list keeps LVGL_DIRTY_MAX areas and grows the cheapest one
+    lvgl_dirty_clear(&d);
+    for (int i = 0; i < 3 * LVGL_DIRTY_MAX; i++) {
+        int x = (i % 8) * 96;
+        int y = (i / 8) * 70;
+        lvgl_dirty_add(&d, x, y, x + 20, y + 20);
+    }
+    EXPECT(d.count <= LVGL_DIRTY_MAX, "full list: %d areas", d.count);
+
+    // Split: header band swallows a label, a footer band, one narrow area
+    lvgl_dirty_clear(&d);
+    lvgl_dirty_add(&d, 0, 0, 799, 47);
+    lvgl_dirty_add(&d, 100, 10, 180, 30);
+    lvgl_dirty_add(&d, 300, 440, 799, 479);
+    lvgl_dirty_add(&d, 64, 200, 127, 260);
+    lvgl_dirty_split(&d, BAND_MIN_W, bands, &nb, narrow, &nn);
+    EXPECT(nb == 2 && bands[0].y1 == 0 && bands[0].y2 == 47 && bands[1].y1 == 440 &&
+           bands[1].x1 == 0 && bands[1].x2 == SCREEN_W - 1, "bands: %d", nb);
+    EXPECT(nn == 1 && narrow[0].x1 == 64 && narrow[0].y1 == 200, "narrow: %d", nn);
+
+    // Touching bands merge into one transfer
+    lvgl_dirty_clear(&d);
+    lvgl_dirty_add(&d, 0, 100, 499, 149);
+    lvgl_dirty_add(&d, 200, 150, 799, 199);
+    lvgl_dirty_split(&d, BAND_MIN_W, bands, &nb, narrow, &nn);
+    EXPECT(nb == 1 && bands[0].y1 == 100 && bands[0].y2 == 199 && nn == 0,
+           "touching bands: %d bands, %d narrow", nb, nn);
+
+    // band_min_width above the screen width: no bands (CPU-only sync)
+    lvgl_dirty_split(&d, SCREEN_W + 1, bands, &nb, narrow, &nn);
+    EXPECT(nb == 0 && nn == d.count, "no-DMA split: %d bands, %d narrow", nb, nn);
+}
+
+static void check_random(void) {
+    lvgl_dirty_t d;
+    lvgl_dirty_rect_t bands[LVGL_DIRTY_MAX];
+    lvgl_dirty_rect_t narrow[LVGL_DIRTY_MAX];
+    uint64_t drawn_px = 0;
+    uint64_t copied_px = 0;
+    int frame_failures = 0;
+
+    printf("== %d random frames\n", RANDOM_FRAMES);
+    lvgl_dirty_init(&d, SCREEN_W, SCREEN_H, LVGL_DIRTY_ALIGN_PX);
+
+    for (int f = 0; f < RANDOM_FRAMES && frame_failures < 5; f++) {
+        int failures_before = s_failures;
+        int areas = rng_range(1, 40);
+
+        lvgl_dirty_clear(&d);
+        memset(s_drawn, 0, sizeof(s_drawn));
+        for (int i = 0; i < areas; i++) {
+            int w = rng_next() % 4 == 0 ? rng_range(200, 900) : rng_range(1, 120);
+            int h = rng_next() % 4 == 0 ? rng_range(100, 500) : rng_range(1, 60);
+            lvgl_dirty_rect_t r;
+            r.x1 = (int16_t)rng_range(-50, SCREEN_W);
+            r.y1 = (int16_t)rng_range(-50, SCREEN_H);
+            r.x2 = (int16_t)(r.x1 + w - 1);
+            r.y2 = (int16_t)(r.y1 + h - 1);
+            if (lvgl_dirty_add(&d, r.x1, r.y1, r.x2, r.y2)) {
+                if (r.x1 < 0) r.x1 = 0;
+                if (r.y1 < 0) r.y1 = 0;
+                if (r.x2 >= SCREEN_W) r.x2 = SCREEN_W - 1;
+                if (r.y2 >= SCREEN_H) r.y2 = SCREEN_H - 1;
+                paint(s_drawn, &r, 1);
+            }
+        }
+
+        EXPECT(d.count <= LVGL_DIRTY_MAX, "frame %d: %d areas", f, d.count);
+        for (int i = 0; i < d.count; i++) {
+            const lvgl_dirty_rect_t *r = &d.rect[i];
+            EXPECT(r->x1 >= 0 && r->y1 >= 0 && r->x2 < SCREEN_W && r->y2 < SCREEN_H &&
+                   r->x1 <= r->x2 && r->y1 <= r->y2, "frame %d: area %d off screen", f, i);
+            EXPECT(r->x1 % LVGL_DIRTY_ALIGN_PX == 0 && (r->x2 + 1) % LVGL_DIRTY_ALIGN_PX == 0,
+                   "frame %d: area %d not aligned", f, i);
+        }
+
+        memset(s_copied, 0, sizeof(s_copied));
+        paint(s_copied, d.rect, d.count);
+        EXPECT(covers(), "frame %d: tracked areas miss drawn pixels", f);
+
+        int nb;
+        int nn;
+        lvgl_dirty_split(&d, BAND_MIN_W, bands, &nb, narrow, &nn);
+        memset(s_copied, 0, sizeof(s_copied));
+        paint(s_copied, bands, nb);
+        paint(s_copied, narrow, nn);
+        EXPECT(covers(), "frame %d: copy jobs miss drawn pixels", f);
+        for (int i = 1; i < nb; i++) {
+            EXPECT(bands[i].y1 > bands[i - 1].y2 + 1, "frame %d: bands %d/%d not merged", f, i - 1, i);
+        }
+
+        for (int y = 0; y < SCREEN_H; y++) {
+            for (int x = 0; x < SCREEN_W; x++) {
+                drawn_px += s_drawn[y][x];
+            }
+        }
+        copied_px += lvgl_dirty_pixels(&d);
+        if (s_failures != failures_before) frame_failures++;
+    }
+    printf("  tracked areas copy %.2fx the redrawn pixels\n", (double)copied_px / (double)drawn_px);
+}
+
+int main(void) {
+    check_fixed();
+    check_random();
+    printf("%d check(s) failed\n", s_failures);
+    return s_failures ? 1 : 0;
+}
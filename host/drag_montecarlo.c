@@ -0,0 +1,489 @@
+/**
+ * Drag Detection Monte Carlo Benchmark (host)
+ *
+ * Author: Colin Bitterfield
+ * Email: colin@bitterfield.com
+ * Date Created: 2026-10-18
+ * Date Updated: 2026-10-18
+ * Version: 0.2.0
+ *
+ * Changelog:
+ * - 0.2.0 (2026-10-18): --max-fa threshold; exit 1 when a regime exceeds it
+ *   or misses a drag
+ *
+ * Runs thousands of seeded simulator nights (anchor_sim.c -> NMEA 2000
+ * frames -> anchor_ingest.c -> engine) across the wind, drift and GPS noise
+ * regimes of docs/wind_drift_ui_logic.md and reports:
+ * - Detection latency: seconds from drag onset to ALARM (p50/p90/p99/max),
+ *   plus how far the anchor had dragged by then.
+ * - False alarms per 1000 12-hour nights, counted over the time before any
+ *   drag, with the alarm bits that caused them. After a false alarm the crew
+ *   checks the anchor and re-sets the watch on it, so a night can have
+ *   several; nights with at least one are counted too.
+ * - Engine CPU per fix: time spent in anchor_engine_update() (mean, p50,
+ *   p99, max).
+ *
+ * Nights are jobs in a shared queue (an atomic cursor) drained by one worker
+ * per core. Each night's seed depends only on --seed, the regime and the
+ * night number, so results do not depend on the thread count.
+ * The JSON report goes to stdout (or --out); a table goes to stderr.
+ * The run fails (exit 1) when any regime's false-alarm rate is above --max-fa
+ * or any drag goes undetected, so it can gate detector changes.
+ *
+ *   drag_montecarlo --nights 500 --out results.json
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include <getopt.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <unistd.h>
+#include "anchor_sim.h"
+#include "anchor_ingest.h"
+#include "anchor_engine.h"
+
+#define MC_REPORT_VERSION       2
+#define MC_RODE_M               30.0f
+#define MC_RADIUS_M             40.0f
+#define MC_MAX_FA_PER_1000      10.0    // Default --max-fa: false alarms per 1000 nights (1 night in 100)
+#define MC_ONSET_MIN_S          7200.0  // Drag starts 2 h .. hours - 2 h into the night
+#define MC_ALARM_BITS           8
+#define MC_TIMING_BUCKETS       240     // Log histogram: 8 buckets per power of two
+
+typedef struct {
+    const char *name;
+    float wind_kn;              // 0 = calm, manual drift
+    float drift_kn;             // Drift speed while dragging (anchor moves at half of it)
+    float drift_to_deg;         // Manual drift direction (calm only)
+    float noise_m;              // GPS noise (1 sigma per axis)
+} mc_regime_t;
+
+// docs/wind_drift_ui_logic.md: wind-driven drift (wind + 180), or manual drift in a calm
+static const mc_regime_t s_regimes[] = {
+    { "calm-current/gps0.5",  0.0f, 0.6f, 90.0f, 0.5f },
+    { "calm-current/gps1.5",  0.0f, 0.6f, 90.0f, 1.5f },
+    { "calm-current/gps3.0",  0.0f, 0.6f, 90.0f, 3.0f },
+    { "light-8kn/gps0.5",     8.0f, 0.4f, 0.0f,  0.5f },
+    { "light-8kn/gps1.5",     8.0f, 0.4f, 0.0f,  1.5f },
+    { "light-8kn/gps3.0",     8.0f, 0.4f, 0.0f,  3.0f },
+    { "fresh-15kn/gps0.5",   15.0f, 0.8f, 0.0f,  0.5f },
+    { "fresh-15kn/gps1.5",   15.0f, 0.8f, 0.0f,  1.5f },
+    { "fresh-15kn/gps3.0",   15.0f, 0.8f, 0.0f,  3.0f },
+    { "strong-25kn/gps0.5",  25.0f, 1.5f, 0.0f,  0.5f },
+    { "strong-25kn/gps1.5",  25.0f, 1.5f, 0.0f,  1.5f },
+    { "strong-25kn/gps3.0",  25.0f, 1.5f, 0.0f,  3.0f },
+};
+#define MC_REGIME_COUNT ((int)(sizeof(s_regimes) / sizeof(s_regimes[0])))
+
+static const char *s_alarm_names[MC_ALARM_BITS] = {
+    "radius", "envelope_exit", "envelope_drift", "hull",
+    "drag_predicted", "wind_cross", "depth_trend", "geofence"
+};
+
+// Outcome of one night
+typedef struct {
+    bool drag;                  // Anchor dragged this night
+    bool detected;              // ALARM after the onset
+    float latency_s;            // Onset to ALARM
+    float drag_m;               // Anchor displacement at ALARM
+    float exposure_h;           // Hours without a drag (false alarm exposure)
+    uint16_t false_alarms;
+    uint16_t fa_bits[MC_ALARM_BITS];
+    uint32_t fixes;
+    uint64_t fix_ns;            // Sum of anchor_engine_update() times
+    uint32_t fix_ns_max;
+    uint32_t hist[MC_TIMING_BUCKETS];
+} mc_night_t;
+
+typedef struct {
+    int nights;                 // Per regime
+    double hours;
+    double drag_fraction;
+    uint32_t seed;
+    mc_night_t *result;         // [regime * nights + night]
+    atomic_int next_job;        // Work queue cursor
+} mc_run_t;
+
+// Per-night state shared with the ingest sink
+typedef struct {
+    anchor_engine_t eng;
+    anchor_sim_t sim;
+    anchor_ingest_t ingest;
+    mc_night_t *out;
+    uint32_t onset_ms;          // UINT32_MAX = no drag
+    bool done;                  // Drag detected
+} mc_worker_t;
+
+static uint32_t mc_seed(uint32_t base, int regime, int night) {
+    uint64_t z = ((uint64_t)base << 32) ^ ((uint64_t)regime << 20) ^ (uint64_t)night;
+    z += 0x9E3779B97F4A7C15ull;
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    z ^= z >> 31;
+    return (uint32_t)z ? (uint32_t)z : 1u;
+}
+
+static double mc_uniform(uint32_t *s) {
+    *s ^= *s << 13;
+    *s ^= *s >> 17;
+    *s ^= *s << 5;
+    return (*s + 0.5) / 4294967296.0;
+}
+
+static uint64_t mc_now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+/**
+ * Log-histogram bucket of a duration (8 sub-buckets per power of two)
+ */
+static int mc_bucket(uint32_t ns) {
+    if (ns < 8) return (int)ns;
+    int oct = 31 - __builtin_clz(ns);
+    int b = (oct - 2) * 8 + (int)((ns >> (oct - 3)) & 7);
+    return b < MC_TIMING_BUCKETS ? b : MC_TIMING_BUCKETS - 1;
+}
+
+static uint32_t mc_bucket_floor(int b) {
+    if (b < 8) return (uint32_t)b;
+    int oct = b / 8 + 2;
+    return (8u + (uint32_t)(b % 8)) << (oct - 3);
+}
+
+static void sink_fix(void *ctx, double lat, double lon, uint32_t t_ms) {
+    mc_worker_t *w = ctx;
+    mc_night_t *out = w->out;
+    if (w->done) return;
+
+    anchor_fix_t fix = { .lat = lat, .lon = lon, .t_ms = t_ms };
+    anchor_state_t before = w->eng.state;
+    uint64_t t0 = mc_now_ns();
+    anchor_engine_update(&w->eng, &fix);
+    uint64_t dt = mc_now_ns() - t0;
+
+    uint32_t ns = dt > UINT32_MAX ? UINT32_MAX : (uint32_t)dt;
+    out->fixes++;
+    out->fix_ns += ns;
+    if (ns > out->fix_ns_max) out->fix_ns_max = ns;
+    out->hist[mc_bucket(ns)]++;
+
+    if (before == ANCHOR_STATE_ALARM || w->eng.state != ANCHOR_STATE_ALARM) {
+        return;
+    }
+    if (t_ms < w->onset_ms) {
+        // False alarm: the crew finds the anchor holding and re-sets the watch on it
+        out->false_alarms++;
+        for (int b = 0; b < MC_ALARM_BITS; b++) {
+            if (w->eng.alarm_flags & (1u << b)) out->fa_bits[b]++;
+        }
+        double alat, alon;
+        anchor_sim_anchor(&w->sim, &alat, &alon);
+        anchor_engine_set_anchor(&w->eng, alat, alon, t_ms);
+    } else {
+        out->detected = true;
+        out->latency_s = (t_ms - w->onset_ms) / 1000.0f;
+        out->drag_m = (float)hypot(w->sim.anchor_e, w->sim.anchor_n);
+        w->done = true;
+    }
+}
+
+static void sink_heading(void *ctx, float heading_deg, uint32_t t_ms) {
+    anchor_engine_update_heading(&((mc_worker_t *)ctx)->eng, heading_deg, t_ms);
+}
+
+static void sink_wind(void *ctx, float speed_mps, float angle_deg, bool relative, uint32_t t_ms) {
+    anchor_engine_update_wind(&((mc_worker_t *)ctx)->eng, speed_mps, angle_deg, relative, t_ms);
+}
+
+static void sink_depth(void *ctx, float depth_m, uint32_t t_ms) {
+    anchor_engine_update_depth(&((mc_worker_t *)ctx)->eng, depth_m, t_ms);
+}
+
+static void on_frame(void *ctx, uint32_t can_id, const uint8_t *data, uint8_t len) {
+    mc_worker_t *w = ctx;
+    anchor_ingest_n2k_frame(&w->ingest, can_id, data, len, w->sim.t_ms);
+}
+
+/**
+ * Simulate one night of one regime
+ */
+static void mc_night(mc_run_t *run, mc_worker_t *w, int regime, int night) {
+    const mc_regime_t *rg = &s_regimes[regime];
+    mc_night_t *out = &run->result[regime * run->nights + night];
+    memset(out, 0, sizeof(mc_night_t));
+
+    sim_config_t cfg;
+    anchor_sim_default_config(&cfg);
+    cfg.seed = mc_seed(run->seed, regime, night);
+    cfg.rode_m = MC_RODE_M;
+    cfg.wind_kn = rg->wind_kn;
+    cfg.drift_kn = rg->drift_kn;
+    cfg.drift_to_deg = rg->drift_to_deg;
+    cfg.noise_m = rg->noise_m;
+
+    // Drag or not, and when, from a stream independent of the boat model
+    uint32_t draw = cfg.seed ^ 0x9E3779B9u;
+    if (draw == 0) draw = 1;
+    uint32_t end_ms = (uint32_t)(run->hours * 3600000.0);
+    out->drag = mc_uniform(&draw) < run->drag_fraction;
+    w->onset_ms = UINT32_MAX;
+    if (out->drag) {
+        double span = run->hours * 3600.0 - 2.0 * MC_ONSET_MIN_S;
+        w->onset_ms = (uint32_t)((MC_ONSET_MIN_S + (span > 0.0 ? span : 0.0) * mc_uniform(&draw)) * 1000.0);
+    }
+    w->out = out;
+    w->done = false;
+
+    anchor_config_t ecfg;
+    anchor_engine_default_config(&ecfg);
+    ecfg.radius_m = MC_RADIUS_M;
+    ecfg.rode_m = MC_RODE_M;
+    anchor_engine_init(&w->eng, &ecfg);
+    anchor_sim_init(&w->sim, &cfg);
+    ingest_sink_t sink = { sink_fix, sink_heading, sink_wind, sink_depth, w };
+    anchor_ingest_init(&w->ingest, &sink);
+    anchor_engine_set_anchor(&w->eng, cfg.lat, cfg.lon, 0);     // Watch set at the drop
+
+    while (w->sim.t_ms < end_ms && !w->done) {
+        if (!w->sim.dragging && w->sim.t_ms >= w->onset_ms) {
+            anchor_sim_set_drag(&w->sim, true);
+        }
+        anchor_sim_step(&w->sim);
+        anchor_sim_emit_n2k(&w->sim, on_frame, w);
+    }
+    uint32_t quiet_ms = (w->onset_ms < end_ms) ? w->onset_ms : end_ms;
+    out->exposure_h = quiet_ms / 3600000.0f;
+}
+
+static void* mc_worker(void *arg) {
+    mc_run_t *run = arg;
+    mc_worker_t *w = malloc(sizeof(mc_worker_t));
+    if (w == NULL) return NULL;
+
+    int jobs = run->nights * MC_REGIME_COUNT;
+    for (;;) {
+        int job = atomic_fetch_add(&run->next_job, 1);
+        if (job >= jobs) break;
+        mc_night(run, w, job / run->nights, job % run->nights);
+    }
+    free(w);
+    return NULL;
+}
+
+static int cmp_float(const void *a, const void *b) {
+    float x = *(const float *)a, y = *(const float *)b;
+    return (x > y) - (x < y);
+}
+
+static float pct(const float *sorted, int n, double p) {
+    if (n == 0) return NAN;
+    int i = (int)ceil(p / 100.0 * n) - 1;
+    return sorted[i < 0 ? 0 : i];
+}
+
+static uint32_t hist_pct(const uint32_t *hist, uint64_t total, double p) {
+    uint64_t want = (uint64_t)ceil(p / 100.0 * total), seen = 0;
+    for (int b = 0; b < MC_TIMING_BUCKETS; b++) {
+        seen += hist[b];
+        if (seen >= want && seen > 0) return mc_bucket_floor(b);
+    }
+    return 0;
+}
+
+static void json_num(FILE *f, const char *key, double v, const char *sep) {
+    if (isnan(v)) {
+        fprintf(f, "\"%s\": null%s", key, sep);
+    } else {
+        fprintf(f, "\"%s\": %.6g%s", key, v, sep);
+    }
+}
+
+static void usage(const char *prog) {
+    fprintf(stderr,
+            "usage: %s [options]\n"
+            "  --nights N         nights per regime (100)\n"
+            "  --hours H          night length (12)\n"
+            "  --drag-fraction F  share of nights where the anchor drags (0.5)\n"
+            "  --seed S           base seed (1)\n"
+            "  --threads T        worker threads (one per core)\n"
+            "  --max-fa R         fail above R false alarms per 1000 nights in any regime (%g)\n"
+            "  --out FILE         JSON report file (stdout)\n",
+            prog, MC_MAX_FA_PER_1000);
+}
+
+int main(int argc, char **argv) {
+    static const struct option options[] = {
+        { "nights",        required_argument, NULL, 'n' },
+        { "hours",         required_argument, NULL, 'h' },
+        { "drag-fraction", required_argument, NULL, 'f' },
+        { "seed",          required_argument, NULL, 's' },
+        { "threads",       required_argument, NULL, 't' },
+        { "out",           required_argument, NULL, 'o' },
+        { "max-fa",        required_argument, NULL, 'm' },
+        { NULL, 0, NULL, 0 }
+    };
+
+    static mc_run_t run;
+    run.nights = 100;
+    run.hours = 12.0;
+    run.drag_fraction = 0.5;
+    run.seed = 1;
+    long threads = sysconf(_SC_NPROCESSORS_ONLN);
+    const char *out_path = NULL;
+    double max_fa = MC_MAX_FA_PER_1000;
+
+    int opt;
+    while ((opt = getopt_long(argc, argv, "", options, NULL)) != -1) {
+        switch (opt) {
+            case 'n': run.nights = atoi(optarg); break;
+            case 'h': run.hours = atof(optarg); break;
+            case 'f': run.drag_fraction = atof(optarg); break;
+            case 's': run.seed = (uint32_t)strtoul(optarg, NULL, 0); break;
+            case 't': threads = atol(optarg); break;
+            case 'o': out_path = optarg; break;
+            case 'm': max_fa = atof(optarg); break;
+            default:
+                usage(argv[0]);
+                return 2;
+        }
+    }
+    if (run.nights <= 0 || run.hours <= 0.0 || threads <= 0 || max_fa < 0.0) {
+        usage(argv[0]);
+        return 2;
+    }
+
+    run.result = calloc((size_t)run.nights * MC_REGIME_COUNT, sizeof(mc_night_t));
+    pthread_t *tid = calloc((size_t)threads, sizeof(pthread_t));
+    float *lat = malloc(sizeof(float) * run.nights);
+    float *dist = malloc(sizeof(float) * run.nights);
+    if (run.result == NULL || tid == NULL || lat == NULL || dist == NULL) {
+        fprintf(stderr, "out of memory\n");
+        return 1;
+    }
+    atomic_init(&run.next_job, 0);
+
+    // The swing FFT builds its twiddle table on first use - do that before the workers share it
+    static float warmup[2 * SWING_FFT_N];
+    anchor_swing_fft_c(warmup, SWING_FFT_N);
+
+    fprintf(stderr, "%d regimes x %d nights of %.0f h on %ld threads\n",
+            MC_REGIME_COUNT, run.nights, run.hours, threads);
+    uint64_t start = mc_now_ns();
+    for (long i = 0; i < threads; i++) {
+        pthread_create(&tid[i], NULL, mc_worker, &run);
+    }
+    for (long i = 0; i < threads; i++) {
+        pthread_join(tid[i], NULL);
+    }
+    double wall_s = (mc_now_ns() - start) * 1e-9;
+
+    FILE *f = stdout;
+    if (out_path != NULL && (f = fopen(out_path, "w")) == NULL) {
+        perror(out_path);
+        return 1;
+    }
+
+    fprintf(f, "{\n  \"benchmark\": \"drag_montecarlo\",\n  \"version\": %d,\n", MC_REPORT_VERSION);
+    fprintf(f, "  \"seed\": %lu,\n  \"nights_per_regime\": %d,\n  \"hours\": %g,\n",
+            (unsigned long)run.seed, run.nights, run.hours);
+    fprintf(f, "  \"drag_fraction\": %g,\n  \"threads\": %ld,\n  \"wall_s\": %.3f,\n",
+            run.drag_fraction, threads, wall_s);
+    fprintf(f, "  \"rode_m\": %g,\n  \"radius_m\": %g,\n", MC_RODE_M, MC_RADIUS_M);
+    fprintf(f, "  \"max_false_alarms_per_1000_nights\": %g,\n  \"regimes\": [\n", max_fa);
+
+    fprintf(stderr, "%-20s %5s %5s %8s %8s %8s %8s %7s %7s %9s %7s %7s %4s\n", "regime", "drags", "miss",
+            "lat p50", "lat p90", "lat p99", "drag p90", "FA", "FA nts", "FA/1000n", "fix ns", "fix p99", "ok");
+
+    int failed = 0;
+
+    for (int r = 0; r < MC_REGIME_COUNT; r++) {
+        const mc_regime_t *rg = &s_regimes[r];
+        const mc_night_t *nights = &run.result[r * run.nights];
+        int drags = 0, detected = 0, fa_nights = 0;
+        uint32_t fa = 0, fa_bits[MC_ALARM_BITS] = {0};
+        double exposure_h = 0.0;
+        uint64_t fixes = 0, fix_ns = 0;
+        uint32_t fix_max = 0;
+        static uint32_t hist[MC_TIMING_BUCKETS];
+        memset(hist, 0, sizeof(hist));
+
+        for (int n = 0; n < run.nights; n++) {
+            const mc_night_t *nt = &nights[n];
+            if (nt->drag) drags++;
+            if (nt->detected) {
+                lat[detected] = nt->latency_s;
+                dist[detected] = nt->drag_m;
+                detected++;
+            }
+            fa += nt->false_alarms;
+            fa_nights += (nt->false_alarms > 0);
+            for (int b = 0; b < MC_ALARM_BITS; b++) fa_bits[b] += nt->fa_bits[b];
+            exposure_h += nt->exposure_h;
+            fixes += nt->fixes;
+            fix_ns += nt->fix_ns;
+            if (nt->fix_ns_max > fix_max) fix_max = nt->fix_ns_max;
+            for (int b = 0; b < MC_TIMING_BUCKETS; b++) hist[b] += nt->hist[b];
+        }
+        qsort(lat, detected, sizeof(float), cmp_float);
+        qsort(dist, detected, sizeof(float), cmp_float);
+        double fa_rate = exposure_h > 0.0 ? fa / exposure_h * run.hours * 1000.0 : NAN;
+        double fix_mean = fixes ? (double)fix_ns / fixes : NAN;
+        bool pass = !(fa_rate > max_fa) && detected == drags;
+        failed += !pass;
+
+        fprintf(f, "    {\n      \"name\": \"%s\",\n      ", rg->name);
+        json_num(f, "wind_kn", rg->wind_kn, ", ");
+        json_num(f, "drift_kn", rg->drift_kn, ", ");
+        json_num(f, "noise_m", rg->noise_m, ",\n");
+        fprintf(f, "      \"nights\": %d, \"drags\": %d, \"detected\": %d, \"missed\": %d,\n",
+                run.nights, drags, detected, drags - detected);
+        fprintf(f, "      \"latency_s\": { ");
+        json_num(f, "p50", pct(lat, detected, 50), ", ");
+        json_num(f, "p90", pct(lat, detected, 90), ", ");
+        json_num(f, "p99", pct(lat, detected, 99), ", ");
+        json_num(f, "max", pct(lat, detected, 100), " },\n");
+        fprintf(f, "      \"drag_m_at_alarm\": { ");
+        json_num(f, "p50", pct(dist, detected, 50), ", ");
+        json_num(f, "p90", pct(dist, detected, 90), ", ");
+        json_num(f, "max", pct(dist, detected, 100), " },\n");
+        fprintf(f, "      \"false_alarms\": %lu, \"false_alarm_nights\": %d, ", (unsigned long)fa, fa_nights);
+        json_num(f, "exposure_h", exposure_h, ", ");
+        json_num(f, "false_alarms_per_1000_nights", fa_rate, ", ");
+        fprintf(f, "\"pass\": %s,\n", pass ? "true" : "false");
+        fprintf(f, "      \"false_alarm_bits\": { ");
+        for (int b = 0; b < MC_ALARM_BITS; b++) {
+            fprintf(f, "\"%s\": %lu%s", s_alarm_names[b], (unsigned long)fa_bits[b],
+                    b + 1 < MC_ALARM_BITS ? ", " : " },\n");
+        }
+        fprintf(f, "      \"fix_ns\": { \"fixes\": %llu, ", (unsigned long long)fixes);
+        json_num(f, "mean", fix_mean, ", ");
+        fprintf(f, "\"p50\": %lu, \"p99\": %lu, \"max\": %lu }\n    }%s\n",
+                (unsigned long)hist_pct(hist, fixes, 50), (unsigned long)hist_pct(hist, fixes, 99),
+                (unsigned long)fix_max, r + 1 < MC_REGIME_COUNT ? "," : "");
+
+        fprintf(stderr, "%-20s %5d %5d %8.0f %8.0f %8.0f %8.1f %7lu %7d %9.1f %7.0f %7lu %4s\n", rg->name,
+                drags, drags - detected, pct(lat, detected, 50), pct(lat, detected, 90),
+                pct(lat, detected, 99), pct(dist, detected, 90), (unsigned long)fa, fa_nights, fa_rate,
+                fix_mean, (unsigned long)hist_pct(hist, fixes, 99), pass ? "ok" : "FAIL");
+    }
+    fprintf(f, "  ]\n}\n");
+    if (f != stdout) fclose(f);
+
+    fprintf(stderr, "wall %.1f s\n", wall_s);
+    if (failed > 0) {
+        fprintf(stderr, "FAILED: %d regime(s) above %g false alarms per 1000 nights or missing a drag\n",
+                failed, max_fa);
+    }
+    free(run.result);
+    free(tid);
+    free(lat);
+    free(dist);
+    return failed > 0 ? 1 : 0;
+}
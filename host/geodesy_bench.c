@@ -0,0 +1,201 @@
+/**
+ * Geodesy Kernel Accuracy vs Speed Matrix (host)
+ *
+ * Author: Colin Bitterfield
+ * Email: colin@bitterfield.com
+ * Date Created: 2026-10-18
+ * Version: 0.1.0
+ *
+ * Links anchor_geodesy.c three times (double, float and fixed point) and,
+ * for each kernel and mode, reports the worst distance error against a
+ * double-precision Vincenty reference at 1 m to 20 km, and the time per
+ * call. Pairs are random over latitudes +-70 degrees and all bearings. The
+ * last line names the cheapest float or fixed-point kernel within
+ * GEOD_BUDGET_MM at anchoring ranges (up to 500 m).
+ *
+ * Timings are host timings. The ESP32-S3 does double precision in
+ * software, so the double rows are there for accuracy and are left out of
+ * the pick.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <stdbool.h>
+#include <time.h>
+#include "anchor_geodesy.h"
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+GEOD_DECLARE_MODE(_double)
+GEOD_DECLARE_MODE(_float)
+GEOD_DECLARE_MODE(_fixed)
+
+#define BENCH_PAIRS         20000
+#define BENCH_MIN_S         0.2
+#define GEOD_BUDGET_MM      100         // 10 cm
+#define ANCHORING_RANGES    4           // Ranges up to 500 m
+
+static const double s_range_m[] = { 1.0, 10.0, 100.0, 500.0, 2000.0, 20000.0 };
+#define RANGES              (int)(sizeof(s_range_m) / sizeof(s_range_m[0]))
+
+typedef struct {
+    const char *name;
+    bool pick;                  // Candidate for the target (not software double)
+    void (*ref_init)(geod_ref_t *ref, geod_pos_t origin);
+    uint32_t (*equirect)(const geod_ref_t *ref, geod_pos_t p);
+    uint32_t (*haversine)(geod_pos_t a, geod_pos_t b);
+    uint32_t (*vincenty)(geod_pos_t a, geod_pos_t b);
+} geod_mode_t;
+
+static const geod_mode_t s_modes[] = {
+    { "double", false, geod_ref_init_double, geod_equirect_mm_double, geod_haversine_mm_double, geod_vincenty_mm_double },
+    { "float",  true,  geod_ref_init_float,  geod_equirect_mm_float,  geod_haversine_mm_float,  geod_vincenty_mm_float },
+    { "fixed",  true,  geod_ref_init_fixed,  geod_equirect_mm_fixed,  geod_haversine_mm_fixed,  geod_vincenty_mm_fixed },
+};
+#define MODES               (int)(sizeof(s_modes) / sizeof(s_modes[0]))
+
+static const char *s_kernels[] = { "equirect", "haversine", "vincenty" };
+#define KERNELS             3
+
+static geod_pos_t s_a[RANGES][BENCH_PAIRS];
+static geod_pos_t s_b[RANGES][BENCH_PAIRS];
+static uint32_t s_truth[RANGES][BENCH_PAIRS];
+static geod_ref_t s_ref[BENCH_PAIRS];
+static uint32_t s_rng = 2463534242u;
+
+static double now_s(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static double uniform(double lo, double hi) {
+    s_rng ^= s_rng << 13;
+    s_rng ^= s_rng >> 17;
+    s_rng ^= s_rng << 5;
+    return lo + (hi - lo) * (s_rng / 4294967296.0);
+}
+
+/**
+ * Random pairs about range_m apart (the reference distance is what counts)
+ */
+static void make_pairs(int r) {
+    for (int i = 0; i < BENCH_PAIRS; i++) {
+        double lat = uniform(-70.0, 70.0);
+        double lon = uniform(-180.0, 180.0);
+        double brg = uniform(0.0, 2.0 * M_PI);
+        double dlat = s_range_m[r] * cos(brg) / 111132.0;
+        double dlon = s_range_m[r] * sin(brg) / (111320.0 * cos(lat * M_PI / 180.0));
+        double lon2 = lon + dlon;
+        if (lon2 >= 180.0) {
+            lon2 -= 360.0;
+        }
+        s_a[r][i] = (geod_pos_t){ GEOD_DEG_TO_E7(lat), GEOD_DEG_TO_E7(lon) };
+        s_b[r][i] = (geod_pos_t){ GEOD_DEG_TO_E7(lat + dlat), GEOD_DEG_TO_E7(lon2) };
+        s_truth[r][i] = geod_vincenty_mm_double(s_a[r][i], s_b[r][i]);
+    }
+}
+
+static uint32_t run_kernel(const geod_mode_t *m, int k, int r, int i) {
+    switch (k) {
+        case 0: return m->equirect(&s_ref[i], s_b[r][i]);
+        case 1: return m->haversine(s_a[r][i], s_b[r][i]);
+        default: return m->vincenty(s_a[r][i], s_b[r][i]);
+    }
+}
+
+static void init_refs(const geod_mode_t *m, int r) {
+    for (int i = 0; i < BENCH_PAIRS; i++) {
+        m->ref_init(&s_ref[i], s_a[r][i]);
+    }
+}
+
+/**
+ * Worst absolute error against the reference (mm)
+ */
+static uint32_t max_error(const geod_mode_t *m, int k, int r) {
+    uint32_t worst = 0;
+    if (k == 0) {
+        init_refs(m, r);
+    }
+    for (int i = 0; i < BENCH_PAIRS; i++) {
+        uint32_t d = run_kernel(m, k, r, i);
+        uint32_t err = d > s_truth[r][i] ? d - s_truth[r][i] : s_truth[r][i] - d;
+        if (err > worst) {
+            worst = err;
+        }
+    }
+    return worst;
+}
+
+/**
+ * Time per call at 500 m (the equirectangular reference is set up outside the loop)
+ */
+static double ns_per_call(const geod_mode_t *m, int k) {
+    const int r = ANCHORING_RANGES - 1;
+    volatile uint32_t sink = 0;
+    long calls = 0;
+    if (k == 0) {
+        init_refs(m, r);
+    }
+    double start = now_s(), elapsed;
+    do {
+        for (int i = 0; i < BENCH_PAIRS; i++) {
+            sink += run_kernel(m, k, r, i);
+        }
+        calls += BENCH_PAIRS;
+        elapsed = now_s() - start;
+    } while (elapsed < BENCH_MIN_S);
+    (void)sink;
+    return elapsed * 1e9 / calls;
+}
+
+int main(void) {
+    for (int r = 0; r < RANGES; r++) {
+        make_pairs(r);
+    }
+
+    printf("Geodesy kernels: worst error vs double Vincenty (mm), %d pairs per range\n\n", BENCH_PAIRS);
+    printf("%-10s %-7s", "kernel", "mode");
+    for (int r = 0; r < RANGES; r++) {
+        char label[16];
+        snprintf(label, sizeof(label), s_range_m[r] < 1000.0 ? "%.0f m" : "%.0f km",
+                 s_range_m[r] < 1000.0 ? s_range_m[r] : s_range_m[r] / 1000.0);
+        printf(" %9s", label);
+    }
+    printf(" %9s  %s\n", "ns/call", "<= 10 cm to 500 m");
+
+    const char *best_kernel = NULL, *best_mode = NULL;
+    double best_ns = 0.0;
+    for (int k = 0; k < KERNELS; k++) {
+        for (int m = 0; m < MODES; m++) {
+            bool ok = true;
+            printf("%-10s %-7s", s_kernels[k], s_modes[m].name);
+            for (int r = 0; r < RANGES; r++) {
+                uint32_t err = max_error(&s_modes[m], k, r);
+                printf(" %9lu", (unsigned long)err);
+                if (r < ANCHORING_RANGES && err > GEOD_BUDGET_MM) {
+                    ok = false;
+                }
+            }
+            double ns = ns_per_call(&s_modes[m], k);
+            printf(" %9.1f  %s\n", ns, ok ? "yes" : "no");
+            if (ok && s_modes[m].pick && (best_kernel == NULL || ns < best_ns)) {
+                best_kernel = s_kernels[k];
+                best_mode = s_modes[m].name;
+                best_ns = ns;
+            }
+        }
+    }
+
+    if (best_kernel != NULL) {
+        printf("\ncheapest within %d mm up to 500 m: %s / %s (%.1f ns/call)\n",
+               GEOD_BUDGET_MM, best_kernel, best_mode, best_ns);
+    } else {
+        printf("\nno kernel within %d mm up to 500 m\n", GEOD_BUDGET_MM);
+    }
+    return best_kernel != NULL ? 0 : 1;
+}
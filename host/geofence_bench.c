@@ -0,0 +1,168 @@
+/**
+ * Geofence Evaluation Benchmark (host)
+ *
+ * Author: Colin Bitterfield
+ * Email: colin@bitterfield.com
+ * Date Created: 2026-10-18
+ * Date Updated: 2026-10-18
+ * Version: 0.1.1
+ *
+ * Changelog:
+ * - 0.1.1 (2026-10-18): Checks the zones again after the origin moves
+ *
+ * Measures full zone-set evaluations per second (one evaluation = one fix
+ * tested against every zone) as the vertex count grows, for random fixes
+ * across the anchorage and for fixes hugging the zone edges (boundary
+ * cells, the slow path). Every result is checked against a brute-force
+ * ray cast over all edges, also after the origin moves and the zones are
+ * shifted and recompiled.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <time.h>
+#include "anchor_geofence.h"
+
+#define BENCH_POINTS    4096
+#define BENCH_MIN_S     0.25
+
+static anchor_geofence_t s_set;
+static float s_px[BENCH_POINTS];
+static float s_py[BENCH_POINTS];
+
+static double now_s(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static float frand(float lo, float hi) {
+    return lo + (hi - lo) * (float)rand() / (float)RAND_MAX;
+}
+
+/**
+ * Reference inside test: every edge, no index
+ */
+static bool brute_contains(const geofence_def_t *def, float x, float y) {
+    bool inside = false;
+    for (int i = 0, j = def->n - 1; i < def->n; j = i++) {
+        const geofence_pt_t *a = &def->v[i];
+        const geofence_pt_t *b = &def->v[j];
+        if ((a->y > y) != (b->y > y) &&
+            x < a->x + (y - a->y) * (b->x - a->x) / (b->y - a->y)) {
+            inside = !inside;
+        }
+    }
+    return inside;
+}
+
+/**
+ * Star-shaped polygon (concave) around a random centre
+ */
+static void make_polygon(geofence_def_t *def, int n) {
+    float cx = frand(-200.0f, 200.0f);
+    float cy = frand(-200.0f, 200.0f);
+    float r = frand(20.0f, 60.0f);
+    *def = (geofence_def_t){ .type = GEOFENCE_POLYGON, .kind = GEOFENCE_EXCLUDE,
+                             .enabled = true, .n = (uint8_t)n };
+    for (int i = 0; i < n; i++) {
+        float a = 2.0f * (float)M_PI * i / n;
+        float ri = r * frand(0.5f, 1.0f);
+        def->v[i].x = cx + ri * sinf(a);
+        def->v[i].y = cy + ri * cosf(a);
+    }
+}
+
+static void make_points(bool boundary) {
+    for (int i = 0; i < BENCH_POINTS; i++) {
+        if (!boundary) {
+            s_px[i] = frand(-300.0f, 300.0f);
+            s_py[i] = frand(-300.0f, 300.0f);
+            continue;
+        }
+        // Within 2 m of a random edge of a random zone
+        const geofence_def_t *def = &s_set.zone[rand() % s_set.count].def;
+        int e = rand() % def->n;
+        const geofence_pt_t *a = &def->v[e];
+        const geofence_pt_t *b = &def->v[(e + 1) % def->n];
+        float t = frand(0.0f, 1.0f);
+        s_px[i] = a->x + t * (b->x - a->x) + frand(-2.0f, 2.0f);
+        s_py[i] = a->y + t * (b->y - a->y) + frand(-2.0f, 2.0f);
+    }
+}
+
+static int verify(void) {
+    int errors = 0;
+    for (int i = 0; i < BENCH_POINTS; i++) {
+        uint32_t hits = anchor_geofence_eval(&s_set, s_px[i], s_py[i]);
+        for (int z = 0; z < s_set.count; z++) {
+            bool ref = brute_contains(&s_set.zone[z].def, s_px[i], s_py[i]);
+            errors += (ref != ((hits >> z) & 1u));
+        }
+    }
+    return errors;
+}
+
+/**
+ * Evaluations per second over the point set
+ */
+static double run(uint32_t *sink) {
+    long evals = 0;
+    double t0 = now_s(), t;
+    do {
+        for (int i = 0; i < BENCH_POINTS; i++) {
+            *sink ^= anchor_geofence_eval(&s_set, s_px[i], s_py[i]);
+        }
+        evals += BENCH_POINTS;
+        t = now_s() - t0;
+    } while (t < BENCH_MIN_S);
+    return evals / t;
+}
+
+int main(void) {
+    static const int vertices[] = { 4, 8, 16, 32, 64 };
+    uint32_t sink = 0;
+    srand(1);
+
+    printf("# %d zones per set, %d fixes per run\n", GEOFENCE_MAX_ZONES, BENCH_POINTS);
+    printf("%-10s %-9s %14s %10s %7s\n", "zone", "fixes", "evals/s", "ns/eval", "errors");
+
+    for (size_t k = 0; k < sizeof(vertices) / sizeof(vertices[0]); k++) {
+        anchor_geofence_init(&s_set);
+        for (int z = 0; z < GEOFENCE_MAX_ZONES; z++) {
+            geofence_def_t def;
+            make_polygon(&def, vertices[k]);
+            anchor_geofence_add(&s_set, &def);
+        }
+        for (int boundary = 0; boundary <= 1; boundary++) {
+            make_points(boundary);
+            int errors = verify();
+            double rate = run(&sink);
+            printf("poly-%-5d %-9s %14.0f %10.1f %7d\n", vertices[k],
+                   boundary ? "boundary" : "random", rate, 1e9 / rate, errors);
+        }
+    }
+
+    // Moving the origin shifts and recompiles every zone (errors include zones it disabled)
+    anchor_geofence_set_origin(&s_set, 30.0, -90.0);
+    uint32_t dropped = anchor_geofence_set_origin(&s_set, 30.0004, -89.9995);
+    make_points(true);
+    printf("%-10s %-9s %14s %10s %7d\n", "shifted", "boundary", "-", "-",
+           verify() + __builtin_popcount(dropped));
+
+    // Annular sectors (no grid, two cross products)
+    anchor_geofence_init(&s_set);
+    for (int z = 0; z < GEOFENCE_MAX_ZONES; z++) {
+        geofence_def_t def = { .type = GEOFENCE_SECTOR, .kind = GEOFENCE_EXCLUDE, .enabled = true,
+                               .center = { frand(-200.0f, 200.0f), frand(-200.0f, 200.0f) },
+                               .r_in_m = frand(0.0f, 20.0f), .r_out_m = frand(30.0f, 80.0f),
+                               .start_deg = frand(0.0f, 360.0f), .sweep_deg = frand(30.0f, 300.0f) };
+        anchor_geofence_add(&s_set, &def);
+    }
+    make_points(false);
+    double rate = run(&sink);
+    printf("%-10s %-9s %14.0f %10.1f %7s\n", "sector", "random", rate, 1e9 / rate, "-");
+
+    return (int)(sink & 0);
+}
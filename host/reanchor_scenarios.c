@@ -0,0 +1,226 @@
+/**
+ * Re-anchoring Scenarios (host)
+ *
+ * Author: Colin Bitterfield
+ * Email: colin@bitterfield.com
+ * Date Created: 2026-10-18
+ * Date Updated: 2026-10-18
+ * Version: 0.1.1
+ *
+ * Changelog:
+ * - 0.1.1 (2026-10-18): fast-rebite scenario, suggestion expectations
+ *
+ * Deterministic (seeded) boat tracks run through the full engine at 1 Hz to
+ * show how the anchor hypotheses behave:
+ * - reanchor:    swing, motor 200 m, drop again - the watch alarms and
+ *                suggests the new spot; the skipper sets the anchor there
+ * - drag-reset:  anchor drags 90 m and bites again - the alarm must stay
+ * - squall-drag: a fast 0.8 m/s drag - still no switch
+ * - fast-rebite: a 1.2 m/s drag that bites again - alarm stays latched,
+ *                the new spot is only suggested
+ * - quiet-night: 12 h of wind-shift swinging - no alarm, no hypotheses
+ * Prints the event log of each run and exits non-zero if any expectation
+ * fails.
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <math.h>
+#include "anchor_engine.h"
+
+#define SIM_LAT         41.0
+#define SIM_LON         (-71.0)
+#define SIM_RODE_M      30.0
+#define SIM_NOISE_M     1.0
+#define SIM_RADIUS_M    40.0f
+#define SIM_FALLBACK_S  120.0   // Boat falls back onto the rode after a drop
+
+typedef enum {
+    PHASE_SWING = 0,            // Swing around the anchor
+    PHASE_MOTOR,                // Motor to (to_e, to_n), then drop there
+    PHASE_DRAG                  // Anchor drags downwind at speed, then bites
+} phase_type_t;
+
+typedef struct {
+    phase_type_t type;
+    double duration_s;
+    double to_e, to_n;          // PHASE_MOTOR destination
+    double speed_mps;           // PHASE_MOTOR / PHASE_DRAG
+} phase_t;
+
+typedef struct {
+    const char *name;
+    uint32_t seed;
+    double swing_deg;           // Swing half-angle
+    double period_s;            // Swing period
+    const phase_t *phases;
+    int phase_count;
+    // Expectations
+    uint32_t reanchors;
+    bool alarm_at_end;
+    bool suggested;             // At least one SUGGEST event
+    bool accept;                // Skipper sets the anchor at a suggested spot
+    double anchor_tol_m;        // Final engine anchor within this of the true anchor (0 = skip)
+} scenario_t;
+
+static uint32_t s_rng;
+
+static double rng_uniform(void) {
+    s_rng ^= s_rng << 13;
+    s_rng ^= s_rng >> 17;
+    s_rng ^= s_rng << 5;
+    return (s_rng + 0.5) / 4294967296.0;
+}
+
+static double rng_gauss(void) {
+    return sqrt(-2.0 * log(rng_uniform())) * cos(2.0 * M_PI * rng_uniform());
+}
+
+/**
+ * Boat position on the rode for a swing angle, falling back after a drop
+ */
+static void boat_on_rode(const scenario_t *sc, double anchor_e, double anchor_n,
+                         double t_since_drop, double t, double *e, double *n) {
+    double lie = (t_since_drop < SIM_FALLBACK_S) ? t_since_drop / SIM_FALLBACK_S : 1.0;
+    double a = (180.0 + sc->swing_deg * sin(2.0 * M_PI * t / sc->period_s)) * M_PI / 180.0;
+    *e = anchor_e + SIM_RODE_M * lie * sin(a);
+    *n = anchor_n + SIM_RODE_M * lie * cos(a);     // Wind from the north, boat lies south
+}
+
+static int run(const scenario_t *sc) {
+    static anchor_engine_t eng;
+    anchor_config_t cfg;
+    anchor_engine_default_config(&cfg);
+    cfg.radius_m = SIM_RADIUS_M;
+    anchor_engine_init(&eng, &cfg);
+
+    geo_ref_t world;
+    geo_ref_init(&world, SIM_LAT, SIM_LON);
+    s_rng = sc->seed;
+
+    // Watch starts with the boat already lying to the rode
+    double anchor_e = 0.0, anchor_n = 0.0, drop_t = -SIM_FALLBACK_S;
+    double boat_e = 0.0, boat_n = 0.0;
+    double t = 0.0;
+    uint32_t first_alarm_s = 0;
+    uint32_t events_seen = 0;
+    uint32_t suggestions = 0;
+    anchor_engine_set_anchor(&eng, SIM_LAT, SIM_LON, 0);
+
+    printf("== %s\n", sc->name);
+    for (int p = 0; p < sc->phase_count; p++) {
+        const phase_t *ph = &sc->phases[p];
+        double start_e = boat_e, start_n = boat_n;
+        double motor_s = hypot(ph->to_e - start_e, ph->to_n - start_n) / (ph->speed_mps > 0 ? ph->speed_mps : 1);
+        double duration = (ph->type == PHASE_MOTOR) ? motor_s : ph->duration_s;
+
+        for (double pt = 0.0; pt < duration; pt += 1.0, t += 1.0) {
+            switch (ph->type) {
+                case PHASE_SWING:
+                    boat_on_rode(sc, anchor_e, anchor_n, t - drop_t, t, &boat_e, &boat_n);
+                    break;
+                case PHASE_MOTOR:
+                    boat_e = start_e + (ph->to_e - start_e) * pt / motor_s;
+                    boat_n = start_n + (ph->to_n - start_n) * pt / motor_s;
+                    anchor_e = ph->to_e;
+                    anchor_n = ph->to_n;
+                    drop_t = t + 1.0;
+                    break;
+                case PHASE_DRAG:
+                    anchor_n -= ph->speed_mps;     // Dragged downwind (south)
+                    boat_on_rode(sc, anchor_e, anchor_n, t - drop_t, t, &boat_e, &boat_n);
+                    break;
+            }
+
+            anchor_fix_t fix = { .t_ms = (uint32_t)(t * 1000.0) };
+            geo_from_enu(&world, (float)(boat_e + SIM_NOISE_M * rng_gauss()),
+                         (float)(boat_n + SIM_NOISE_M * rng_gauss()), &fix.lat, &fix.lon);
+            uint32_t flags = anchor_engine_update(&eng, &fix);
+            if (flags && first_alarm_s == 0) {
+                first_alarm_s = (uint32_t)t;
+                printf("  t=%6.0f ALARM flags=0x%02x\n", t, (unsigned int)flags);
+            }
+
+            reanchor_event_t ev;
+            for (; events_seen < eng.reanchor.event_count; events_seen++) {
+                if (anchor_reanchor_event(&eng.reanchor, events_seen, &ev)) {
+                    printf("  t=%6.0f %-7s hypo %u at %6.1f, %6.1f  lead %.0f\n",
+                           ev.t_ms / 1000.0, anchor_reanchor_event_name(ev.type),
+                           (unsigned int)ev.hypo, ev.east_m, ev.north_m, ev.margin);
+                }
+                if (ev.type == REANCHOR_EVENT_SWITCH) {
+                    first_alarm_s = 0;
+                } else if (ev.type == REANCHOR_EVENT_SUGGEST) {
+                    suggestions++;
+                    if (sc->accept) {
+                        double lat, lon;
+                        geo_from_enu(&eng.anchor, ev.east_m, ev.north_m, &lat, &lon);
+                        anchor_engine_set_anchor(&eng, lat, lon, fix.t_ms);
+                        printf("  t=%6.0f anchor set at the suggestion\n", t);
+                        first_alarm_s = 0;
+                        events_seen = 0;
+                        break;
+                    }
+                }
+            }
+        }
+    }
+
+    float ae, an;
+    geo_to_enu(&world, eng.anchor.lat0, eng.anchor.lon0, &ae, &an);
+    double anchor_err = hypot(ae - anchor_e, an - anchor_n);
+    bool alarm = eng.state == ANCHOR_STATE_ALARM;
+
+    int failures = 0;
+    failures += (eng.reanchors != sc->reanchors);
+    failures += (alarm != sc->alarm_at_end);
+    failures += ((suggestions > 0) != sc->suggested);
+    failures += (sc->anchor_tol_m > 0.0 && anchor_err > sc->anchor_tol_m);
+    printf("  end t=%.0f state=%s reanchors=%lu suggestions=%lu anchor error %.1f m -> %s\n\n",
+           t, anchor_engine_state_name(eng.state), (unsigned long)eng.reanchors,
+           (unsigned long)suggestions, anchor_err, failures ? "FAIL" : "PASS");
+    return failures ? 1 : 0;
+}
+
+static const phase_t reanchor_phases[] = {
+    { .type = PHASE_SWING, .duration_s = 3600 },
+    { .type = PHASE_MOTOR, .to_e = 200.0, .to_n = 50.0, .speed_mps = 2.5 },
+    { .type = PHASE_SWING, .duration_s = 3600 },
+};
+static const phase_t drag_reset_phases[] = {
+    { .type = PHASE_SWING, .duration_s = 3600 },
+    { .type = PHASE_DRAG, .duration_s = 300, .speed_mps = 0.3 },
+    { .type = PHASE_SWING, .duration_s = 7200 },
+};
+static const phase_t squall_drag_phases[] = {
+    { .type = PHASE_SWING, .duration_s = 3600 },
+    { .type = PHASE_DRAG, .duration_s = 120, .speed_mps = 0.8 },
+    { .type = PHASE_SWING, .duration_s = 3600 },
+};
+static const phase_t fast_rebite_phases[] = {
+    { .type = PHASE_SWING, .duration_s = 3600 },
+    { .type = PHASE_DRAG, .duration_s = 90, .speed_mps = 1.2 },
+    { .type = PHASE_SWING, .duration_s = 3600 },
+};
+static const phase_t quiet_phases[] = {
+    { .type = PHASE_SWING, .duration_s = 12 * 3600 },
+};
+
+#define PHASES(p) p, (int)(sizeof(p) / sizeof(p[0]))
+
+int main(void) {
+    static const scenario_t scenarios[] = {
+        { "reanchor",    1, 35.0, 90.0, PHASES(reanchor_phases),    0, false, true,  true,  10.0 },
+        { "drag-reset",  2, 35.0, 90.0, PHASES(drag_reset_phases),  0, true,  false, false, 0.0 },
+        { "squall-drag", 3, 45.0, 60.0, PHASES(squall_drag_phases), 0, true,  false, false, 0.0 },
+        { "fast-rebite", 5, 45.0, 60.0, PHASES(fast_rebite_phases), 0, true,  true,  false, 0.0 },
+        { "quiet-night", 4, 30.0, 90.0, PHASES(quiet_phases),       0, false, false, false, 5.0 },
+    };
+
+    int failures = 0;
+    for (size_t i = 0; i < sizeof(scenarios) / sizeof(scenarios[0]); i++) {
+        failures += run(&scenarios[i]);
+    }
+    printf("%d scenario(s) failed\n", failures);
+    return failures;
+}
@@ -0,0 +1,173 @@
+/**
+ * Frame Buffer Rotation Benchmark (host)
+ *
+ * Author: Colin Bitterfield
+ * Email: colin@bitterfield.com
+ * Date Created: 2026-10-18
+ * Date Updated: 2026-10-18
+ * Version: 0.1.1
+ *
+ * Changelog:
+ * - 0.1.1 (2026-10-18): Times lvgl_rotate_copy_tiled(), now separate from the flush path default
+ *
+ * Measures MPixels/s of the tiled rotation kernel against the per-pixel
+ * loop at 90, 180 and 270 degrees, for a full 800x480 frame and for
+ * typical dirty areas (a header strip, a value label, an unaligned
+ * rectangle). Before timing, each case is run through both kernels into
+ * destination buffers pre-filled with a sentinel, and the two whole
+ * buffers must match. This checks the rotated pixels and that nothing
+ * outside the area was written. The written pixels must also lie exactly
+ * in lvgl_rotate_area()'s bounds, and row bands copied from their own
+ * buffer (lvgl_rotate_copy_band(), the rotated partial render flush) must
+ * match the same rows copied from the full frame.
+ *
+ * Host numbers only show the access-pattern effect. The target figures
+ * (PSRAM frame buffers behind the S3 data cache) come from the boot
+ * benchmark in main.c (ENABLE_ROTATE_BENCHMARK).
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <time.h>
+#include "lvgl_rotate.h"
+
+#define PANEL_W         800
+#define PANEL_H         480
+#define BENCH_MIN_S     0.25
+#define SENTINEL        0xDEAD
+#define BAND_ROWS       24      // Partial render band (CONFIG_ANCHOR_RENDER_PARTIAL_LINES default)
+
+typedef struct {
+    const char *name;
+    int x_start, y_start, x_end, y_end;     // In the logical (portrait at 90/270) frame
+} bench_area_t;
+
+static const bench_area_t s_areas[] = {
+    { "full frame",     0,  0, -1, -1 },    // -1: last column / row
+    { "header strip",   0,  0, -1, 47 },
+    { "value label",  140, 300, 339, 359 },
+    { "unaligned",      3,  7, 130, 300 },
+};
+
+static uint16_t s_src[PANEL_W * PANEL_H];
+static uint16_t s_dst[PANEL_W * PANEL_H];
+static uint16_t s_ref[PANEL_W * PANEL_H];
+
+typedef void (*rotate_fn_t)(const uint16_t *, uint16_t *, int, int, int, int, int, int, int);
+
+static double now_s(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+/**
+ * MPixels/s of one kernel on one area
+ */
+static double bench(rotate_fn_t fn, const bench_area_t *a, int w, int h, int rotation) {
+    int x_end = a->x_end < 0 ? w - 1 : a->x_end;
+    int y_end = a->y_end < 0 ? h - 1 : a->y_end;
+    double pixels = (double)(x_end - a->x_start + 1) * (y_end - a->y_start + 1);
+
+    long iterations = 0;
+    double start = now_s();
+    double elapsed;
+    do {
+        fn(s_src, s_dst, a->x_start, a->y_start, x_end, y_end, w, h, rotation);
+        iterations++;
+        elapsed = now_s() - start;
+    } while (elapsed < BENCH_MIN_S);
+    return pixels * iterations / elapsed / 1e6;
+}
+
+static void fill_sentinel(void) {
+    for (int i = 0; i < PANEL_W * PANEL_H; i++) {
+        s_dst[i] = SENTINEL;
+        s_ref[i] = SENTINEL;
+    }
+}
+
+/**
+ * Tiled output must match the per-pixel loop over the whole buffer, inside
+ * the rotated area bounds
+ */
+static int verify(const bench_area_t *a, int w, int h, int rotation) {
+    int x_end = a->x_end < 0 ? w - 1 : a->x_end;
+    int y_end = a->y_end < 0 ? h - 1 : a->y_end;
+
+    fill_sentinel();
+    lvgl_rotate_copy_tiled(s_src, s_dst, a->x_start, a->y_start, x_end, y_end, w, h, rotation);
+    lvgl_rotate_copy_pixel(s_src, s_ref, a->x_start, a->y_start, x_end, y_end, w, h, rotation);
+    if (memcmp(s_dst, s_ref, sizeof(s_dst)) != 0) {
+        printf("MISMATCH: %s at %d degrees\n", a->name, rotation);
+        return 1;
+    }
+
+    // Destination frame is h wide at 90/270, w wide at 180
+    int dst_w = rotation == 180 ? w : h;
+    int x1 = a->x_start, y1 = a->y_start, x2 = x_end, y2 = y_end;
+    lvgl_rotate_area(&x1, &y1, &x2, &y2, w, h, rotation);
+    for (int i = 0; i < PANEL_W * PANEL_H; i++) {
+        int x = i % dst_w, y = i / dst_w;
+        bool inside = x >= x1 && x <= x2 && y >= y1 && y <= y2;
+        if (inside != (s_dst[i] != SENTINEL)) {
+            printf("MISMATCH: %s at %d degrees, pixel %d,%d outside the rotated area\n",
+                   a->name, rotation, x, y);
+            return 1;
+        }
+    }
+    return 0;
+}
+
+/**
+ * Every band copied from its own buffer must match the full-frame copy
+ */
+static int verify_bands(int w, int h, int rotation) {
+    fill_sentinel();
+    for (int y = 0; y < h; y += BAND_ROWS) {
+        int y_end = y + BAND_ROWS - 1 < h ? y + BAND_ROWS - 1 : h - 1;
+        static uint16_t band[PANEL_W * BAND_ROWS];
+        memcpy(band, s_src + y * w, (size_t)(y_end - y + 1) * w * sizeof(uint16_t));
+        lvgl_rotate_copy_band(band, s_dst, y, y_end, w, h, rotation);
+    }
+    lvgl_rotate_copy_pixel(s_src, s_ref, 0, 0, w - 1, h - 1, w, h, rotation);
+    if (memcmp(s_dst, s_ref, sizeof(s_dst)) != 0) {
+        printf("MISMATCH: %d row bands at %d degrees\n", BAND_ROWS, rotation);
+        return 1;
+    }
+    return 0;
+}
+
+int main(void) {
+    static const int rotations[] = { 90, 180, 270 };
+    int failures = 0;
+
+    srand(1);
+    for (int i = 0; i < PANEL_W * PANEL_H; i++) {
+        s_src[i] = (uint16_t)rand();
+        if (s_src[i] == SENTINEL) s_src[i] = 0;
+    }
+
+    printf("Rotation kernels, MPixels/s (%dx%d panel, %dx%d tiles)\n\n",
+           PANEL_W, PANEL_H, LVGL_ROTATE_TILE, LVGL_ROTATE_TILE);
+    printf("%-5s %-14s %10s %10s %8s\n", "deg", "area", "per-pixel", "tiled", "speedup");
+
+    for (size_t r = 0; r < sizeof(rotations) / sizeof(rotations[0]); r++) {
+        int rotation = rotations[r];
+        int w = rotation == 180 ? PANEL_W : PANEL_H;     // LVGL's logical frame
+        int h = rotation == 180 ? PANEL_H : PANEL_W;
+        failures += verify_bands(w, h, rotation);
+        for (size_t i = 0; i < sizeof(s_areas) / sizeof(s_areas[0]); i++) {
+            const bench_area_t *a = &s_areas[i];
+            failures += verify(a, w, h, rotation);
+            double ref = bench(lvgl_rotate_copy_pixel, a, w, h, rotation);
+            double tiled = bench(lvgl_rotate_copy_tiled, a, w, h, rotation);
+            printf("%-5d %-14s %10.1f %10.1f %7.2fx\n", rotation, a->name, ref, tiled, tiled / ref);
+        }
+    }
+
+    printf("\n%s\n", failures == 0 ? "All outputs match the per-pixel loop" : "FAILED");
+    return failures == 0 ? 0 : 1;
+}
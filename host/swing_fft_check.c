@@ -0,0 +1,157 @@
+/**
+ * Swing FFT vs Reference DFT (host)
+ *
+ * Author: Colin Bitterfield
+ * Email: colin@bitterfield.com
+ * Date Created: 2026-10-18
+ * Version: 0.1.0
+ *
+ * Checks the FFT used by anchor_swing.c against a double-precision O(n^2)
+ * DFT for every power-of-two length up to SWING_FFT_N. Inputs:
+ * - random:  uniform complex noise
+ * - impulse: one non-zero sample away from the origin
+ * - tone:    a complex exponential between bins
+ * - swing:   a 60 s swing along a line plus drift, Hann windowed and
+ *            zero-padded as swing_analyse() does (SWING_FFT_N only)
+ * Both anchor_swing_fft_c() and the anchor_swing_fft() dispatcher (the
+ * portable path on the host) are checked. The error is the worst bin error
+ * relative to the largest reference bin. Exits non-zero if any case is
+ * above FFT_TOLERANCE.
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+#include "anchor_swing.h"
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+#define FFT_TOLERANCE       1e-5    // Worst bin error / largest reference bin
+#define FFT_MIN_N           2
+
+typedef enum {
+    INPUT_RANDOM = 0,
+    INPUT_IMPULSE,
+    INPUT_TONE,
+    INPUT_SWING,
+    INPUT_COUNT
+} input_t;
+
+static const char *s_input_names[INPUT_COUNT] = { "random", "impulse", "tone", "swing" };
+
+static uint32_t s_rng = 1;
+
+static float rng_uniform(void) {
+    s_rng ^= s_rng << 13;
+    s_rng ^= s_rng >> 17;
+    s_rng ^= s_rng << 5;
+    return (float)((s_rng + 0.5) / 4294967296.0) * 2.0f - 1.0f;
+}
+
+/**
+ * Fill n complex points (interleaved re/im)
+ */
+static void make_input(float *z, int n, input_t input) {
+    memset(z, 0, 2 * (size_t)n * sizeof(float));
+    switch (input) {
+    case INPUT_RANDOM:
+        for (int i = 0; i < 2 * n; i++) {
+            z[i] = rng_uniform();
+        }
+        break;
+    case INPUT_IMPULSE:
+        z[2 * (n / 2 + n / 4) + 0] = 1.0f;
+        z[2 * (n / 2 + n / 4) + 1] = -0.5f;
+        break;
+    case INPUT_TONE:
+        for (int i = 0; i < n; i++) {
+            double a = 2.0 * M_PI * 3.3 * i / n;
+            z[2 * i] = (float)cos(a);
+            z[2 * i + 1] = (float)sin(a);
+        }
+        break;
+    case INPUT_SWING:
+        // SWING_N samples at SWING_SAMPLE_MS, zero-padded to n like swing_analyse()
+        for (int i = 0; i < SWING_N && i < n; i++) {
+            double t = i * SWING_SAMPLE_MS / 1000.0;
+            double s = 15.0 * sin(2.0 * M_PI * t / 60.0);
+            double w = 0.5 - 0.5 * cos(2.0 * M_PI * i / (SWING_N - 1));
+            z[2 * i] = (float)(w * (0.6 * s + 0.01 * t));
+            z[2 * i + 1] = (float)(w * (0.8 * s - 0.02 * t));
+        }
+        break;
+    default:
+        break;
+    }
+}
+
+/**
+ * Reference DFT in double precision, X[k] = sum z[i] exp(-j*2*pi*i*k/n)
+ */
+static void dft_ref(const float *z, double *out, int n) {
+    for (int k = 0; k < n; k++) {
+        double re = 0.0, im = 0.0;
+        for (int i = 0; i < n; i++) {
+            double a = -2.0 * M_PI * (double)((int64_t)i * k % n) / n;
+            re += z[2 * i] * cos(a) - z[2 * i + 1] * sin(a);
+            im += z[2 * i] * sin(a) + z[2 * i + 1] * cos(a);
+        }
+        out[2 * k] = re;
+        out[2 * k + 1] = im;
+    }
+}
+
+/**
+ * Worst bin error relative to the largest reference bin
+ */
+static double fft_error(const float *x, const double *ref, int n) {
+    double peak = 0.0, worst = 0.0;
+    for (int k = 0; k < n; k++) {
+        double mag = hypot(ref[2 * k], ref[2 * k + 1]);
+        double err = hypot(x[2 * k] - ref[2 * k], x[2 * k + 1] - ref[2 * k + 1]);
+        if (mag > peak) peak = mag;
+        if (err > worst) worst = err;
+    }
+    return peak > 0.0 ? worst / peak : worst;
+}
+
+int main(void) {
+    static float input[2 * SWING_FFT_N];
+    static float x[2 * SWING_FFT_N];
+    static double ref[2 * SWING_FFT_N];
+    int failures = 0;
+    double worst_c = 0.0, worst_dispatch = 0.0;
+
+    printf("%-8s %5s %12s %12s\n", "input", "n", "fft_c", "fft");
+    for (int in = 0; in < INPUT_COUNT; in++) {
+        for (int n = FFT_MIN_N; n <= SWING_FFT_N; n <<= 1) {
+            if (in == INPUT_SWING && n != SWING_FFT_N) continue;
+
+            make_input(input, n, (input_t)in);
+            dft_ref(input, ref, n);
+
+            memcpy(x, input, 2 * (size_t)n * sizeof(float));
+            anchor_swing_fft_c(x, n);
+            double err_c = fft_error(x, ref, n);
+
+            memcpy(x, input, 2 * (size_t)n * sizeof(float));
+            anchor_swing_fft(x, n);
+            double err_dispatch = fft_error(x, ref, n);
+
+            bool fail = err_c > FFT_TOLERANCE || err_dispatch > FFT_TOLERANCE;
+            failures += fail;
+            if (err_c > worst_c) worst_c = err_c;
+            if (err_dispatch > worst_dispatch) worst_dispatch = err_dispatch;
+            printf("%-8s %5d %12.3e %12.3e%s\n", s_input_names[in], n, err_c, err_dispatch,
+                   fail ? "  FAIL" : "");
+        }
+    }
+
+    printf("worst relative error: fft_c %.3e, fft %.3e (tolerance %.0e)\n",
+           worst_c, worst_dispatch, FFT_TOLERANCE);
+    printf("%d case(s) failed\n", failures);
+    return failures;
+}
@@ -0,0 +1,168 @@
+/**
+ * Depth Channel Tide Scenarios (host)
+ *
+ * Author: Colin Bitterfield
+ * Email: colin@bitterfield.com
+ * Date Created: 2026-10-18
+ * Version: 0.1.0
+ *
+ * Deterministic (seeded) depth tracks at 1 Hz run through anchor_depth.c to
+ * check the scope radius and the depth-trend flag against tide curves:
+ * - tide-flood:    a 3 m flood after the drop. The reference comes from the
+ *                  settled depth, not the shallow water over the anchor, and
+ *                  the radius shrinks with the reach
+ * - tide-ebb:      a 4 m ebb on a short rode. The radius grows
+ * - sloping-swing: 12 h swinging over a 1 m slope with a noisy drag-rate gate
+ *                  and bad pings. No flag
+ * - shoaling-drag: the anchor drags into water shoaling at 0.6 m/min. Flagged
+ * The radius change is checked against the Pythagorean reach at the true
+ * tide height. Exits non-zero if any expectation fails.
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <math.h>
+#include "anchor_depth.h"
+
+#define SIM_TIDE_PERIOD_S   (12.42 * 3600.0)   // Semidiurnal tide
+#define SIM_NOISE_M         0.05    // Sounder noise
+#define SIM_BAD_PING_S      300     // One 0 m reading this often
+#define SIM_FALLBACK_S      120     // Boat falls back from over the anchor
+#define SIM_SETTLE_S        300     // Engine reports settled from here
+#define SIM_GATE_PERIOD_S   300     // Drag-rate gate false positives: 60 s on every 5 min
+
+typedef struct {
+    const char *name;
+    uint32_t seed;
+    float rode_m;
+    float bow_m;
+    double low_m;               // Depth at low water under the swing
+    double range_m;             // Tide range
+    bool from_high;             // Start at high water (ebb) instead of low (flood)
+    double over_anchor_m;       // Depth over the anchor at the drop (shallower slope)
+    double slope_m;             // Depth change across the swing (+-half)
+    double swing_s;             // Swing period
+    bool noisy_gate;            // moving_away true 60 s in every 5 min
+    double drag_at_s;           // Drag into shoaling water from here (0 = none)
+    double drag_mps;            // Depth change during the drag
+    double hours;
+    // Expectations
+    bool flag;                  // DEPTH_FLAG_TREND raised
+    double radius_tol_m;        // Radius change vs the true tide reach (0 = skip)
+} scenario_t;
+
+static uint32_t s_rng;
+
+static double rng_uniform(void) {
+    s_rng ^= s_rng << 13;
+    s_rng ^= s_rng >> 17;
+    s_rng ^= s_rng << 5;
+    return (s_rng + 0.5) / 4294967296.0;
+}
+
+static double rng_gauss(void) {
+    return sqrt(-2.0 * log(rng_uniform())) * cos(2.0 * M_PI * rng_uniform());
+}
+
+/**
+ * True tide height under the swing at t
+ */
+static double tide_depth(const scenario_t *sc, double t) {
+    double c = cos(2.0 * M_PI * t / SIM_TIDE_PERIOD_S);
+    return sc->low_m + sc->range_m / 2.0 * (sc->from_high ? 1.0 + c : 1.0 - c);
+}
+
+static int run(const scenario_t *sc) {
+    anchor_depth_t depth;
+    anchor_depth_init(&depth, sc->rode_m, sc->bow_m);
+    s_rng = sc->seed;
+
+    double ref_true_sum = 0.0;
+    int ref_true_n = 0;
+    double ref_true_m = 0.0;
+    double max_err = 0.0;
+    double flag_s = -1.0;
+    double drag_m = 0.0;
+    float delta = 0.0f;
+
+    printf("== %s\n", sc->name);
+    for (double t = 0.0; t < sc->hours * 3600.0; t += 1.0) {
+        double tide = tide_depth(sc, t);
+        double d = tide + 0.5 * sc->slope_m * sin(2.0 * M_PI * t / sc->swing_s);
+        if (t < SIM_FALLBACK_S) {
+            d += (sc->over_anchor_m - sc->low_m) * (1.0 - t / SIM_FALLBACK_S);
+        }
+        bool dragging = sc->drag_at_s > 0.0 && t >= sc->drag_at_s;
+        if (dragging) {
+            drag_m += sc->drag_mps;
+            d += drag_m;
+        }
+        d += SIM_NOISE_M * rng_gauss();
+        if ((int)t % SIM_BAD_PING_S == SIM_BAD_PING_S - 1) {
+            d = 0.0;
+        }
+
+        bool settled = t >= SIM_SETTLE_S;
+        bool moving_away = dragging ||
+                           (sc->noisy_gate && fmod(t, SIM_GATE_PERIOD_S) < 60.0);
+        bool was_valid = depth.ref_valid;
+        uint32_t t_ms = (uint32_t)(t * 1000.0);
+        uint32_t flags = anchor_depth_add(&depth, (float)d, t_ms, moving_away, settled);
+
+        // The reference is the true tide over the same window the channel averaged
+        if (settled && !was_valid) {
+            ref_true_sum += tide;
+            ref_true_n++;
+            if (depth.ref_valid) {
+                ref_true_m = ref_true_sum / ref_true_n;
+            }
+        }
+        if ((flags & DEPTH_FLAG_TREND) && flag_s < 0.0) {
+            flag_s = t;
+            printf("  t=%6.0f DEPTH_TREND (depth %.2f m)\n", t, depth.depth_m);
+        }
+        if (depth.ref_valid && !dragging) {
+            delta = anchor_depth_radius_delta(&depth, t_ms);
+            double expect = anchor_depth_reach(sc->rode_m, (float)(tide + sc->bow_m)) -
+                            anchor_depth_reach(sc->rode_m, (float)(ref_true_m + sc->bow_m));
+            double err = fabs(delta - expect);
+            if (err > max_err) max_err = err;
+        }
+    }
+
+    // Reference depth back from the reach, to show it is not the depth over the anchor
+    float ref_v = sqrtf(sc->rode_m * sc->rode_m - depth.ref_reach_m * depth.ref_reach_m) - sc->bow_m;
+
+    int failures = 0;
+    failures += ((flag_s >= 0.0) != sc->flag);
+    failures += !depth.ref_valid;
+    failures += (sc->radius_tol_m > 0.0 && max_err > sc->radius_tol_m);
+    printf("  reference depth %.2f m (true %.2f m), radius change %+.2f m, worst error %.2f m -> %s\n\n",
+           ref_v, ref_true_m, delta, max_err, failures ? "FAIL" : "PASS");
+    return failures ? 1 : 0;
+}
+
+int main(void) {
+    static const scenario_t scenarios[] = {
+        { .name = "tide-flood", .seed = 1, .rode_m = 40.0f, .bow_m = 1.0f,
+          .low_m = 4.0, .range_m = 3.0, .over_anchor_m = 3.0, .slope_m = 0.4, .swing_s = 60.0,
+          .noisy_gate = true, .hours = 6.0, .flag = false, .radius_tol_m = 0.3 },
+        { .name = "tide-ebb", .seed = 2, .rode_m = 25.0f, .bow_m = 1.5f,
+          .low_m = 3.0, .range_m = 4.0, .from_high = true, .over_anchor_m = 6.0, .slope_m = 0.4,
+          .swing_s = 90.0, .noisy_gate = true, .hours = 6.0, .flag = false, .radius_tol_m = 0.3 },
+        { .name = "sloping-swing", .seed = 3, .rode_m = 50.0f, .bow_m = 1.0f,
+          .low_m = 6.0, .range_m = 2.0, .over_anchor_m = 5.0, .slope_m = 1.0, .swing_s = 75.0,
+          .noisy_gate = true, .hours = 12.0, .flag = false, .radius_tol_m = 0.3 },
+        { .name = "shoaling-drag", .seed = 4, .rode_m = 40.0f, .bow_m = 1.0f,
+          .low_m = 8.0, .range_m = 2.0, .over_anchor_m = 8.0, .slope_m = 0.4, .swing_s = 60.0,
+          .drag_at_s = 7200.0, .drag_mps = -0.01, .hours = 2.2, .flag = true, .radius_tol_m = 0.3 },
+    };
+
+    int failures = 0;
+    for (size_t i = 0; i < sizeof(scenarios) / sizeof(scenarios[0]); i++) {
+        failures += run(&scenarios[i]);
+    }
+    printf("%d scenario(s) failed\n", failures);
+    return failures;
+}
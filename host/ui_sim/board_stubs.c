@@ -0,0 +1,128 @@
+/**
+ * Board Service Stubs for the Headless UI Target (host)
+ *
+ * Author: Colin Bitterfield
+ * Email: colin@bitterfield.com
+ * Date Created: 2026-10-18
+ * Version: 0.1.0
+ *
+ * Canned answers for the board drivers the screens call (RTC, SD card, power)
+ * so every screen renders with plausible, repeatable content.
+ */
+
+#include "power_management.h"
+#include "sd_card.h"
+#include "rtc_pcf85063a.h"
+#include <stdio.h>
+#include <string.h>
+
+#define STUB_RTC_EPOCH_S        (12 * 3600)     // RTC reads 2026-10-18 12:00:00 at start
+
+typedef struct {
+    const char *name;
+    bool is_directory;
+    uint64_t size;
+} stub_file_t;
+
+static const stub_file_t stub_files[] = {
+    {"logs", true, 0},
+    {"tracks", true, 0},
+    {"anchor_2026-10-17.csv", false, 48213},
+    {"config.json", false, 1337},
+};
+
+static bool s_sd_mounted = true;
+
+// ============================================================================
+// Power management
+// ============================================================================
+
+void power_mgmt_init(void) {
+}
+
+void power_mgmt_sleep(void) {
+    ESP_LOGW("power", "Deep sleep requested (ignored on host)");
+}
+
+bool power_mgmt_is_wake_from_sleep(void) {
+    return false;
+}
+
+esp_sleep_wakeup_cause_t power_mgmt_get_wake_cause(void) {
+    return ESP_SLEEP_WAKEUP_UNDEFINED;
+}
+
+void power_mgmt_set_timer_wakeup(int hours) {
+}
+
+void power_mgmt_save_state(void) {
+}
+
+void power_mgmt_restore_state(void) {
+}
+
+// ============================================================================
+// SD card
+// ============================================================================
+
+bool sd_card_init(void) {
+    s_sd_mounted = true;
+    return true;
+}
+
+void sd_card_deinit(void) {
+    s_sd_mounted = false;
+}
+
+bool sd_card_is_mounted(void) {
+    return s_sd_mounted;
+}
+
+bool sd_card_format(void) {
+    return true;
+}
+
+bool sd_card_get_space(uint64_t *total_bytes, uint64_t *free_bytes) {
+    *total_bytes = 32ULL * 1000 * 1000 * 1000;
+    *free_bytes = 29ULL * 1000 * 1000 * 1000;
+    return true;
+}
+
+bool sd_card_list_dir(const char *path, sd_file_info_t *files, int max_files, int *file_count) {
+    int n = 0;
+    for (size_t i = 0; i < sizeof(stub_files) / sizeof(stub_files[0]) && n < max_files; i++) {
+        snprintf(files[n].name, sizeof(files[n].name), "%s", stub_files[i].name);
+        files[n].is_directory = stub_files[i].is_directory;
+        files[n].size = stub_files[i].size;
+        n++;
+    }
+    *file_count = n;
+    return true;
+}
+
+// ============================================================================
+// RTC (runs on the simulated clock)
+// ============================================================================
+
+void PCF85063A_Init(void) {
+}
+
+void PCF85063A_Set_Time(datetime_t time) {
+}
+
+void PCF85063A_Set_Date(datetime_t date) {
+}
+
+void PCF85063A_Set_All(datetime_t time) {
+}
+
+void PCF85063A_Read_now(datetime_t *time) {
+    uint32_t s = STUB_RTC_EPOCH_S + ui_sim_clock_ms() / 1000;
+    time->year = 2026;
+    time->month = 10;
+    time->day = 18 + (s / 86400) % 10;
+    time->dotw = (s / 86400) % 7;               // 2026-10-18 is a Sunday
+    time->hour = (s / 3600) % 24;
+    time->min = (s / 60) % 60;
+    time->sec = s % 60;
+}
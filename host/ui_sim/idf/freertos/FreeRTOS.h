@@ -0,0 +1,2 @@
+// Host shim: see idf_shim.h
+#include "idf_shim.h"
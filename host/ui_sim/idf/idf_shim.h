@@ -0,0 +1,164 @@
+/**
+ * ESP-IDF Shim for the Headless UI Target (host)
+ *
+ * Author: Colin Bitterfield
+ * Email: colin@bitterfield.com
+ * Date Created: 2026-10-18
+ * Version: 0.1.0
+ *
+ * The few ESP-IDF and FreeRTOS services the UI sources call, reduced to what
+ * a single-threaded host process needs. Every IDF header the UI includes
+ * (esp_log.h, esp_timer.h, freertos/semphr.h, ...) is a one-line file in this
+ * directory that includes this one.
+ *
+ * Time is simulated: esp_timer_get_time(), the cycle counter and the LVGL
+ * tick all read the clock advanced by ui_sim_clock_advance(), so a run
+ * renders the same pixels however fast the host is. Heap and chip queries
+ * return fixed board values for the same reason.
+ */
+
+#ifndef IDF_SHIM_H
+#define IDF_SHIM_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <stdio.h>              // The IDF headers pull these in for their users
+#include <string.h>
+#include "sdkconfig.h"
+
+// ============================================================================
+// Errors
+// ============================================================================
+typedef int esp_err_t;
+
+#define ESP_OK                      0
+#define ESP_FAIL                    -1
+#define ESP_ERR_NO_MEM              0x101
+#define ESP_ERR_INVALID_ARG         0x102
+#define ESP_ERR_INVALID_STATE       0x103
+#define ESP_ERR_INVALID_SIZE        0x104
+#define ESP_ERR_NOT_FOUND           0x105
+#define ESP_ERR_NOT_SUPPORTED       0x106
+#define ESP_ERR_TIMEOUT             0x107
+#define ESP_ERR_NVS_NOT_FOUND       0x1102
+
+const char* esp_err_to_name(esp_err_t code);
+
+// ============================================================================
+// Logging (stderr, filtered by esp_log_level_set)
+// ============================================================================
+typedef enum {
+    ESP_LOG_NONE = 0,
+    ESP_LOG_ERROR,
+    ESP_LOG_WARN,
+    ESP_LOG_INFO,
+    ESP_LOG_DEBUG,
+    ESP_LOG_VERBOSE
+} esp_log_level_t;
+
+void esp_log_level_set(const char *tag, esp_log_level_t level);
+void esp_log_write(esp_log_level_t level, const char *tag, const char *format, ...)
+    __attribute__((format(printf, 3, 4)));
+
+#define ESP_LOGE(tag, format, ...) esp_log_write(ESP_LOG_ERROR, tag, format, ##__VA_ARGS__)
+#define ESP_LOGW(tag, format, ...) esp_log_write(ESP_LOG_WARN, tag, format, ##__VA_ARGS__)
+#define ESP_LOGI(tag, format, ...) esp_log_write(ESP_LOG_INFO, tag, format, ##__VA_ARGS__)
+#define ESP_LOGD(tag, format, ...) esp_log_write(ESP_LOG_DEBUG, tag, format, ##__VA_ARGS__)
+#define ESP_LOGV(tag, format, ...) esp_log_write(ESP_LOG_VERBOSE, tag, format, ##__VA_ARGS__)
+
+// ============================================================================
+// Simulated clock
+// ============================================================================
+/**
+ * Advance the simulated clock
+ * @param ms Milliseconds
+ */
+void ui_sim_clock_advance(uint32_t ms);
+
+/**
+ * Simulated time (LV_TICK_CUSTOM_SYS_TIME_EXPR)
+ * @return Milliseconds since start
+ */
+uint32_t ui_sim_clock_ms(void);
+
+int64_t esp_timer_get_time(void);
+uint32_t esp_cpu_get_cycle_count(void);
+
+// ============================================================================
+// Heap and chip (fixed ESP32-S3 N16R8 values)
+// ============================================================================
+#define MALLOC_CAP_8BIT             (1 << 2)
+#define MALLOC_CAP_DMA              (1 << 3)
+#define MALLOC_CAP_SPIRAM           (1 << 10)
+#define MALLOC_CAP_INTERNAL         (1 << 11)
+
+void* heap_caps_malloc(size_t size, uint32_t caps);
+void* heap_caps_calloc(size_t n, size_t size, uint32_t caps);
+void heap_caps_free(void *ptr);
+size_t heap_caps_get_free_size(uint32_t caps);
+uint32_t esp_get_free_heap_size(void);
+uint32_t esp_get_minimum_free_heap_size(void);
+const char* esp_get_idf_version(void);
+
+#define CHIP_ESP32S3                9
+#define CHIP_FEATURE_EMB_FLASH      (1 << 0)
+#define CHIP_FEATURE_WIFI_BGN       (1 << 1)
+#define CHIP_FEATURE_BLE            (1 << 4)
+#define CHIP_FEATURE_EMB_PSRAM      (1 << 6)
+
+typedef struct {
+    int model;
+    uint32_t features;
+    uint16_t revision;
+    uint8_t cores;
+} esp_chip_info_t;
+
+typedef struct esp_flash_t esp_flash_t;
+
+void esp_chip_info(esp_chip_info_t *out_info);
+esp_err_t esp_flash_get_size(esp_flash_t *chip, uint32_t *out_size);
+
+typedef enum {
+    ESP_SLEEP_WAKEUP_UNDEFINED = 0,
+    ESP_SLEEP_WAKEUP_EXT0 = 2,
+    ESP_SLEEP_WAKEUP_TIMER = 4,
+} esp_sleep_wakeup_cause_t;
+
+// ============================================================================
+// FreeRTOS (one thread: mutexes always succeed)
+// ============================================================================
+typedef uint32_t TickType_t;
+typedef int BaseType_t;
+typedef void* SemaphoreHandle_t;
+typedef void (*gpio_isr_t)(void *arg);
+
+#define pdTRUE                      1
+#define pdFALSE                     0
+#define pdPASS                      pdTRUE
+#define portMAX_DELAY               ((TickType_t)0xffffffffUL)
+#define pdMS_TO_TICKS(ms)           ((TickType_t)(ms))
+
+SemaphoreHandle_t xSemaphoreCreateMutex(void);
+BaseType_t xSemaphoreTake(SemaphoreHandle_t sem, TickType_t ticks);
+BaseType_t xSemaphoreGive(SemaphoreHandle_t sem);
+void vTaskDelay(TickType_t ticks);
+
+// ============================================================================
+// NVS (always empty; writes are accepted and dropped)
+// ============================================================================
+typedef uint32_t nvs_handle_t;
+
+typedef enum {
+    NVS_READONLY,
+    NVS_READWRITE
+} nvs_open_mode_t;
+
+esp_err_t nvs_open(const char *name, nvs_open_mode_t mode, nvs_handle_t *out_handle);
+esp_err_t nvs_get_blob(nvs_handle_t handle, const char *key, void *out_value, size_t *length);
+esp_err_t nvs_set_blob(nvs_handle_t handle, const char *key, const void *value, size_t length);
+esp_err_t nvs_commit(nvs_handle_t handle);
+void nvs_close(nvs_handle_t handle);
+
+#endif // IDF_SHIM_H
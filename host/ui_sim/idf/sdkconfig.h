@@ -0,0 +1,19 @@
+/**
+ * sdkconfig for the Headless UI Target (host)
+ *
+ * Author: Colin Bitterfield
+ * Email: colin@bitterfield.com
+ * Date Created: 2026-10-18
+ * Version: 0.1.0
+ *
+ * The project options the UI sources read, at their firmware values.
+ */
+
+#ifndef SDKCONFIG_H
+#define SDKCONFIG_H
+
+#define CONFIG_IDF_TARGET                   "esp32s3"
+#define CONFIG_ESP_DEFAULT_CPU_FREQ_MHZ     240
+#define CONFIG_ANCHOR_FRAME_STATS_LOG_S     0
+
+#endif // SDKCONFIG_H
@@ -0,0 +1,197 @@
+/**
+ * ESP-IDF Shim Implementation (host)
+ *
+ * Author: Colin Bitterfield
+ * Email: colin@bitterfield.com
+ * Date Created: 2026-10-18
+ * Version: 0.1.0
+ */
+
+#include "idf_shim.h"
+#include "sdkconfig.h"
+#include <stdio.h>
+#include <stdarg.h>
+#include <string.h>
+
+#define SHIM_HEAP_FREE          (220 * 1024)        // Internal heap after boot (typical)
+#define SHIM_HEAP_MIN_FREE      (180 * 1024)
+#define SHIM_PSRAM_FREE         (7 * 1024 * 1024)
+#define SHIM_FLASH_SIZE         (16 * 1024 * 1024)
+#define SHIM_LOG_TAGS           16
+
+typedef struct {
+    char tag[24];
+    esp_log_level_t level;
+} shim_log_tag_t;
+
+static uint64_t s_clock_us = 0;
+static esp_log_level_t s_log_default = ESP_LOG_WARN;
+static shim_log_tag_t s_log_tags[SHIM_LOG_TAGS];
+static int s_log_tag_count = 0;
+static int s_mutex_dummy;
+
+// ============================================================================
+// Errors and logging
+// ============================================================================
+
+const char* esp_err_to_name(esp_err_t code) {
+    switch (code) {
+        case ESP_OK: return "ESP_OK";
+        case ESP_FAIL: return "ESP_FAIL";
+        case ESP_ERR_NO_MEM: return "ESP_ERR_NO_MEM";
+        case ESP_ERR_INVALID_ARG: return "ESP_ERR_INVALID_ARG";
+        case ESP_ERR_INVALID_STATE: return "ESP_ERR_INVALID_STATE";
+        case ESP_ERR_INVALID_SIZE: return "ESP_ERR_INVALID_SIZE";
+        case ESP_ERR_NOT_FOUND: return "ESP_ERR_NOT_FOUND";
+        case ESP_ERR_NOT_SUPPORTED: return "ESP_ERR_NOT_SUPPORTED";
+        case ESP_ERR_TIMEOUT: return "ESP_ERR_TIMEOUT";
+        case ESP_ERR_NVS_NOT_FOUND: return "ESP_ERR_NVS_NOT_FOUND";
+        default: return "UNKNOWN ERROR";
+    }
+}
+
+void esp_log_level_set(const char *tag, esp_log_level_t level) {
+    if (strcmp(tag, "*") == 0) {
+        s_log_default = level;
+        s_log_tag_count = 0;
+        return;
+    }
+    for (int i = 0; i < s_log_tag_count; i++) {
+        if (strcmp(s_log_tags[i].tag, tag) == 0) {
+            s_log_tags[i].level = level;
+            return;
+        }
+    }
+    if (s_log_tag_count < SHIM_LOG_TAGS) {
+        snprintf(s_log_tags[s_log_tag_count].tag, sizeof(s_log_tags[0].tag), "%s", tag);
+        s_log_tags[s_log_tag_count].level = level;
+        s_log_tag_count++;
+    }
+}
+
+void esp_log_write(esp_log_level_t level, const char *tag, const char *format, ...) {
+    esp_log_level_t limit = s_log_default;
+    for (int i = 0; i < s_log_tag_count; i++) {
+        if (strcmp(s_log_tags[i].tag, tag) == 0) {
+            limit = s_log_tags[i].level;
+            break;
+        }
+    }
+    if (level > limit) return;
+
+    static const char letters[] = "NEWIDV";
+    fprintf(stderr, "%c (%u) %s: ", letters[level], (unsigned int)ui_sim_clock_ms(), tag);
+    va_list args;
+    va_start(args, format);
+    vfprintf(stderr, format, args);
+    va_end(args);
+    fputc('\n', stderr);
+}
+
+// ============================================================================
+// Simulated clock
+// ============================================================================
+
+void ui_sim_clock_advance(uint32_t ms) {
+    s_clock_us += (uint64_t)ms * 1000;
+}
+
+uint32_t ui_sim_clock_ms(void) {
+    return (uint32_t)(s_clock_us / 1000);
+}
+
+int64_t esp_timer_get_time(void) {
+    return (int64_t)s_clock_us;
+}
+
+uint32_t esp_cpu_get_cycle_count(void) {
+    return (uint32_t)(s_clock_us * CONFIG_ESP_DEFAULT_CPU_FREQ_MHZ);
+}
+
+// ============================================================================
+// Heap and chip
+// ============================================================================
+
+void* heap_caps_malloc(size_t size, uint32_t caps) {
+    return malloc(size);
+}
+
+void* heap_caps_calloc(size_t n, size_t size, uint32_t caps) {
+    return calloc(n, size);
+}
+
+void heap_caps_free(void *ptr) {
+    free(ptr);
+}
+
+size_t heap_caps_get_free_size(uint32_t caps) {
+    return (caps & MALLOC_CAP_SPIRAM) ? SHIM_PSRAM_FREE : SHIM_HEAP_FREE;
+}
+
+uint32_t esp_get_free_heap_size(void) {
+    return SHIM_HEAP_FREE + SHIM_PSRAM_FREE;
+}
+
+uint32_t esp_get_minimum_free_heap_size(void) {
+    return SHIM_HEAP_MIN_FREE + SHIM_PSRAM_FREE;
+}
+
+const char* esp_get_idf_version(void) {
+    return "v5.5.1-host";
+}
+
+void esp_chip_info(esp_chip_info_t *out_info) {
+    out_info->model = CHIP_ESP32S3;
+    out_info->features = CHIP_FEATURE_WIFI_BGN | CHIP_FEATURE_BLE;
+    out_info->revision = 2;
+    out_info->cores = 2;
+}
+
+esp_err_t esp_flash_get_size(esp_flash_t *chip, uint32_t *out_size) {
+    *out_size = SHIM_FLASH_SIZE;
+    return ESP_OK;
+}
+
+// ============================================================================
+// FreeRTOS
+// ============================================================================
+
+SemaphoreHandle_t xSemaphoreCreateMutex(void) {
+    return &s_mutex_dummy;
+}
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t sem, TickType_t ticks) {
+    return pdTRUE;
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t sem) {
+    return pdTRUE;
+}
+
+void vTaskDelay(TickType_t ticks) {
+    ui_sim_clock_advance(ticks);
+}
+
+// ============================================================================
+// NVS
+// ============================================================================
+
+esp_err_t nvs_open(const char *name, nvs_open_mode_t mode, nvs_handle_t *out_handle) {
+    *out_handle = 1;
+    return mode == NVS_READONLY ? ESP_ERR_NVS_NOT_FOUND : ESP_OK;
+}
+
+esp_err_t nvs_get_blob(nvs_handle_t handle, const char *key, void *out_value, size_t *length) {
+    return ESP_ERR_NVS_NOT_FOUND;
+}
+
+esp_err_t nvs_set_blob(nvs_handle_t handle, const char *key, const void *value, size_t length) {
+    return ESP_OK;
+}
+
+esp_err_t nvs_commit(nvs_handle_t handle) {
+    return ESP_OK;
+}
+
+void nvs_close(nvs_handle_t handle) {
+}
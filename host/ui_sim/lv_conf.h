@@ -0,0 +1,80 @@
+/**
+ * LVGL Configuration for the Headless UI Target (host)
+ *
+ * Author: Colin Bitterfield
+ * Email: colin@bitterfield.com
+ * Date Created: 2026-10-18
+ * Version: 0.1.0
+ *
+ * LVGL 8.4 settings matching the firmware's sdkconfig (CONFIG_LV_*) so the
+ * host renders the same pixels as the panel. Only values that differ from
+ * the LVGL 8.4 defaults are listed; lv_conf_internal.h fills in the rest.
+ * The one host-only change is the tick: it comes from the simulated clock.
+ */
+
+#ifndef LV_CONF_H
+#define LV_CONF_H
+
+#include <stdint.h>
+
+// Color settings
+#define LV_COLOR_DEPTH                  16
+#define LV_COLOR_16_SWAP                0
+
+// Memory settings
+#define LV_MEM_CUSTOM                   1
+#define LV_MEM_CUSTOM_INCLUDE           <stdlib.h>
+#define LV_MEM_CUSTOM_ALLOC             malloc
+#define LV_MEM_CUSTOM_FREE              free
+#define LV_MEM_CUSTOM_REALLOC           realloc
+#define LV_MEMCPY_MEMSET_STD            1
+
+// HAL settings
+#define LV_DISP_DEF_REFR_PERIOD         30
+#define LV_INDEV_DEF_READ_PERIOD        30
+#define LV_DPI_DEF                      130
+#define LV_TICK_CUSTOM                  1
+#define LV_TICK_CUSTOM_INCLUDE          "idf_shim.h"
+#define LV_TICK_CUSTOM_SYS_TIME_EXPR    (ui_sim_clock_ms())
+
+// Drawing
+#define LV_DRAW_COMPLEX                 1
+#define LV_SHADOW_CACHE_SIZE            0
+#define LV_CIRCLE_CACHE_SIZE            4
+#define LV_LAYER_SIMPLE_BUF_SIZE        (24 * 1024)
+#define LV_IMG_CACHE_DEF_SIZE           0
+#define LV_GRADIENT_MAX_STOPS           2
+#define LV_GRAD_CACHE_DEF_SIZE          0
+#define LV_DISP_ROT_MAX_BUF             (10 * 1024)
+
+// Logging, asserts, others
+#define LV_USE_LOG                      0
+#define LV_USE_ASSERT_NULL              1
+#define LV_USE_ASSERT_MALLOC            1
+#define LV_USE_PERF_MONITOR             0
+#define LV_USE_USER_DATA                1
+
+// Fonts (the project's own fonts are compiled from main/fonts)
+#define LV_FONT_MONTSERRAT_14           1
+#define LV_FONT_DEFAULT                 &lv_font_montserrat_14
+
+// Text
+#define LV_TXT_ENC                      LV_TXT_ENC_UTF8
+#define LV_LABEL_TEXT_SELECTION         1
+#define LV_LABEL_LONG_TXT_HINT          1
+
+// Themes
+#define LV_USE_THEME_DEFAULT            1
+#define LV_THEME_DEFAULT_DARK           0
+#define LV_THEME_DEFAULT_GROW           1
+#define LV_THEME_DEFAULT_TRANSITION_TIME 80
+#define LV_USE_THEME_BASIC              1
+
+// Layouts
+#define LV_USE_FLEX                     1
+#define LV_USE_GRID                     1
+
+// Others
+#define LV_USE_SNAPSHOT                 1
+
+#endif // LV_CONF_H
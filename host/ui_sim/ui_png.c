@@ -0,0 +1,118 @@
+/**
+ * PNG Snapshots Implementation (host)
+ *
+ * Author: Colin Bitterfield
+ * Email: colin@bitterfield.com
+ * Date Created: 2026-10-18
+ * Version: 0.1.0
+ */
+
+#include "ui_png.h"
+#include <png.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/**
+ * RGB565 to RGB888 (bit replication: 0x1F -> 0xFF, 0 -> 0)
+ */
+static uint8_t* ui_png_to_rgb(const uint16_t *fb, int width, int height) {
+    uint8_t *rgb = malloc((size_t)width * height * 3);
+    if (rgb == NULL) return NULL;
+
+    uint8_t *p = rgb;
+    for (int i = 0; i < width * height; i++) {
+        uint16_t c = fb[i];
+        uint8_t r = (c >> 11) & 0x1F;
+        uint8_t g = (c >> 5) & 0x3F;
+        uint8_t b = c & 0x1F;
+        *p++ = (uint8_t)((r << 3) | (r >> 2));
+        *p++ = (uint8_t)((g << 2) | (g >> 4));
+        *p++ = (uint8_t)((b << 3) | (b >> 2));
+    }
+    return rgb;
+}
+
+/**
+ * Write an RGB565 frame as a PNG
+ */
+bool ui_png_write(const char *path, const uint16_t *fb, int width, int height) {
+    uint8_t *rgb = ui_png_to_rgb(fb, width, height);
+    if (rgb == NULL) return false;
+
+    png_image image;
+    memset(&image, 0, sizeof(image));
+    image.version = PNG_IMAGE_VERSION;
+    image.width = (png_uint_32)width;
+    image.height = (png_uint_32)height;
+    image.format = PNG_FORMAT_RGB;
+
+    bool ok = png_image_write_to_file(&image, path, 0, rgb, 0, NULL) != 0;
+    if (!ok) {
+        fprintf(stderr, "%s: %s\n", path, image.message);
+    }
+    free(rgb);
+    return ok;
+}
+
+/**
+ * Compare an RGB565 frame with a golden PNG
+ */
+bool ui_png_compare(const char *path, const uint16_t *fb, int width, int height,
+                    uint8_t tolerance, ui_png_diff_t *diff) {
+    png_image image;
+    memset(&image, 0, sizeof(image));
+    image.version = PNG_IMAGE_VERSION;
+
+    if (!png_image_begin_read_from_file(&image, path)) {
+        fprintf(stderr, "%s: %s\n", path, image.message);
+        return false;
+    }
+    if (image.width != (png_uint_32)width || image.height != (png_uint_32)height) {
+        fprintf(stderr, "%s: %ux%u, frame is %dx%d\n", path, (unsigned int)image.width,
+                (unsigned int)image.height, width, height);
+        png_image_free(&image);
+        return false;
+    }
+
+    image.format = PNG_FORMAT_RGB;
+    uint8_t *golden = malloc(PNG_IMAGE_SIZE(image));
+    uint8_t *frame = ui_png_to_rgb(fb, width, height);
+    bool ok = golden != NULL && frame != NULL &&
+              png_image_finish_read(&image, NULL, golden, 0, NULL) != 0;
+    if (!ok) {
+        fprintf(stderr, "%s: %s\n", path, image.message[0] ? image.message : "out of memory");
+        png_image_free(&image);
+        free(golden);
+        free(frame);
+        return false;
+    }
+
+    memset(diff, 0, sizeof(*diff));
+    diff->x0 = width;
+    diff->y0 = height;
+    diff->x1 = -1;
+    diff->y1 = -1;
+    for (int y = 0; y < height; y++) {
+        for (int x = 0; x < width; x++) {
+            const uint8_t *a = &golden[((size_t)y * width + x) * 3];
+            const uint8_t *b = &frame[((size_t)y * width + x) * 3];
+            uint8_t delta = 0;
+            for (int c = 0; c < 3; c++) {
+                uint8_t d = (uint8_t)(a[c] > b[c] ? a[c] - b[c] : b[c] - a[c]);
+                if (d > delta) delta = d;
+            }
+            if (delta > diff->max_delta) diff->max_delta = delta;
+            if (delta <= tolerance) continue;
+
+            diff->diff_pixels++;
+            if (x < diff->x0) diff->x0 = x;
+            if (y < diff->y0) diff->y0 = y;
+            if (x > diff->x1) diff->x1 = x;
+            if (y > diff->y1) diff->y1 = y;
+        }
+    }
+    free(golden);
+    free(frame);
+    return true;
+}
@@ -0,0 +1,50 @@
+/**
+ * PNG Snapshots for the Headless UI Target (host)
+ *
+ * Author: Colin Bitterfield
+ * Email: colin@bitterfield.com
+ * Date Created: 2026-10-18
+ * Version: 0.1.0
+ *
+ * Writes RGB565 frame buffers as 8-bit RGB PNGs (libpng) and compares a
+ * frame against a golden PNG. RGB565 widens to RGB888 by bit replication,
+ * so a golden written by ui_png_write() reads back to the exact frame and
+ * a tolerance of 0 is a pixel-exact comparison.
+ */
+
+#ifndef UI_PNG_H
+#define UI_PNG_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+typedef struct {
+    uint32_t diff_pixels;       // Pixels differing by more than the tolerance
+    uint8_t max_delta;          // Largest channel difference seen
+    int x0, y0, x1, y1;         // Bounding box of the differing pixels (x1 < x0 = none)
+} ui_png_diff_t;
+
+/**
+ * Write an RGB565 frame as a PNG
+ * @param path Output file
+ * @param fb Frame buffer (width * height pixels, no padding)
+ * @param width Frame width
+ * @param height Frame height
+ * @return false on an I/O or libpng error
+ */
+bool ui_png_write(const char *path, const uint16_t *fb, int width, int height);
+
+/**
+ * Compare an RGB565 frame with a golden PNG
+ * @param path Golden file
+ * @param fb Frame buffer
+ * @param width Frame width
+ * @param height Frame height
+ * @param tolerance Largest channel difference (0-255) still counted as equal
+ * @param diff Result (filled when the golden could be read)
+ * @return false if the golden is missing, unreadable or a different size
+ */
+bool ui_png_compare(const char *path, const uint16_t *fb, int width, int height,
+                    uint8_t tolerance, ui_png_diff_t *diff);
+
+#endif // UI_PNG_H
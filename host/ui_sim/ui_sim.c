@@ -0,0 +1,487 @@
+/**
+ * Headless UI Target (host)
+ *
+ * Author: Colin Bitterfield
+ * Email: colin@bitterfield.com
+ * Date Created: 2026-10-18
+ * Date Updated: 2026-10-18
+ * Version: 0.1.1
+ *
+ * Changelog:
+ * - 0.1.1 (2026-10-18): Firmware blend hooks (lvgl_draw_hooks) on by default, --no-blend-hooks
+ *
+ * Runs the firmware's screens (screens.c, the shared header and footer, the
+ * screen manager and the anchor watch) on LVGL 8.4 with an 800x480 RGB565
+ * memory frame buffer in direct mode, as on the panel, and a scripted touch
+ * input. Nothing is shown; frames go to PNG files and timing to stdout.
+ *
+ *   ui_sim --screens --out /tmp/screens             # every screen to PNG
+ *   ui_sim --screens --golden host/ui_sim/golden    # compare with the goldens
+ *   ui_sim --screens --golden host/ui_sim/golden --update
+ *   ui_sim --golden host/ui_sim/golden host/ui_sim/scripts/anchor-watch.tch
+ *
+ * --screens loads each registered screen, lets it settle, then times a full
+ * redraw. A touch script (one command per line, # comments) drives taps and
+ * drags frame by frame and reports the render time of every frame that drew
+ * something:
+ *   load NAME              Load a screen by its registered name (START, TOOLS, ...)
+ *   tap X Y                Press and release
+ *   press X Y / move X Y / release
+ *   drag X0 Y0 X1 Y1 MS    Press, move over MS milliseconds, release
+ *   wait MS                Run frames for MS of simulated time
+ *   footer                 Show the footer (the swipe-up gesture in main.c)
+ *   fix LAT LON            Feed a GPS fix to the anchor watch
+ *   anchor                 Set the anchor at the last fix
+ *   snap NAME              Snapshot the frame (compared or written like a screen)
+ *
+ * The display uses the firmware's blend hooks (lvgl_draw_hooks.c) with the
+ * host C kernels; --no-blend-hooks renders with LVGL's own loops. Goldens
+ * must match both ways, and --screens gives the before/after redraw times.
+ *
+ * Time is simulated (idf_shim.h), so frames are repeatable and a golden
+ * mismatch means the UI changed. Render times are host wall-clock times:
+ * compare them between builds on the same machine, not with the panel.
+ * Exit status: 0 all matched, 1 a golden differed or was missing, 2 usage or
+ * script error.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <getopt.h>
+#include <time.h>
+#include "lvgl.h"
+#include "board_config.h"
+#include "screens.h"
+#include "ui_footer.h"
+#include "ui_status.h"
+#include "ui_screen_mgr.h"
+#include "lvgl_draw_hooks.h"
+#include "anchor_watch.h"
+#include "sd_card.h"
+#include "ui_png.h"
+#include "idf_shim.h"
+
+#define SIM_WIDTH               LCD_WIDTH
+#define SIM_HEIGHT              LCD_HEIGHT
+#define SIM_FRAME_MS            LV_DISP_DEF_REFR_PERIOD
+#define SIM_SETTLE_MS           600         // After a load: transitions, async deletes
+#define SIM_TAP_FRAMES          2           // Frames held down and up for a tap
+#define SIM_LINE_MAX            256
+#define SIM_PATH_MAX            512
+
+typedef struct {
+    double *ms;                 // Render time of each frame that drew
+    uint32_t *px;               // Pixels flushed by that frame
+    uint32_t count;
+    uint32_t cap;
+} sim_timing_t;
+
+typedef struct {
+    const char *golden_dir;     // Compare with (or --update: write to) this directory
+    const char *out_dir;        // Also write every snapshot here
+    bool update;
+    uint8_t tolerance;
+    uint32_t snaps;
+    uint32_t failures;
+} sim_snap_cfg_t;
+
+static uint16_t s_fb[SIM_WIDTH * SIM_HEIGHT];
+static lv_disp_draw_buf_t s_draw_buf;
+static lv_disp_drv_t s_disp_drv;
+static lv_indev_drv_t s_indev_drv;
+static uint32_t s_frame_px = 0;             // Pixels flushed since the frame started
+static lv_point_t s_touch_point = {0, 0};
+static bool s_touch_down = false;
+static sim_snap_cfg_t s_snap;
+
+static double wall_ms(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000.0 + ts.tv_nsec / 1e6;
+}
+
+// ============================================================================
+// Display and touch drivers
+// ============================================================================
+
+/**
+ * Direct mode: LVGL already drew into s_fb, only count the area
+ */
+static void sim_flush_cb(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t *color_map) {
+    s_frame_px += (uint32_t)lv_area_get_size(area);
+    lv_disp_flush_ready(drv);
+}
+
+static void sim_touch_read_cb(lv_indev_drv_t *drv, lv_indev_data_t *data) {
+    data->point = s_touch_point;
+    data->state = s_touch_down ? LV_INDEV_STATE_PRESSED : LV_INDEV_STATE_RELEASED;
+}
+
+static void sim_drivers_init(void) {
+    lv_disp_draw_buf_init(&s_draw_buf, s_fb, NULL, SIM_WIDTH * SIM_HEIGHT);
+
+    lv_disp_drv_init(&s_disp_drv);
+    s_disp_drv.hor_res = SIM_WIDTH;
+    s_disp_drv.ver_res = SIM_HEIGHT;
+    s_disp_drv.flush_cb = sim_flush_cb;
+    s_disp_drv.draw_buf = &s_draw_buf;
+    s_disp_drv.direct_mode = 1;
+    lvgl_draw_hooks_init(&s_disp_drv);
+    lv_disp_drv_register(&s_disp_drv);
+
+    lv_indev_drv_init(&s_indev_drv);
+    s_indev_drv.type = LV_INDEV_TYPE_POINTER;
+    s_indev_drv.read_cb = sim_touch_read_cb;
+    lv_indev_drv_register(&s_indev_drv);
+}
+
+// ============================================================================
+// Frames and timing
+// ============================================================================
+
+static void sim_timing_add(sim_timing_t *t, double ms, uint32_t px) {
+    if (t->count == t->cap) {
+        t->cap = t->cap ? t->cap * 2 : 256;
+        t->ms = realloc(t->ms, t->cap * sizeof(*t->ms));
+        t->px = realloc(t->px, t->cap * sizeof(*t->px));
+        if (t->ms == NULL || t->px == NULL) {
+            fprintf(stderr, "out of memory\n");
+            exit(2);
+        }
+    }
+    t->ms[t->count] = ms;
+    t->px[t->count] = px;
+    t->count++;
+}
+
+static int cmp_double(const void *a, const void *b) {
+    double x = *(const double *)a, y = *(const double *)b;
+    return (x > y) - (x < y);
+}
+
+static void sim_timing_report(const char *name, sim_timing_t *t) {
+    if (t->count == 0) {
+        printf("%-24s no frames drawn\n", name);
+        return;
+    }
+    uint64_t px = 0;
+    for (uint32_t i = 0; i < t->count; i++) {
+        px += t->px[i];
+    }
+    qsort(t->ms, t->count, sizeof(*t->ms), cmp_double);
+    printf("%-24s %5u frames  p50 %6.2f  p95 %6.2f  p99 %6.2f  max %6.2f ms  %6.1f kpx/frame\n",
+           name, (unsigned int)t->count, t->ms[t->count / 2], t->ms[t->count * 95 / 100],
+           t->ms[t->count * 99 / 100], t->ms[t->count - 1], px / 1000.0 / t->count);
+}
+
+/**
+ * One display period: advance the clock and run the LVGL handler
+ */
+static void sim_frame(sim_timing_t *timing) {
+    ui_sim_clock_advance(SIM_FRAME_MS);
+    s_frame_px = 0;
+    double start = wall_ms();
+    lv_timer_handler();
+    double elapsed = wall_ms() - start;
+    if (timing != NULL && s_frame_px > 0) {
+        sim_timing_add(timing, elapsed, s_frame_px);
+    }
+}
+
+static void sim_run_ms(uint32_t ms, sim_timing_t *timing) {
+    for (uint32_t t = 0; t < ms; t += SIM_FRAME_MS) {
+        sim_frame(timing);
+    }
+}
+
+// ============================================================================
+// Snapshots
+// ============================================================================
+
+/**
+ * Compare the frame with its golden (or write it) and print the result
+ */
+static bool sim_snap(const char *name) {
+    char path[SIM_PATH_MAX];
+    bool ok = true;
+    s_snap.snaps++;
+
+    if (s_snap.out_dir != NULL) {
+        snprintf(path, sizeof(path), "%s/%s.png", s_snap.out_dir, name);
+        if (!ui_png_write(path, s_fb, SIM_WIDTH, SIM_HEIGHT)) ok = false;
+    }
+    if (s_snap.golden_dir == NULL) {
+        printf("  %s\n", s_snap.out_dir == NULL ? "-" : ok ? "written" : "WRITE FAILED");
+    } else if (s_snap.update) {
+        snprintf(path, sizeof(path), "%s/%s.png", s_snap.golden_dir, name);
+        ok = ui_png_write(path, s_fb, SIM_WIDTH, SIM_HEIGHT) && ok;
+        printf("  %s\n", ok ? "golden updated" : "WRITE FAILED");
+    } else {
+        ui_png_diff_t diff;
+        snprintf(path, sizeof(path), "%s/%s.png", s_snap.golden_dir, name);
+        if (!ui_png_compare(path, s_fb, SIM_WIDTH, SIM_HEIGHT, s_snap.tolerance, &diff)) {
+            printf("  NO GOLDEN\n");
+            ok = false;
+        } else if (diff.diff_pixels > 0) {
+            printf("  DIFF %u px (max delta %u) in %d,%d - %d,%d\n", (unsigned int)diff.diff_pixels,
+                   (unsigned int)diff.max_delta, diff.x0, diff.y0, diff.x1, diff.y1);
+            ok = false;
+        } else {
+            printf("  ok\n");
+        }
+    }
+    if (!ok) {
+        s_snap.failures++;
+    }
+    return ok;
+}
+
+// ============================================================================
+// Screen sweep
+// ============================================================================
+
+/**
+ * Load every registered screen, time its build and a full redraw, snapshot it
+ */
+static void sim_sweep_screens(void) {
+    printf("%-16s %6s %10s %10s\n", "screen", "objs", "build ms", "redraw ms");
+    for (int id = 0; id < SCREEN_COUNT; id++) {
+        const char *name = ui_screen_name(id);
+        if (name == NULL) continue;
+
+        double start = wall_ms();
+        lv_obj_t *screen = ui_screen_get(id);
+        double build_ms = wall_ms() - start;
+        if (screen == NULL) {
+            printf("%-16s build failed\n", name);
+            s_snap.failures++;
+            continue;
+        }
+        ui_screen_load(id);
+        sim_run_ms(SIM_SETTLE_MS, NULL);
+
+        lv_obj_invalidate(lv_scr_act());
+        start = wall_ms();
+        lv_refr_now(NULL);
+        double redraw_ms = wall_ms() - start;
+
+        ui_screen_stats_t stats;
+        ui_screen_get_stats(id, &stats);
+        printf("%-16s %6u %10.2f %10.2f", name, (unsigned int)stats.objects, build_ms, redraw_ms);
+        sim_snap(name);
+    }
+}
+
+// ============================================================================
+// Touch scripts
+// ============================================================================
+
+static int sim_screen_by_name(const char *name) {
+    for (int id = 0; id < SCREEN_COUNT; id++) {
+        const char *n = ui_screen_name(id);
+        if (n != NULL && strcasecmp(n, name) == 0) return id;
+    }
+    return UI_SCREEN_NONE;
+}
+
+static void sim_touch(bool down, int x, int y, int frames, sim_timing_t *timing) {
+    s_touch_down = down;
+    s_touch_point.x = (lv_coord_t)x;
+    s_touch_point.y = (lv_coord_t)y;
+    for (int i = 0; i < frames; i++) {
+        sim_frame(timing);
+    }
+}
+
+/**
+ * Run one command line
+ * @return false on a syntax error or unknown screen
+ */
+static bool sim_script_line(char *line, sim_timing_t *timing) {
+    char cmd[32], arg[64];
+    double a = 0, b = 0, c = 0, d = 0, e = 0;
+    int n = sscanf(line, "%31s %lf %lf %lf %lf %lf", cmd, &a, &b, &c, &d, &e);
+    if (n < 1) return true;
+
+    if (strcmp(cmd, "tap") == 0 && n == 3) {
+        sim_touch(true, (int)a, (int)b, SIM_TAP_FRAMES, timing);
+        sim_touch(false, (int)a, (int)b, SIM_TAP_FRAMES, timing);
+    } else if (strcmp(cmd, "press") == 0 && n == 3) {
+        sim_touch(true, (int)a, (int)b, 1, timing);
+    } else if (strcmp(cmd, "move") == 0 && n == 3) {
+        sim_touch(s_touch_down, (int)a, (int)b, 1, timing);
+    } else if (strcmp(cmd, "release") == 0 && n == 1) {
+        sim_touch(false, s_touch_point.x, s_touch_point.y, 1, timing);
+    } else if (strcmp(cmd, "drag") == 0 && n == 6) {
+        int steps = (int)(e / SIM_FRAME_MS);
+        if (steps < 1) steps = 1;
+        sim_touch(true, (int)a, (int)b, 1, timing);
+        for (int i = 1; i <= steps; i++) {
+            sim_touch(true, (int)(a + (c - a) * i / steps), (int)(b + (d - b) * i / steps), 1, timing);
+        }
+        sim_touch(false, (int)c, (int)d, SIM_TAP_FRAMES, timing);
+    } else if (strcmp(cmd, "wait") == 0 && n == 2) {
+        sim_run_ms((uint32_t)a, timing);
+    } else if (strcmp(cmd, "footer") == 0 && n == 1) {
+        ui_footer_show(ui_footer_get());
+        sim_frame(timing);
+    } else if (strcmp(cmd, "fix") == 0 && n == 3) {
+        anchor_watch_feed_fix(ANCHOR_SOURCE_N2K, a, b);
+    } else if (strcmp(cmd, "anchor") == 0 && n == 1) {
+        if (!anchor_watch_set_anchor_here()) {
+            fprintf(stderr, "anchor: no position fix yet\n");
+            return false;
+        }
+    } else if ((strcmp(cmd, "load") == 0 || strcmp(cmd, "snap") == 0) &&
+               sscanf(line, "%31s %63s", cmd, arg) == 2) {
+        if (cmd[0] == 's') {
+            printf("  snap %-28s", arg);
+            sim_snap(arg);
+            return true;
+        }
+        int id = sim_screen_by_name(arg);
+        if (id == UI_SCREEN_NONE || !ui_screen_load(id)) {
+            fprintf(stderr, "load: unknown screen %s\n", arg);
+            return false;
+        }
+        sim_frame(timing);
+    } else {
+        return false;
+    }
+    return true;
+}
+
+/**
+ * Run a touch script and report its frame times
+ * @return false on a script error
+ */
+static bool sim_run_script(const char *path) {
+    FILE *f = fopen(path, "r");
+    if (f == NULL) {
+        perror(path);
+        return false;
+    }
+
+    const char *base = strrchr(path, '/');
+    base = base ? base + 1 : path;
+    printf("script %s\n", base);
+
+    sim_timing_t timing = {0};
+    char line[SIM_LINE_MAX];
+    int line_no = 0;
+    bool ok = true;
+    while (ok && fgets(line, sizeof(line), f) != NULL) {
+        line_no++;
+        char *hash = strchr(line, '#');
+        if (hash != NULL) *hash = '\0';
+        if (!sim_script_line(line, &timing)) {
+            fprintf(stderr, "%s:%d: bad command: %s\n", path, line_no, line);
+            ok = false;
+        }
+    }
+    fclose(f);
+
+    sim_timing_report(base, &timing);
+    free(timing.ms);
+    free(timing.px);
+    return ok;
+}
+
+// ============================================================================
+// Main
+// ============================================================================
+
+/**
+ * Firmware UI bring-up (main.c order): status model, footer, screens
+ */
+static void sim_page_callback(ui_page_t page) {
+    ui_screen_load(page);
+}
+
+static bool sim_ui_init(void) {
+    lv_init();
+    sim_drivers_init();
+
+    if (anchor_watch_init() != ESP_OK || ui_status_init() != ESP_OK ||
+        ui_screen_mgr_init() != ESP_OK || screens_register(sim_page_callback) != ESP_OK) {
+        fprintf(stderr, "UI initialization failed\n");
+        return false;
+    }
+    if (ui_footer_init(sim_page_callback) == NULL) {
+        fprintf(stderr, "Footer initialization failed\n");
+        return false;
+    }
+    ui_status_set_time(12, 0, 0);
+    ui_status_set_flag(UI_STATUS_SD, sd_card_is_mounted());
+
+    ui_screen_load(SCREEN_START);
+    sim_run_ms(SIM_SETTLE_MS, NULL);
+    return true;
+}
+
+static void usage(const char *prog) {
+    fprintf(stderr,
+            "usage: %s [options] [script.tch ...]\n"
+            "  --screens        load, time and snapshot every registered screen\n"
+            "  --golden DIR     compare snapshots with DIR/<name>.png\n"
+            "  --update         write the snapshots to the --golden directory instead\n"
+            "  --out DIR        also write every snapshot to DIR/<name>.png\n"
+            "  --tolerance N    largest channel difference still equal (0)\n"
+            "  --no-blend-hooks render with LVGL's own blend loops\n"
+            "  --verbose        firmware logs at info level (warnings only)\n",
+            prog);
+}
+
+int main(int argc, char **argv) {
+    static const struct option options[] = {
+        { "screens",   no_argument,       NULL, 's' },
+        { "golden",    required_argument, NULL, 'g' },
+        { "update",    no_argument,       NULL, 'u' },
+        { "out",       required_argument, NULL, 'o' },
+        { "tolerance", required_argument, NULL, 't' },
+        { "verbose",   no_argument,       NULL, 'v' },
+        { "no-blend-hooks", no_argument,  NULL, 'n' },
+        { NULL, 0, NULL, 0 }
+    };
+
+    bool sweep = false;
+    int opt;
+    while ((opt = getopt_long(argc, argv, "", options, NULL)) != -1) {
+        switch (opt) {
+            case 's': sweep = true; break;
+            case 'g': s_snap.golden_dir = optarg; break;
+            case 'u': s_snap.update = true; break;
+            case 'o': s_snap.out_dir = optarg; break;
+            case 't': s_snap.tolerance = (uint8_t)atoi(optarg); break;
+            case 'v': esp_log_level_set("*", ESP_LOG_INFO); break;
+            case 'n': lvgl_draw_hooks_enable(false); break;
+            default:
+                usage(argv[0]);
+                return 2;
+        }
+    }
+    if ((!sweep && optind >= argc) || (s_snap.update && s_snap.golden_dir == NULL)) {
+        usage(argv[0]);
+        return 2;
+    }
+
+    if (!sim_ui_init()) {
+        return 2;
+    }
+    if (sweep) {
+        sim_sweep_screens();
+    }
+    for (int i = optind; i < argc; i++) {
+        if (!sim_run_script(argv[i])) {
+            return 2;
+        }
+    }
+
+    if (s_snap.golden_dir != NULL && !s_snap.update) {
+        printf("%u of %u snapshots match\n", (unsigned int)(s_snap.snaps - s_snap.failures),
+               (unsigned int)s_snap.snaps);
+    }
+    return s_snap.failures > 0 ? 1 : 0;
+}
@@ -0,0 +1,96 @@
+/**
+ * Heading-Based Anchor Triangulation Implementation
+ *
+ * Author: Colin Bitterfield
+ * Email: colin@bitterfield.com
+ * Date Created: 2026-10-18
+ * Version: 0.1.0
+ */
+
+#include "anchor_bearing.h"
+#include <string.h>
+#include <math.h>
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+/**
+ * Add (sign = +1) or remove (sign = -1) one line from the running sums
+ */
+static void bearing_accumulate(anchor_bearing_t *brg, const bearing_sample_t *s, double sign) {
+    // Heading h points along (sin h, cos h) in ENU; the normal is (cos h, -sin h)
+    double nx = cos(s->heading_rad);
+    double ny = -sin(s->heading_rad);
+    double c = nx * s->east_m + ny * s->north_m;
+
+    brg->s_xx += sign * nx * nx;
+    brg->s_xy += sign * nx * ny;
+    brg->s_yy += sign * ny * ny;
+    brg->s_bx += sign * nx * c;
+    brg->s_by += sign * ny * c;
+    brg->s_cc += sign * c * c;
+}
+
+/**
+ * Initialise an empty estimator
+ */
+void anchor_bearing_init(anchor_bearing_t *brg) {
+    memset(brg, 0, sizeof(*brg));
+}
+
+/**
+ * Add one bow bearing line
+ */
+void anchor_bearing_add(anchor_bearing_t *brg, float east_m, float north_m, float heading_deg) {
+    bearing_sample_t *slot = &brg->ring[brg->head];
+
+    if (brg->count == BEARING_WINDOW) {
+        bearing_accumulate(brg, slot, -1.0);
+    } else {
+        brg->count++;
+    }
+
+    slot->east_m = east_m;
+    slot->north_m = north_m;
+    slot->heading_rad = heading_deg * (float)(M_PI / 180.0);
+    bearing_accumulate(brg, slot, 1.0);
+
+    brg->head = (uint16_t)((brg->head + 1) % BEARING_WINDOW);
+}
+
+/**
+ * Solve for the anchor position
+ */
+bool anchor_bearing_estimate(const anchor_bearing_t *brg, bearing_estimate_t *est) {
+    memset(est, 0, sizeof(*est));
+    if (brg->count < BEARING_MIN_SAMPLES) {
+        return false;
+    }
+
+    double a = brg->s_xx, b = brg->s_xy, d = brg->s_yy;
+    double det = a * d - b * b;
+    double tr = a + d;
+
+    // Eigenvalue ratio lmin/lmax of the symmetric 2x2 - how well the lines fan out
+    double disc = sqrt(fmax(0.0, 0.25 * tr * tr - det));
+    double lmax = 0.5 * tr + disc;
+    double lmin = 0.5 * tr - disc;
+    est->spread = (lmax > 0.0) ? (float)(lmin / lmax) : 0.0f;
+    if (est->spread < BEARING_MIN_SPREAD) {
+        return false;
+    }
+
+    double x = (d * brg->s_bx - b * brg->s_by) / det;
+    double y = (a * brg->s_by - b * brg->s_bx) / det;
+
+    // sum (n.x - n.p)^2 = x'Ax - 2 x'b + sum c^2
+    double res = a * x * x + 2.0 * b * x * y + d * y * y
+               - 2.0 * (x * brg->s_bx + y * brg->s_by) + brg->s_cc;
+
+    est->east_m = (float)x;
+    est->north_m = (float)y;
+    est->rms_m = (float)sqrt(fmax(0.0, res) / brg->count);
+    est->valid = true;
+    return true;
+}
@@ -0,0 +1,86 @@
+/**
+ * Heading-Based Anchor Triangulation
+ *
+ * Author: Colin Bitterfield
+ * Email: colin@bitterfield.com
+ * Date Created: 2026-10-18
+ * Version: 0.1.0
+ *
+ * With the rode taut the bow points roughly at the anchor, so every
+ * (position, heading) pair is a line passing near it. As the boat swings the
+ * lines fan out and their least-squares intersection is an anchor position
+ * estimate that is independent of the circle fit (anchor_circle.h).
+ *
+ * For a line through p with unit normal n the squared miss distance of x is
+ * (n.(x - p))^2. Summing over the window gives the 2x2 normal equations
+ *     [sum n n^T] x = sum n n^T p
+ * which are kept as running sums over a sliding window: a new sample adds its
+ * terms, the evicted sample subtracts its terms - O(1) per sample.
+ *
+ * Headings must be true (apply variation to PGN 127250 magnetic headings).
+ * Pure C (no ESP-IDF dependencies) so it can be compiled on the host.
+ */
+
+#ifndef ANCHOR_BEARING_H
+#define ANCHOR_BEARING_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define BEARING_WINDOW          120     // Samples in the sliding window (2 min at 1 Hz)
+#define BEARING_MIN_SAMPLES     30      // Samples before an estimate is attempted
+#define BEARING_MIN_SPREAD      0.05f   // Min eigenvalue ratio of the normal matrix (~13 deg fan)
+
+// One stored line (re-derived on eviction, keeps the window at 12 bytes/sample)
+typedef struct {
+    float east_m;           // Boat position
+    float north_m;
+    float heading_rad;      // True heading (radians)
+} bearing_sample_t;
+
+typedef struct {
+    bearing_sample_t ring[BEARING_WINDOW];
+    uint16_t head;          // Next slot to write
+    uint16_t count;         // Samples in the window
+    // Running sums of the normal equations (double: add/subtract must cancel)
+    double s_xx;            // sum nx*nx
+    double s_xy;            // sum nx*ny
+    double s_yy;            // sum ny*ny
+    double s_bx;            // sum nx*(n.p)
+    double s_by;            // sum ny*(n.p)
+    double s_cc;            // sum (n.p)^2 (for the residual)
+} anchor_bearing_t;
+
+// Estimate result
+typedef struct {
+    bool valid;             // Enough samples and spread for a stable solution
+    float east_m;           // Estimated anchor position (ENU)
+    float north_m;
+    float rms_m;            // RMS miss distance of the lines
+    float spread;           // Eigenvalue ratio (0 = parallel lines, 1 = isotropic fan)
+} bearing_estimate_t;
+
+/**
+ * Initialise an empty estimator
+ * @param brg Estimator
+ */
+void anchor_bearing_init(anchor_bearing_t *brg);
+
+/**
+ * Add one bow bearing line - O(1)
+ * @param brg Estimator
+ * @param east_m Boat east offset (metres)
+ * @param north_m Boat north offset (metres)
+ * @param heading_deg True heading (degrees)
+ */
+void anchor_bearing_add(anchor_bearing_t *brg, float east_m, float north_m, float heading_deg);
+
+/**
+ * Solve for the anchor position - O(1)
+ * @param brg Estimator
+ * @param est Output estimate (valid = false if not solvable yet)
+ * @return true if est->valid
+ */
+bool anchor_bearing_estimate(const anchor_bearing_t *brg, bearing_estimate_t *est);
+
+#endif // ANCHOR_BEARING_H
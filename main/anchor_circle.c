@@ -0,0 +1,102 @@
+/**
+ * Swing Circle Fit Implementation
+ *
+ * Author: Colin Bitterfield
+ * Email: colin@bitterfield.com
+ * Date Created: 2026-10-18
+ * Version: 0.1.0
+ */
+
+#include "anchor_circle.h"
+#include <string.h>
+#include <math.h>
+
+/**
+ * 3x3 determinant (row-major)
+ */
+static double circle_det3(const double m[9]) {
+    return m[0] * (m[4] * m[8] - m[5] * m[7])
+         - m[1] * (m[3] * m[8] - m[5] * m[6])
+         + m[2] * (m[3] * m[7] - m[4] * m[6]);
+}
+
+/**
+ * Initialise an empty fit
+ */
+void anchor_circle_init(anchor_circle_t *fit) {
+    memset(fit, 0, sizeof(*fit));
+}
+
+/**
+ * Add one position
+ */
+void anchor_circle_add(anchor_circle_t *fit, float east_m, float north_m) {
+    double x = east_m;
+    double y = north_m;
+    double z = x * x + y * y;
+
+    fit->n++;
+    fit->sx += x;
+    fit->sy += y;
+    fit->sxx += x * x;
+    fit->sxy += x * y;
+    fit->syy += y * y;
+    fit->sz += z;
+    fit->sxz += x * z;
+    fit->syz += y * z;
+    fit->szz += z * z;
+}
+
+/**
+ * Solve the fit (Cramer's rule on the 3x3 normal equations)
+ */
+bool anchor_circle_estimate(const anchor_circle_t *fit, circle_estimate_t *est) {
+    memset(est, 0, sizeof(*est));
+    if (fit->n < CIRCLE_MIN_FIXES) {
+        return false;
+    }
+
+    double n = (double)fit->n;
+    double m[9] = {
+        fit->sxx, fit->sxy, fit->sx,
+        fit->sxy, fit->syy, fit->sy,
+        fit->sx,  fit->sy,  n
+    };
+    double r[3] = { -fit->sxz, -fit->syz, -fit->sz };
+
+    double det = circle_det3(m);
+    // Relative to the scale of the moments - a collinear track is singular
+    double scale = fit->sxx * fit->syy * n;
+    if (scale <= 0.0 || fabs(det) < 1e-9 * scale) {
+        return false;
+    }
+
+    double sol[3];
+    for (int c = 0; c < 3; c++) {
+        double mc[9];
+        memcpy(mc, m, sizeof(mc));
+        mc[c] = r[0];
+        mc[3 + c] = r[1];
+        mc[6 + c] = r[2];
+        sol[c] = circle_det3(mc) / det;
+    }
+
+    double D = sol[0], E = sol[1], F = sol[2];
+    double r2 = 0.25 * (D * D + E * E) - F;
+    if (r2 <= 0.0) {
+        return false;
+    }
+
+    // Algebraic residual sum (z + Dx + Ey + F)^2 expanded over the moment sums;
+    // divided by 4r^2 it approximates the squared radial residual
+    double res = fit->szz + D * D * fit->sxx + E * E * fit->syy + F * F * n
+               + 2.0 * (D * fit->sxz + E * fit->syz + F * fit->sz
+                        + D * E * fit->sxy + D * F * fit->sx + E * F * fit->sy);
+
+    est->east_m = (float)(-0.5 * D);
+    est->north_m = (float)(-0.5 * E);
+    est->radius_m = (float)sqrt(r2);
+    est->rms_m = (float)sqrt(fmax(0.0, res) / (4.0 * r2 * n));
+    est->valid = true;
+    return true;
+}
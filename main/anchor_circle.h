@@ -0,0 +1,67 @@
+/**
+ * Swing Circle Fit
+ *
+ * Author: Colin Bitterfield
+ * Email: colin@bitterfield.com
+ * Date Created: 2026-10-18
+ * Version: 0.1.0
+ *
+ * A boat swinging on a taut rode moves along an arc centred on the anchor.
+ * The algebraic (Kasa) circle fit minimises sum (x^2 + y^2 + Dx + Ey + F)^2,
+ * whose normal equations only need running moment sums - O(1) per fix and a
+ * 3x3 solve per estimate. Centre = (-D/2, -E/2), r^2 = (D^2 + E^2)/4 - F.
+ *
+ * Used as the primary anchor position estimate and cross-checked against
+ * the heading triangulation (anchor_bearing.h).
+ *
+ * Pure C (no ESP-IDF dependencies) so it can be compiled on the host.
+ */
+
+#ifndef ANCHOR_CIRCLE_H
+#define ANCHOR_CIRCLE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define CIRCLE_MIN_FIXES        30      // Fixes before a fit is attempted
+
+typedef struct {
+    uint32_t n;             // Fixes accumulated
+    // Moment sums (double - z = x^2 + y^2 grows quickly)
+    double sx, sy;
+    double sxx, sxy, syy;
+    double sz, sxz, syz, szz;
+} anchor_circle_t;
+
+// Fit result
+typedef struct {
+    bool valid;             // Solvable with a real radius
+    float east_m;           // Fitted centre (ENU)
+    float north_m;
+    float radius_m;         // Fitted radius
+    float rms_m;            // Approximate RMS radial residual
+} circle_estimate_t;
+
+/**
+ * Initialise an empty fit
+ * @param fit Fit accumulator
+ */
+void anchor_circle_init(anchor_circle_t *fit);
+
+/**
+ * Add one position - O(1)
+ * @param fit Fit accumulator
+ * @param east_m East offset (metres)
+ * @param north_m North offset (metres)
+ */
+void anchor_circle_add(anchor_circle_t *fit, float east_m, float north_m);
+
+/**
+ * Solve the fit - O(1)
+ * @param fit Fit accumulator
+ * @param est Output estimate (valid = false if not solvable yet)
+ * @return true if est->valid
+ */
+bool anchor_circle_estimate(const anchor_circle_t *fit, circle_estimate_t *est);
+
+#endif // ANCHOR_CIRCLE_H
@@ -0,0 +1,156 @@
+/**
+ * Depth Channel and Scope Radius Implementation
+ *
+ * Author: Colin Bitterfield
+ * Email: colin@bitterfield.com
+ * Date Created: 2026-10-18
+ * Date Updated: 2026-10-18
+ * Version: 0.2.0
+ *
+ * Changelog:
+ * - 0.2.0 (2026-10-18): Reference reach and trend buckets start once the fall-back has settled;
+ *   slow trend starts from zero instead of one bucket's slope
+ */
+
+#include "anchor_depth.h"
+#include <string.h>
+#include <math.h>
+
+/**
+ * Median of the filter ring (insertion sort of at most DEPTH_MEDIAN_N values)
+ */
+static float depth_median(const anchor_depth_t *depth) {
+    float v[DEPTH_MEDIAN_N];
+    int n = depth->ring_count;
+
+    for (int i = 0; i < n; i++) {
+        float x = depth->ring[i];
+        int j = i - 1;
+        while (j >= 0 && v[j] > x) {
+            v[j + 1] = v[j];
+            j--;
+        }
+        v[j + 1] = x;
+    }
+    return v[n / 2];
+}
+
+/**
+ * Close a 10 s bucket and update the trends
+ */
+static void depth_close_bucket(anchor_depth_t *depth, float mean_m, float dt_s, bool moving_away) {
+    if (depth->buckets > 0 && dt_s > 0.0f) {
+        float slope = (mean_m - depth->last_bucket_m) / dt_s;
+        float a_fast = dt_s / (DEPTH_FAST_S + dt_s);
+        float a_slow = dt_s / (DEPTH_SLOW_S + dt_s);
+
+        // Slow trend starts from zero: a tide moves the depth under a tenth of DEPTH_TREND_MPS,
+        // while a seed from the first buckets would carry their swing for 30 min
+        if (depth->buckets == 1) {
+            depth->fast_mps = slope;
+        } else {
+            depth->fast_mps += a_fast * (slope - depth->fast_mps);
+        }
+        depth->slow_mps += a_slow * (slope - depth->slow_mps);
+    }
+
+    depth->last_bucket_m = mean_m;
+    if (depth->buckets < UINT16_MAX) {
+        depth->buckets++;
+    }
+
+    // A trend step only counts while the boat is also moving off the anchor
+    if (depth->buckets >= DEPTH_MIN_BUCKETS && moving_away &&
+        fabsf(depth->fast_mps - depth->slow_mps) > DEPTH_TREND_MPS) {
+        if (depth->trend_run < UINT8_MAX) depth->trend_run++;
+    } else {
+        depth->trend_run = 0;
+    }
+}
+
+/**
+ * Initialise an empty depth channel
+ */
+void anchor_depth_init(anchor_depth_t *depth, float rode_m, float bow_height_m) {
+    memset(depth, 0, sizeof(*depth));
+    depth->rode_m = rode_m;
+    depth->bow_height_m = bow_height_m;
+}
+
+/**
+ * Add one depth sample
+ */
+uint32_t anchor_depth_add(anchor_depth_t *depth, float depth_m, uint32_t t_ms, bool moving_away,
+                          bool settled) {
+    depth->ring[depth->ring_head] = depth_m;
+    depth->ring_head = (uint8_t)((depth->ring_head + 1) % DEPTH_MEDIAN_N);
+    if (depth->ring_count < DEPTH_MEDIAN_N) {
+        depth->ring_count++;
+    }
+
+    depth->depth_m = depth_median(depth);
+    depth->depth_ms = t_ms;
+    depth->valid = true;
+
+    // Reference reach: the mean filtered depth over DEPTH_REF_MS once settled. The first
+    // samples come while the boat falls back over the anchor and are not its depth.
+    if (!depth->ref_valid && settled && depth->rode_m > 0.0f) {
+        if (depth->ref_n == 0) {
+            depth->ref_start_ms = t_ms;
+        }
+        depth->ref_sum += depth->depth_m;
+        depth->ref_n++;
+        if ((t_ms - depth->ref_start_ms) >= DEPTH_REF_MS) {
+            depth->ref_reach_m = anchor_depth_reach(depth->rode_m,
+                                                    depth->ref_sum / (float)depth->ref_n +
+                                                    depth->bow_height_m);
+            depth->ref_valid = true;
+        }
+    }
+
+    // Trend buckets also wait for the settle: the fall-back slope would seed the slow trend
+    if (!settled) {
+        depth->flags = 0;
+        return depth->flags;
+    }
+    if (!depth->started) {
+        depth->bucket_start_ms = t_ms;
+        depth->started = true;
+    }
+    depth->bucket_sum += depth->depth_m;
+    depth->bucket_n++;
+
+    uint32_t elapsed = t_ms - depth->bucket_start_ms;
+    if (elapsed >= DEPTH_BUCKET_MS) {
+        depth_close_bucket(depth, depth->bucket_sum / (float)depth->bucket_n,
+                           (float)elapsed / 1000.0f, moving_away);
+        depth->bucket_start_ms = t_ms;
+        depth->bucket_sum = 0.0f;
+        depth->bucket_n = 0;
+    }
+
+    depth->flags = (depth->trend_run >= DEPTH_TREND_BUCKETS) ? DEPTH_FLAG_TREND : 0;
+    return depth->flags;
+}
+
+/**
+ * Horizontal reach of the rode at a depth
+ */
+float anchor_depth_reach(float rode_m, float vertical_m) {
+    if (vertical_m >= rode_m) {
+        return 0.0f;
+    }
+    return sqrtf(rode_m * rode_m - vertical_m * vertical_m);
+}
+
+/**
+ * Change in horizontal reach since the reference depth
+ */
+float anchor_depth_radius_delta(const anchor_depth_t *depth, uint32_t t_ms) {
+    if (!depth->ref_valid || !depth->valid || (t_ms - depth->depth_ms) > DEPTH_MAX_AGE_MS) {
+        return 0.0f;
+    }
+
+    float reach = anchor_depth_reach(depth->rode_m, depth->depth_m + depth->bow_height_m);
+    return reach - depth->ref_reach_m;
+}
@@ -0,0 +1,117 @@
+/**
+ * Depth Channel and Scope Radius
+ *
+ * Author: Colin Bitterfield
+ * Email: colin@bitterfield.com
+ * Date Created: 2026-10-18
+ * Date Updated: 2026-10-18
+ * Version: 0.2.0
+ *
+ * Changelog:
+ * - 0.2.0 (2026-10-18): Reference reach from the mean filtered depth over
+ *   DEPTH_REF_MS once the boat has settled, not the first sample. Trend
+ *   buckets also start at the settle
+ *
+ * Water depth (PGN 128267 / $SDDBT) feeds two things:
+ * - Scope radius: the horizontal reach of the rode is sqrt(L^2 - v^2), where
+ *   v = depth + bow height. As the tide rises the reach shrinks, and as it
+ *   falls the reach grows. The alarm radius is moved by that change from the
+ *   reference: the mean filtered depth over DEPTH_REF_MS once the boat has
+ *   fallen back onto the rode. Until then the radius is not adjusted.
+ * - Depth trend: the slow trend (tide) is compared with the fast trend. A
+ *   step away from the tide rate while the boat is moving away from the
+ *   anchor is a drag indicator (dragging into deeper or shallower water).
+ *   Buckets start once the boat has settled, so the fall-back does not seed
+ *   the tide trend.
+ *
+ * Raw samples pass a 5-sample median filter so a single bad ping is dropped.
+ * They are then averaged into 10 s buckets. Every step is O(1).
+ * Pure C (no ESP-IDF dependencies) so it can be compiled on the host.
+ */
+
+#ifndef ANCHOR_DEPTH_H
+#define ANCHOR_DEPTH_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define DEPTH_MEDIAN_N          5       // Median filter length (samples)
+#define DEPTH_BUCKET_MS         10000   // Trend sample interval
+#define DEPTH_MAX_AGE_MS        10000   // Depth older than this is ignored
+#define DEPTH_FAST_S            60.0f   // Fast trend time constant
+#define DEPTH_SLOW_S            1800.0f // Slow (tide) trend time constant
+#define DEPTH_TREND_MPS         0.005f  // Fast/slow trend difference flagged (0.3 m/min)
+#define DEPTH_TREND_BUCKETS     3       // Consecutive buckets beyond the limit before flagging
+#define DEPTH_MIN_BUCKETS       12      // Buckets before the trend is trusted (2 min)
+#define DEPTH_REF_MS            120000  // Settled depth averaged for the reference reach
+
+// Result flags from anchor_depth_add()
+#define DEPTH_FLAG_TREND        (1u << 0)   // Depth trend departed from the tide trend
+
+typedef struct {
+    // Median filter
+    float ring[DEPTH_MEDIAN_N];
+    uint8_t ring_head;
+    uint8_t ring_count;
+    bool valid;
+    float depth_m;              // Latest filtered depth
+    uint32_t depth_ms;          // Time of latest sample
+    // Decimation
+    bool started;
+    uint32_t bucket_start_ms;
+    float bucket_sum;
+    uint16_t bucket_n;
+    float last_bucket_m;        // Previous bucket mean
+    uint16_t buckets;           // Buckets closed so far
+    // Trend (m/s, + = getting deeper)
+    float fast_mps;
+    float slow_mps;
+    uint8_t trend_run;
+    // Scope
+    float rode_m;               // Rode paid out (0 = unknown, radius not adjusted)
+    float bow_height_m;         // Bow roller height above the waterline
+    bool ref_valid;
+    float ref_reach_m;          // Horizontal reach at the settled reference depth
+    uint32_t ref_start_ms;      // First settled sample
+    float ref_sum;              // Filtered depths summed since then
+    uint32_t ref_n;
+    uint32_t flags;
+} anchor_depth_t;
+
+/**
+ * Initialise an empty depth channel
+ * @param depth Depth channel
+ * @param rode_m Rode paid out (metres, 0 = unknown)
+ * @param bow_height_m Bow roller height above the waterline (metres)
+ */
+void anchor_depth_init(anchor_depth_t *depth, float rode_m, float bow_height_m);
+
+/**
+ * Add one depth sample - O(1)
+ * @param depth Depth channel
+ * @param depth_m Water depth (metres, transducer offset already applied)
+ * @param t_ms Timestamp (milliseconds)
+ * @param moving_away true while the boat is drifting away from the anchor
+ * @param settled true once the boat has fallen back onto the rode
+ * @return DEPTH_FLAG_* bitmask
+ */
+uint32_t anchor_depth_add(anchor_depth_t *depth, float depth_m, uint32_t t_ms, bool moving_away,
+                          bool settled);
+
+/**
+ * Horizontal reach of the rode at a depth (Pythagorean scope)
+ * @param rode_m Rode length (metres)
+ * @param vertical_m Depth plus bow height (metres)
+ * @return Horizontal reach (metres, 0 if the rode is too short)
+ */
+float anchor_depth_reach(float rode_m, float vertical_m);
+
+/**
+ * Change in horizontal reach since the reference depth
+ * @param depth Depth channel
+ * @param t_ms Timestamp (milliseconds)
+ * @return Metres to add to the alarm radius (0 if unknown or stale)
+ */
+float anchor_depth_radius_delta(const anchor_depth_t *depth, uint32_t t_ms);
+
+#endif // ANCHOR_DEPTH_H
@@ -0,0 +1,184 @@
+/**
+ * Drag Rate Estimator Implementation
+ *
+ * Author: Colin Bitterfield
+ * Email: colin@bitterfield.com
+ * Date Created: 2026-10-18
+ * Date Updated: 2026-10-18
+ * Version: 0.2.0
+ *
+ * Changelog:
+ * - 0.2.0 (2026-10-18): Fit the newest span_n samples (swing-period span),
+ *   count rising fits
+ * - 0.1.1 (2026-10-18): Keep the newest sample in last_d_m
+ */
+
+#include "anchor_dragrate.h"
+#include <string.h>
+#include <math.h>
+
+/**
+ * k-th smallest element (Hoare quickselect, reorders the array) - O(n) average
+ */
+static float dragrate_select(float *a, int n, int k) {
+    int lo = 0;
+    int hi = n - 1;
+
+    while (lo < hi) {
+        float pivot = a[(lo + hi) / 2];
+        int i = lo;
+        int j = hi;
+        while (i <= j) {
+            while (a[i] < pivot) i++;
+            while (a[j] > pivot) j--;
+            if (i <= j) {
+                float tmp = a[i];
+                a[i] = a[j];
+                a[j] = tmp;
+                i++;
+                j--;
+            }
+        }
+        if (k <= j) {
+            hi = j;
+        } else if (k >= i) {
+            lo = i;
+        } else {
+            break;
+        }
+    }
+    return a[k];
+}
+
+/**
+ * Median (upper median for even n)
+ */
+static float dragrate_median(float *a, int n) {
+    return dragrate_select(a, n, n / 2);
+}
+
+/**
+ * Theil-Sen fit over the newest span_n samples
+ */
+static void dragrate_fit(anchor_dragrate_t *dr) {
+    int n = dr->span_n;
+    if (dr->count < n) {
+        dr->valid = false;
+        dr->rising = 0;
+        return;
+    }
+
+    // Pairwise slopes (slot of the k-th newest sample: newest - k)
+    int newest = (dr->head + DRAGRATE_WINDOW - 1) % DRAGRATE_WINDOW;
+    int m = 0;
+    for (int i = 0; i < n; i++) {
+        int a = (newest + DRAGRATE_WINDOW - i) % DRAGRATE_WINDOW;
+        for (int j = i + 1; j < n; j++) {
+            int b = (newest + DRAGRATE_WINDOW - j) % DRAGRATE_WINDOW;
+            float dt = dr->t_s[a] - dr->t_s[b];
+            if (dt != 0.0f) {
+                dr->scratch[m++] = (dr->d_m[a] - dr->d_m[b]) / dt;
+            }
+        }
+    }
+    if (m == 0) {
+        dr->valid = false;
+        dr->rising = 0;
+        return;
+    }
+    float slope = dragrate_median(dr->scratch, m);
+
+    // Intercept: median residual, evaluated at the newest sample
+    float t_new = dr->t_s[newest];
+    for (int i = 0; i < n; i++) {
+        int a = (newest + DRAGRATE_WINDOW - i) % DRAGRATE_WINDOW;
+        dr->scratch[i] = dr->d_m[a] - slope * (dr->t_s[a] - t_new);
+    }
+
+    dr->rate_mps = slope;
+    dr->fit_d_m = dragrate_median(dr->scratch, n);
+    dr->fit_t_ms = dr->t0_ms + (uint32_t)(t_new * 1000.0f);
+    dr->valid = true;
+    if (slope < DRAGRATE_MIN_MPS) {
+        dr->rising = 0;
+    } else if (dr->rising < DRAGRATE_PERSIST) {
+        dr->rising++;
+    }
+}
+
+/**
+ * Initialise an empty estimator
+ */
+void anchor_dragrate_init(anchor_dragrate_t *dr) {
+    memset(dr, 0, sizeof(*dr));
+    dr->span_n = DRAGRATE_WINDOW;
+}
+
+/**
+ * Set the swing period the fit has to average out
+ */
+void anchor_dragrate_set_period(anchor_dragrate_t *dr, float period_s) {
+    float span_s = DRAGRATE_SWING_PERIODS * period_s;
+    if (span_s < DRAGRATE_SPAN_MIN_S) {
+        span_s = DRAGRATE_SPAN_MIN_S;
+    }
+    int n = (int)ceilf(span_s * 1000.0f / (float)DRAGRATE_DECIMATE_MS);
+    dr->span_n = (uint8_t)((n < DRAGRATE_WINDOW) ? n : DRAGRATE_WINDOW);
+}
+
+/**
+ * Add one distance-from-anchor measurement
+ */
+bool anchor_dragrate_add(anchor_dragrate_t *dr, float dist_m, uint32_t t_ms) {
+    if (!dr->started) {
+        dr->t0_ms = t_ms;
+        dr->bucket_start_ms = t_ms;
+        dr->started = true;
+    }
+
+    dr->bucket_sum += dist_m;
+    dr->bucket_n++;
+
+    if ((t_ms - dr->bucket_start_ms) < DRAGRATE_DECIMATE_MS) {
+        return false;
+    }
+
+    // Close the bucket: one sample at its mid-time
+    uint32_t mid_ms = dr->bucket_start_ms + (t_ms - dr->bucket_start_ms) / 2;
+    dr->t_s[dr->head] = (float)(mid_ms - dr->t0_ms) / 1000.0f;
+    dr->d_m[dr->head] = dr->bucket_sum / (float)dr->bucket_n;
+    dr->last_d_m = dr->d_m[dr->head];
+    dr->head = (uint8_t)((dr->head + 1) % DRAGRATE_WINDOW);
+    if (dr->count < DRAGRATE_WINDOW) {
+        dr->count++;
+    }
+
+    dr->bucket_start_ms = t_ms;
+    dr->bucket_sum = 0.0f;
+    dr->bucket_n = 0;
+
+    dragrate_fit(dr);
+    return true;
+}
+
+/**
+ * Whether the boat is moving away from the anchor, not just swinging
+ */
+bool anchor_dragrate_is_rising(const anchor_dragrate_t *dr) {
+    return dr->valid && dr->rising >= DRAGRATE_PERSIST;
+}
+
+/**
+ * Predict seconds until a boundary distance is reached
+ */
+float anchor_dragrate_time_to(const anchor_dragrate_t *dr, float boundary_m, uint32_t t_ms) {
+    if (!anchor_dragrate_is_rising(dr)) {
+        return -1.0f;
+    }
+
+    float now_d = dr->fit_d_m + dr->rate_mps * (float)(t_ms - dr->fit_t_ms) / 1000.0f;
+    if (now_d >= boundary_m) {
+        return 0.0f;
+    }
+    return (boundary_m - now_d) / dr->rate_mps;
+}
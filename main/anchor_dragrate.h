@@ -0,0 +1,109 @@
+/**
+ * Drag Rate Estimator and Time-to-Boundary Prediction
+ *
+ * Author: Colin Bitterfield
+ * Email: colin@bitterfield.com
+ * Date Created: 2026-10-18
+ * Date Updated: 2026-10-18
+ * Version: 0.2.0
+ *
+ * Changelog:
+ * - 0.2.0 (2026-10-18): Fit span follows the swing period (8 min window);
+ *   a crossing is predicted only after DRAGRATE_PERSIST rising fits
+ * - 0.1.1 (2026-10-18): last_d_m (newest 10 s mean distance) for the engine's settle check
+ *
+ * Estimates the radial drift velocity (distance from anchor per second) with
+ * the Theil-Sen estimator: the median of all pairwise slopes, which ignores
+ * up to ~29% outliers (GPS jumps, multipath) without any tuning.
+ *
+ * Cost is bounded by decimation: distances are averaged into one sample per
+ * DRAGRATE_DECIMATE_MS and only DRAGRATE_WINDOW samples are kept, so each
+ * re-estimate is at most 1128 slopes plus a quickselect, every 10 seconds.
+ *
+ * A swinging boat moves in and out on every swing, and a fit over part of
+ * a swing reads that as a drag. The fit therefore spans
+ * DRAGRATE_SWING_PERIODS swing periods (anchor_swing.h), at least
+ * DRAGRATE_SPAN_MIN_S and at most the whole window. Until a period is known
+ * it spans the whole window. A rate is only reported once the window covers
+ * the span, and a crossing is only predicted after DRAGRATE_PERSIST fits in
+ * a row have moved away at DRAGRATE_MIN_MPS or more.
+ *
+ * Pure C (no ESP-IDF dependencies) so it can be compiled on the host.
+ */
+
+#ifndef ANCHOR_DRAGRATE_H
+#define ANCHOR_DRAGRATE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define DRAGRATE_WINDOW         48      // Decimated samples kept (8 min)
+#define DRAGRATE_DECIMATE_MS    10000   // Averaging bucket per sample
+#define DRAGRATE_SPAN_MIN_S     240.0f  // Shortest fitted span (no swing, or a fast one)
+#define DRAGRATE_SWING_PERIODS  3.0f    // Fitted span in swing periods
+#define DRAGRATE_PERSIST        6       // Rising fits in a row before a crossing is predicted (1 min)
+#define DRAGRATE_MIN_MPS        0.02f   // Slower than this is not a drag (1.2 m/min)
+#define DRAGRATE_PAIRS          (DRAGRATE_WINDOW * (DRAGRATE_WINDOW - 1) / 2)
+
+typedef struct {
+    float t_s[DRAGRATE_WINDOW];     // Sample time since first sample (seconds)
+    float d_m[DRAGRATE_WINDOW];     // Mean distance in the bucket (metres)
+    uint8_t head;                   // Next slot to write
+    uint8_t count;                  // Samples in the window
+    uint8_t span_n;                 // Samples fitted (newest first)
+    uint32_t t0_ms;                 // Time base for t_s
+    uint32_t bucket_start_ms;       // Start of the open bucket
+    float bucket_sum;               // Sum of distances in the open bucket
+    uint16_t bucket_n;              // Fixes in the open bucket
+    bool started;                   // t0_ms / bucket_start_ms valid
+    float last_d_m;                 // Mean distance of the newest sample
+    float scratch[DRAGRATE_PAIRS];  // Pairwise slopes / residuals (median workspace)
+    // Latest estimate
+    bool valid;                     // Rate available
+    float rate_mps;                 // Radial velocity (+ = moving away from anchor)
+    float fit_d_m;                  // Fitted distance at fit_t_ms
+    uint32_t fit_t_ms;              // Time of the newest sample
+    uint8_t rising;                 // Fits in a row at or above DRAGRATE_MIN_MPS
+} anchor_dragrate_t;
+
+/**
+ * Initialise an empty estimator
+ * @param dr Estimator
+ */
+void anchor_dragrate_init(anchor_dragrate_t *dr);
+
+/**
+ * Set the swing period the fit has to average out - O(1), takes effect at the
+ * next estimate
+ * @param dr Estimator
+ * @param period_s Dominant swing period (0 = no swing, fit DRAGRATE_SPAN_MIN_S)
+ */
+void anchor_dragrate_set_period(anchor_dragrate_t *dr, float period_s);
+
+/**
+ * Add one distance-from-anchor measurement
+ * @param dr Estimator
+ * @param dist_m Distance from anchor (metres)
+ * @param t_ms Timestamp (milliseconds)
+ * @return true if a new estimate was computed (once per bucket)
+ */
+bool anchor_dragrate_add(anchor_dragrate_t *dr, float dist_m, uint32_t t_ms);
+
+/**
+ * Whether the boat is moving away from the anchor, not just swinging
+ * @param dr Estimator
+ * @return true after DRAGRATE_PERSIST fits in a row at DRAGRATE_MIN_MPS or more
+ */
+bool anchor_dragrate_is_rising(const anchor_dragrate_t *dr);
+
+/**
+ * Predict seconds until a boundary distance is reached
+ * @param dr Estimator
+ * @param boundary_m Alarm boundary distance (metres)
+ * @param t_ms Current time (milliseconds)
+ * @return Seconds to boundary (0 if already beyond), or -1 if no crossing predicted
+ *         (not rising, see anchor_dragrate_is_rising)
+ */
+float anchor_dragrate_time_to(const anchor_dragrate_t *dr, float boundary_m, uint32_t t_ms);
+
+#endif // ANCHOR_DRAGRATE_H
@@ -0,0 +1,499 @@
+/**
+ * Anchor Drag Detection Engine Implementation
+ *
+ * Author: Colin Bitterfield
+ * Email: colin@bitterfield.com
+ * Date Created: 2026-10-18
+ * Date Updated: 2026-10-18
+ * Version: 0.2.8
+ *
+ * Changelog:
+ * - 0.2.8 (2026-10-18): Depth reference reach taken once the fall-back has settled
+ * - 0.2.7 (2026-10-18): No re-anchor switch while alarmed, only a suggestion
+ * - 0.2.6 (2026-10-18): A lie or wind shift also relearns the wind model's lie
+ * - 0.2.5 (2026-10-18): Radius alarm needs the boat outside for
+ *   radius_hold_ms (ANCHOR_RADIUS_HOLD_MS, or the noise profile's best averaging time)
+ * - 0.2.4 (2026-10-18): Envelope grows only while the drag rate is not rising
+ * - 0.2.3 (2026-10-18): Safe polygon learns only while the drag rate is not
+ *   rising; restarts when the boat's lie (smoothed heading) or the wind shifts
+ * - 0.2.2 (2026-10-18): Safe polygon restarts once the fall-back has settled,
+ *   no polygon alarms before that
+ * - 0.2.1 (2026-10-18): Envelope alarms off by default; envelope cells sized
+ *   from the noise profile
+ * - 0.2.0 (2026-10-18): Drag rate restarts once settled and fits over the
+ *   swing period; depth gate needs a persistent rise
+ * - 0.1.1 (2026-10-18): Agreeing estimates end ARMING only after
+ *   ANCHOR_ARMING_MIN_MS and once the fall-back has settled
+ */
+
+#include "anchor_engine.h"
+#include "board_config.h"
+#include <string.h>
+#include <math.h>
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+/**
+ * Compare the circle fit with the heading triangulation
+ */
+static void anchor_engine_cross_check(anchor_engine_t *eng) {
+    anchor_circle_estimate(&eng->circle, &eng->circle_est);
+    anchor_bearing_estimate(&eng->bearing, &eng->bearing_est);
+
+    if (!eng->circle_est.valid || !eng->bearing_est.valid) {
+        eng->check = ANCHOR_CHECK_UNKNOWN;
+        return;
+    }
+
+    float de = eng->circle_est.east_m - eng->bearing_est.east_m;
+    float dn = eng->circle_est.north_m - eng->bearing_est.north_m;
+    eng->check = (de * de + dn * dn <= ANCHOR_CROSSCHECK_TOL_M * ANCHOR_CROSSCHECK_TOL_M)
+               ? ANCHOR_CHECK_AGREE : ANCHOR_CHECK_MISMATCH;
+}
+
+/**
+ * Fit the drag rate and time polygon excursions over the swing period once
+ * the swing has been analysed
+ */
+static void anchor_engine_drag_span(anchor_engine_t *eng) {
+    if (eng->swing.analyses == 0) {
+        return;     // Period unknown: the estimator fits its whole window
+    }
+    float period_s = (eng->swing.result.cls == SWING_CLASS_OSCILLATING)
+                     ? eng->swing.result.period_s : 0.0f;
+    anchor_dragrate_set_period(&eng->dragrate, period_s);
+    anchor_hull_set_period(&eng->hull, period_s);
+}
+
+/**
+ * Track the fall-back after the drop on one 10 s mean distance
+ */
+static void anchor_engine_settle(anchor_engine_t *eng, float mean_m, uint32_t t_ms) {
+    if (eng->settled) {
+        return;
+    }
+    if (mean_m > eng->settle_m + ANCHOR_SETTLE_MARGIN_M) {
+        eng->settle_m = mean_m;
+        eng->settle_ms = t_ms;
+    } else if ((t_ms - eng->settle_ms) >= ANCHOR_SETTLE_MS) {
+        // The fall-back is not a drag, nor the reach of the swing: learn
+        // both from the settled swing only
+        eng->settled = true;
+        anchor_dragrate_init(&eng->dragrate);
+        anchor_hull_init(&eng->hull, eng->cfg.hull_margin_m);
+        eng->hull.smooth_alpha = eng->cfg.smooth_alpha;
+        anchor_engine_drag_span(eng);
+    }
+}
+
+/**
+ * True when dir_deg is ANCHOR_RELEARN_DEG or more from the reference (set on first use)
+ */
+static bool anchor_engine_shifted(bool *ref_valid, float *ref_deg, float dir_deg) {
+    if (!*ref_valid) {
+        *ref_deg = dir_deg;
+        *ref_valid = true;
+        return false;
+    }
+    float d = fmodf(dir_deg - *ref_deg + 540.0f, 360.0f) - 180.0f;
+    return fabsf(d) >= ANCHOR_RELEARN_DEG;
+}
+
+/**
+ * Restart the safe polygon when the boat's lie or the wind shifts for good
+ *
+ * A turn of the tide or a wind shift swings the boat to a new sector that it
+ * does not come back from, so the old polygon no longer describes the swing.
+ * The lie is the smoothed heading: a dragging anchor moves the boat without
+ * turning it, a new pull turns it. A lie shift is how a turn of the tide shows
+ * without a current sensor.
+ */
+static void anchor_engine_relearn(anchor_engine_t *eng, uint32_t t_ms) {
+    bool shift = false;
+
+    if (eng->heading_valid && (t_ms - eng->heading_ms) <= ANCHOR_HEADING_MAX_AGE_MS) {
+        float rad = eng->heading_deg * ((float)M_PI / 180.0f);
+        if (!eng->lie_valid) {
+            eng->lie_e = sinf(rad);
+            eng->lie_n = cosf(rad);
+        } else {
+            float dt = (float)(t_ms - eng->lie_ms);
+            float a = dt / ((float)ANCHOR_LIE_SMOOTH_MS + dt);
+            eng->lie_e += a * (sinf(rad) - eng->lie_e);
+            eng->lie_n += a * (cosf(rad) - eng->lie_n);
+        }
+        eng->lie_ms = t_ms;
+        eng->lie_valid = true;
+        float lie_deg = atan2f(eng->lie_e, eng->lie_n) * (180.0f / (float)M_PI);
+        shift |= anchor_engine_shifted(&eng->relearn_lie_valid, &eng->relearn_lie_deg, lie_deg);
+    }
+
+    const anchor_wind_t *wind = &eng->wind;
+    if (wind->wind_valid && (t_ms - wind->wind_ms) <= WIND_MAX_AGE_MS &&
+        hypotf(wind->we, wind->wn) >= WIND_MIN_SPEED_MPS) {
+        float to_deg = atan2f(wind->we, wind->wn) * (180.0f / (float)M_PI);
+        shift |= anchor_engine_shifted(&eng->relearn_wind_valid, &eng->relearn_wind_deg, to_deg);
+    }
+
+    // Not while alarmed: the swing that follows a drag is not a new lie
+    if (shift && eng->settled && eng->state != ANCHOR_STATE_ALARM) {
+        anchor_hull_init(&eng->hull, eng->cfg.hull_margin_m);
+        eng->hull.smooth_alpha = eng->cfg.smooth_alpha;
+        anchor_engine_drag_span(eng);
+        anchor_wind_relearn(&eng->wind, eng->east_m, eng->north_m, t_ms);
+        eng->relearn_lie_valid = false;
+        eng->relearn_wind_valid = false;
+    }
+}
+
+/**
+ * Fill a configuration with board_config.h defaults
+ */
+void anchor_engine_default_config(anchor_config_t *cfg) {
+    cfg->radius_m = ALARM_DISTANCE_DEFAULT_FT * GEO_FEET_TO_METERS;
+    cfg->radius_hold_ms = ANCHOR_RADIUS_HOLD_MS;
+    cfg->arming_time_s = ARMING_TIME_DEFAULT_SEC;
+    cfg->use_envelope = false;
+    cfg->envelope_cell_m = ENVELOPE_CELL_DEFAULT_M;
+    cfg->use_hull = true;
+    cfg->hull_margin_m = HULL_MARGIN_DEFAULT_M;
+    cfg->drag_horizon_s = DRAG_HORIZON_DEFAULT_SEC;
+    cfg->use_wind = true;
+    cfg->rode_m = RODE_LENGTH_DEFAULT_M;
+    cfg->bow_height_m = BOW_HEIGHT_DEFAULT_M;
+    cfg->use_depth = true;
+    cfg->smooth_alpha = HULL_SWING_SMOOTH;
+    cfg->use_reanchor = true;
+}
+
+/**
+ * Tune a configuration from a calibrated noise profile
+ */
+void anchor_engine_apply_noise(anchor_config_t *cfg, const noise_profile_t *profile) {
+    if (profile == NULL || !profile->valid) {
+        return;
+    }
+
+    if (cfg->radius_m < profile->min_radius_m) {
+        cfg->radius_m = profile->min_radius_m;
+    }
+    // Hold the radius decision for the averaging time that beats the noise down the most
+    uint32_t hold_ms = (uint32_t)(profile->tau_best_s * 1000.0f);
+    cfg->radius_hold_ms = (hold_ms > ANCHOR_RADIUS_HOLD_MS) ? hold_ms : ANCHOR_RADIUS_HOLD_MS;
+    cfg->hull_margin_m = profile->hull_margin_m;
+    cfg->envelope_cell_m = ENVELOPE_CELL_NOISE_FACTOR * profile->radius95_m;
+    cfg->smooth_alpha = profile->smooth_alpha;
+}
+
+/**
+ * Initialise the engine in the OFF state
+ */
+void anchor_engine_init(anchor_engine_t *eng, const anchor_config_t *cfg) {
+    memset(eng, 0, sizeof(*eng));
+    if (cfg != NULL) {
+        eng->cfg = *cfg;
+    } else {
+        anchor_engine_default_config(&eng->cfg);
+    }
+    eng->radius_m = eng->cfg.radius_m;
+    eng->radius_out = false;
+    eng->state = ANCHOR_STATE_OFF;
+}
+
+/**
+ * Attach a zone set
+ */
+void anchor_engine_set_geofence(anchor_engine_t *eng, anchor_geofence_t *set) {
+    eng->geofence = set;
+    eng->geofence_hits = 0;
+}
+
+/**
+ * Attach an AIS target set
+ */
+void anchor_engine_set_neighbors(anchor_engine_t *eng, anchor_neighbors_t *set) {
+    eng->neighbors = set;
+    eng->neighbor_flags = 0;
+    if (set != NULL && eng->state != ANCHOR_STATE_OFF) {
+        anchor_neighbors_set_origin(set, eng->anchor.lat0, eng->anchor.lon0);
+    }
+}
+
+/**
+ * Move the anchor and restart every detector in ARMING
+ */
+static void anchor_engine_reset_anchor(anchor_engine_t *eng, double lat, double lon, uint32_t t_ms) {
+    geo_ref_init(&eng->anchor, lat, lon);
+    eng->drop_ms = t_ms;
+    eng->settle_m = 0.0f;
+    eng->settle_ms = t_ms;
+    eng->settled = false;
+    eng->last_fix_ms = t_ms;
+    eng->east_m = 0.0f;
+    eng->north_m = 0.0f;
+    eng->dist_m = 0.0f;
+    eng->alarm_flags = 0;
+
+    // Grid covers the alarm circle with margin in noise-sized cells; centroid limit is one radius
+    anchor_envelope_init(&eng->envelope,
+                         eng->cfg.radius_m * ENVELOPE_EXTENT_FACTOR,
+                         eng->cfg.envelope_cell_m,
+                         eng->cfg.radius_m);
+    anchor_hull_init(&eng->hull, eng->cfg.hull_margin_m);
+    eng->hull.smooth_alpha = eng->cfg.smooth_alpha;
+    eng->lie_e = 0.0f;
+    eng->lie_n = 0.0f;
+    eng->lie_ms = 0;
+    eng->lie_valid = false;
+    eng->relearn_lie_valid = false;
+    eng->relearn_lie_deg = 0.0f;
+    eng->relearn_wind_valid = false;
+    eng->relearn_wind_deg = 0.0f;
+    anchor_circle_init(&eng->circle);
+    anchor_bearing_init(&eng->bearing);
+    memset(&eng->circle_est, 0, sizeof(eng->circle_est));
+    memset(&eng->bearing_est, 0, sizeof(eng->bearing_est));
+    eng->check = ANCHOR_CHECK_UNKNOWN;
+    anchor_dragrate_init(&eng->dragrate);
+    eng->ttb_s = -1.0f;
+    anchor_wind_init(&eng->wind, t_ms);
+    eng->wind_grace = 0;
+    anchor_depth_init(&eng->depth, eng->cfg.rode_m, eng->cfg.bow_height_m);
+    eng->radius_m = eng->cfg.radius_m;
+    anchor_swing_init(&eng->swing);
+    eng->geofence_hits = 0;
+    eng->swing_radius_m = 0.0f;
+    eng->neighbor_flags = 0;
+    if (eng->neighbors != NULL) {
+        anchor_neighbors_set_origin(eng->neighbors, lat, lon);
+    }
+
+    eng->state = ANCHOR_STATE_ARMING;
+}
+
+/**
+ * Drop the anchor at a position and start ARMING
+ */
+void anchor_engine_set_anchor(anchor_engine_t *eng, double lat, double lon, uint32_t t_ms) {
+    anchor_engine_reset_anchor(eng, lat, lon, t_ms);
+    anchor_reanchor_init(&eng->reanchor, eng->cfg.radius_m, t_ms);
+    eng->reanchors = 0;
+}
+
+/**
+ * Stop watching and return to OFF
+ */
+void anchor_engine_stop(anchor_engine_t *eng) {
+    eng->state = ANCHOR_STATE_OFF;
+    eng->alarm_flags = 0;
+    eng->neighbor_flags = 0;
+}
+
+/**
+ * Feed one position fix
+ */
+uint32_t anchor_engine_update(anchor_engine_t *eng, const anchor_fix_t *fix) {
+    if (eng->state == ANCHOR_STATE_OFF) {
+        return 0;
+    }
+
+    eng->last_fix_ms = fix->t_ms;
+    geo_to_enu(&eng->anchor, fix->lat, fix->lon, &eng->east_m, &eng->north_m);
+    eng->dist_m = sqrtf(eng->east_m * eng->east_m + eng->north_m * eng->north_m);
+
+    // Re-anchored elsewhere: move the anchor to the new swing centre and re-arm.
+    // Never while alarmed - a dragging anchor that re-bites must not clear the alarm.
+    if (eng->cfg.use_reanchor) {
+        int slot = anchor_reanchor_add(&eng->reanchor, eng->east_m, eng->north_m, fix->t_ms);
+        if (slot >= 0 && eng->state == ANCHOR_STATE_ALARM) {
+            anchor_reanchor_suggest(&eng->reanchor, slot, fix->t_ms);
+        } else if (slot >= 0) {
+            double lat, lon;
+            geo_from_enu(&eng->anchor, eng->reanchor.hypo[slot].east_m,
+                         eng->reanchor.hypo[slot].north_m, &lat, &lon);
+            anchor_reanchor_switch(&eng->reanchor, slot, fix->t_ms);
+            anchor_engine_reset_anchor(eng, lat, lon, fix->t_ms);
+            eng->reanchors++;
+            return 0;
+        }
+    }
+
+    // Envelope learns during ARMING and keeps adapting while ARMED (no growth while drifting off)
+    uint32_t env_flags = anchor_envelope_add(&eng->envelope, eng->east_m, eng->north_m,
+                                             eng->state != ANCHOR_STATE_ALARM &&
+                                             !anchor_dragrate_is_rising(&eng->dragrate));
+
+    // Independent anchor position estimates
+    anchor_circle_add(&eng->circle, eng->east_m, eng->north_m);
+    if (eng->heading_valid && (fix->t_ms - eng->heading_ms) <= ANCHOR_HEADING_MAX_AGE_MS) {
+        anchor_bearing_add(&eng->bearing, eng->east_m, eng->north_m, eng->heading_deg);
+    }
+    anchor_engine_cross_check(eng);
+
+    // Swing period and oscillation vs drift (one FFT every 2 minutes)
+    if (anchor_swing_add(&eng->swing, eng->east_m, eng->north_m, fix->t_ms)) {
+        anchor_engine_drag_span(eng);
+    }
+
+    // Alarm circle follows the tide: the rode reaches further as the water falls
+    float radius = eng->cfg.radius_m + anchor_depth_radius_delta(&eng->depth, fix->t_ms);
+    float radius_min = eng->cfg.radius_m * ANCHOR_RADIUS_MIN_FRACTION;
+    eng->radius_m = (radius > radius_min) ? radius : radius_min;
+    if (eng->dist_m <= eng->radius_m) {
+        eng->radius_out = false;
+    } else if (!eng->radius_out) {
+        eng->radius_out = true;
+        eng->radius_out_ms = fix->t_ms;
+    }
+
+    // Radial drift and time to the alarm circle (restarted once the fall-back settles)
+    if (anchor_dragrate_add(&eng->dragrate, eng->dist_m, fix->t_ms)) {
+        anchor_engine_settle(eng, eng->dragrate.last_d_m, fix->t_ms);
+    }
+    eng->ttb_s = anchor_dragrate_time_to(&eng->dragrate, eng->radius_m, fix->t_ms);
+
+    // Safe polygon: nothing is learned while drifting off or alarmed
+    anchor_engine_relearn(eng, fix->t_ms);
+    anchor_hull_add(&eng->hull, eng->east_m, eng->north_m, fix->t_ms,
+                    eng->state != ANCHOR_STATE_ALARM && !anchor_dragrate_is_rising(&eng->dragrate));
+
+    // A full swing cycle has been seen - the envelope has learned its shape
+    if (anchor_hull_is_ready(&eng->hull)) {
+        anchor_envelope_set_mature(&eng->envelope);
+    }
+
+    // Wind residual (stops learning once alarmed so a drag is never learned)
+    uint32_t wind_flags = anchor_wind_observe(&eng->wind, eng->east_m, eng->north_m,
+                                              fix->t_ms, eng->state != ANCHOR_STATE_ALARM);
+
+    // User zones (debounced per zone, so keep evaluating through ARMING)
+    eng->geofence_hits = (eng->geofence != NULL)
+                         ? anchor_geofence_check(eng->geofence, fix->lat, fix->lon) : 0;
+
+    // Neighbors against the swing learned so far (never less than where we are)
+    eng->swing_radius_m = eng->cfg.use_reanchor
+                          ? eng->reanchor.hypo[eng->reanchor.current].radius_m : eng->radius_m;
+    if (eng->swing_radius_m < eng->dist_m) {
+        eng->swing_radius_m = eng->dist_m;
+    }
+    eng->neighbor_flags = (eng->neighbors != NULL)
+                          ? anchor_neighbors_check(eng->neighbors, eng->east_m, eng->north_m,
+                                                   eng->swing_radius_m, fix->t_ms) : 0;
+
+    if (eng->state == ANCHOR_STATE_ARMING) {
+        // Agreeing estimates confirm the anchor is set - no need to wait out the timer,
+        // but not while the boat is still falling back on the rode
+        uint32_t arming_ms = fix->t_ms - eng->drop_ms;
+        bool confirmed = eng->check == ANCHOR_CHECK_AGREE && eng->settled &&
+                         arming_ms >= ANCHOR_ARMING_MIN_MS;
+        if (confirmed || arming_ms >= eng->cfg.arming_time_s * 1000u) {
+            eng->state = ANCHOR_STATE_ARMED;
+        } else {
+            return 0;
+        }
+    }
+
+    uint32_t flags = 0;
+    if (eng->radius_out && (fix->t_ms - eng->radius_out_ms) >= eng->cfg.radius_hold_ms) {
+        flags |= ANCHOR_ALARM_RADIUS;
+    }
+    if (eng->cfg.use_envelope) {
+        if (env_flags & ENVELOPE_FLAG_EXIT) {
+            flags |= ANCHOR_ALARM_ENVELOPE_EXIT;
+        }
+        if (env_flags & ENVELOPE_FLAG_MIGRATED) {
+            flags |= ANCHOR_ALARM_ENVELOPE_DRIFT;
+        }
+    }
+    // hull.flags, not hull_flags: the polygon may have restarted on this fix
+    if (eng->cfg.use_hull && eng->settled && (eng->hull.flags & HULL_FLAG_EXIT)) {
+        flags |= ANCHOR_ALARM_HULL;
+    }
+    if (eng->cfg.drag_horizon_s > 0 && eng->ttb_s >= 0.0f &&
+        eng->ttb_s < (float)eng->cfg.drag_horizon_s) {
+        flags |= ANCHOR_ALARM_DRAG_PREDICTED;
+    }
+    if (eng->cfg.use_wind) {
+        // A gust along the wind explains the excursion - hold off, but not forever
+        if ((flags & ANCHOR_ALARM_GEOMETRIC) && (wind_flags & WIND_FLAG_EXPLAINED) &&
+            eng->wind_grace < ANCHOR_WIND_GRACE_FIXES) {
+            flags &= ~ANCHOR_ALARM_GEOMETRIC;
+            eng->wind_grace++;
+        } else if (!(wind_flags & WIND_FLAG_EXPLAINED)) {
+            eng->wind_grace = 0;
+        }
+        if (wind_flags & WIND_FLAG_CROSS) {
+            flags |= ANCHOR_ALARM_WIND_CROSS;
+        }
+    }
+    if (eng->cfg.use_depth && (eng->depth.flags & DEPTH_FLAG_TREND) &&
+        (fix->t_ms - eng->depth.depth_ms) <= DEPTH_MAX_AGE_MS) {
+        flags |= ANCHOR_ALARM_DEPTH_TREND;
+    }
+    if (eng->geofence_hits != 0) {
+        flags |= ANCHOR_ALARM_GEOFENCE;
+    }
+
+    // ALARM latches until the user stops or re-sets the anchor
+    eng->alarm_flags = flags;
+    if (flags != 0) {
+        eng->state = ANCHOR_STATE_ALARM;
+    }
+
+    return flags;
+}
+
+/**
+ * Feed one true heading sample
+ */
+void anchor_engine_update_heading(anchor_engine_t *eng, float heading_deg, uint32_t t_ms) {
+    eng->heading_deg = heading_deg;
+    eng->heading_ms = t_ms;
+    eng->heading_valid = true;
+}
+
+/**
+ * Feed one wind sample
+ */
+void anchor_engine_update_wind(anchor_engine_t *eng, float speed_mps, float angle_deg,
+                               bool relative, uint32_t t_ms) {
+    if (relative) {
+        // Apparent/true wind relative to the bow needs the heading to become a bearing
+        if (!eng->heading_valid || (t_ms - eng->heading_ms) > ANCHOR_HEADING_MAX_AGE_MS) {
+            return;
+        }
+        angle_deg += eng->heading_deg;
+    }
+    angle_deg = fmodf(angle_deg, 360.0f);
+    if (angle_deg < 0.0f) angle_deg += 360.0f;
+
+    anchor_wind_update(&eng->wind, speed_mps, angle_deg, t_ms);
+}
+
+/**
+ * Feed one water depth sample
+ */
+void anchor_engine_update_depth(anchor_engine_t *eng, float depth_m, uint32_t t_ms) {
+    if (eng->state == ANCHOR_STATE_OFF) {
+        return;
+    }
+
+    // Motion gate: the boat is drifting off the anchor, not just swinging
+    bool moving_away = anchor_dragrate_is_rising(&eng->dragrate);
+    anchor_depth_add(&eng->depth, depth_m, t_ms, moving_away, eng->settled);
+}
+
+/**
+ * Get printable state name
+ */
+const char* anchor_engine_state_name(anchor_state_t state) {
+    switch (state) {
+        case ANCHOR_STATE_OFF:    return "OFF";
+        case ANCHOR_STATE_ARMING: return "ARMING";
+        case ANCHOR_STATE_ARMED:  return "ARMED";
+        case ANCHOR_STATE_ALARM:  return "ALARM";
+        default:                  return "UNKNOWN";
+    }
+}
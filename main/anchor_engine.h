@@ -0,0 +1,285 @@
+/**
+ * Anchor Drag Detection Engine
+ *
+ * Author: Colin Bitterfield
+ * Email: colin@bitterfield.com
+ * Date Created: 2026-10-18
+ * Date Updated: 2026-10-18
+ * Version: 0.1.4
+ *
+ * Changelog:
+ * - 0.1.4 (2026-10-18): radius_hold_ms / ANCHOR_RADIUS_HOLD_MS: time outside
+ *   the radius before it alarms
+ * - 0.1.3 (2026-10-18): Safe polygon restarts when the boat's lie or the
+ *   wind shifts
+ * - 0.1.2 (2026-10-18): envelope_cell_m; envelope alarms off by default
+ * - 0.1.1 (2026-10-18): ARMING ends early only after ANCHOR_ARMING_MIN_MS and
+ *   once the boat has settled back on the rode
+ *
+ * Core anchor watch state machine (OFF -> ARMING -> ARMED -> ALARM) fed one
+ * GPS fix at a time. Positions are projected to East/North metres around the
+ * anchor (anchor_geo.h) and evaluated against:
+ * - The alarm radius circle (ALARM_DISTANCE_DEFAULT_FT by default), moved
+ *   with the tide by the rode's scope when the rode length is known
+ *   (anchor_depth.h)
+ * - The learned swing envelope (anchor_envelope.h), off by default until its
+ *   false-alarm rate is acceptable (host/drag_montecarlo.c)
+ * - The adaptive safe polygon once a full swing is seen (anchor_hull.h)
+ * - The predicted time to reach the alarm radius (anchor_dragrate.h)
+ * - The learned wind/lie relationship (anchor_wind.h), which holds off
+ *   geometric alarms for positions a gust explains and flags sustained
+ *   cross-wind excursions
+ * - The depth trend, which flags a step in depth while drifting off
+ * - User exclusion / keep-in zones (anchor_geofence.h), when a zone set is
+ *   attached
+ *
+ * AIS neighbors (anchor_neighbors.h), when a target set is attached, are
+ * checked against the learned swing circle on every fix. Their flags are a
+ * proximity warning and do not latch ALARM - a passing boat is not a drag.
+ *
+ * Re-anchoring without stopping the watch is detected by tracking competing
+ * anchor hypotheses (anchor_reanchor.h). When the boat has motored to and
+ * settled on a new swing, the engine moves its anchor there and re-arms.
+ *
+ * The swing spectrum (anchor_swing.h) reports the dominant swing period and
+ * amplitude, and whether the trail is oscillating or drifting.
+ *
+ * The anchor position itself is estimated two independent ways - a circle
+ * fit of the swing (anchor_circle.h) and bow-heading triangulation
+ * (anchor_bearing.h). When they agree, ARMING ends early - but never before
+ * ANCHOR_ARMING_MIN_MS, and only once the boat has stopped falling back: the
+ * 10 s mean distance (anchor_dragrate.h) has not grown by more than
+ * ANCHOR_SETTLE_MARGIN_M for ANCHOR_SETTLE_MS. The arming timer still ends
+ * ARMING on its own, so an anchor that never sets is still watched.
+ *
+ * The engine has no RTOS or LVGL dependencies. Callers own the instance and
+ * serialise access (GPS task on target, simulator on the host).
+ */
+
+#ifndef ANCHOR_ENGINE_H
+#define ANCHOR_ENGINE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "anchor_geo.h"
+#include "anchor_envelope.h"
+#include "anchor_hull.h"
+#include "anchor_circle.h"
+#include "anchor_bearing.h"
+#include "anchor_dragrate.h"
+#include "anchor_wind.h"
+#include "anchor_depth.h"
+#include "anchor_swing.h"
+#include "anchor_noise.h"
+#include "anchor_geofence.h"
+#include "anchor_reanchor.h"
+#include "anchor_neighbors.h"
+
+// Engine states (see docs/OUTSTANDING_ISSUES.md Phase 4)
+typedef enum {
+    ANCHOR_STATE_OFF = 0,       // Not watching
+    ANCHOR_STATE_ARMING,        // Anchor dropped, learning swing pattern
+    ANCHOR_STATE_ARMED,         // Watching for drag
+    ANCHOR_STATE_ALARM          // Drag detected
+} anchor_state_t;
+
+// Alarm reasons (bitmask returned by anchor_engine_update)
+#define ANCHOR_ALARM_RADIUS         (1u << 0)   // Outside alarm circle
+#define ANCHOR_ALARM_ENVELOPE_EXIT  (1u << 1)   // Left the learned swing envelope
+#define ANCHOR_ALARM_ENVELOPE_DRIFT (1u << 2)   // Envelope centroid migrated
+#define ANCHOR_ALARM_HULL           (1u << 3)   // Left the adaptive safe polygon
+#define ANCHOR_ALARM_DRAG_PREDICTED (1u << 4)   // Radius crossing predicted within horizon
+#define ANCHOR_ALARM_WIND_CROSS     (1u << 5)   // Sustained excursion across the wind
+#define ANCHOR_ALARM_DEPTH_TREND    (1u << 6)   // Depth trend step while drifting off
+#define ANCHOR_ALARM_GEOFENCE       (1u << 7)   // Inside an exclusion zone / outside a keep-in zone
+
+// Geometric alarms the wind model may hold off during a gust
+#define ANCHOR_ALARM_GEOMETRIC      (ANCHOR_ALARM_RADIUS | ANCHOR_ALARM_ENVELOPE_EXIT | ANCHOR_ALARM_HULL)
+
+// Anchor position cross-check (circle fit vs heading triangulation)
+typedef enum {
+    ANCHOR_CHECK_UNKNOWN = 0,   // Not enough data for both estimates
+    ANCHOR_CHECK_AGREE,         // Estimates within ANCHOR_CROSSCHECK_TOL_M
+    ANCHOR_CHECK_MISMATCH       // Estimates disagree (slack rode, bad compass)
+} anchor_check_t;
+
+#define ANCHOR_CROSSCHECK_TOL_M     5.0f    // Max circle/bearing estimate separation
+#define ANCHOR_HEADING_MAX_AGE_MS   2000    // Heading older than this is not paired with a fix
+#define ANCHOR_WIND_GRACE_FIXES     30      // Max consecutive fixes a gust may hold off an alarm
+#define ANCHOR_RADIUS_MIN_FRACTION  0.5f    // Tide never shrinks the alarm radius below this
+#define ANCHOR_RADIUS_HOLD_MS       10000   // Time outside the radius before it alarms (GPS noise spikes are shorter)
+#define ANCHOR_ARMING_MIN_MS        30000   // Agreeing estimates end ARMING no earlier (ARMING_TIME_MIN_SEC)
+#define ANCHOR_SETTLE_MARGIN_M      2.0f    // Growth of the furthest mean distance that counts as falling back
+#define ANCHOR_SETTLE_MS            30000   // No such growth for this long = settled on the rode
+#define ANCHOR_RELEARN_DEG          15.0f   // Lie or wind shift that restarts the safe polygon
+#define ANCHOR_LIE_SMOOTH_MS        120000  // Heading smoothing for the lie (averages out the yaw)
+
+// Single position fix
+typedef struct {
+    double lat;             // Latitude (degrees)
+    double lon;             // Longitude (degrees)
+    uint32_t t_ms;          // Monotonic timestamp (milliseconds)
+} anchor_fix_t;
+
+// Engine configuration
+typedef struct {
+    float radius_m;             // Alarm circle radius
+    uint32_t radius_hold_ms;    // Time outside the radius before it alarms (longer once calibrated)
+    uint32_t arming_time_s;     // Time spent ARMING before alarms are live
+    bool use_envelope;          // Raise envelope exit/drift alarms (off by default)
+    float envelope_cell_m;      // Smallest envelope cell (from the noise 95% radius once calibrated)
+    bool use_hull;              // Raise safe-polygon alarms once learned
+    float hull_margin_m;        // Safe-polygon margin around the swing hull
+    uint32_t drag_horizon_s;    // Alarm when the radius is predicted within this time (0 = off)
+    bool use_wind;              // Hold off gust-explained alarms, flag cross-wind excursions
+    float rode_m;               // Rode paid out (0 = unknown, radius not tide-adjusted)
+    float bow_height_m;         // Bow roller height above the waterline
+    bool use_depth;             // Raise depth-trend alarms
+    float smooth_alpha;         // Swing-tracking EMA weight (HULL_SWING_SMOOTH unless calibrated)
+    bool use_reanchor;          // Follow the boat to a new anchorage (re-arms automatically)
+} anchor_config_t;
+
+typedef struct {
+    anchor_config_t cfg;
+    anchor_state_t state;
+    geo_ref_t anchor;           // Anchor position (ENU origin)
+    uint32_t drop_ms;           // Time anchor was set
+    float settle_m;             // Furthest 10 s mean distance while falling back
+    uint32_t settle_ms;         // Time settle_m last grew
+    bool settled;               // Fall-back over (latches until the anchor moves)
+    uint32_t last_fix_ms;       // Time of latest fix
+    float east_m;               // Latest boat position relative to anchor
+    float north_m;
+    float dist_m;               // Latest distance from anchor
+    uint32_t alarm_flags;       // ANCHOR_ALARM_* reasons of latest fix
+    anchor_envelope_t envelope; // Learned swing area
+    anchor_hull_t hull;         // Adaptive safe polygon
+    float lie_e;                // Smoothed heading unit vector (the way the boat lies)
+    float lie_n;
+    uint32_t lie_ms;            // Time lie_e/lie_n were last updated
+    bool lie_valid;             // lie_e/lie_n have been set
+    bool relearn_lie_valid;     // relearn_lie_deg has been set
+    float relearn_lie_deg;      // Lie when the polygon last (re)started
+    bool relearn_wind_valid;    // relearn_wind_deg has been set
+    float relearn_wind_deg;     // Wind-to direction when the polygon last (re)started
+    float heading_deg;          // Latest true heading (PGN 127250 + variation)
+    uint32_t heading_ms;        // Time of latest heading
+    bool heading_valid;         // heading_deg has been set
+    anchor_circle_t circle;     // Swing circle fit
+    anchor_bearing_t bearing;   // Bow bearing triangulation
+    circle_estimate_t circle_est;   // Latest circle fit
+    bearing_estimate_t bearing_est; // Latest triangulation
+    anchor_check_t check;       // Cross-check result
+    anchor_dragrate_t dragrate; // Radial drift velocity estimator
+    float ttb_s;                // Predicted seconds to alarm radius (-1 = none)
+    anchor_wind_t wind;         // Wind/lie model
+    uint16_t wind_grace;        // Consecutive fixes with alarms held off by the wind model
+    anchor_depth_t depth;       // Depth channel and scope
+    float radius_m;             // Effective alarm radius (cfg.radius_m moved with the tide)
+    bool radius_out;            // Outside radius_m since radius_out_ms
+    uint32_t radius_out_ms;     // When the boat last went outside radius_m
+    anchor_swing_t swing;       // Swing period / drift spectrum
+    anchor_geofence_t *geofence;    // Caller-owned zone set (NULL = none)
+    uint32_t geofence_hits;     // Zones violated (bit per zone index)
+    anchor_reanchor_t reanchor; // Anchor hypotheses (survives automatic re-anchoring)
+    uint32_t reanchors;         // Automatic re-anchors since the anchor was set
+    anchor_neighbors_t *neighbors;  // Caller-owned AIS target set (NULL = none)
+    float swing_radius_m;       // Predicted swing radius around the anchor
+    uint8_t neighbor_flags;     // NEIGHBOR_FLAG_ALERT bits of the latest fix (warning only)
+} anchor_engine_t;
+
+/**
+ * Fill a configuration with board_config.h defaults
+ * @param cfg Configuration to fill
+ */
+void anchor_engine_default_config(anchor_config_t *cfg);
+
+/**
+ * Tune a configuration from a calibrated noise profile (anchor_noise.h).
+ * Raises the alarm radius to the profile's minimum safe radius, and sets the
+ * safe-polygon margin, envelope cell size and swing smoothing.
+ * @param cfg Configuration to tune
+ * @param profile Noise profile (ignored if not valid)
+ */
+void anchor_engine_apply_noise(anchor_config_t *cfg, const noise_profile_t *profile);
+
+/**
+ * Initialise the engine in the OFF state
+ * @param eng Engine instance
+ * @param cfg Configuration (NULL for defaults)
+ */
+void anchor_engine_init(anchor_engine_t *eng, const anchor_config_t *cfg);
+
+/**
+ * Attach a zone set - evaluated on every fix while the watch is on
+ * @param eng Engine instance
+ * @param set Zone set (caller-owned, NULL to detach)
+ */
+void anchor_engine_set_geofence(anchor_engine_t *eng, anchor_geofence_t *set);
+
+/**
+ * Attach an AIS target set - moved to the anchor frame on every anchor change
+ * and checked on every fix while the watch is on
+ * @param eng Engine instance
+ * @param set Target set (caller-owned, NULL to detach)
+ */
+void anchor_engine_set_neighbors(anchor_engine_t *eng, anchor_neighbors_t *set);
+
+/**
+ * Drop the anchor at a position and start ARMING
+ * @param eng Engine instance
+ * @param lat Anchor latitude (degrees)
+ * @param lon Anchor longitude (degrees)
+ * @param t_ms Timestamp (milliseconds)
+ */
+void anchor_engine_set_anchor(anchor_engine_t *eng, double lat, double lon, uint32_t t_ms);
+
+/**
+ * Stop watching and return to OFF
+ * @param eng Engine instance
+ */
+void anchor_engine_stop(anchor_engine_t *eng);
+
+/**
+ * Feed one position fix
+ * @param eng Engine instance
+ * @param fix Position fix
+ * @return ANCHOR_ALARM_* bitmask (0 = no alarm)
+ */
+uint32_t anchor_engine_update(anchor_engine_t *eng, const anchor_fix_t *fix);
+
+/**
+ * Feed one true heading sample - O(1); paired with the next position fix
+ * @param eng Engine instance
+ * @param heading_deg True heading (degrees)
+ * @param t_ms Timestamp (milliseconds)
+ */
+void anchor_engine_update_heading(anchor_engine_t *eng, float heading_deg, uint32_t t_ms);
+
+/**
+ * Feed one wind sample (PGN 130306 / $WIMWV) - O(1)
+ * @param eng Engine instance
+ * @param speed_mps Wind speed (m/s)
+ * @param angle_deg Wind angle (degrees)
+ * @param relative true if angle_deg is relative to the bow (needs a recent heading)
+ * @param t_ms Timestamp (milliseconds)
+ */
+void anchor_engine_update_wind(anchor_engine_t *eng, float speed_mps, float angle_deg,
+                               bool relative, uint32_t t_ms);
+
+/**
+ * Feed one water depth sample (PGN 128267 / $SDDBT) - O(1)
+ * @param eng Engine instance
+ * @param depth_m Water depth (metres, transducer offset already applied)
+ * @param t_ms Timestamp (milliseconds)
+ */
+void anchor_engine_update_depth(anchor_engine_t *eng, float depth_m, uint32_t t_ms);
+
+/**
+ * Get printable state name
+ * @param state Engine state
+ * @return Static string ("OFF", "ARMING", "ARMED", "ALARM")
+ */
+const char* anchor_engine_state_name(anchor_state_t state);
+
+#endif // ANCHOR_ENGINE_H
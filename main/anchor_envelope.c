@@ -0,0 +1,219 @@
+/**
+ * Swing Envelope Occupancy Grid Implementation
+ *
+ * Author: Colin Bitterfield
+ * Email: colin@bitterfield.com
+ * Date Created: 2026-10-18
+ * Date Updated: 2026-10-18
+ * Version: 0.2.1
+ *
+ * Changelog:
+ * - 0.2.1 (2026-10-18): Tolerance-ring growth gated by the caller; occupied
+ *   cells always reinforced
+ * - 0.2.0 (2026-10-18): Keep learning fixes inside the envelope once mature;
+ *   cell size floored at the GPS noise
+ */
+
+#include "anchor_envelope.h"
+#include <string.h>
+
+/**
+ * Map an ENU position to grid column/row
+ * @return false if the position falls outside the grid
+ */
+static bool envelope_cell_of(const anchor_envelope_t *env, float east_m, float north_m,
+                             int *col, int *row) {
+    float fx = (east_m + env->half_extent_m) / env->cell_m;
+    float fy = (env->half_extent_m - north_m) / env->cell_m;
+
+    if (fx < 0.0f || fy < 0.0f || fx >= ENVELOPE_GRID_DIM || fy >= ENVELOPE_GRID_DIM) {
+        return false;
+    }
+
+    *col = (int)fx;
+    *row = (int)fy;
+    return true;
+}
+
+/**
+ * Check the 3x3 neighbourhood around a cell for occupancy
+ */
+static bool envelope_neighbourhood_occupied(const anchor_envelope_t *env, int col, int row) {
+    for (int r = row - 1; r <= row + 1; r++) {
+        if (r < 0 || r >= ENVELOPE_GRID_DIM) continue;
+        const uint8_t *line = &env->cells[r * ENVELOPE_GRID_DIM];
+        for (int c = col - 1; c <= col + 1; c++) {
+            if (c < 0 || c >= ENVELOPE_GRID_DIM) continue;
+            if (line[c] >= ENVELOPE_OCCUPIED_MIN) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+/**
+ * Initialise an empty envelope centred on the anchor
+ */
+void anchor_envelope_init(anchor_envelope_t *env, float half_extent_m, float cell_min_m,
+                         float migrate_m) {
+    memset(env, 0, sizeof(*env));
+    // Cells below the noise floor would turn GPS scatter into exits: widen the grid instead
+    if (half_extent_m < cell_min_m * (ENVELOPE_GRID_DIM / 2)) {
+        half_extent_m = cell_min_m * (ENVELOPE_GRID_DIM / 2);
+    }
+    env->half_extent_m = half_extent_m;
+    env->cell_m = (2.0f * half_extent_m) / ENVELOPE_GRID_DIM;
+    env->migrate_m = migrate_m;
+}
+
+/**
+ * Forget all learned positions (keeps geometry)
+ */
+void anchor_envelope_clear(anchor_envelope_t *env) {
+    anchor_envelope_init(env, env->half_extent_m, env->cell_m, env->migrate_m);
+}
+
+/**
+ * Halve every cell and recompute centroid sums
+ */
+void anchor_envelope_decay(anchor_envelope_t *env) {
+    uint32_t total = 0;
+    int32_t sum_col = 0;
+    int32_t sum_row = 0;
+
+    for (int row = 0; row < ENVELOPE_GRID_DIM; row++) {
+        uint8_t *line = &env->cells[row * ENVELOPE_GRID_DIM];
+        uint32_t row_total = 0;
+        for (int col = 0; col < ENVELOPE_GRID_DIM; col++) {
+            uint8_t v = line[col] >> 1;
+            line[col] = v;
+            row_total += v;
+            sum_col += (int32_t)v * col;
+        }
+        total += row_total;
+        sum_row += (int32_t)row_total * row;
+    }
+
+    env->total = total;
+    env->sum_col = sum_col;
+    env->sum_row = sum_row;
+    env->since_decay = 0;
+}
+
+/**
+ * Add one position fix
+ */
+uint32_t anchor_envelope_add(anchor_envelope_t *env, float east_m, float north_m, bool grow) {
+    int col = 0;
+    int row = 0;
+    bool in_grid = envelope_cell_of(env, east_m, north_m, &col, &row);
+    bool mature = env->mature;
+    uint32_t flags = 0;
+
+    // Classify against the envelope learned so far, before this fix joins it
+    bool inside = in_grid && envelope_neighbourhood_occupied(env, col, row);
+    if (mature) {
+        if (inside) {
+            env->outside_run = 0;
+        } else if (env->outside_run < UINT16_MAX) {
+            env->outside_run++;
+        }
+        if (env->outside_run >= ENVELOPE_EXIT_FIXES) {
+            flags |= ENVELOPE_FLAG_EXIT;
+        }
+    }
+
+    // Accumulate - once mature an occupied cell is always reinforced, so
+    // decay only ages out cells the swing no longer visits. The envelope
+    // grows into the tolerance ring only when the caller allows it (a slow
+    // drag is not learned), and a fix that has left it is never learned.
+    uint8_t *cell = in_grid ? &env->cells[row * ENVELOPE_GRID_DIM + col] : NULL;
+    if (in_grid && (!mature || *cell >= ENVELOPE_OCCUPIED_MIN || (inside && grow))) {
+        if (*cell == ENVELOPE_CELL_MAX) {
+            anchor_envelope_decay(env);
+        }
+        (*cell)++;
+        env->total++;
+        env->sum_col += col;
+        env->sum_row += row;
+    }
+    env->fixes++;
+
+    if (++env->since_decay >= ENVELOPE_DECAY_INTERVAL) {
+        anchor_envelope_decay(env);
+    }
+
+    // Fall back to maturing on our own if nobody declared a full swing
+    if (!env->mature && env->fixes >= ENVELOPE_LOCK_FIXES) {
+        anchor_envelope_set_mature(env);
+    } else if (mature && env->ref_valid) {
+        float ce, cn;
+        if (anchor_envelope_centroid(env, &ce, &cn)) {
+            float de = ce - env->ref_east_m;
+            float dn = cn - env->ref_north_m;
+            if (de * de + dn * dn > env->migrate_m * env->migrate_m) {
+                flags |= ENVELOPE_FLAG_MIGRATED;
+            }
+        }
+    }
+
+    env->flags = flags;
+    return flags;
+}
+
+/**
+ * Test whether a position lies inside the learned envelope
+ */
+bool anchor_envelope_contains(const anchor_envelope_t *env, float east_m, float north_m) {
+    int col, row;
+    if (!envelope_cell_of(env, east_m, north_m, &col, &row)) {
+        return false;
+    }
+    return envelope_neighbourhood_occupied(env, col, row);
+}
+
+/**
+ * Get the count-weighted centroid of the envelope
+ */
+bool anchor_envelope_centroid(const anchor_envelope_t *env, float *east_m, float *north_m) {
+    if (env->total == 0) {
+        return false;
+    }
+
+    // Cell centres: +0.5 cell from the column/row index
+    float mean_col = (float)env->sum_col / (float)env->total + 0.5f;
+    float mean_row = (float)env->sum_row / (float)env->total + 0.5f;
+    *east_m = mean_col * env->cell_m - env->half_extent_m;
+    *north_m = env->half_extent_m - mean_row * env->cell_m;
+    return true;
+}
+
+/**
+ * Re-capture the reference centroid
+ */
+void anchor_envelope_rebase(anchor_envelope_t *env) {
+    env->ref_valid = anchor_envelope_centroid(env, &env->ref_east_m, &env->ref_north_m);
+}
+
+/**
+ * End the learning phase and capture the reference centroid
+ */
+bool anchor_envelope_set_mature(anchor_envelope_t *env) {
+    if (env->mature) {
+        return true;
+    }
+    if (env->fixes < ENVELOPE_MATURE_FIXES) {
+        return false;
+    }
+    env->mature = true;
+    anchor_envelope_rebase(env);
+    return true;
+}
+
+/**
+ * Check whether the learning phase is over
+ */
+bool anchor_envelope_is_mature(const anchor_envelope_t *env) {
+    return env->mature;
+}
@@ -0,0 +1,154 @@
+/**
+ * Swing Envelope Occupancy Grid
+ *
+ * Author: Colin Bitterfield
+ * Email: colin@bitterfield.com
+ * Date Created: 2026-10-18
+ * Date Updated: 2026-10-18
+ * Version: 0.2.1
+ *
+ * Changelog:
+ * - 0.2.1 (2026-10-18): Growth into the tolerance ring only when the caller
+ *   allows it (drag rate not rising); occupied cells are always reinforced
+ * - 0.2.0 (2026-10-18): Keep learning fixes inside the envelope once mature
+ *   (decay no longer only shrinks it); cell size floored at the GPS noise
+ *
+ * Learns the shape of the area the boat actually swings through, instead of
+ * assuming a fixed circle around the anchor. A 64x64 grid of uint8 hit
+ * counts is centred on the anchor and fed one ENU fix at a time:
+ * - Update is O(1): one cell increment plus running centroid sums
+ * - Periodic decay halves every cell (one 4096-byte pass, well under 1 ms)
+ * - A fix whose 3x3 neighbourhood is empty lies outside the learned envelope
+ * - The count-weighted centroid is tracked to detect envelope migration
+ * - Cells are never smaller than ENVELOPE_CELL_NOISE_FACTOR x the 95% radius
+ *   of the calibrated GPS noise (ENVELOPE_CELL_DEFAULT_M until calibrated):
+ *   the grid widens instead, so the 3x3 tolerance ring is 1.5-3 noise radii
+ *   and scatter alone does not leave the envelope
+ * - Learning of the shape ends when the caller declares a full swing has
+ *   been seen (or after ENVELOPE_LOCK_FIXES). From then on a fix in an
+ *   occupied cell is always learned, so decay does not age out the swing.
+ *   A fix in the tolerance ring is learned only when the caller allows it
+ *   (the engine refuses while the drag rate is rising or alarmed), so the
+ *   envelope follows a wandering swing but not a slow drag. A fix outside is
+ *   never learned.
+ *
+ * Row 0 is the northern edge and column 0 the western edge, so the grid maps
+ * directly onto screen pixels for the heatmap layer (see ui_heatmap.h).
+ *
+ * Pure C (no ESP-IDF dependencies) so it can be compiled on the host.
+ */
+
+#ifndef ANCHOR_ENVELOPE_H
+#define ANCHOR_ENVELOPE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Grid geometry
+#define ENVELOPE_GRID_DIM           64
+#define ENVELOPE_CELL_COUNT         (ENVELOPE_GRID_DIM * ENVELOPE_GRID_DIM)
+#define ENVELOPE_CELL_MAX           255
+
+// Learning and detection parameters
+#define ENVELOPE_DECAY_INTERVAL     600     // Fixes between halving passes (10 min at 1 Hz)
+#define ENVELOPE_MATURE_FIXES       120     // Min fixes before learning may end
+#define ENVELOPE_LOCK_FIXES         600     // Learning ends on its own after this many fixes
+#define ENVELOPE_OCCUPIED_MIN       2       // Hit count for a cell to belong to the envelope
+#define ENVELOPE_EXIT_FIXES         3       // Consecutive outside fixes before flagging exit
+#define ENVELOPE_EXTENT_FACTOR      1.5f    // Grid half-extent as a multiple of alarm radius
+#define ENVELOPE_CELL_NOISE_FACTOR  1.5f    // Smallest cell edge / GPS noise 95% radius
+#define ENVELOPE_CELL_DEFAULT_M     4.0f    // Smallest cell until calibrated (1.5 x the 2.5 m 95% radius HULL_MARGIN_DEFAULT_M assumes)
+
+// Result flags from anchor_envelope_add()
+#define ENVELOPE_FLAG_EXIT          (1u << 0)   // Position left the learned envelope
+#define ENVELOPE_FLAG_MIGRATED      (1u << 1)   // Envelope centroid moved beyond limit
+
+typedef struct {
+    uint8_t cells[ENVELOPE_CELL_COUNT]; // Hit counts, row-major, row 0 = north
+    float half_extent_m;                // Distance from anchor to grid edge
+    float cell_m;                       // Cell edge length
+    float migrate_m;                    // Centroid displacement limit
+    uint32_t total;                     // Sum of all cell counts
+    int32_t sum_col;                    // Sum of count * column (centroid)
+    int32_t sum_row;                    // Sum of count * row (centroid)
+    uint32_t fixes;                     // Fixes accumulated since clear
+    uint16_t since_decay;               // Fixes since the last halving pass
+    uint16_t outside_run;               // Consecutive fixes outside the envelope
+    bool mature;                        // Learning phase over, detection live
+    bool ref_valid;                     // Reference centroid captured
+    float ref_east_m;                   // Reference centroid (at maturity)
+    float ref_north_m;
+    uint32_t flags;                     // Latest ENVELOPE_FLAG_* result
+} anchor_envelope_t;
+
+/**
+ * Initialise an empty envelope centred on the anchor
+ * @param env Envelope to initialise
+ * @param half_extent_m Distance from anchor to grid edge (metres, widened to fit cell_min_m)
+ * @param cell_min_m Smallest cell edge (metres, from the GPS noise floor)
+ * @param migrate_m Centroid displacement that raises ENVELOPE_FLAG_MIGRATED
+ */
+void anchor_envelope_init(anchor_envelope_t *env, float half_extent_m, float cell_min_m,
+                         float migrate_m);
+
+/**
+ * Forget all learned positions (keeps geometry)
+ * @param env Envelope
+ */
+void anchor_envelope_clear(anchor_envelope_t *env);
+
+/**
+ * Add one position fix - O(1) except on decay passes
+ * @param env Envelope
+ * @param east_m East offset from anchor (metres)
+ * @param north_m North offset from anchor (metres)
+ * @param grow false to keep a mature envelope from growing into its tolerance ring
+ * @return ENVELOPE_FLAG_* bitmask (0 while the envelope is still learning)
+ */
+uint32_t anchor_envelope_add(anchor_envelope_t *env, float east_m, float north_m, bool grow);
+
+/**
+ * Halve every cell and recompute centroid sums (whole-grid scan)
+ * @param env Envelope
+ */
+void anchor_envelope_decay(anchor_envelope_t *env);
+
+/**
+ * Test whether a position lies inside the learned envelope
+ * @param env Envelope
+ * @param east_m East offset from anchor (metres)
+ * @param north_m North offset from anchor (metres)
+ * @return true if any cell in the 3x3 neighbourhood is occupied
+ */
+bool anchor_envelope_contains(const anchor_envelope_t *env, float east_m, float north_m);
+
+/**
+ * Get the count-weighted centroid of the envelope
+ * @param env Envelope
+ * @param east_m Output east offset (metres)
+ * @param north_m Output north offset (metres)
+ * @return false if the envelope is empty
+ */
+bool anchor_envelope_centroid(const anchor_envelope_t *env, float *east_m, float *north_m);
+
+/**
+ * Re-capture the reference centroid (e.g. after the user acknowledges a move)
+ * @param env Envelope
+ */
+void anchor_envelope_rebase(anchor_envelope_t *env);
+
+/**
+ * End the learning phase (call once a full swing has been seen)
+ * @param env Envelope
+ * @return true if mature, false if fewer than ENVELOPE_MATURE_FIXES so far
+ */
+bool anchor_envelope_set_mature(anchor_envelope_t *env);
+
+/**
+ * Check whether the learning phase is over and detection is live
+ * @param env Envelope
+ * @return true once matured by the caller or after ENVELOPE_LOCK_FIXES
+ */
+bool anchor_envelope_is_mature(const anchor_envelope_t *env);
+
+#endif // ANCHOR_ENVELOPE_H
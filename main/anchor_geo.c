@@ -0,0 +1,40 @@
+/**
+ * Anchor Geodesy Helpers Implementation
+ *
+ * Author: Colin Bitterfield
+ * Email: colin@bitterfield.com
+ * Date Created: 2026-10-18
+ * Version: 0.1.0
+ */
+
+#include "anchor_geo.h"
+#include <math.h>
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+/**
+ * Initialise a local reference frame
+ */
+void geo_ref_init(geo_ref_t *ref, double lat, double lon) {
+    ref->lat0 = lat;
+    ref->lon0 = lon;
+    ref->m_per_deg_lon = GEO_METERS_PER_DEG_LAT * cos(lat * M_PI / 180.0);
+}
+
+/**
+ * Convert latitude/longitude to local East/North metres
+ */
+void geo_to_enu(const geo_ref_t *ref, double lat, double lon, float *east_m, float *north_m) {
+    *east_m = (float)((lon - ref->lon0) * ref->m_per_deg_lon);
+    *north_m = (float)((lat - ref->lat0) * GEO_METERS_PER_DEG_LAT);
+}
+
+/**
+ * Convert local East/North metres back to latitude/longitude
+ */
+void geo_from_enu(const geo_ref_t *ref, float east_m, float north_m, double *lat, double *lon) {
+    *lat = ref->lat0 + north_m / GEO_METERS_PER_DEG_LAT;
+    *lon = ref->lon0 + (ref->m_per_deg_lon > 0.0 ? east_m / ref->m_per_deg_lon : 0.0);
+}
@@ -0,0 +1,62 @@
+/**
+ * Anchor Geodesy Helpers
+ *
+ * Author: Colin Bitterfield
+ * Email: colin@bitterfield.com
+ * Date Created: 2026-10-18
+ * Version: 0.1.0
+ *
+ * Local East/North (ENU) projection around the anchor position.
+ * At anchoring ranges (< 500 m) an equirectangular projection anchored at
+ * the reference latitude is accurate to a few millimetres, so every drag
+ * detection module works in float metres relative to the anchor.
+ *
+ * Pure C (no ESP-IDF dependencies) so it can be compiled on the host.
+ */
+
+#ifndef ANCHOR_GEO_H
+#define ANCHOR_GEO_H
+
+#include <stdbool.h>
+
+// Physical constants (match docs/anchoring_mode_specification.md)
+#define GEO_METERS_PER_DEG_LAT      111320.0
+#define GEO_FEET_TO_METERS          0.3048f
+#define GEO_KNOTS_TO_MPS            0.514444f
+
+// Local tangent-plane reference (usually the anchor position)
+typedef struct {
+    double lat0;            // Reference latitude (degrees)
+    double lon0;            // Reference longitude (degrees)
+    double m_per_deg_lon;   // Metres per degree of longitude at lat0
+} geo_ref_t;
+
+/**
+ * Initialise a local reference frame
+ * @param ref Reference to initialise
+ * @param lat Reference latitude (degrees)
+ * @param lon Reference longitude (degrees)
+ */
+void geo_ref_init(geo_ref_t *ref, double lat, double lon);
+
+/**
+ * Convert latitude/longitude to local East/North metres
+ * @param ref Reference frame from geo_ref_init()
+ * @param lat Latitude (degrees)
+ * @param lon Longitude (degrees)
+ * @param east_m Output east offset (metres)
+ * @param north_m Output north offset (metres)
+ */
+void geo_to_enu(const geo_ref_t *ref, double lat, double lon, float *east_m, float *north_m);
+
+/**
+ * Convert local East/North metres back to latitude/longitude
+ * @param ref Reference frame from geo_ref_init()
+ * @param east_m East offset (metres)
+ * @param north_m North offset (metres)
+ * @param lat Output latitude (degrees)
+ * @param lon Output longitude (degrees)
+ */
+void geo_from_enu(const geo_ref_t *ref, float east_m, float north_m, double *lat, double *lon);
+
+#endif // ANCHOR_GEO_H
@@ -0,0 +1,423 @@
+/**
+ * Geodesy Kernels Implementation
+ *
+ * Author: Colin Bitterfield
+ * Email: colin@bitterfield.com
+ * Date Created: 2026-10-18
+ * Version: 0.1.0
+ */
+
+#include "anchor_geodesy.h"
+#include <math.h>
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+// Function names carry GEOD_SUFFIX (empty by default)
+#ifndef GEOD_SUFFIX
+#define GEOD_SUFFIX
+#endif
+#define GEOD_CAT2(a, b)     a##b
+#define GEOD_CAT(a, b)      GEOD_CAT2(a, b)
+#define GEOD_FN(name)       GEOD_CAT(name, GEOD_SUFFIX)
+
+#define E7_HALF_TURN        1800000000LL
+#define VINCENTY_MAX_ITER   20
+
+/**
+ * Longitude difference b - a wrapped to +-180 degrees
+ */
+static int64_t dlon_e7(geod_pos_t a, geod_pos_t b) {
+    int64_t d = (int64_t)b.lon_e7 - a.lon_e7;
+    if (d > E7_HALF_TURN) {
+        d -= 2 * E7_HALF_TURN;
+    } else if (d < -E7_HALF_TURN) {
+        d += 2 * E7_HALF_TURN;
+    }
+    return d;
+}
+
+static int32_t sat_i32(int64_t v) {
+    return v > INT32_MAX ? INT32_MAX : (v < INT32_MIN ? INT32_MIN : (int32_t)v);
+}
+
+#if GEO_PRECISION == GEO_PRECISION_FIXED
+
+/*
+ * Fixed point: values in Q30 (1.0 = 2^30) held in int64, angles in Q30
+ * radians. Products of two Q30 values are exact in int64 before rounding.
+ */
+#define Q30                 (1LL << 30)
+#define Q30_PI              3373259426LL
+#define Q30_PI_2            1686629713LL
+#define Q30_PI_4            843314857LL
+#define Q30_TAN_PI_8        444758426LL
+#define E7_TO_Q30_K         4024455254LL    // pi / 1.8e9 rad per 1e-7 degree (Q61)
+#define Q30_F               3600053LL       // Flattening
+#define Q30_OMF             1070141771LL    // 1 - f
+#define Q30_E2              7188036LL       // First eccentricity squared
+#define Q30_EP2             7236480LL       // Second eccentricity squared (a^2 - b^2) / b^2
+#define Q24_KA              186763114LL     // a, mm per 1e-7 degree of arc (Q24)
+#define Q24_KAM             185512851LL     // a (1 - e^2), mm per 1e-7 degree of arc (Q24)
+#define B_MM_4              1589188079LL    // Semi-minor axis / 4 (mm)
+#define MEAN_RADIUS_MM      6371008800ULL
+
+// sin Taylor coefficients -1/3! .. -1/11!, cos -1/2! .. 1/12!, atan -1/3 .. 1/21 (Q30)
+static const int64_t SIN_C[] = { -178956971, 8947849, -213044, 2959, -27 };
+static const int64_t COS_C[] = { -536870912, 44739243, -1491308, 26631, -296, 2 };
+static const int64_t ATAN_C[] = { -357913941, 214748365, -153391689, 119304647, -97612893,
+                                  82595525, -71582788, 63161284, -56512728, 51130563 };
+
+static int64_t qmul(int64_t a, int64_t b) {
+    return (a * b + (1LL << 29)) >> 30;
+}
+
+/**
+ * Degrees x 1e7 to Q30 radians (shift 31), or half the angle (shift 32)
+ */
+static int64_t e7_to_q30(int64_t e7, int shift) {
+    return (e7 * E7_TO_Q30_K + (1LL << (shift - 1))) >> shift;
+}
+
+/**
+ * Rounded square root: Newton from a power of two above the root
+ */
+static uint32_t isqrt64(uint64_t v) {
+    if (v == 0) {
+        return 0;
+    }
+    uint64_t x = 1ULL << ((64 - __builtin_clzll(v) + 1) / 2);
+    for (uint64_t y = (x + v / x) / 2; y < x; y = (x + v / x) / 2) {
+        x = y;
+    }
+    return (uint32_t)(v - x * x > x ? x + 1 : x);
+}
+
+/**
+ * sin and cos of a Q30 angle: quadrant reduction, then Taylor on +-pi/4
+ */
+static void q30_sincos(int64_t x, int64_t *s_out, int64_t *c_out) {
+    int64_t q = x + Q30_PI_4;
+    int64_t k = (q >= 0) ? q / Q30_PI_2 : -((-q + Q30_PI_2 - 1) / Q30_PI_2);
+    int64_t r = x - k * Q30_PI_2;
+    int64_t r2 = qmul(r, r);
+
+    int64_t ps = SIN_C[4];
+    for (int i = 3; i >= 0; i--) {
+        ps = SIN_C[i] + qmul(r2, ps);
+    }
+    int64_t s = r + qmul(qmul(r, r2), ps);
+    int64_t pc = COS_C[5];
+    for (int i = 4; i >= 0; i--) {
+        pc = COS_C[i] + qmul(r2, pc);
+    }
+    int64_t c = Q30 + qmul(r2, pc);
+
+    switch (k & 3) {
+        case 0: *s_out = s;  *c_out = c;  break;
+        case 1: *s_out = c;  *c_out = -s; break;
+        case 2: *s_out = -s; *c_out = -c; break;
+        default: *s_out = -c; *c_out = s; break;
+    }
+}
+
+/**
+ * atan of t in [0, 1] (Q30): reduced about 1 above tan(pi/8), then Taylor
+ */
+static int64_t q30_atan01(int64_t t) {
+    int64_t base = 0;
+    if (t > Q30_TAN_PI_8) {
+        t = (t - Q30) * Q30 / (t + Q30);
+        base = Q30_PI_4;
+    }
+    int64_t t2 = qmul(t, t);
+    int64_t p = ATAN_C[9];
+    for (int i = 8; i >= 0; i--) {
+        p = ATAN_C[i] + qmul(t2, p);
+    }
+    return base + t + qmul(qmul(t, t2), p);
+}
+
+/**
+ * atan2 of any two same-scale values (Q30 result in -pi..pi)
+ */
+static int64_t q30_atan2(int64_t y, int64_t x) {
+    int64_t ay = y < 0 ? -y : y;
+    int64_t ax = x < 0 ? -x : x;
+    if (ay == 0 && ax == 0) {
+        return 0;
+    }
+    while (ay > (1LL << 31) || ax > (1LL << 31)) {
+        ay >>= 1;
+        ax >>= 1;
+    }
+    int64_t a = (ay <= ax) ? q30_atan01((ay << 30) / ax) : Q30_PI_2 - q30_atan01((ax << 30) / ay);
+    if (x < 0) {
+        a = Q30_PI - a;
+    }
+    return (y < 0) ? -a : a;
+}
+
+/**
+ * Set up an equirectangular reference
+ */
+void GEOD_FN(geod_ref_init)(geod_ref_t *ref, geod_pos_t origin) {
+    int64_t s, c;
+    q30_sincos(e7_to_q30(origin.lat_e7, 31), &s, &c);
+    int64_t w = Q30 - qmul(Q30_E2, qmul(s, s));         // 1 - e^2 sin^2
+    int64_t sw = isqrt64((uint64_t)w << 30);
+    ref->origin = origin;
+    ref->scale.q.north = (int32_t)((((Q24_KAM << 30) / w) << 30) / sw);     // M
+    ref->scale.q.east = (int32_t)qmul((Q24_KA << 30) / sw, c);              // N cos(lat)
+}
+
+/**
+ * East/North offset from the reference
+ */
+void GEOD_FN(geod_enu)(const geod_ref_t *ref, geod_pos_t p, int32_t *east_mm, int32_t *north_mm) {
+    int64_t dlat = (int64_t)p.lat_e7 - ref->origin.lat_e7;
+    int64_t dlon = dlon_e7(ref->origin, p);
+    *east_mm = sat_i32((dlon * ref->scale.q.east + (1 << 23)) >> 24);
+    *north_mm = sat_i32((dlat * ref->scale.q.north + (1 << 23)) >> 24);
+}
+
+/**
+ * Equirectangular distance from the reference
+ */
+uint32_t GEOD_FN(geod_equirect_mm)(const geod_ref_t *ref, geod_pos_t p) {
+    int32_t e, n;
+    GEOD_FN(geod_enu)(ref, p, &e, &n);
+    return isqrt64((uint64_t)((int64_t)e * e) + (uint64_t)((int64_t)n * n));
+}
+
+/**
+ * Haversine great-circle distance
+ */
+uint32_t GEOD_FN(geod_haversine_mm)(geod_pos_t a, geod_pos_t b) {
+    int64_t s1, c1, s2, c2, sh, ch, sl, cl;
+    q30_sincos(e7_to_q30(a.lat_e7, 31), &s1, &c1);
+    q30_sincos(e7_to_q30(b.lat_e7, 31), &s2, &c2);
+    q30_sincos(e7_to_q30((int64_t)b.lat_e7 - a.lat_e7, 32), &sh, &ch);
+    q30_sincos(e7_to_q30(dlon_e7(a, b), 32), &sl, &cl);
+
+    int64_t h = sh * sh + qmul(qmul(c1, c2), sl) * sl;  // Q60
+    if (h > (1LL << 60)) {
+        h = 1LL << 60;
+    }
+    int64_t half = q30_atan2(isqrt64((uint64_t)h), isqrt64((uint64_t)((1LL << 60) - h)));
+    uint64_t d = (MEAN_RADIUS_MM * (uint64_t)half + (1ULL << 28)) >> 29;
+    return d > UINT32_MAX ? UINT32_MAX : (uint32_t)d;
+}
+
+/**
+ * sin and cos of the reduced latitude: tan U = (1 - f) tan lat
+ */
+static void reduced_lat(int32_t lat_e7, int64_t *sin_u, int64_t *cos_u) {
+    int64_t s, c;
+    q30_sincos(e7_to_q30(lat_e7, 31), &s, &c);
+    int64_t fs = qmul(Q30_OMF, s);
+    int64_t w = isqrt64((uint64_t)(c * c + fs * fs));
+    *sin_u = fs * Q30 / w;
+    *cos_u = c * Q30 / w;
+}
+
+/**
+ * Vincenty inverse distance on the WGS84 ellipsoid
+ */
+uint32_t GEOD_FN(geod_vincenty_mm)(geod_pos_t a, geod_pos_t b) {
+    int64_t su1, cu1, su2, cu2;
+    reduced_lat(a.lat_e7, &su1, &cu1);
+    reduced_lat(b.lat_e7, &su2, &cu2);
+    int64_t L = e7_to_q30(dlon_e7(a, b), 31);
+    int64_t lambda = L;
+    int64_t sin_s = 0, cos_s = Q30, sigma = 0, cos2a = Q30, cos2sm = 0;
+    int64_t cu1cu2 = qmul(cu1, cu2);
+    int64_t su1cu2 = qmul(su1, cu2);
+
+    for (int i = 0; i < VINCENTY_MAX_ITER; i++) {
+        int64_t sl, cl;
+        q30_sincos(lambda, &sl, &cl);
+        int64_t t1 = qmul(cu2, sl);
+        int64_t t2 = (cu1 * su2 - su1cu2 * cl + (1LL << 29)) >> 30;
+        sin_s = isqrt64((uint64_t)(t1 * t1 + t2 * t2));
+        if (sin_s == 0) {
+            return 0;
+        }
+        cos_s = (su1 * su2 + cu1cu2 * cl + (1LL << 29)) >> 30;
+        sigma = q30_atan2(sin_s, cos_s);
+        int64_t sin_a = qmul(cu1cu2, sl) * Q30 / sin_s;
+        cos2a = Q30 - qmul(sin_a, sin_a);
+        cos2sm = (cos2a > 0) ? cos_s - 2 * qmul(su1, su2) * Q30 / cos2a : 0;
+        if (cos2sm > Q30) {
+            cos2sm = Q30;
+        } else if (cos2sm < -Q30) {
+            cos2sm = -Q30;
+        }
+        int64_t C = qmul(qmul(Q30_F, cos2a), 4 * Q30 + qmul(Q30_F, 4 * Q30 - 3 * cos2a)) / 16;
+        int64_t term = cos2sm + qmul(C, qmul(cos_s, 2 * qmul(cos2sm, cos2sm) - Q30));
+        term = sigma + qmul(C, qmul(sin_s, term));
+        int64_t prev = lambda;
+        lambda = L + qmul(qmul(Q30 - C, Q30_F), qmul(sin_a, term));
+        if (lambda - prev <= 1 && prev - lambda <= 1) {
+            break;
+        }
+    }
+
+    int64_t u2 = qmul(cos2a, Q30_EP2);
+    int64_t A = Q30 + qmul(u2, 268435456 + qmul(u2, -50331648 + qmul(u2, 20971520 + qmul(u2, -11468800))));
+    int64_t B = qmul(u2, 268435456 + qmul(u2, -134217728 + qmul(u2, 77594624 + qmul(u2, -49283072))));
+    int64_t c2m2 = qmul(cos2sm, cos2sm);
+    int64_t x1 = qmul(cos_s, 2 * c2m2 - Q30);
+    int64_t y = (((4 * qmul(sin_s, sin_s) - 3 * Q30) >> 1) * ((4 * c2m2 - 3 * Q30) >> 1)) >> 28;
+    int64_t inner = x1 - qmul(qmul(B, cos2sm) / 6, y);
+    int64_t ds = qmul(qmul(B, sin_s), cos2sm + qmul(B, inner) / 4);
+    int64_t x = qmul(A, sigma - ds);
+    int64_t d = (B_MM_4 * x + (1LL << 27)) >> 28;
+    return d < 0 ? 0 : (d > UINT32_MAX ? UINT32_MAX : (uint32_t)d);
+}
+
+#else // GEO_PRECISION_DOUBLE / GEO_PRECISION_FLOAT
+
+/*
+ * Floating point: one source for both widths. RF(sin) is sin or sinf.
+ */
+#if GEO_PRECISION == GEO_PRECISION_FLOAT
+typedef float real_t;
+#define RF(fn)              fn##f
+#define VINCENTY_TOL        1e-7f
+#else
+typedef double real_t;
+#define RF(fn)              fn
+#define VINCENTY_TOL        1e-12
+#endif
+
+#define RAD_PER_E7          ((real_t)(M_PI / 180.0 / GEOD_E7))
+
+static uint32_t to_mm(real_t m) {
+    real_t mm = m * (real_t)1000.0 + (real_t)0.5;
+    return mm <= (real_t)0.0 ? 0 : (mm >= (real_t)UINT32_MAX ? UINT32_MAX : (uint32_t)mm);
+}
+
+/**
+ * Set up an equirectangular reference
+ */
+void GEOD_FN(geod_ref_init)(geod_ref_t *ref, geod_pos_t origin) {
+    const real_t e2 = (real_t)(GEOD_WGS84_F * (2.0 - GEOD_WGS84_F));
+    real_t lat = origin.lat_e7 * RAD_PER_E7;
+    real_t s = RF(sin)(lat);
+    real_t w = (real_t)1.0 - e2 * s * s;
+    real_t n = (real_t)GEOD_WGS84_A / RF(sqrt)(w);                  // Prime vertical radius
+    real_t m = n * ((real_t)1.0 - e2) / w;                          // Meridian radius
+    ref->origin = origin;
+#if GEO_PRECISION == GEO_PRECISION_FLOAT
+    ref->scale.f.north = m * RAD_PER_E7;
+    ref->scale.f.east = n * RF(cos)(lat) * RAD_PER_E7;
+#else
+    ref->scale.d.north = m * RAD_PER_E7;
+    ref->scale.d.east = n * cos(lat) * RAD_PER_E7;
+#endif
+}
+
+static void enu_m(const geod_ref_t *ref, geod_pos_t p, real_t *e, real_t *n) {
+    real_t dlat = (real_t)((int64_t)p.lat_e7 - ref->origin.lat_e7);
+    real_t dlon = (real_t)dlon_e7(ref->origin, p);
+#if GEO_PRECISION == GEO_PRECISION_FLOAT
+    *e = dlon * ref->scale.f.east;
+    *n = dlat * ref->scale.f.north;
+#else
+    *e = dlon * ref->scale.d.east;
+    *n = dlat * ref->scale.d.north;
+#endif
+}
+
+/**
+ * East/North offset from the reference
+ */
+void GEOD_FN(geod_enu)(const geod_ref_t *ref, geod_pos_t p, int32_t *east_mm, int32_t *north_mm) {
+    real_t e, n;
+    enu_m(ref, p, &e, &n);
+    *east_mm = sat_i32((int64_t)RF(floor)(e * (real_t)1000.0 + (real_t)0.5));
+    *north_mm = sat_i32((int64_t)RF(floor)(n * (real_t)1000.0 + (real_t)0.5));
+}
+
+/**
+ * Equirectangular distance from the reference
+ */
+uint32_t GEOD_FN(geod_equirect_mm)(const geod_ref_t *ref, geod_pos_t p) {
+    real_t e, n;
+    enu_m(ref, p, &e, &n);
+    return to_mm(RF(sqrt)(e * e + n * n));
+}
+
+/**
+ * Haversine great-circle distance
+ */
+uint32_t GEOD_FN(geod_haversine_mm)(geod_pos_t a, geod_pos_t b) {
+    real_t lat1 = a.lat_e7 * RAD_PER_E7;
+    real_t lat2 = b.lat_e7 * RAD_PER_E7;
+    real_t sh = RF(sin)((real_t)((int64_t)b.lat_e7 - a.lat_e7) * RAD_PER_E7 * (real_t)0.5);
+    real_t sl = RF(sin)((real_t)dlon_e7(a, b) * RAD_PER_E7 * (real_t)0.5);
+    real_t h = sh * sh + RF(cos)(lat1) * RF(cos)(lat2) * sl * sl;
+    if (h > (real_t)1.0) {
+        h = (real_t)1.0;
+    }
+    real_t c = (real_t)2.0 * RF(atan2)(RF(sqrt)(h), RF(sqrt)((real_t)1.0 - h));
+    return to_mm((real_t)GEOD_MEAN_RADIUS_M * c);
+}
+
+/**
+ * Vincenty inverse distance on the WGS84 ellipsoid
+ */
+uint32_t GEOD_FN(geod_vincenty_mm)(geod_pos_t a, geod_pos_t b) {
+    const real_t f = (real_t)GEOD_WGS84_F;
+    const real_t bm = (real_t)(GEOD_WGS84_A * (1.0 - GEOD_WGS84_F));
+    const real_t ep2 = (real_t)(GEOD_WGS84_F * (2.0 - GEOD_WGS84_F) /
+                                ((1.0 - GEOD_WGS84_F) * (1.0 - GEOD_WGS84_F)));
+    real_t lat1 = a.lat_e7 * RAD_PER_E7;
+    real_t lat2 = b.lat_e7 * RAD_PER_E7;
+    real_t fs1 = ((real_t)1.0 - f) * RF(sin)(lat1), c1 = RF(cos)(lat1);
+    real_t fs2 = ((real_t)1.0 - f) * RF(sin)(lat2), c2 = RF(cos)(lat2);
+    real_t w1 = RF(sqrt)(c1 * c1 + fs1 * fs1), w2 = RF(sqrt)(c2 * c2 + fs2 * fs2);
+    real_t su1 = fs1 / w1, cu1 = c1 / w1;
+    real_t su2 = fs2 / w2, cu2 = c2 / w2;
+    real_t L = (real_t)dlon_e7(a, b) * RAD_PER_E7;
+    real_t lambda = L;
+    real_t sin_s = 0, cos_s = 1, sigma = 0, cos2a = 1, cos2sm = 0;
+
+    for (int i = 0; i < VINCENTY_MAX_ITER * 5; i++) {
+        real_t sl = RF(sin)(lambda), cl = RF(cos)(lambda);
+        real_t t1 = cu2 * sl;
+        real_t t2 = cu1 * su2 - su1 * cu2 * cl;
+        sin_s = RF(sqrt)(t1 * t1 + t2 * t2);
+        if (sin_s == (real_t)0.0) {
+            return 0;
+        }
+        cos_s = su1 * su2 + cu1 * cu2 * cl;
+        sigma = RF(atan2)(sin_s, cos_s);
+        real_t sin_a = cu1 * cu2 * sl / sin_s;
+        cos2a = (real_t)1.0 - sin_a * sin_a;
+        cos2sm = (cos2a != (real_t)0.0) ? cos_s - (real_t)2.0 * su1 * su2 / cos2a : (real_t)0.0;
+        real_t C = f / (real_t)16.0 * cos2a * ((real_t)4.0 + f * ((real_t)4.0 - (real_t)3.0 * cos2a));
+        real_t prev = lambda;
+        lambda = L + ((real_t)1.0 - C) * f * sin_a *
+                 (sigma + C * sin_s * (cos2sm + C * cos_s * ((real_t)-1.0 + (real_t)2.0 * cos2sm * cos2sm)));
+        if (RF(fabs)(lambda - prev) < VINCENTY_TOL) {
+            break;
+        }
+    }
+
+    real_t u2 = cos2a * ep2;
+    real_t A = (real_t)1.0 + u2 / (real_t)16384.0 *
+               ((real_t)4096.0 + u2 * ((real_t)-768.0 + u2 * ((real_t)320.0 - (real_t)175.0 * u2)));
+    real_t B = u2 / (real_t)1024.0 *
+               ((real_t)256.0 + u2 * ((real_t)-128.0 + u2 * ((real_t)74.0 - (real_t)47.0 * u2)));
+    real_t c2m2 = cos2sm * cos2sm;
+    real_t ds = B * sin_s * (cos2sm + B / (real_t)4.0 *
+                (cos_s * ((real_t)-1.0 + (real_t)2.0 * c2m2) -
+                 B / (real_t)6.0 * cos2sm * ((real_t)-3.0 + (real_t)4.0 * sin_s * sin_s) *
+                 ((real_t)-3.0 + (real_t)4.0 * c2m2)));
+    return to_mm(bm * A * (sigma - ds));
+}
+
+#endif // GEO_PRECISION
@@ -0,0 +1,125 @@
+/**
+ * Geodesy Kernels with Compile-Time Precision
+ *
+ * Author: Colin Bitterfield
+ * Email: colin@bitterfield.com
+ * Date Created: 2026-10-18
+ * Version: 0.1.0
+ *
+ * Position-to-metres kernels on integer positions (1e-7 degree, the NMEA
+ * 2000 resolution, ~1.1 cm):
+ * - Equirectangular: East/North from a precomputed reference, scaled by the
+ *   WGS84 meridian and prime-vertical radii at the reference latitude.
+ *   The per-fix path is two multiplies.
+ * - Haversine: great-circle distance on the mean-radius sphere.
+ * - Vincenty: inverse geodesic on the WGS84 ellipsoid (sub-millimetre in
+ *   double precision; the reference for the others).
+ *
+ * GEO_PRECISION picks the arithmetic at compile time (Kconfig
+ * ANCHOR_GEODESY_PRECISION on the target, -D on the host):
+ * - GEO_PRECISION_DOUBLE: double and libm. Software floating point on the
+ *   ESP32-S3, which only has a single-precision FPU.
+ * - GEO_PRECISION_FLOAT: float and libm, with coordinate differences taken
+ *   in integers first so nothing cancels in float.
+ * - GEO_PRECISION_FIXED: int32/int64 only. Angles are Q30 radians; sin/cos
+ *   are degree 9/10 Taylor polynomials on +-pi/4 (truncation < 2e-10) and
+ *   atan is a degree 21 polynomial on +-tan(pi/8) (truncation < 1e-10),
+ *   so one Q30 ulp (9.3e-10 rad, 6 mm on the Earth) dominates. Measured
+ *   bounds per kernel and range are in docs/drag_detection.md
+ *   (host/geodesy_bench.c).
+ *
+ * Distances are millimetres and saturate at UINT32_MAX (4295 km); the
+ * kernels target anchoring and AIS ranges. Defining GEOD_SUFFIX when
+ * compiling anchor_geodesy.c renames its functions (geod_enu_fixed, ...),
+ * so a benchmark can link every mode side by side (GEOD_DECLARE_MODE).
+ * Pure C (no ESP-IDF dependencies) so it can be compiled on the host.
+ */
+
+#ifndef ANCHOR_GEODESY_H
+#define ANCHOR_GEODESY_H
+
+#include <stdint.h>
+
+#define GEO_PRECISION_DOUBLE    0
+#define GEO_PRECISION_FLOAT     1
+#define GEO_PRECISION_FIXED     2
+
+#ifndef GEO_PRECISION
+#define GEO_PRECISION           GEO_PRECISION_FIXED
+#endif
+
+// WGS84
+#define GEOD_WGS84_A            6378137.0               // Semi-major axis (m)
+#define GEOD_WGS84_F            (1.0 / 298.257223563)   // Flattening
+#define GEOD_MEAN_RADIUS_M      6371008.8               // IUGG mean radius (haversine)
+#define GEOD_E7                 10000000.0              // Position units per degree
+
+// Degrees to 1e-7 degree (rounded)
+#define GEOD_DEG_TO_E7(deg)     ((int32_t)((deg) * GEOD_E7 + ((deg) >= 0.0 ? 0.5 : -0.5)))
+
+// Position in 1e-7 degrees
+typedef struct {
+    int32_t lat_e7;
+    int32_t lon_e7;
+} geod_pos_t;
+
+// Equirectangular reference (scales in the arithmetic of the mode that set it up)
+typedef struct {
+    geod_pos_t origin;
+    union {
+        struct { double north, east; } d;       // Metres per 1e-7 degree
+        struct { float north, east; } f;
+        struct { int32_t north, east; } q;      // Millimetres per 1e-7 degree (Q24)
+    } scale;
+} geod_ref_t;
+
+/**
+ * Set up an equirectangular reference (once per anchor)
+ * @param ref Reference to initialise
+ * @param origin Reference position
+ */
+void geod_ref_init(geod_ref_t *ref, geod_pos_t origin);
+
+/**
+ * East/North offset from the reference
+ * @param ref Reference from geod_ref_init()
+ * @param p Position
+ * @param east_mm Output east offset (millimetres)
+ * @param north_mm Output north offset (millimetres)
+ */
+void geod_enu(const geod_ref_t *ref, geod_pos_t p, int32_t *east_mm, int32_t *north_mm);
+
+/**
+ * Equirectangular distance from the reference
+ * @param ref Reference from geod_ref_init()
+ * @param p Position
+ * @return Distance (millimetres)
+ */
+uint32_t geod_equirect_mm(const geod_ref_t *ref, geod_pos_t p);
+
+/**
+ * Haversine great-circle distance
+ * @param a First position
+ * @param b Second position
+ * @return Distance (millimetres)
+ */
+uint32_t geod_haversine_mm(geod_pos_t a, geod_pos_t b);
+
+/**
+ * Vincenty inverse distance on the WGS84 ellipsoid
+ * Nearly antipodal points may not converge; the last iterate is used.
+ * @param a First position
+ * @param b Second position
+ * @return Distance (millimetres)
+ */
+uint32_t geod_vincenty_mm(geod_pos_t a, geod_pos_t b);
+
+// Prototypes of a copy compiled with -DGEOD_SUFFIX=sfx
+#define GEOD_DECLARE_MODE(sfx) \
+    void geod_ref_init##sfx(geod_ref_t *ref, geod_pos_t origin); \
+    void geod_enu##sfx(const geod_ref_t *ref, geod_pos_t p, int32_t *east_mm, int32_t *north_mm); \
+    uint32_t geod_equirect_mm##sfx(const geod_ref_t *ref, geod_pos_t p); \
+    uint32_t geod_haversine_mm##sfx(geod_pos_t a, geod_pos_t b); \
+    uint32_t geod_vincenty_mm##sfx(geod_pos_t a, geod_pos_t b);
+
+#endif // ANCHOR_GEODESY_H
@@ -0,0 +1,329 @@
+/**
+ * Geofence Zones Implementation
+ *
+ * Author: Colin Bitterfield
+ * Email: colin@bitterfield.com
+ * Date Created: 2026-10-18
+ * Date Updated: 2026-10-18
+ * Version: 0.1.1
+ *
+ * Changelog:
+ * - 0.1.1 (2026-10-18): Zones that fail to recompile after an origin move are disabled and reported
+ */
+
+#include "anchor_geofence.h"
+#include <string.h>
+#include <math.h>
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+#define GEOFENCE_CELL_OUTSIDE   0
+#define GEOFENCE_CELL_INSIDE    1
+#define GEOFENCE_CELL_BOUNDARY  2
+
+/**
+ * Grid index of a coordinate, clamped to the grid
+ */
+static int geofence_cell_index(float v, float min, float size) {
+    int i = (int)((v - min) / size);
+    if (i < 0) return 0;
+    if (i >= GEOFENCE_GRID) return GEOFENCE_GRID - 1;
+    return i;
+}
+
+/**
+ * Ray-cast (+x) against the edges in a mask (half-open in y, so vertices count once)
+ */
+static bool geofence_ray_cast(const geofence_zone_t *zone, uint64_t mask, float x, float y) {
+    const geofence_pt_t *v = zone->def.v;
+    int n = zone->def.n;
+    bool inside = false;
+    while (mask) {
+        int i = __builtin_ctzll(mask);
+        mask &= mask - 1;
+        const geofence_pt_t *a = &v[i];
+        const geofence_pt_t *b = &v[(i + 1 == n) ? 0 : i + 1];
+        if ((a->y > y) != (b->y > y) && x < a->x + (y - a->y) * zone->inv_slope[i]) {
+            inside = !inside;
+        }
+    }
+    return inside;
+}
+
+/**
+ * Mark the grid cells an edge passes through as boundary cells
+ */
+static void geofence_mark_edge(geofence_zone_t *zone, const geofence_pt_t *a, const geofence_pt_t *b) {
+    float lo_y = fminf(a->y, b->y);
+    float hi_y = fmaxf(a->y, b->y);
+    int r0 = geofence_cell_index(lo_y, zone->min_y, zone->cell_h);
+    int r1 = geofence_cell_index(hi_y, zone->min_y, zone->cell_h);
+
+    for (int r = r0; r <= r1; r++) {
+        // Clip the edge to this row's band and take its x extent
+        float band_lo = fmaxf(lo_y, zone->min_y + r * zone->cell_h);
+        float band_hi = fminf(hi_y, zone->min_y + (r + 1) * zone->cell_h);
+        float x_lo, x_hi;
+        if (hi_y > lo_y) {
+            float xa = a->x + (band_lo - a->y) * (b->x - a->x) / (b->y - a->y);
+            float xb = a->x + (band_hi - a->y) * (b->x - a->x) / (b->y - a->y);
+            x_lo = fminf(xa, xb);
+            x_hi = fmaxf(xa, xb);
+        } else {
+            x_lo = fminf(a->x, b->x);
+            x_hi = fmaxf(a->x, b->x);
+        }
+        int c0 = geofence_cell_index(x_lo, zone->min_x, zone->cell_w);
+        int c1 = geofence_cell_index(x_hi, zone->min_x, zone->cell_w);
+        for (int c = c0; c <= c1; c++) {
+            zone->cell[r * GEOFENCE_GRID + c] = GEOFENCE_CELL_BOUNDARY;
+        }
+    }
+}
+
+/**
+ * Build the edge table and grid index of a polygon
+ */
+static bool geofence_compile_polygon(geofence_zone_t *zone) {
+    const geofence_def_t *def = &zone->def;
+    if (def->n < 3 || def->n > GEOFENCE_MAX_VERTICES) {
+        return false;
+    }
+
+    zone->min_x = zone->max_x = def->v[0].x;
+    zone->min_y = zone->max_y = def->v[0].y;
+    for (int i = 1; i < def->n; i++) {
+        zone->min_x = fminf(zone->min_x, def->v[i].x);
+        zone->max_x = fmaxf(zone->max_x, def->v[i].x);
+        zone->min_y = fminf(zone->min_y, def->v[i].y);
+        zone->max_y = fmaxf(zone->max_y, def->v[i].y);
+    }
+    zone->cell_w = (zone->max_x - zone->min_x) / GEOFENCE_GRID;
+    zone->cell_h = (zone->max_y - zone->min_y) / GEOFENCE_GRID;
+    if (zone->cell_w <= 0.0f || zone->cell_h <= 0.0f) {
+        return false;   // Degenerate (all vertices on a line)
+    }
+
+    memset(zone->row_edges, 0, sizeof(zone->row_edges));
+    memset(zone->cell, GEOFENCE_CELL_OUTSIDE, sizeof(zone->cell));
+    for (int i = 0; i < def->n; i++) {
+        const geofence_pt_t *a = &def->v[i];
+        const geofence_pt_t *b = &def->v[(i + 1) % def->n];
+        geofence_mark_edge(zone, a, b);
+        if (a->y == b->y) {
+            zone->inv_slope[i] = 0.0f;   // Horizontal edges never cross the ray
+            continue;
+        }
+        zone->inv_slope[i] = (b->x - a->x) / (b->y - a->y);
+        int r0 = geofence_cell_index(fminf(a->y, b->y), zone->min_y, zone->cell_h);
+        int r1 = geofence_cell_index(fmaxf(a->y, b->y), zone->min_y, zone->cell_h);
+        for (int r = r0; r <= r1; r++) {
+            zone->row_edges[r] |= (uint64_t)1 << i;
+        }
+    }
+
+    // Cells no edge touches are wholly inside or outside: classify by their centre
+    uint64_t all = (def->n == 64) ? ~(uint64_t)0 : (((uint64_t)1 << def->n) - 1);
+    for (int r = 0; r < GEOFENCE_GRID; r++) {
+        for (int c = 0; c < GEOFENCE_GRID; c++) {
+            uint8_t *cell = &zone->cell[r * GEOFENCE_GRID + c];
+            if (*cell == GEOFENCE_CELL_BOUNDARY) {
+                continue;
+            }
+            float x = zone->min_x + (c + 0.5f) * zone->cell_w;
+            float y = zone->min_y + (r + 0.5f) * zone->cell_h;
+            *cell = geofence_ray_cast(zone, all, x, y) ? GEOFENCE_CELL_INSIDE : GEOFENCE_CELL_OUTSIDE;
+        }
+    }
+    return true;
+}
+
+/**
+ * Precompute radii and start/end unit vectors of an annular sector
+ */
+static bool geofence_compile_sector(geofence_zone_t *zone) {
+    const geofence_def_t *def = &zone->def;
+    if (def->r_out_m <= def->r_in_m || def->r_in_m < 0.0f ||
+        def->sweep_deg <= 0.0f || def->sweep_deg > 360.0f) {
+        return false;
+    }
+
+    zone->r_in2 = def->r_in_m * def->r_in_m;
+    zone->r_out2 = def->r_out_m * def->r_out_m;
+    float a0 = def->start_deg * (float)M_PI / 180.0f;
+    float a1 = (def->start_deg + def->sweep_deg) * (float)M_PI / 180.0f;
+    zone->ux0 = sinf(a0);
+    zone->uy0 = cosf(a0);
+    zone->ux1 = sinf(a1);
+    zone->uy1 = cosf(a1);
+    zone->wide = def->sweep_deg > 180.0f;
+
+    zone->min_x = def->center.x - def->r_out_m;
+    zone->max_x = def->center.x + def->r_out_m;
+    zone->min_y = def->center.y - def->r_out_m;
+    zone->max_y = def->center.y + def->r_out_m;
+    return true;
+}
+
+/**
+ * Compile a zone from its definition
+ */
+static bool geofence_compile(geofence_zone_t *zone) {
+    switch (zone->def.type) {
+        case GEOFENCE_POLYGON: return geofence_compile_polygon(zone);
+        case GEOFENCE_SECTOR:  return geofence_compile_sector(zone);
+        default:               return false;
+    }
+}
+
+/**
+ * Initialise an empty zone set
+ */
+void anchor_geofence_init(anchor_geofence_t *set) {
+    memset(set, 0, sizeof(*set));
+}
+
+/**
+ * Set the ENU origin of the zone set
+ */
+uint32_t anchor_geofence_set_origin(anchor_geofence_t *set, double lat, double lon) {
+    uint32_t failed = 0;
+    if (set->origin_valid && set->count > 0) {
+        // Shift existing zones into the new frame
+        float dx, dy;
+        geo_to_enu(&set->origin, lat, lon, &dx, &dy);
+        for (int z = 0; z < set->count; z++) {
+            geofence_def_t *def = &set->zone[z].def;
+            for (int i = 0; i < def->n; i++) {
+                def->v[i].x -= dx;
+                def->v[i].y -= dy;
+            }
+            def->center.x -= dx;
+            def->center.y -= dy;
+            if (!geofence_compile(&set->zone[z])) {
+                // Rounding collapsed it: stop evaluating the old tables
+                set->zone[z].def.enabled = false;
+                set->run[z] = 0;
+                failed |= 1u << z;
+            }
+        }
+    }
+    geo_ref_init(&set->origin, lat, lon);
+    set->origin_valid = true;
+    return failed;
+}
+
+/**
+ * Compile and add a zone
+ */
+int anchor_geofence_add(anchor_geofence_t *set, const geofence_def_t *def) {
+    if (set->count >= GEOFENCE_MAX_ZONES) {
+        return -1;
+    }
+    geofence_zone_t *zone = &set->zone[set->count];
+    zone->def = *def;
+    zone->def.name[GEOFENCE_NAME_LEN - 1] = '\0';
+    if (!geofence_compile(zone)) {
+        return -1;
+    }
+    set->run[set->count] = 0;
+    return set->count++;
+}
+
+/**
+ * Remove a zone
+ */
+bool anchor_geofence_remove(anchor_geofence_t *set, int index) {
+    if (index < 0 || index >= set->count) {
+        return false;
+    }
+    int tail = set->count - index - 1;
+    memmove(&set->zone[index], &set->zone[index + 1], tail * sizeof(set->zone[0]));
+    memmove(&set->run[index], &set->run[index + 1], tail * sizeof(set->run[0]));
+    set->count--;
+    return true;
+}
+
+/**
+ * Test a point against one compiled zone
+ */
+bool anchor_geofence_zone_contains(const geofence_zone_t *zone, float x, float y) {
+    if (x < zone->min_x || x > zone->max_x || y < zone->min_y || y > zone->max_y) {
+        return false;
+    }
+
+    if (zone->def.type == GEOFENCE_SECTOR) {
+        float dx = x - zone->def.center.x;
+        float dy = y - zone->def.center.y;
+        float d2 = dx * dx + dy * dy;
+        if (d2 < zone->r_in2 || d2 > zone->r_out2) {
+            return false;
+        }
+        if (zone->def.sweep_deg >= 360.0f) {
+            return true;
+        }
+        // Cross products: negative when the second vector is clockwise of the first
+        float c0 = zone->ux0 * dy - zone->uy0 * dx;     // start -> point
+        float c1 = dx * zone->uy1 - dy * zone->ux1;     // point -> end
+        if (zone->wide) {
+            return !(c0 > 0.0f && c1 > 0.0f);           // Not in the narrow complement
+        }
+        return c0 <= 0.0f && c1 <= 0.0f;
+    }
+
+    int r = geofence_cell_index(y, zone->min_y, zone->cell_h);
+    int c = geofence_cell_index(x, zone->min_x, zone->cell_w);
+    uint8_t cell = zone->cell[r * GEOFENCE_GRID + c];
+    if (cell != GEOFENCE_CELL_BOUNDARY) {
+        return cell == GEOFENCE_CELL_INSIDE;
+    }
+    return geofence_ray_cast(zone, zone->row_edges[r], x, y);
+}
+
+/**
+ * Evaluate all enabled zones at an ENU point
+ */
+uint32_t anchor_geofence_eval(const anchor_geofence_t *set, float x, float y) {
+    uint32_t hits = 0;
+    for (int z = 0; z < set->count; z++) {
+        const geofence_zone_t *zone = &set->zone[z];
+        if (!zone->def.enabled) {
+            continue;
+        }
+        bool inside = anchor_geofence_zone_contains(zone, x, y);
+        if (inside != (zone->def.kind == GEOFENCE_KEEP_IN)) {
+            hits |= 1u << z;
+        }
+    }
+    return hits;
+}
+
+/**
+ * Evaluate all enabled zones for one fix, debounced per zone
+ */
+uint32_t anchor_geofence_check(anchor_geofence_t *set, double lat, double lon) {
+    if (!set->origin_valid || set->count == 0) {
+        return 0;
+    }
+
+    float x, y;
+    geo_to_enu(&set->origin, lat, lon, &x, &y);
+    uint32_t raw = anchor_geofence_eval(set, x, y);
+
+    uint32_t hits = 0;
+    for (int z = 0; z < set->count; z++) {
+        if (raw & (1u << z)) {
+            if (set->run[z] < GEOFENCE_EXIT_FIXES) {
+                set->run[z]++;
+            }
+            if (set->run[z] >= GEOFENCE_EXIT_FIXES) {
+                hits |= 1u << z;
+            }
+        } else {
+            set->run[z] = 0;
+        }
+    }
+    return hits;
+}
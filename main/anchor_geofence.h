@@ -0,0 +1,161 @@
+/**
+ * Geofence Zones (Polygons and Annular Sectors)
+ *
+ * Author: Colin Bitterfield
+ * Email: colin@bitterfield.com
+ * Date Created: 2026-10-18
+ * Date Updated: 2026-10-18
+ * Version: 0.1.1
+ *
+ * Changelog:
+ * - 0.1.1 (2026-10-18): anchor_geofence_set_origin() disables and reports zones that fail to recompile
+ *
+ * User-defined exclusion (shoal, neighbouring boat) and keep-in zones in a
+ * local East/North frame around a fixed origin. Each zone is compiled once
+ * when it is added:
+ * - Polygon: bounding box, per-edge inverse slope, and an 8x8 grid over the
+ *   box. Grid cells that no edge touches are pre-classified inside/outside.
+ *   Each grid row keeps a 64-bit mask of the edges that span it, so a point
+ *   in a boundary cell ray-casts only against those edges.
+ * - Annular sector: squared radii and the start/end unit vectors, so the
+ *   test is two cross products with no trigonometry.
+ *
+ * A fix outside the box or in a pre-classified cell costs a few compares.
+ * Twenty 64-vertex zones evaluate in about a microsecond on the host
+ * (host/geofence_bench.c).
+ * Pure C (no ESP-IDF dependencies) so it can be compiled on the host.
+ */
+
+#ifndef ANCHOR_GEOFENCE_H
+#define ANCHOR_GEOFENCE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "anchor_geo.h"
+
+#define GEOFENCE_MAX_ZONES      20
+#define GEOFENCE_MAX_VERTICES   64
+#define GEOFENCE_GRID           8       // Grid cells per side
+#define GEOFENCE_NAME_LEN       16
+#define GEOFENCE_EXIT_FIXES     3       // Consecutive violating fixes before flagging
+#define GEOFENCE_BLOB_VERSION   1       // Bump when geofence_def_t changes (NVS blob)
+
+typedef enum {
+    GEOFENCE_POLYGON = 0,
+    GEOFENCE_SECTOR
+} geofence_type_t;
+
+typedef enum {
+    GEOFENCE_EXCLUDE = 0,       // Alarm when inside (shoal, other boat)
+    GEOFENCE_KEEP_IN            // Alarm when outside
+} geofence_kind_t;
+
+typedef struct {
+    float x;                    // East (metres)
+    float y;                    // North (metres)
+} geofence_pt_t;
+
+// Zone definition (what is edited and saved)
+typedef struct {
+    uint8_t type;               // geofence_type_t
+    uint8_t kind;               // geofence_kind_t
+    bool enabled;
+    char name[GEOFENCE_NAME_LEN];
+    // Polygon
+    uint8_t n;
+    geofence_pt_t v[GEOFENCE_MAX_VERTICES];
+    // Annular sector (bearings true, clockwise from start)
+    geofence_pt_t center;
+    float r_in_m;
+    float r_out_m;
+    float start_deg;
+    float sweep_deg;
+} geofence_def_t;
+
+// Compiled zone
+typedef struct {
+    geofence_def_t def;
+    float min_x, min_y, max_x, max_y;       // Bounding box
+    // Polygon
+    float inv_slope[GEOFENCE_MAX_VERTICES]; // dx/dy of edge i -> i+1
+    float cell_w, cell_h;
+    uint64_t row_edges[GEOFENCE_GRID];      // Edges spanning each grid row
+    uint8_t cell[GEOFENCE_GRID * GEOFENCE_GRID];    // GEOFENCE_CELL_*
+    // Sector
+    float r_in2, r_out2;
+    float ux0, uy0, ux1, uy1;               // Start / end unit vectors
+    bool wide;                              // Sweep over 180 degrees
+} geofence_zone_t;
+
+// Zone set in one ENU frame
+typedef struct {
+    geo_ref_t origin;
+    bool origin_valid;
+    uint8_t count;
+    geofence_zone_t zone[GEOFENCE_MAX_ZONES];
+    uint8_t run[GEOFENCE_MAX_ZONES];        // Consecutive violating fixes per zone
+} anchor_geofence_t;
+
+/**
+ * Initialise an empty zone set
+ * @param set Zone set
+ */
+void anchor_geofence_init(anchor_geofence_t *set);
+
+/**
+ * Set the ENU origin of the zone set
+ *
+ * Zones already in the set are shifted into the new frame and recompiled. A
+ * zone that no longer compiles is disabled (def.enabled = false) rather than
+ * evaluated with stale tables.
+ * @param set Zone set
+ * @param lat Origin latitude (degrees)
+ * @param lon Origin longitude (degrees)
+ * @return Bitmask of zones disabled because they failed to recompile (0 normally)
+ */
+uint32_t anchor_geofence_set_origin(anchor_geofence_t *set, double lat, double lon);
+
+/**
+ * Compile and add a zone
+ * @param set Zone set
+ * @param def Zone definition (polygon needs n >= 3, sector r_out_m > r_in_m)
+ * @return Zone index, or -1 if the set is full or the definition is invalid
+ */
+int anchor_geofence_add(anchor_geofence_t *set, const geofence_def_t *def);
+
+/**
+ * Remove a zone
+ * @param set Zone set
+ * @param index Zone index
+ * @return true if removed
+ */
+bool anchor_geofence_remove(anchor_geofence_t *set, int index);
+
+/**
+ * Test a point against one compiled zone
+ * @param zone Compiled zone
+ * @param x East (metres, zone-set frame)
+ * @param y North (metres, zone-set frame)
+ * @return true if the point is inside the zone
+ */
+bool anchor_geofence_zone_contains(const geofence_zone_t *zone, float x, float y);
+
+/**
+ * Evaluate all enabled zones for one fix
+ * @param set Zone set
+ * @param lat Latitude (degrees)
+ * @param lon Longitude (degrees)
+ * @return Bitmask of zones violated for GEOFENCE_EXIT_FIXES consecutive fixes
+ */
+uint32_t anchor_geofence_check(anchor_geofence_t *set, double lat, double lon);
+
+/**
+ * Evaluate all enabled zones at an ENU point (no debouncing)
+ * @param set Zone set
+ * @param x East (metres, zone-set frame)
+ * @param y North (metres, zone-set frame)
+ * @return Bitmask of zones violated at the point
+ */
+uint32_t anchor_geofence_eval(const anchor_geofence_t *set, float x, float y);
+
+#endif // ANCHOR_GEOFENCE_H
@@ -0,0 +1,347 @@
+/**
+ * Adaptive Safe Zone - Incremental Convex Hull Implementation
+ *
+ * Author: Colin Bitterfield
+ * Email: colin@bitterfield.com
+ * Date Created: 2026-10-18
+ * Date Updated: 2026-10-18
+ * Version: 0.3.0
+ *
+ * Changelog:
+ * - 0.3.0 (2026-10-18): Timed polygon exit; learn excursions once the boat
+ *   is back inside
+ * - 0.2.0 (2026-10-18): Keep learning within the reach once ready; exit
+ *   needs the reach too
+ */
+
+#include "anchor_hull.h"
+#include <string.h>
+#include <math.h>
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+#define HULL_DEG_TO_RAD     ((float)M_PI / 180.0f)
+
+/**
+ * Cross product of (a - o) x (b - o); > 0 when o->a->b turns left
+ */
+static inline float hull_cross(hull_pt_t o, hull_pt_t a, hull_pt_t b) {
+    return (a.x - o.x) * (b.y - o.y) - (a.y - o.y) * (b.x - o.x);
+}
+
+/**
+ * Lexicographic (x, then y) ordering for the monotone chain
+ */
+static inline bool hull_less(hull_pt_t a, hull_pt_t b) {
+    return (a.x < b.x) || (a.x == b.x && a.y < b.y);
+}
+
+/**
+ * O(log n) point-in-convex-polygon (counter-clockwise, n >= 3)
+ */
+static bool hull_poly_contains(const hull_pt_t *p, int n, hull_pt_t q) {
+    if (n < 3) {
+        return false;
+    }
+
+    // Outside the fan spanned by p[1]..p[n-1] as seen from p[0]
+    if (hull_cross(p[0], p[1], q) < 0.0f || hull_cross(p[0], p[n - 1], q) > 0.0f) {
+        return false;
+    }
+
+    // Binary search for the wedge p[0], p[lo], p[lo+1] containing q
+    int lo = 1;
+    int hi = n - 1;
+    while (hi - lo > 1) {
+        int mid = (lo + hi) / 2;
+        if (hull_cross(p[0], p[mid], q) >= 0.0f) {
+            lo = mid;
+        } else {
+            hi = mid;
+        }
+    }
+    return hull_cross(p[lo], p[hi], q) >= 0.0f;
+}
+
+/**
+ * Rebuild a hull (v, n) from its vertices plus one new point (monotone chain)
+ */
+static void hull_insert(hull_pt_t *v, uint8_t *n, hull_pt_t q) {
+    hull_pt_t sorted[HULL_MAX_VERTICES + 1];
+    int count = 0;
+
+    // Existing vertices plus q, insertion-sorted (n is at most 33)
+    for (int i = 0; i <= *n; i++) {
+        hull_pt_t p = (i < *n) ? v[i] : q;
+        int j = count++;
+        while (j > 0 && hull_less(p, sorted[j - 1])) {
+            sorted[j] = sorted[j - 1];
+            j--;
+        }
+        sorted[j] = p;
+    }
+
+    if (count < 3) {
+        memcpy(v, sorted, count * sizeof(hull_pt_t));
+        *n = (uint8_t)count;
+        return;
+    }
+
+    // Lower then upper chain; result is counter-clockwise without repeat
+    hull_pt_t out[2 * (HULL_MAX_VERTICES + 1)];
+    int k = 0;
+    for (int i = 0; i < count; i++) {
+        while (k >= 2 && hull_cross(out[k - 2], out[k - 1], sorted[i]) <= 0.0f) k--;
+        out[k++] = sorted[i];
+    }
+    for (int i = count - 2, t = k + 1; i >= 0; i--) {
+        while (k >= t && hull_cross(out[k - 2], out[k - 1], sorted[i]) <= 0.0f) k--;
+        out[k++] = sorted[i];
+    }
+    k--;
+
+    memcpy(v, out, k * sizeof(hull_pt_t));
+    *n = (uint8_t)k;
+}
+
+/**
+ * Drop the flattest vertex of (v, n) until within budget; lost height goes to slack
+ */
+static void hull_reduce(hull_pt_t *v, uint8_t *count, float *slack_m) {
+    while (*count > HULL_MAX_VERTICES) {
+        int n = *count;
+        int best = 0;
+        float best_h = INFINITY;
+
+        for (int i = 0; i < n; i++) {
+            hull_pt_t a = v[(i + n - 1) % n];
+            hull_pt_t b = v[(i + 1) % n];
+            float base = hypotf(b.x - a.x, b.y - a.y);
+            float h = (base > 0.0f) ? hull_cross(a, b, v[i]) / base : 0.0f;
+            h = fabsf(h);
+            if (h < best_h) {
+                best_h = h;
+                best = i;
+            }
+        }
+
+        memmove(&v[best], &v[best + 1], (n - best - 1) * sizeof(hull_pt_t));
+        (*count)--;
+        if (best_h > *slack_m) {
+            *slack_m = best_h;
+        }
+    }
+}
+
+static void hull_expand(anchor_hull_t *hull);
+
+/**
+ * Add a point to the hull (if outside it) and rebuild the expanded polygon
+ */
+static void hull_learn(anchor_hull_t *hull, hull_pt_t p) {
+    if (!hull_poly_contains(hull->v, hull->n, p)) {
+        hull_insert(hull->v, &hull->n, p);
+        hull_reduce(hull->v, &hull->n, &hull->slack_m);
+        hull_expand(hull);
+    }
+}
+
+/**
+ * Offset the hull outward by margin + slack (mitred, bevelled if sharp)
+ */
+static void hull_expand(anchor_hull_t *hull) {
+    int n = hull->n;
+    float m = hull->margin_m + hull->slack_m;
+    hull->ex_n = 0;
+
+    if (n < 3) {
+        return;
+    }
+
+    for (int i = 0; i < n; i++) {
+        hull_pt_t prev = hull->v[(i + n - 1) % n];
+        hull_pt_t cur = hull->v[i];
+        hull_pt_t next = hull->v[(i + 1) % n];
+
+        // Outward unit normals of the incoming and outgoing edges (CCW hull)
+        float e1x = cur.x - prev.x, e1y = cur.y - prev.y;
+        float e2x = next.x - cur.x, e2y = next.y - cur.y;
+        float l1 = hypotf(e1x, e1y);
+        float l2 = hypotf(e2x, e2y);
+        float n1x = e1y / l1, n1y = -e1x / l1;
+        float n2x = e2y / l2, n2y = -e2x / l2;
+
+        float bx = n1x + n2x, by = n1y + n2y;
+        float bl = hypotf(bx, by);
+        float cos_half = (bl > 0.0f) ? (bx * n1x + by * n1y) / bl : 0.0f;
+
+        if (cos_half > 0.5f) {
+            // Mitre join - at most 2x margin from the vertex
+            float s = m / (cos_half * bl);
+            hull->ex[hull->ex_n++] = (hull_pt_t){ cur.x + bx * s, cur.y + by * s };
+        } else {
+            // Bevel join for sharp corners (swing-arc tips)
+            hull->ex[hull->ex_n++] = (hull_pt_t){ cur.x + n1x * m, cur.y + n1y * m };
+            hull->ex[hull->ex_n++] = (hull_pt_t){ cur.x + n2x * m, cur.y + n2y * m };
+        }
+    }
+}
+
+/**
+ * Track swing reversals of the bearing from the anchor
+ */
+static void hull_track_swing(anchor_hull_t *hull, hull_pt_t p) {
+    if (hypotf(p.x, p.y) < HULL_MIN_RANGE_M) {
+        return;
+    }
+
+    if (!hull->bearing_valid) {
+        hull->smooth = p;
+        hull->bearing_ext = atan2f(p.x, p.y);
+        hull->bearing_valid = true;
+        return;
+    }
+
+    // Smooth the position first so GPS jitter cannot fake a reversal
+    hull->smooth.x += hull->smooth_alpha * (p.x - hull->smooth.x);
+    hull->smooth.y += hull->smooth_alpha * (p.y - hull->smooth.y);
+    float bearing = atan2f(hull->smooth.x, hull->smooth.y);
+
+    // Signed excursion from the current extreme, wrapped to [-pi, pi]
+    float d = bearing - hull->bearing_ext;
+    if (d > (float)M_PI) d -= 2.0f * (float)M_PI;
+    if (d < -(float)M_PI) d += 2.0f * (float)M_PI;
+
+    float rev = HULL_REVERSAL_DEG * HULL_DEG_TO_RAD;
+
+    if (hull->swing_dir == 0) {
+        if (fabsf(d) >= rev) {
+            hull->swing_dir = (d > 0.0f) ? 1 : -1;
+            hull->bearing_ext = bearing;
+        }
+    } else if ((float)hull->swing_dir * d > 0.0f) {
+        hull->bearing_ext = bearing;            // Still swinging the same way
+    } else if (fabsf(d) >= rev) {
+        hull->swing_dir = (int8_t)-hull->swing_dir;
+        hull->bearing_ext = bearing;
+        if (hull->reversals < UINT8_MAX) {
+            hull->reversals++;
+        }
+    }
+}
+
+/**
+ * Initialise an empty hull
+ */
+void anchor_hull_init(anchor_hull_t *hull, float margin_m) {
+    memset(hull, 0, sizeof(*hull));
+    hull->margin_m = margin_m;
+    hull->smooth_alpha = HULL_SWING_SMOOTH;
+    hull->exit_ms = HULL_EXIT_MS;
+}
+
+/**
+ * Set the swing period an excursion is timed against
+ */
+void anchor_hull_set_period(anchor_hull_t *hull, float period_s) {
+    float exit_ms = HULL_EXIT_PERIODS * period_s * 1000.0f;
+    hull->exit_ms = (exit_ms > (float)HULL_EXIT_MS) ? (uint32_t)exit_ms : HULL_EXIT_MS;
+}
+
+/**
+ * Feed one position fix
+ */
+uint32_t anchor_hull_add(anchor_hull_t *hull, float east_m, float north_m, uint32_t t_ms, bool learn) {
+    hull_pt_t p = { east_m, north_m };
+    uint32_t flags = 0;
+
+    if (!hull->ready) {
+        if (learn && (hull->points == 0 ||
+                      hypotf(p.x - hull->last.x, p.y - hull->last.y) >= HULL_DECIMATE_M)) {
+            hull->last = p;
+            hull->points++;
+            hull_track_swing(hull, p);
+            hull_learn(hull, p);
+            if (hull->points >= HULL_READY_POINTS && hull->reversals >= HULL_READY_REVERSALS &&
+                hull->n >= 3) {
+                hull->ready = true;
+            }
+        }
+        hull->flags = 0;
+        return 0;
+    }
+
+    bool inside = hull_poly_contains(hull->ex, hull->ex_n, p);
+    if (hull->outside) {
+        // Back inside and staying: the excursion was a swing, not a drag - learn its extent
+        if (!inside) {
+            hull->returning = false;
+        } else if (!hull->returning) {
+            hull->returning = true;
+            hull->return_ms = t_ms;
+        } else if ((t_ms - hull->return_ms) >= HULL_RETURN_MS) {
+            if (hull->pend_ok) {
+                memcpy(hull->v, hull->pend, hull->pend_n * sizeof(hull_pt_t));
+                hull->n = hull->pend_n;
+                hull->slack_m = hull->pend_slack_m;
+                hull_expand(hull);
+            }
+            hull->outside = false;
+            hull->returning = false;
+        }
+    } else if (!inside) {
+        hull->outside = true;
+        hull->outside_ms = t_ms;
+        memcpy(hull->pend, hull->v, hull->n * sizeof(hull_pt_t));
+        hull->pend_n = hull->n;
+        hull->pend_slack_m = hull->slack_m;
+        hull->pend_ok = true;
+    }
+    if (!inside && hull->outside && (t_ms - hull->outside_ms) >= hull->exit_ms) {
+        flags |= HULL_FLAG_EXIT;
+    }
+
+    if (!learn) {
+        hull->pend_ok = false;
+    } else if (hull->outside && hull->pend_ok && !hull_poly_contains(hull->pend, hull->pend_n, p)) {
+        hull_insert(hull->pend, &hull->pend_n, p);
+        hull_reduce(hull->pend, &hull->pend_n, &hull->pend_slack_m);
+    }
+
+    hull->flags = flags;
+    return flags;
+}
+
+/**
+ * Test whether a position lies inside the margin-expanded hull
+ */
+bool anchor_hull_contains(const anchor_hull_t *hull, float east_m, float north_m) {
+    hull_pt_t p = { east_m, north_m };
+    return hull_poly_contains(hull->ex, hull->ex_n, p);
+}
+
+/**
+ * Check whether the hull has seen a full swing and is used for alarms
+ */
+bool anchor_hull_is_ready(const anchor_hull_t *hull) {
+    return hull->ready;
+}
+
+/**
+ * Get the area of the unexpanded hull (shoelace)
+ */
+float anchor_hull_area(const anchor_hull_t *hull) {
+    if (hull->n < 3) {
+        return 0.0f;
+    }
+
+    float twice = 0.0f;
+    for (int i = 0; i < hull->n; i++) {
+        hull_pt_t a = hull->v[i];
+        hull_pt_t b = hull->v[(i + 1) % hull->n];
+        twice += a.x * b.y - b.x * a.y;
+    }
+    return 0.5f * twice;
+}
@@ -0,0 +1,150 @@
+/**
+ * Adaptive Safe Zone - Incremental Convex Hull of the Swing Area
+ *
+ * Author: Colin Bitterfield
+ * Email: colin@bitterfield.com
+ * Date Created: 2026-10-18
+ * Date Updated: 2026-10-18
+ * Version: 0.3.0
+ *
+ * Changelog:
+ * - 0.3.0 (2026-10-18): Exit is the polygon again (no reach), timed against
+ *   the swing period; an excursion is learned only once the boat comes back;
+ *   ready after two full swing cycles
+ * - 0.2.0 (2026-10-18): No longer frozen once ready - keeps learning within
+ *   a slowly growing reach, and exit needs the reach too
+ *
+ * Once the boat has swung through a full cycle, the convex hull of its track
+ * (expanded by a margin) is a much tighter safe zone than the rode-length
+ * circle, because the swing arc is usually narrow. This module:
+ * - Decimates the trail (a point is kept only if it moved HULL_DECIMATE_M)
+ * - Maintains the hull incrementally with Andrew's monotone chain; points
+ *   already inside the hull are rejected in O(log n) without a rebuild
+ * - Bounds the hull to HULL_MAX_VERTICES by dropping the flattest vertex and
+ *   adding the lost height to the margin, so the zone never shrinks
+ * - Pre-computes the margin-expanded polygon so containment is O(log n)
+ * - Is used for alarms once two full swing cycles have been seen, and keeps
+ *   learning after that, but only from excursions the boat comes back from:
+ *   fixes outside the zone go into a pending hull, which replaces the hull
+ *   once the boat has been back inside for HULL_RETURN_MS. A yaw wider than
+ *   any seen so far is learned; a drag never comes back, even one that
+ *   leaves the boat hovering at the edge where a noisy fix or two falls back
+ *   inside. An excursion is dropped if the caller refused learning on any of
+ *   its fixes (drag rate rising, alarm). A wind shift or a turn of the tide
+ *   moves the boat to a new sector for good; the caller restarts the hull
+ *   then (anchor_engine.c).
+ * - Flags an exit while outside on an excursion (out of the margin-expanded
+ *   hull, not back inside for HULL_RETURN_MS since) that has lasted
+ *   HULL_EXIT_MS, or HULL_EXIT_PERIODS swing periods if that is longer
+ *
+ * Coordinates are ENU metres relative to the anchor (anchor_geo.h).
+ * Pure C (no ESP-IDF dependencies) so it can be compiled on the host.
+ */
+
+#ifndef ANCHOR_HULL_H
+#define ANCHOR_HULL_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Hull geometry
+#define HULL_MAX_VERTICES       32                      // Hull vertex budget
+#define HULL_MAX_EXPANDED       (2 * HULL_MAX_VERTICES) // Bevelled corners add a vertex
+#define HULL_DECIMATE_M         1.0f                    // Min spacing of trail points
+#define HULL_MARGIN_DEFAULT_M   5.0f                    // Default safe-zone margin
+
+// Learning and detection parameters
+#define HULL_READY_POINTS       16      // Decimated points before the hull can be used
+#define HULL_READY_REVERSALS    4       // Swing reversals before use (two full cycles)
+#define HULL_REVERSAL_DEG       15.0f   // Bearing swing-back that counts as a reversal
+#define HULL_MIN_RANGE_M        3.0f    // Ignore bearing while this close to the anchor
+#define HULL_SWING_SMOOTH       0.2f    // EMA weight of the position used for reversals
+#define HULL_EXIT_MS            180000  // Shortest excursion that flags an exit (1.5 x the slowest swing period)
+#define HULL_EXIT_PERIODS       1.5f    // Excursion length that flags an exit, in swing periods
+#define HULL_RETURN_MS          20000   // Time back inside that ends an excursion (noise flickers are shorter)
+
+// Result flags from anchor_hull_add()
+#define HULL_FLAG_EXIT          (1u << 0)   // Position left the expanded hull
+
+typedef struct {
+    float x;                // East (metres)
+    float y;                // North (metres)
+} hull_pt_t;
+
+typedef struct {
+    hull_pt_t v[HULL_MAX_VERTICES + 1];     // Hull vertices, counter-clockwise
+    uint8_t n;                              // Hull vertex count
+    hull_pt_t ex[HULL_MAX_EXPANDED];        // Margin-expanded polygon, counter-clockwise
+    uint8_t ex_n;                           // Expanded vertex count
+    float margin_m;                         // Configured margin
+    float slack_m;                          // Extra margin from vertex reduction
+    hull_pt_t last;                         // Last accepted trail point
+    uint32_t points;                        // Decimated points accepted
+    bool bearing_valid;                     // bearing_ext and smooth initialised
+    hull_pt_t smooth;                       // Smoothed position for swing tracking
+    float smooth_alpha;                     // EMA weight (HULL_SWING_SMOOTH unless tuned)
+    float bearing_ext;                      // Bearing extreme in current swing (radians)
+    int8_t swing_dir;                       // Current swing direction (+1/-1, 0 = unknown)
+    uint8_t reversals;                      // Swing reversals seen
+    bool ready;                             // Full swing seen, hull used for alarms
+    bool outside;                           // On an excursion since outside_ms
+    uint32_t outside_ms;                    // Start of the current excursion
+    uint32_t exit_ms;                       // Excursion length that flags an exit
+    bool returning;                         // Back inside since return_ms, excursion not over yet
+    uint32_t return_ms;                     // Start of the current return
+    hull_pt_t pend[HULL_MAX_VERTICES + 1];  // Hull plus the current excursion
+    uint8_t pend_n;                         // Pending vertex count
+    float pend_slack_m;                     // Pending slack
+    bool pend_ok;                           // Excursion still learnable
+    uint32_t flags;                         // Latest HULL_FLAG_* result
+} anchor_hull_t;
+
+/**
+ * Initialise an empty hull
+ * @param hull Hull to initialise
+ * @param margin_m Safe-zone margin around the hull (metres)
+ */
+void anchor_hull_init(anchor_hull_t *hull, float margin_m);
+
+/**
+ * Set the swing period an excursion is timed against - O(1)
+ * @param hull Hull
+ * @param period_s Dominant swing period (0 = no swing, HULL_EXIT_MS)
+ */
+void anchor_hull_set_period(anchor_hull_t *hull, float period_s);
+
+/**
+ * Feed one position fix - learns, and checks containment once ready
+ * @param hull Hull
+ * @param east_m East offset from anchor (metres)
+ * @param north_m North offset from anchor (metres)
+ * @param t_ms Timestamp (milliseconds)
+ * @param learn false to keep this fix (and the excursion it is part of) out of the hull
+ * @return HULL_FLAG_* bitmask (0 = inside, not out for long or still learning)
+ */
+uint32_t anchor_hull_add(anchor_hull_t *hull, float east_m, float north_m, uint32_t t_ms, bool learn);
+
+/**
+ * Test whether a position lies inside the margin-expanded hull - O(log n)
+ * @param hull Hull
+ * @param east_m East offset from anchor (metres)
+ * @param north_m North offset from anchor (metres)
+ * @return true if inside (false if outside or no polygon yet)
+ */
+bool anchor_hull_contains(const anchor_hull_t *hull, float east_m, float north_m);
+
+/**
+ * Check whether the hull has seen a full swing and is used for alarms
+ * @param hull Hull
+ * @return true once a full swing cycle has been learned
+ */
+bool anchor_hull_is_ready(const anchor_hull_t *hull);
+
+/**
+ * Get the area of the unexpanded hull
+ * @param hull Hull
+ * @return Area in square metres (0 if fewer than 3 vertices)
+ */
+float anchor_hull_area(const anchor_hull_t *hull);
+
+#endif // ANCHOR_HULL_H
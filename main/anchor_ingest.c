@@ -0,0 +1,452 @@
+/**
+ * NMEA 2000 / NMEA 0183 Ingest Implementation
+ *
+ * Author: Colin Bitterfield
+ * Email: colin@bitterfield.com
+ * Date Created: 2026-10-18
+ * Version: 0.1.0
+ */
+
+#include "anchor_ingest.h"
+#include <string.h>
+#include <stdlib.h>
+#include <math.h>
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+#define INGEST_RAD_TO_DEG       (180.0 / M_PI)
+#define INGEST_FEET_TO_M        0.3048
+#define INGEST_KNOTS_TO_MPS     0.514444
+#define INGEST_KMH_TO_MPS       (1.0 / 3.6)
+#define INGEST_MAX_FIELDS       20
+
+// NMEA 2000 "not available" markers
+#define N2K_NA_U16              0xFFFDu     // This and above: NA / out of range / reserved
+#define N2K_NA_I16              0x7FFD
+#define N2K_NA_U32              0xFFFFFFFDu
+#define N2K_NA_I32              0x7FFFFFFD
+#define N2K_NA_I64              0x7FFFFFFFFFFFFFFDLL
+
+// GNSS method (PGN 129029 byte 31, high nibble) accepted as a fix: GNSS .. RTK float
+#define N2K_METHOD_GNSS         1
+#define N2K_METHOD_RTK_FLOAT    5
+
+// Heading / wind reference codes
+#define N2K_HEADING_TRUE        0
+#define N2K_HEADING_MAGNETIC    1
+#define N2K_WIND_TRUE_NORTH     0
+#define N2K_WIND_MAGNETIC       1
+#define N2K_WIND_APPARENT       2
+
+static uint16_t get_u16(const uint8_t *p) { return (uint16_t)(p[0] | (p[1] << 8)); }
+static int16_t get_i16(const uint8_t *p) { return (int16_t)get_u16(p); }
+static uint32_t get_u32(const uint8_t *p) {
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+static int32_t get_i32(const uint8_t *p) { return (int32_t)get_u32(p); }
+static int64_t get_i64(const uint8_t *p) {
+    return (int64_t)((uint64_t)get_u32(p) | ((uint64_t)get_u32(p + 4) << 32));
+}
+
+/**
+ * Deliver a fix if it is plausible
+ */
+static bool ingest_fix(anchor_ingest_t *ing, double lat, double lon, uint32_t t_ms) {
+    if (!(lat >= -90.0 && lat <= 90.0 && lon >= -180.0 && lon <= 180.0)) {
+        ing->errors++;
+        return false;
+    }
+    if (ing->sink.fix != NULL) {
+        ing->sink.fix(ing->sink.ctx, lat, lon, t_ms);
+    }
+    return true;
+}
+
+/**
+ * Normalise an angle to [0, 360)
+ */
+static float ingest_wrap360(double deg) {
+    deg = fmod(deg, 360.0);
+    return (float)(deg < 0.0 ? deg + 360.0 : deg);
+}
+
+/**
+ * Initialise an ingest instance
+ */
+void anchor_ingest_init(anchor_ingest_t *ing, const ingest_sink_t *sink) {
+    memset(ing, 0, sizeof(anchor_ingest_t));
+    if (sink != NULL) {
+        ing->sink = *sink;
+    }
+    ing->position_pgn = N2K_PGN_GNSS_POSITION;
+    ing->source = N2K_SOURCE_ANY;
+}
+
+/**
+ * Build a 29-bit NMEA 2000 CAN identifier
+ */
+uint32_t anchor_ingest_n2k_id(uint32_t pgn, uint8_t priority, uint8_t source) {
+    return ((uint32_t)(priority & 0x7) << 26) | ((pgn & 0x1FFFF) << 8) | source;
+}
+
+/**
+ * Whether a PGN is sent as a fast packet
+ */
+bool anchor_ingest_is_fast_packet(uint32_t pgn) {
+    switch (pgn) {
+        case N2K_PGN_GNSS_POSITION:
+        case 129038:    // AIS class A position
+        case 129039:    // AIS class B position
+        case 129540:    // GNSS satellites in view
+            return true;
+        default:
+            return false;
+    }
+}
+
+/**
+ * Decode one complete NMEA 2000 message
+ */
+bool anchor_ingest_n2k_message(anchor_ingest_t *ing, uint32_t pgn, uint8_t source,
+                               const uint8_t *data, uint16_t len, uint32_t t_ms) {
+    if (ing->source != N2K_SOURCE_ANY && source != ing->source) {
+        return false;
+    }
+
+    switch (pgn) {
+        case N2K_PGN_POSITION_RAPID: {
+            if (pgn != ing->position_pgn) return false;
+            if (len < 8) break;
+            int32_t lat = get_i32(data);
+            int32_t lon = get_i32(data + 4);
+            if (lat >= N2K_NA_I32 || lon >= N2K_NA_I32) return false;
+            ing->messages++;
+            return ingest_fix(ing, lat * 1e-7, lon * 1e-7, t_ms);
+        }
+
+        case N2K_PGN_GNSS_POSITION: {
+            if (pgn != ing->position_pgn) return false;
+            if (len < 33) break;
+            int64_t lat = get_i64(data + 7);
+            int64_t lon = get_i64(data + 15);
+            uint8_t method = data[31] >> 4;
+            if (lat >= N2K_NA_I64 || lon >= N2K_NA_I64) return false;
+            if (method < N2K_METHOD_GNSS || method > N2K_METHOD_RTK_FLOAT) return false;
+            ing->messages++;
+            return ingest_fix(ing, lat * 1e-16, lon * 1e-16, t_ms);
+        }
+
+        case N2K_PGN_VESSEL_HEADING: {
+            if (len < 8) break;
+            uint16_t raw = get_u16(data + 1);
+            int16_t deviation = get_i16(data + 3);
+            int16_t variation = get_i16(data + 5);
+            uint8_t ref = data[7] & 0x03;
+            if (raw >= N2K_NA_U16) return false;
+            double heading = raw * 1e-4 * INGEST_RAD_TO_DEG;
+            if (ref == N2K_HEADING_MAGNETIC) {
+                if (variation >= N2K_NA_I16) return false;     // Engine needs true heading
+                if (deviation < N2K_NA_I16) heading += deviation * 1e-4 * INGEST_RAD_TO_DEG;
+                heading += variation * 1e-4 * INGEST_RAD_TO_DEG;
+            } else if (ref != N2K_HEADING_TRUE) {
+                return false;
+            }
+            ing->messages++;
+            if (ing->sink.heading != NULL) {
+                ing->sink.heading(ing->sink.ctx, ingest_wrap360(heading), t_ms);
+            }
+            return true;
+        }
+
+        case N2K_PGN_WIND_DATA: {
+            if (len < 6) break;
+            uint16_t speed = get_u16(data + 1);
+            uint16_t angle = get_u16(data + 3);
+            uint8_t ref = data[5] & 0x07;
+            if (speed >= N2K_NA_U16 || angle >= N2K_NA_U16) return false;
+            if (ref == N2K_WIND_MAGNETIC) return false;     // No variation to correct it
+            ing->messages++;
+            if (ing->sink.wind != NULL) {
+                ing->sink.wind(ing->sink.ctx, speed * 0.01f,
+                               ingest_wrap360(angle * 1e-4 * INGEST_RAD_TO_DEG),
+                               ref >= N2K_WIND_APPARENT, t_ms);
+            }
+            return true;
+        }
+
+        case N2K_PGN_WATER_DEPTH: {
+            if (len < 7) break;
+            uint32_t depth = get_u32(data + 1);
+            int16_t offset = get_i16(data + 5);
+            if (depth >= N2K_NA_U32) return false;
+            float depth_m = depth * 0.01f;
+            if (offset > 0 && offset < N2K_NA_I16) {
+                depth_m += offset * 0.001f;     // Positive offset = transducer to waterline
+            }
+            ing->messages++;
+            if (ing->sink.depth != NULL) {
+                ing->sink.depth(ing->sink.ctx, depth_m, t_ms);
+            }
+            return true;
+        }
+
+        default:
+            return false;
+    }
+
+    ing->errors++;      // Known PGN, short payload
+    return false;
+}
+
+/**
+ * Feed one raw NMEA 2000 CAN frame
+ */
+bool anchor_ingest_n2k_frame(anchor_ingest_t *ing, uint32_t can_id, const uint8_t *data,
+                             uint8_t len, uint32_t t_ms) {
+    ing->frames++;
+
+    uint8_t source = can_id & 0xFF;
+    uint8_t pf = (can_id >> 16) & 0xFF;
+    uint32_t pgn = (can_id >> 8) & 0x1FFFF;
+    if (pf < 240) {
+        pgn &= 0x1FF00;     // PDU1: low byte is the destination address
+    }
+
+    if (!anchor_ingest_is_fast_packet(pgn)) {
+        return anchor_ingest_n2k_message(ing, pgn, source, data, len, t_ms);
+    }
+    if (len < 2) {
+        ing->errors++;
+        return false;
+    }
+
+    uint8_t seq = data[0] >> 5;
+    uint8_t counter = data[0] & 0x1F;
+    ingest_fast_packet_t *fp = NULL;
+
+    if (counter == 0) {
+        // First frame: take this message's slot, a free one, or the oldest
+        for (int i = 0; i < INGEST_FAST_PACKET_SLOTS; i++) {
+            ingest_fast_packet_t *s = &ing->fast[i];
+            if (s->pgn == pgn && s->source == source) {
+                if (s->received < s->len) ing->errors++;    // Previous one never finished
+                fp = s;
+                break;
+            }
+            if (fp == NULL || (fp->pgn != 0 && (s->pgn == 0 || s->t_ms < fp->t_ms))) {
+                fp = s;
+            }
+        }
+        if (data[1] > N2K_FAST_PACKET_MAX) {
+            fp->pgn = 0;
+            ing->errors++;
+            return false;
+        }
+        fp->pgn = pgn;
+        fp->source = source;
+        fp->seq = seq;
+        fp->next_frame = 1;
+        fp->len = data[1];
+        fp->t_ms = t_ms;
+        fp->received = 0;
+        uint8_t n = (len > 2) ? len - 2 : 0;
+        if (n > fp->len) n = fp->len;
+        memcpy(fp->data, data + 2, n);
+        fp->received = n;
+    } else {
+        for (int i = 0; i < INGEST_FAST_PACKET_SLOTS; i++) {
+            ingest_fast_packet_t *s = &ing->fast[i];
+            if (s->pgn == pgn && s->source == source && s->seq == seq) {
+                fp = s;
+                break;
+            }
+        }
+        if (fp == NULL) {
+            return false;   // Joined mid-message
+        }
+        if (counter != fp->next_frame) {
+            fp->pgn = 0;    // Lost a frame: drop the message
+            ing->errors++;
+            return false;
+        }
+        uint8_t n = len - 1;
+        if (n > fp->len - fp->received) n = fp->len - fp->received;
+        memcpy(fp->data + fp->received, data + 1, n);
+        fp->received += n;
+        fp->next_frame++;
+    }
+
+    if (fp->received < fp->len) {
+        return false;
+    }
+    fp->pgn = 0;
+    return anchor_ingest_n2k_message(ing, pgn, source, fp->data, fp->len, t_ms);
+}
+
+/**
+ * Parse a numeric field (false if empty or not a number)
+ */
+static bool ingest_field_double(const char *f, double *out) {
+    if (f == NULL || *f == '\0') return false;
+    char *end;
+    *out = strtod(f, &end);
+    return *end == '\0';
+}
+
+/**
+ * Convert NMEA ddmm.mmmm / dddmm.mmmm plus hemisphere to degrees
+ */
+static bool ingest_field_coord(const char *f, const char *hemi, double *out) {
+    double v;
+    if (!ingest_field_double(f, &v) || hemi == NULL) return false;
+    double deg = floor(v / 100.0);
+    deg += (v - deg * 100.0) / 60.0;
+    if (hemi[0] == 'S' || hemi[0] == 'W') {
+        deg = -deg;
+    } else if (hemi[0] != 'N' && hemi[0] != 'E') {
+        return false;
+    }
+    *out = deg;
+    return true;
+}
+
+/**
+ * Decode one complete NMEA 0183 sentence
+ */
+bool anchor_ingest_0183_sentence(anchor_ingest_t *ing, const char *sentence, uint32_t t_ms) {
+    if (sentence[0] != '$') return false;
+
+    // Copy the body and check the checksum (when present)
+    char buf[INGEST_SENTENCE_MAX + 1];
+    size_t n = 0;
+    uint8_t sum = 0;
+    const char *p = sentence + 1;
+    while (*p != '\0' && *p != '*' && *p != '\r' && *p != '\n') {
+        if (n >= INGEST_SENTENCE_MAX) {
+            ing->errors++;
+            return false;
+        }
+        sum ^= (uint8_t)*p;
+        buf[n++] = *p++;
+    }
+    buf[n] = '\0';
+    if (*p == '*') {
+        char *end;
+        unsigned long want = strtoul(p + 1, &end, 16);
+        if (end != p + 3 || want != sum) {
+            ing->errors++;
+            return false;
+        }
+    }
+
+    // Split into fields
+    char *field[INGEST_MAX_FIELDS];
+    int count = 0;
+    char *f = buf;
+    while (count < INGEST_MAX_FIELDS) {
+        field[count++] = f;
+        char *comma = strchr(f, ',');
+        if (comma == NULL) break;
+        *comma = '\0';
+        f = comma + 1;
+    }
+    for (int i = count; i < INGEST_MAX_FIELDS; i++) {
+        field[i] = NULL;
+    }
+
+    // Sentence type is the last three characters of the address (talker ignored)
+    if (strlen(field[0]) != 5 || field[0][0] == 'P') return false;
+    const char *type = field[0] + 2;
+    double v, w;
+
+    if (strcmp(type, "RMC") == 0) {
+        double lat, lon;
+        if (field[2] == NULL || field[2][0] != 'A') return false;              // Void fix
+        if (field[12] != NULL && field[12][0] == 'N') return false;            // Mode: not valid
+        if (!ingest_field_coord(field[3], field[4], &lat) ||
+            !ingest_field_coord(field[5], field[6], &lon)) {
+            ing->errors++;
+            return false;
+        }
+        ing->sentences++;
+        return ingest_fix(ing, lat, lon, t_ms);
+    }
+
+    if (strcmp(type, "HDT") == 0) {
+        if (!ingest_field_double(field[1], &v)) return false;
+        ing->sentences++;
+        if (ing->sink.heading != NULL) {
+            ing->sink.heading(ing->sink.ctx, ingest_wrap360(v), t_ms);
+        }
+        return true;
+    }
+
+    if (strcmp(type, "MWV") == 0) {
+        // R = apparent, T = true - both measured from the bow
+        if (field[5] == NULL || field[5][0] != 'A') return false;
+        if (!ingest_field_double(field[1], &v) || !ingest_field_double(field[3], &w)) return false;
+        switch (field[4] != NULL ? field[4][0] : '\0') {
+            case 'N': w *= INGEST_KNOTS_TO_MPS; break;
+            case 'K': w *= INGEST_KMH_TO_MPS; break;
+            case 'M': break;
+            default:
+                ing->errors++;
+                return false;
+        }
+        ing->sentences++;
+        if (ing->sink.wind != NULL) {
+            ing->sink.wind(ing->sink.ctx, (float)w, ingest_wrap360(v), true, t_ms);
+        }
+        return true;
+    }
+
+    if (strcmp(type, "DPT") == 0 || strcmp(type, "DBT") == 0) {
+        if (type[1] == 'P') {
+            if (!ingest_field_double(field[1], &v)) return false;
+            if (ingest_field_double(field[2], &w) && w > 0.0) {
+                v += w;     // Positive offset = transducer to waterline
+            }
+        } else if (!ingest_field_double(field[3], &v)) {
+            if (!ingest_field_double(field[1], &v)) return false;
+            v *= INGEST_FEET_TO_M;
+        }
+        ing->sentences++;
+        if (ing->sink.depth != NULL) {
+            ing->sink.depth(ing->sink.ctx, (float)v, t_ms);
+        }
+        return true;
+    }
+
+    return false;
+}
+
+/**
+ * Feed bytes from an NMEA 0183 stream
+ */
+int anchor_ingest_0183_bytes(anchor_ingest_t *ing, const char *buf, size_t len, uint32_t t_ms) {
+    int decoded = 0;
+    for (size_t i = 0; i < len; i++) {
+        char c = buf[i];
+        if (c == '$' || c == '!') {
+            ing->line_len = 0;
+            ing->line_overflow = false;
+        } else if (c == '\r' || c == '\n') {
+            if (ing->line_len > 0 && !ing->line_overflow) {
+                ing->line[ing->line_len] = '\0';
+                decoded += anchor_ingest_0183_sentence(ing, ing->line, t_ms) ? 1 : 0;
+            }
+            ing->line_len = 0;
+            continue;
+        } else if (ing->line_len == 0) {
+            continue;   // Noise between sentences
+        }
+        if (ing->line_len >= INGEST_SENTENCE_MAX) {
+            ing->line_overflow = true;
+            continue;
+        }
+        ing->line[ing->line_len++] = c;
+    }
+    return decoded;
+}
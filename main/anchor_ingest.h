@@ -0,0 +1,147 @@
+/**
+ * NMEA 2000 / NMEA 0183 Ingest
+ *
+ * Author: Colin Bitterfield
+ * Email: colin@bitterfield.com
+ * Date Created: 2026-10-18
+ * Version: 0.1.0
+ *
+ * Decodes the navigation data the anchor watch needs and hands it to a sink
+ * (the watch service on the target, the engine directly in host tools):
+ * - NMEA 2000: raw 29-bit CAN frames. Fast-packet PGNs are reassembled per
+ *   source, then 129025 / 129029 (position), 127250 (heading), 130306
+ *   (wind) and 128267 (depth) are decoded.
+ * - NMEA 0183: bytes from a serial port are split into sentences and
+ *   checksummed, then RMC (position), HDT (heading), MWV (wind) and
+ *   DPT / DBT (depth) are decoded.
+ *
+ * Fixes are taken from one position PGN only (the GPS PGN setting), so a GPS
+ * that sends both 129025 and 129029 does not feed the engine twice per
+ * second. Decoding is allocation-free and costs a few hundred nanoseconds
+ * per message.
+ * Pure C (no ESP-IDF dependencies) so it can be compiled on the host.
+ */
+
+#ifndef ANCHOR_INGEST_H
+#define ANCHOR_INGEST_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+// PGNs decoded
+#define N2K_PGN_POSITION_RAPID      129025
+#define N2K_PGN_GNSS_POSITION       129029
+#define N2K_PGN_VESSEL_HEADING      127250
+#define N2K_PGN_WIND_DATA           130306
+#define N2K_PGN_WATER_DEPTH         128267
+
+#define N2K_SOURCE_ANY              0xFF    // Source filter: accept every address
+#define N2K_FAST_PACKET_MAX         223     // Largest fast-packet payload
+#define INGEST_FAST_PACKET_SLOTS    4       // Fast-packet messages assembled at once
+#define INGEST_SENTENCE_MAX         82      // NMEA 0183 sentence incl. "$" and "*hh"
+
+// Decoded data goes here (NULL callbacks are skipped)
+typedef struct {
+    void (*fix)(void *ctx, double lat, double lon, uint32_t t_ms);
+    void (*heading)(void *ctx, float heading_deg, uint32_t t_ms);
+    void (*wind)(void *ctx, float speed_mps, float angle_deg, bool relative, uint32_t t_ms);
+    void (*depth)(void *ctx, float depth_m, uint32_t t_ms);
+    void *ctx;
+} ingest_sink_t;
+
+// One fast-packet message being reassembled
+typedef struct {
+    uint32_t pgn;               // 0 = free
+    uint8_t source;
+    uint8_t seq;                // Sequence counter of this message
+    uint8_t next_frame;         // Frame counter expected next
+    uint8_t len;                // Total payload length (from frame 0)
+    uint8_t received;           // Payload bytes received
+    uint32_t t_ms;              // Frame 0 time (stale slots are reused first)
+    uint8_t data[N2K_FAST_PACKET_MAX];
+} ingest_fast_packet_t;
+
+typedef struct {
+    ingest_sink_t sink;
+    uint32_t position_pgn;      // Fixes from this PGN only (129025 or 129029)
+    uint8_t source;             // N2K source address filter (N2K_SOURCE_ANY = all)
+    ingest_fast_packet_t fast[INGEST_FAST_PACKET_SLOTS];
+    char line[INGEST_SENTENCE_MAX + 1];     // NMEA 0183 sentence being received
+    uint8_t line_len;
+    bool line_overflow;         // Current sentence too long (dropped at its end)
+    // Counters
+    uint32_t frames;            // N2K frames seen
+    uint32_t messages;          // N2K messages decoded
+    uint32_t sentences;         // NMEA 0183 sentences decoded
+    uint32_t errors;            // Bad checksums, broken fast packets, bad fields
+} anchor_ingest_t;
+
+/**
+ * Initialise an ingest instance (fixes from 129029, any source)
+ * @param ing Ingest instance
+ * @param sink Where decoded data goes (copied)
+ */
+void anchor_ingest_init(anchor_ingest_t *ing, const ingest_sink_t *sink);
+
+/**
+ * Feed one raw NMEA 2000 CAN frame - O(1)
+ * @param ing Ingest instance
+ * @param can_id 29-bit extended CAN identifier
+ * @param data Frame data
+ * @param len Frame length (0-8)
+ * @param t_ms Timestamp (milliseconds)
+ * @return true if the frame completed a message that was decoded
+ */
+bool anchor_ingest_n2k_frame(anchor_ingest_t *ing, uint32_t can_id, const uint8_t *data,
+                             uint8_t len, uint32_t t_ms);
+
+/**
+ * Decode one complete NMEA 2000 message (already reassembled)
+ * @param ing Ingest instance
+ * @param pgn Parameter group number
+ * @param source Source address
+ * @param data Payload
+ * @param len Payload length
+ * @param t_ms Timestamp (milliseconds)
+ * @return true if the PGN is one we use and its fields were valid
+ */
+bool anchor_ingest_n2k_message(anchor_ingest_t *ing, uint32_t pgn, uint8_t source,
+                               const uint8_t *data, uint16_t len, uint32_t t_ms);
+
+/**
+ * Feed bytes from an NMEA 0183 stream - O(len)
+ * @param ing Ingest instance
+ * @param buf Received bytes (sentences may be split across calls)
+ * @param len Number of bytes
+ * @param t_ms Timestamp (milliseconds)
+ * @return Sentences decoded
+ */
+int anchor_ingest_0183_bytes(anchor_ingest_t *ing, const char *buf, size_t len, uint32_t t_ms);
+
+/**
+ * Decode one complete NMEA 0183 sentence ("$GPRMC,...*hh", no line ending)
+ * @param ing Ingest instance
+ * @param sentence NUL-terminated sentence
+ * @param t_ms Timestamp (milliseconds)
+ * @return true if the sentence is one we use and its fields were valid
+ */
+bool anchor_ingest_0183_sentence(anchor_ingest_t *ing, const char *sentence, uint32_t t_ms);
+
+/**
+ * Build a 29-bit NMEA 2000 CAN identifier (PDU2 / broadcast)
+ * @param pgn Parameter group number
+ * @param priority Priority (0-7)
+ * @param source Source address
+ * @return CAN identifier
+ */
+uint32_t anchor_ingest_n2k_id(uint32_t pgn, uint8_t priority, uint8_t source);
+
+/**
+ * Whether a PGN is sent as a fast packet
+ * @param pgn Parameter group number
+ * @return true for fast-packet PGNs
+ */
+bool anchor_ingest_is_fast_packet(uint32_t pgn);
+
+#endif // ANCHOR_INGEST_H
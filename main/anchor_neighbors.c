@@ -0,0 +1,445 @@
+/**
+ * AIS Neighbor Swing Circles Implementation
+ *
+ * Author: Colin Bitterfield
+ * Email: colin@bitterfield.com
+ * Date Created: 2026-10-18
+ * Date Updated: 2026-10-18
+ * Version: 0.2.0
+ *
+ * Changelog:
+ * - 0.2.0 (2026-10-18): Search box grows with the fastest target's reach
+ */
+
+#include "anchor_neighbors.h"
+#include <string.h>
+#include <math.h>
+#include <float.h>
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+#define NEIGHBOR_MMSI_MAX       999999999u
+#define NEIGHBOR_SOG_GAP_MS     300000u     // Max report gap for SOG from displacement
+
+/**
+ * Home slot of an MMSI in the hash index (Fibonacci hashing)
+ */
+static uint32_t neighbor_hash(uint32_t mmsi) {
+    return (mmsi * 2654435761u) >> (32 - NEIGHBOR_HASH_BITS);
+}
+
+/**
+ * Index position of an MMSI, or of the empty slot where it would go
+ */
+static uint32_t neighbor_probe(const anchor_neighbors_t *set, uint32_t mmsi) {
+    uint32_t i = neighbor_hash(mmsi);
+    while (set->index[i] != 0 && set->target[set->index[i] - 1].mmsi != mmsi) {
+        i = (i + 1) & (NEIGHBOR_HASH_SIZE - 1);
+    }
+    return i;
+}
+
+/**
+ * Remove an MMSI from the hash index (backward-shift, no tombstones)
+ */
+static void neighbor_unindex(anchor_neighbors_t *set, uint32_t mmsi) {
+    uint32_t i = neighbor_probe(set, mmsi);
+    if (set->index[i] == 0) {
+        return;
+    }
+    uint32_t j = i;
+    for (;;) {
+        j = (j + 1) & (NEIGHBOR_HASH_SIZE - 1);
+        if (set->index[j] == 0) {
+            break;
+        }
+        // Entry at j may move back to i only if its home is not in (i, j]
+        uint32_t home = neighbor_hash(set->target[set->index[j] - 1].mmsi);
+        bool stays = (i <= j) ? (home > i && home <= j) : (home > i || home <= j);
+        if (!stays) {
+            set->index[i] = set->index[j];
+            i = j;
+        }
+    }
+    set->index[i] = 0;
+}
+
+/**
+ * Grid cell of a point (-1 = off the grid)
+ */
+static int16_t neighbor_cell(float x, float y) {
+    int cx = (int)floorf(x / NEIGHBOR_CELL_M) + NEIGHBOR_GRID / 2;
+    int cy = (int)floorf(y / NEIGHBOR_CELL_M) + NEIGHBOR_GRID / 2;
+    if (cx < 0 || cx >= NEIGHBOR_GRID || cy < 0 || cy >= NEIGHBOR_GRID) {
+        return -1;
+    }
+    return (int16_t)(cy * NEIGHBOR_GRID + cx);
+}
+
+/**
+ * Unlink a target from its grid cell
+ */
+static void neighbor_grid_remove(anchor_neighbors_t *set, int slot) {
+    neighbor_t *t = &set->target[slot];
+    if (t->cell < 0) {
+        return;
+    }
+    int16_t *link = &set->cell_head[t->cell];
+    while (*link != slot) {
+        link = &set->target[*link].next;
+    }
+    *link = t->next;
+    t->cell = -1;
+    t->next = -1;
+}
+
+/**
+ * Move a target to the grid cell of its circle centre
+ */
+static void neighbor_grid_place(anchor_neighbors_t *set, int slot) {
+    neighbor_t *t = &set->target[slot];
+    int16_t cell = neighbor_cell(t->cx, t->cy);
+    if (cell == t->cell) {
+        return;
+    }
+    neighbor_grid_remove(set, slot);
+    if (cell >= 0) {
+        t->cell = cell;
+        t->next = set->cell_head[cell];
+        set->cell_head[cell] = (int16_t)slot;
+    }
+}
+
+/**
+ * Bump the version if the drawn state changed noticeably
+ */
+static void neighbor_touch(neighbor_t *t) {
+    if (fabsf(t->cx - t->drawn_cx) < NEIGHBOR_MOVE_M &&
+        fabsf(t->cy - t->drawn_cy) < NEIGHBOR_MOVE_M &&
+        fabsf(t->radius_m - t->drawn_r) < NEIGHBOR_MOVE_M &&
+        t->flags == t->drawn_flags) {
+        return;
+    }
+    t->drawn_cx = t->cx;
+    t->drawn_cy = t->cy;
+    t->drawn_r = t->radius_m;
+    t->drawn_flags = t->flags;
+    t->version++;
+}
+
+/**
+ * Speed over ground of a target
+ */
+static float neighbor_speed(const neighbor_t *t) {
+    return sqrtf(t->ve_mps * t->ve_mps + t->vn_mps * t->vn_mps);
+}
+
+/**
+ * Free a target slot
+ */
+static void neighbor_remove(anchor_neighbors_t *set, int slot) {
+    neighbor_t *t = &set->target[slot];
+    neighbor_grid_remove(set, slot);
+    neighbor_unindex(set, t->mmsi);
+    t->mmsi = 0;
+    t->version++;
+    set->count--;
+}
+
+/**
+ * Swing circle (slow target) or point (moving target) from the history
+ */
+static void neighbor_estimate(neighbor_t *t) {
+    float speed = neighbor_speed(t);
+    t->flags &= ~NEIGHBOR_FLAG_ANCHORED;
+    t->cx = t->east_m;
+    t->cy = t->north_m;
+    t->radius_m = 0.0f;
+    if (speed >= NEIGHBOR_ANCHORED_MPS) {
+        return;
+    }
+
+    float se = 0.0f, sn = 0.0f;
+    for (int i = 0; i < t->hist_count; i++) {
+        se += t->hist_e[i];
+        sn += t->hist_n[i];
+    }
+    float ce = se / t->hist_count;
+    float cn = sn / t->hist_count;
+
+    // Largest excursion from the centroid, including the latest report
+    float r2 = (t->east_m - ce) * (t->east_m - ce) + (t->north_m - cn) * (t->north_m - cn);
+    for (int i = 0; i < t->hist_count; i++) {
+        float de = t->hist_e[i] - ce;
+        float dn = t->hist_n[i] - cn;
+        float d2 = de * de + dn * dn;
+        if (d2 > r2) r2 = d2;
+    }
+    float r = sqrtf(r2);
+    if (r > NEIGHBOR_MAX_RADIUS_M) {
+        return;     // Slow, but wandering too far for a swing
+    }
+    t->flags |= NEIGHBOR_FLAG_ANCHORED;
+    t->cx = ce;
+    t->cy = cn;
+    t->radius_m = ((r > NEIGHBOR_MIN_RADIUS_M) ? r : NEIGHBOR_MIN_RADIUS_M) + NEIGHBOR_MARGIN_M;
+}
+
+/**
+ * Initialise an empty target set
+ */
+void anchor_neighbors_init(anchor_neighbors_t *set) {
+    memset(set, 0, sizeof(*set));
+    for (int i = 0; i < NEIGHBOR_GRID * NEIGHBOR_GRID; i++) {
+        set->cell_head[i] = -1;
+    }
+    for (int i = 0; i < NEIGHBOR_MAX_TARGETS; i++) {
+        set->target[i].cell = -1;
+        set->target[i].next = -1;
+    }
+}
+
+/**
+ * Set the ENU origin (our anchor)
+ */
+void anchor_neighbors_set_origin(anchor_neighbors_t *set, double lat, double lon) {
+    if (set->origin_valid && set->count > 0) {
+        // Shift every target into the new frame
+        float dx, dy;
+        geo_to_enu(&set->origin, lat, lon, &dx, &dy);
+        for (int s = 0; s < NEIGHBOR_MAX_TARGETS; s++) {
+            neighbor_t *t = &set->target[s];
+            if (t->mmsi == 0) {
+                continue;
+            }
+            t->east_m -= dx;
+            t->north_m -= dy;
+            t->cx -= dx;
+            t->cy -= dy;
+            for (int i = 0; i < t->hist_count; i++) {
+                t->hist_e[i] -= dx;
+                t->hist_n[i] -= dy;
+            }
+            t->flags &= ~NEIGHBOR_FLAG_ALERT;
+            neighbor_grid_place(set, s);
+            neighbor_touch(t);
+        }
+    }
+    geo_ref_init(&set->origin, lat, lon);
+    set->origin_valid = true;
+    set->alerts = 0;
+    set->flags = 0;
+    set->closest_mmsi = 0;
+}
+
+/**
+ * Add one AIS position report
+ */
+bool anchor_neighbors_report(anchor_neighbors_t *set, uint32_t mmsi, double lat, double lon,
+                             float sog_mps, float cog_deg, uint32_t t_ms) {
+    if (mmsi == 0 || mmsi > NEIGHBOR_MMSI_MAX) {
+        return false;
+    }
+    if (!set->origin_valid) {
+        geo_ref_init(&set->origin, lat, lon);
+        set->origin_valid = true;
+    }
+
+    uint32_t pos = neighbor_probe(set, mmsi);
+    int slot;
+    if (set->index[pos] != 0) {
+        slot = set->index[pos] - 1;
+    } else {
+        if (set->count >= NEIGHBOR_MAX_TARGETS) {
+            // Full: evict the target heard from least recently (O(n), rare)
+            int oldest = 0;
+            for (int s = 1; s < NEIGHBOR_MAX_TARGETS; s++) {
+                if ((t_ms - set->target[s].report_ms) > (t_ms - set->target[oldest].report_ms)) {
+                    oldest = s;
+                }
+            }
+            neighbor_remove(set, oldest);
+        }
+        slot = 0;
+        while (set->target[slot].mmsi != 0) {
+            slot++;
+        }
+        neighbor_t *t = &set->target[slot];
+        uint16_t version = t->version;
+        memset(t, 0, sizeof(*t));
+        t->mmsi = mmsi;
+        t->cell = -1;
+        t->next = -1;
+        t->version = (uint16_t)(version + 1);
+        t->drawn_r = -1.0f;     // Force the first touch
+        set->count++;
+        set->index[neighbor_probe(set, mmsi)] = (uint16_t)(slot + 1);
+    }
+
+    neighbor_t *t = &set->target[slot];
+    float e, n;
+    geo_to_enu(&set->origin, lat, lon, &e, &n);
+
+    if (sog_mps >= 0.0f) {
+        float cog = cog_deg * (float)M_PI / 180.0f;
+        t->ve_mps = sog_mps * sinf(cog);
+        t->vn_mps = sog_mps * cosf(cog);
+    } else if (t->report_ms != 0 && (t_ms - t->report_ms) > 0 &&
+               (t_ms - t->report_ms) <= NEIGHBOR_SOG_GAP_MS) {
+        // SOG not available: velocity from the last two reports
+        float dt_s = (t_ms - t->report_ms) / 1000.0f;
+        t->ve_mps = (e - t->east_m) / dt_s;
+        t->vn_mps = (n - t->north_m) / dt_s;
+    }
+    t->east_m = e;
+    t->north_m = n;
+    t->report_ms = t_ms;
+    float speed = neighbor_speed(t);
+    if (speed > set->v_max_mps) set->v_max_mps = speed;
+    if (speed > set->sweep_v_max_mps) set->sweep_v_max_mps = speed;
+
+    if (t->hist_count == 0 || (t_ms - t->hist_ms) >= NEIGHBOR_HISTORY_MS) {
+        t->hist_e[t->hist_head] = e;
+        t->hist_n[t->hist_head] = n;
+        t->hist_head = (uint8_t)((t->hist_head + 1) % NEIGHBOR_HISTORY);
+        if (t->hist_count < NEIGHBOR_HISTORY) {
+            t->hist_count++;
+        }
+        t->hist_ms = t_ms;
+    }
+
+    neighbor_estimate(t);
+    neighbor_grid_place(set, slot);
+
+    // Moved out of reach of the checks: nothing will clear its alert otherwise
+    int c = t->cell % NEIGHBOR_GRID;
+    int r = t->cell / NEIGHBOR_GRID;
+    if (t->cell < 0 || c < set->box_c0 || c > set->box_c1 || r < set->box_r0 || r > set->box_r1) {
+        t->flags &= ~NEIGHBOR_FLAG_ALERT;
+    }
+    neighbor_touch(t);
+    return true;
+}
+
+/**
+ * Check the targets near us
+ */
+uint8_t anchor_neighbors_check(anchor_neighbors_t *set, float own_e, float own_n,
+                               float own_radius_m, uint32_t t_ms) {
+    set->flags = 0;
+    set->alerts = 0;
+    set->candidates = 0;
+    set->closest_mmsi = 0;
+    set->closest_m = FLT_MAX;
+
+    // Drop one stale target per check (round robin keeps this O(1)). The same
+    // sweep re-measures the fastest speed, so a fast target that has gone
+    // or slowed stops widening the search box after one cycle.
+    neighbor_t *sweep = &set->target[set->expire_cursor];
+    if (sweep->mmsi != 0 && (t_ms - sweep->report_ms) > NEIGHBOR_STALE_MS) {
+        neighbor_remove(set, set->expire_cursor);
+    } else if (sweep->mmsi != 0 && neighbor_speed(sweep) > set->sweep_v_max_mps) {
+        set->sweep_v_max_mps = neighbor_speed(sweep);
+    }
+    set->expire_cursor = (uint16_t)((set->expire_cursor + 1) % NEIGHBOR_MAX_TARGETS);
+    if (set->expire_cursor == 0) {
+        set->v_max_mps = set->sweep_v_max_mps;
+        set->sweep_v_max_mps = 0.0f;
+    }
+
+    if (set->count == 0) {
+        return 0;
+    }
+
+    // Cells that can hold an intersecting circle (around the anchor) or a close mover (around us).
+    // A mover is dead-reckoned up to one horizon from its last report, then looked at for another.
+    float circle_reach = own_radius_m + NEIGHBOR_MAX_RADIUS_M + NEIGHBOR_MARGIN_M;
+    float move_reach = fmaxf(NEIGHBOR_REACH_M,
+                             set->v_max_mps * 2.0f * NEIGHBOR_CPA_HORIZON_S + NEIGHBOR_CPA_M);
+    float x0 = fminf(-circle_reach, own_e - move_reach);
+    float x1 = fmaxf(circle_reach, own_e + move_reach);
+    float y0 = fminf(-circle_reach, own_n - move_reach);
+    float y1 = fmaxf(circle_reach, own_n + move_reach);
+    int c0 = (int)floorf(x0 / NEIGHBOR_CELL_M) + NEIGHBOR_GRID / 2;
+    int c1 = (int)floorf(x1 / NEIGHBOR_CELL_M) + NEIGHBOR_GRID / 2;
+    int r0 = (int)floorf(y0 / NEIGHBOR_CELL_M) + NEIGHBOR_GRID / 2;
+    int r1 = (int)floorf(y1 / NEIGHBOR_CELL_M) + NEIGHBOR_GRID / 2;
+    if (c0 < 0) c0 = 0;
+    if (r0 < 0) r0 = 0;
+    if (c1 >= NEIGHBOR_GRID) c1 = NEIGHBOR_GRID - 1;
+    if (r1 >= NEIGHBOR_GRID) r1 = NEIGHBOR_GRID - 1;
+    set->box_c0 = (uint8_t)c0;
+    set->box_c1 = (uint8_t)c1;
+    set->box_r0 = (uint8_t)r0;
+    set->box_r1 = (uint8_t)r1;
+
+    for (int r = r0; r <= r1; r++) {
+        for (int c = c0; c <= c1; c++) {
+            for (int s = set->cell_head[r * NEIGHBOR_GRID + c]; s >= 0; s = set->target[s].next) {
+                neighbor_t *t = &set->target[s];
+                set->candidates++;
+                uint8_t alert = 0;
+                float metric;
+
+                if (t->flags & NEIGHBOR_FLAG_ANCHORED) {
+                    // Circle gap (negative = overlap)
+                    metric = sqrtf(t->cx * t->cx + t->cy * t->cy) - (own_radius_m + t->radius_m);
+                    if (metric < 0.0f) {
+                        alert = NEIGHBOR_FLAG_OVERLAP;
+                    }
+                    t->cpa_m = sqrtf((t->cx - own_e) * (t->cx - own_e) +
+                                     (t->cy - own_n) * (t->cy - own_n));
+                    t->tcpa_s = 0.0f;
+                } else {
+                    // Dead-reckon to now, then the closest approach within the horizon
+                    float age_s = fminf((t_ms - t->report_ms) / 1000.0f, NEIGHBOR_CPA_HORIZON_S);
+                    float px = t->east_m + t->ve_mps * age_s - own_e;
+                    float py = t->north_m + t->vn_mps * age_s - own_n;
+                    float vv = t->ve_mps * t->ve_mps + t->vn_mps * t->vn_mps;
+                    float tc = (vv > 0.0f) ? -(px * t->ve_mps + py * t->vn_mps) / vv : 0.0f;
+                    if (tc < 0.0f) tc = 0.0f;
+                    if (tc > NEIGHBOR_CPA_HORIZON_S) tc = NEIGHBOR_CPA_HORIZON_S;
+                    float qx = px + t->ve_mps * tc;
+                    float qy = py + t->vn_mps * tc;
+                    metric = sqrtf(qx * qx + qy * qy);
+                    t->cpa_m = metric;
+                    t->tcpa_s = tc;
+                    if (metric < NEIGHBOR_CPA_M) {
+                        alert = NEIGHBOR_FLAG_CPA;
+                    }
+                }
+
+                t->flags = (uint8_t)((t->flags & ~NEIGHBOR_FLAG_ALERT) | alert);
+                neighbor_touch(t);
+                if (alert) {
+                    set->flags |= alert;
+                    set->alerts++;
+                    if (metric < set->closest_m) {
+                        set->closest_m = metric;
+                        set->closest_mmsi = t->mmsi;
+                    }
+                }
+            }
+        }
+    }
+    return set->flags;
+}
+
+/**
+ * Copy the drawn state of every slot
+ */
+int anchor_neighbors_view(const anchor_neighbors_t *set, neighbor_view_t *out, int max) {
+    int n = (max < NEIGHBOR_MAX_TARGETS) ? max : NEIGHBOR_MAX_TARGETS;
+    for (int s = 0; s < n; s++) {
+        const neighbor_t *t = &set->target[s];
+        out[s].mmsi = t->mmsi;
+        out[s].east_m = t->drawn_cx;
+        out[s].north_m = t->drawn_cy;
+        out[s].radius_m = t->drawn_r;
+        out[s].flags = t->drawn_flags;
+        out[s].version = t->version;
+    }
+    return n;
+}
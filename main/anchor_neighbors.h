@@ -0,0 +1,172 @@
+/**
+ * AIS Neighbor Swing Circles and Closest Approach
+ *
+ * Author: Colin Bitterfield
+ * Email: colin@bitterfield.com
+ * Date Created: 2026-10-18
+ * Date Updated: 2026-10-18
+ * Version: 0.2.0
+ *
+ * Changelog:
+ * - 0.2.0 (2026-10-18): Search box grows with the fastest target's reach
+ *   over the closest-approach horizon
+ *
+ * Tracks up to NEIGHBOR_MAX_TARGETS AIS targets in the engine's ENU frame
+ * (origin = our anchor) and warns when one gets too close:
+ * - Each MMSI keeps a fixed ring of NEIGHBOR_HISTORY positions (one every
+ *   NEIGHBOR_HISTORY_MS). MMSIs are found through a small open-addressing
+ *   hash index, so a report from a known target costs O(1).
+ * - A slow target is treated as anchored. Its swing circle is the centroid
+ *   of its history, with the largest excursion (at least
+ *   NEIGHBOR_MIN_RADIUS_M) plus NEIGHBOR_MARGIN_M for its hull.
+ * - Targets sit in a NEIGHBOR_GRID x NEIGHBOR_GRID spatial grid of
+ *   NEIGHBOR_CELL_M cells. A check only visits the cells within reach of
+ *   our swing circle, so its cost is O(k) in the nearby targets and not
+ *   O(n) in all of them. The reach around our boat is NEIGHBOR_REACH_M, or
+ *   further when the fastest target could close in from beyond it within
+ *   the horizon.
+ * - An anchored neighbor is flagged when its circle intersects our
+ *   predicted swing circle. A moving target is flagged when its closest
+ *   point of approach to our boat is under NEIGHBOR_CPA_M within
+ *   NEIGHBOR_CPA_HORIZON_S.
+ *
+ * Every target carries a version that changes only when its drawn state
+ * changes, so a chart layer can redraw just those objects.
+ * Pure C (no ESP-IDF dependencies) so it can be compiled on the host.
+ */
+
+#ifndef ANCHOR_NEIGHBORS_H
+#define ANCHOR_NEIGHBORS_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "anchor_geo.h"
+
+#define NEIGHBOR_MAX_TARGETS        200
+#define NEIGHBOR_HASH_BITS          9
+#define NEIGHBOR_HASH_SIZE          (1 << NEIGHBOR_HASH_BITS)   // MMSI index slots (> 2x targets)
+#define NEIGHBOR_HISTORY            16      // Positions kept per target
+#define NEIGHBOR_HISTORY_MS         30000   // Min spacing of kept positions
+#define NEIGHBOR_STALE_MS           900000  // Target dropped after 15 min without a report
+#define NEIGHBOR_GRID               16      // Grid cells per side (covers +-1 km)
+#define NEIGHBOR_CELL_M             128.0f  // Grid cell edge
+#define NEIGHBOR_ANCHORED_MPS       0.5f    // Slower than this = anchored (~1 kn)
+#define NEIGHBOR_MIN_RADIUS_M       15.0f   // Smallest swing radius of an anchored target
+#define NEIGHBOR_MAX_RADIUS_M       100.0f  // Larger excursions are not a swing
+#define NEIGHBOR_MARGIN_M           10.0f   // Hull length allowance around a target
+#define NEIGHBOR_CPA_M              30.0f   // Closest approach that raises a flag
+#define NEIGHBOR_CPA_HORIZON_S      120.0f  // Closest approach looked at this far ahead
+#define NEIGHBOR_REACH_M            250.0f  // Least search distance around our boat
+#define NEIGHBOR_MOVE_M             1.0f    // Drawn state changes below this are ignored
+
+// Per-target flags
+#define NEIGHBOR_FLAG_ANCHORED      (1u << 0)   // Swing circle valid (slow target)
+#define NEIGHBOR_FLAG_OVERLAP       (1u << 1)   // Swing circle intersects ours
+#define NEIGHBOR_FLAG_CPA           (1u << 2)   // Closest approach under NEIGHBOR_CPA_M
+#define NEIGHBOR_FLAG_ALERT         (NEIGHBOR_FLAG_OVERLAP | NEIGHBOR_FLAG_CPA)
+
+typedef struct {
+    uint32_t mmsi;              // 0 = free slot
+    uint32_t report_ms;         // Latest report
+    uint32_t hist_ms;           // Latest kept position
+    float east_m;               // Latest position (ENU)
+    float north_m;
+    float ve_mps;               // Velocity over ground (from SOG/COG)
+    float vn_mps;
+    float hist_e[NEIGHBOR_HISTORY];
+    float hist_n[NEIGHBOR_HISTORY];
+    uint8_t hist_head;
+    uint8_t hist_count;
+    float cx, cy;               // Swing circle centre (anchored) or latest position
+    float radius_m;             // Swing circle radius (0 when moving)
+    float cpa_m;                // Closest approach to our boat (latest check)
+    float tcpa_s;               // Time to closest approach
+    uint8_t flags;              // NEIGHBOR_FLAG_*
+    int16_t cell;               // Grid cell (-1 = off the grid)
+    int16_t next;               // Next target in the same cell (-1 = end)
+    uint16_t version;           // Bumped when the drawn state changes
+    float drawn_cx, drawn_cy, drawn_r;      // State at the last version bump
+    uint8_t drawn_flags;
+} neighbor_t;
+
+// Drawn state of one target (for the UI)
+typedef struct {
+    uint32_t mmsi;              // 0 = free slot
+    float east_m;               // Circle centre / position (ENU)
+    float north_m;
+    float radius_m;             // 0 = moving target
+    uint8_t flags;
+    uint16_t version;
+} neighbor_view_t;
+
+typedef struct {
+    geo_ref_t origin;           // ENU frame (our anchor)
+    bool origin_valid;
+    neighbor_t target[NEIGHBOR_MAX_TARGETS];
+    uint16_t count;             // Targets in use
+    uint16_t index[NEIGHBOR_HASH_SIZE];     // MMSI hash index: slot + 1, 0 = empty
+    int16_t cell_head[NEIGHBOR_GRID * NEIGHBOR_GRID];
+    uint16_t expire_cursor;     // Round-robin stale-target sweep
+    float v_max_mps;            // Fastest target speed (upper bound, refreshed each sweep cycle)
+    float sweep_v_max_mps;      // Fastest speed seen in the current sweep cycle
+    uint8_t box_c0, box_c1;     // Grid cells visited by the latest check
+    uint8_t box_r0, box_r1;
+    // Latest check
+    uint8_t flags;              // OR of flagged targets' NEIGHBOR_FLAG_ALERT bits
+    uint16_t alerts;            // Targets flagged
+    uint16_t candidates;        // Targets visited (k)
+    uint32_t closest_mmsi;      // Nearest flagged target (0 = none)
+    float closest_m;            // Its circle gap (overlap) or closest approach
+} anchor_neighbors_t;
+
+/**
+ * Initialise an empty target set
+ * @param set Target set
+ */
+void anchor_neighbors_init(anchor_neighbors_t *set);
+
+/**
+ * Set the ENU origin (our anchor). Existing targets are shifted into the new frame.
+ * @param set Target set
+ * @param lat Origin latitude (degrees)
+ * @param lon Origin longitude (degrees)
+ */
+void anchor_neighbors_set_origin(anchor_neighbors_t *set, double lat, double lon);
+
+/**
+ * Add one AIS position report - O(1)
+ * The first report fixes the origin if none is set yet.
+ * @param set Target set
+ * @param mmsi Target MMSI (non-zero)
+ * @param lat Latitude (degrees)
+ * @param lon Longitude (degrees)
+ * @param sog_mps Speed over ground (m/s, negative = not available)
+ * @param cog_deg Course over ground (degrees true)
+ * @param t_ms Timestamp (milliseconds)
+ * @return false if the report was rejected (bad MMSI)
+ */
+bool anchor_neighbors_report(anchor_neighbors_t *set, uint32_t mmsi, double lat, double lon,
+                             float sog_mps, float cog_deg, uint32_t t_ms);
+
+/**
+ * Check the targets near us - O(k) in the targets within reach
+ * @param set Target set
+ * @param own_e Our position east (metres, same frame)
+ * @param own_n Our position north (metres)
+ * @param own_radius_m Our predicted swing radius around the origin
+ * @param t_ms Timestamp (milliseconds)
+ * @return NEIGHBOR_FLAG_ALERT bits of the flagged targets (0 = clear)
+ */
+uint8_t anchor_neighbors_check(anchor_neighbors_t *set, float own_e, float own_n,
+                               float own_radius_m, uint32_t t_ms);
+
+/**
+ * Copy the drawn state of every slot
+ * @param set Target set
+ * @param out Output array (slot order; free slots have mmsi = 0)
+ * @param max Entries available in out
+ * @return Entries written (min(max, NEIGHBOR_MAX_TARGETS))
+ */
+int anchor_neighbors_view(const anchor_neighbors_t *set, neighbor_view_t *out, int max);
+
+#endif // ANCHOR_NEIGHBORS_H
@@ -0,0 +1,129 @@
+/**
+ * Position Noise Characterization Implementation
+ *
+ * Author: Colin Bitterfield
+ * Email: colin@bitterfield.com
+ * Date Created: 2026-10-18
+ * Version: 0.1.0
+ */
+
+#include "anchor_noise.h"
+#include <string.h>
+#include <math.h>
+
+/**
+ * Push one cumulative sum into a level and accumulate its second difference
+ */
+static void noise_level_push(noise_level_t *lvl, int lag, double cum_e, double cum_n) {
+    lvl->ring_e[lvl->head] = cum_e;
+    lvl->ring_n[lvl->head] = cum_n;
+    lvl->head = (uint8_t)((lvl->head + 1) % NOISE_RING);
+    if (lvl->count < NOISE_RING) {
+        lvl->count++;
+    }
+    if (lvl->count < 2 * lag + 1) {
+        return;
+    }
+
+    // X[i] - 2 X[i-m] + X[i-2m]
+    int i0 = (lvl->head + NOISE_RING - 1) % NOISE_RING;
+    int i1 = (lvl->head + NOISE_RING - 1 - lag) % NOISE_RING;
+    int i2 = (lvl->head + NOISE_RING - 1 - 2 * lag) % NOISE_RING;
+    double de = lvl->ring_e[i0] - 2.0 * lvl->ring_e[i1] + lvl->ring_e[i2];
+    double dn = lvl->ring_n[i0] - 2.0 * lvl->ring_n[i1] + lvl->ring_n[i2];
+    lvl->sum_sq += de * de + dn * dn;
+    lvl->terms++;
+}
+
+/**
+ * Initialise an empty calibration
+ */
+void anchor_noise_init(anchor_noise_t *noise) {
+    memset(noise, 0, sizeof(*noise));
+}
+
+/**
+ * Add one fix taken while the boat is stationary
+ */
+void anchor_noise_add(anchor_noise_t *noise, double lat, double lon, uint32_t t_ms) {
+    if (!noise->started) {
+        geo_ref_init(&noise->origin, lat, lon);
+        noise->first_ms = t_ms;
+        noise->started = true;
+    }
+
+    float e, n;
+    geo_to_enu(&noise->origin, lat, lon, &e, &n);
+    noise->last_ms = t_ms;
+    noise->fixes++;
+
+    // Welford running mean/variance
+    double k = (double)noise->fixes;
+    double de = e - noise->mean_e;
+    double dn = n - noise->mean_n;
+    noise->mean_e += de / k;
+    noise->mean_n += dn / k;
+    noise->m2_e += de * (e - noise->mean_e);
+    noise->m2_n += dn * (n - noise->mean_n);
+
+    // Allan deviation: level L samples the cumulative sum every max(1, m/8) fixes
+    noise->cum_e += e;
+    noise->cum_n += n;
+    for (int l = 0; l < NOISE_LEVELS; l++) {
+        uint32_t m = 1u << l;
+        uint32_t stride = (m > NOISE_OVERLAP) ? m / NOISE_OVERLAP : 1u;
+        if (noise->fixes % stride != 0) {
+            continue;
+        }
+        noise_level_push(&noise->level[l], (int)(m / stride), noise->cum_e, noise->cum_n);
+    }
+}
+
+/**
+ * Compute the profile from the data so far
+ */
+void anchor_noise_profile(const anchor_noise_t *noise, noise_profile_t *profile) {
+    memset(profile, 0, sizeof(*profile));
+    profile->version = NOISE_PROFILE_VERSION;
+    profile->fixes = noise->fixes;
+    if (noise->fixes < NOISE_MIN_FIXES) {
+        return;
+    }
+
+    profile->interval_s = (float)(noise->last_ms - noise->first_ms) / 1000.0f /
+                          (float)(noise->fixes - 1);
+    double var = (noise->m2_e + noise->m2_n) / (2.0 * (noise->fixes - 1));
+    profile->sigma_m = (float)sqrt(var);
+    profile->radius95_m = NOISE_R95_FACTOR * profile->sigma_m;
+
+    // Horizontal ADEV: sigma^2(tau) = <d^2> / (2 m^2), summed over both axes
+    int best = -1;
+    for (int l = 0; l < NOISE_LEVELS; l++) {
+        const noise_level_t *lvl = &noise->level[l];
+        if (lvl->terms < NOISE_MIN_TERMS) {
+            continue;
+        }
+        double m = (double)(1u << l);
+        profile->adev_m[l] = (float)sqrt(lvl->sum_sq / (2.0 * m * m * lvl->terms));
+        if (best < 0 || profile->adev_m[l] < profile->adev_m[best]) {
+            best = l;
+        }
+    }
+    if (best < 0) {
+        return;
+    }
+    profile->tau_best_s = (float)(1u << best) * profile->interval_s;
+    profile->adev_best_m = profile->adev_m[best];
+
+    // Tuning: radius clears the scatter, smoothing averages down to the ADEV minimum
+    profile->min_radius_m = NOISE_RADIUS_FACTOR * profile->radius95_m;
+    profile->hull_margin_m = NOISE_MARGIN_FACTOR * profile->radius95_m;
+    if (profile->hull_margin_m < NOISE_MARGIN_MIN_M) {
+        profile->hull_margin_m = NOISE_MARGIN_MIN_M;
+    }
+    float alpha = 1.0f / (float)(1u << best);
+    if (alpha < NOISE_ALPHA_MIN) alpha = NOISE_ALPHA_MIN;
+    if (alpha > NOISE_ALPHA_MAX) alpha = NOISE_ALPHA_MAX;
+    profile->smooth_alpha = alpha;
+    profile->valid = true;
+}
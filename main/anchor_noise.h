@@ -0,0 +1,107 @@
+/**
+ * Position Noise Characterization (Allan Deviation)
+ *
+ * Author: Colin Bitterfield
+ * Email: colin@bitterfield.com
+ * Date Created: 2026-10-18
+ * Version: 0.1.0
+ *
+ * "Calibrate at dock": with the boat made fast, every fix is noise. This
+ * module streams the fixes through:
+ * - Welford mean/variance of East and North (raw scatter, 95% radius)
+ * - Overlapping Allan deviation at averaging times tau = 2^L fix intervals,
+ *   L = 0..NOISE_LEVELS-1. The second difference of the cumulative position
+ *   sum is taken every max(1, m/8) fixes, so each level keeps a 17-entry ring.
+ *   Short taus are fully overlapping; long taus overlap 8x.
+ *
+ * The ADEV curve shows how far an averaged position still wanders at each
+ * time scale. Its minimum is the best smoothing time, and the raw scatter
+ * sets the smallest radius that will not false-alarm. The state is about
+ * 3 KB whatever the calibration length.
+ * Pure C (no ESP-IDF dependencies) so it can be compiled on the host.
+ */
+
+#ifndef ANCHOR_NOISE_H
+#define ANCHOR_NOISE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "anchor_geo.h"
+
+#define NOISE_LEVELS            10      // tau = 1 .. 512 fix intervals
+#define NOISE_OVERLAP           8       // Second differences per tau (long taus)
+#define NOISE_RING              (2 * NOISE_OVERLAP + 1)
+#define NOISE_MIN_FIXES         120     // Fixes before a profile is produced
+#define NOISE_MIN_TERMS         8       // ADEV terms before a level is reported
+#define NOISE_R95_FACTOR        2.448f  // 95% radius / per-axis sigma (Rayleigh)
+#define NOISE_RADIUS_FACTOR     4.0f    // Minimum safe radius / 95% radius
+#define NOISE_MARGIN_FACTOR     2.0f    // Safe-polygon margin / 95% radius
+#define NOISE_MARGIN_MIN_M      2.0f    // Safe-polygon margin floor
+#define NOISE_ALPHA_MIN         0.1f    // Smoothing weight range (keeps swing reversals timely)
+#define NOISE_ALPHA_MAX         1.0f
+#define NOISE_PROFILE_VERSION   1       // Bump when noise_profile_t changes (NVS blob)
+
+// Calibration result (stored per GPS source)
+typedef struct {
+    uint16_t version;           // NOISE_PROFILE_VERSION
+    bool valid;
+    uint32_t fixes;             // Fixes collected
+    float interval_s;           // Mean fix interval (tau0)
+    float sigma_m;              // Per-axis 1-sigma scatter
+    float radius95_m;           // 95% of fixes within this radius of the mean
+    float adev_m[NOISE_LEVELS]; // Horizontal Allan deviation at tau = 2^L * tau0 (0 = no data)
+    float tau_best_s;           // Averaging time with the lowest ADEV
+    float adev_best_m;          // ADEV at tau_best_s
+    // Derived engine tuning
+    float min_radius_m;         // Smallest alarm radius that will not false-alarm
+    float hull_margin_m;        // Safe-polygon margin
+    float smooth_alpha;         // EMA weight for swing tracking (1 = none)
+} noise_profile_t;
+
+// One averaging-time level
+typedef struct {
+    double ring_e[NOISE_RING];  // Cumulative sums at stride intervals
+    double ring_n[NOISE_RING];
+    uint8_t head;
+    uint8_t count;
+    double sum_sq;              // Sum of squared second differences (both axes)
+    uint32_t terms;
+} noise_level_t;
+
+typedef struct {
+    bool started;
+    geo_ref_t origin;           // Calibration origin (first fix)
+    uint32_t first_ms;
+    uint32_t last_ms;
+    uint32_t fixes;
+    // Welford
+    double mean_e, mean_n;
+    double m2_e, m2_n;
+    // Cumulative sums for ADEV
+    double cum_e, cum_n;
+    noise_level_t level[NOISE_LEVELS];
+} anchor_noise_t;
+
+/**
+ * Initialise an empty calibration
+ * @param noise Calibration state
+ */
+void anchor_noise_init(anchor_noise_t *noise);
+
+/**
+ * Add one fix taken while the boat is stationary - O(NOISE_LEVELS)
+ * @param noise Calibration state
+ * @param lat Latitude (degrees)
+ * @param lon Longitude (degrees)
+ * @param t_ms Timestamp (milliseconds)
+ */
+void anchor_noise_add(anchor_noise_t *noise, double lat, double lon, uint32_t t_ms);
+
+/**
+ * Compute the profile from the data so far
+ * @param noise Calibration state
+ * @param profile Output profile (valid = false until NOISE_MIN_FIXES)
+ */
+void anchor_noise_profile(const anchor_noise_t *noise, noise_profile_t *profile);
+
+#endif // ANCHOR_NOISE_H
@@ -0,0 +1,298 @@
+/**
+ * Re-anchoring Detection Implementation
+ *
+ * Author: Colin Bitterfield
+ * Email: colin@bitterfield.com
+ * Date Created: 2026-10-18
+ * Date Updated: 2026-10-18
+ * Version: 0.2.0
+ *
+ * Changelog:
+ * - 0.2.0 (2026-10-18): Suggestion events for switches declined while alarmed
+ */
+
+#include "anchor_reanchor.h"
+#include <string.h>
+#include <math.h>
+
+/**
+ * Append an event to the ring
+ */
+static void reanchor_log(anchor_reanchor_t *r, reanchor_event_type_t type, int slot,
+                         float margin, uint32_t t_ms) {
+    reanchor_event_t *ev = &r->events[r->event_count % REANCHOR_EVENTS];
+    ev->t_ms = t_ms;
+    ev->type = (uint8_t)type;
+    ev->hypo = (uint8_t)slot;
+    ev->east_m = r->hypo[slot].east_m;
+    ev->north_m = r->hypo[slot].north_m;
+    ev->margin = margin;
+    r->event_count++;
+}
+
+/**
+ * Reset a slot to a fresh hypothesis centred on a point
+ */
+static void reanchor_hypo_start(reanchor_hypo_t *h, float east_m, float north_m,
+                                float score, uint32_t t_ms) {
+    memset(h, 0, sizeof(*h));
+    h->used = true;
+    h->east_m = h->drop_e = east_m;
+    h->north_m = h->drop_n = north_m;
+    h->radius_m = h->fit_radius_m = REANCHOR_MIN_RADIUS_M;
+    h->score = score;
+    h->explained_ms = t_ms;
+    anchor_circle_init(&h->circle);
+}
+
+/**
+ * Score one fix against a hypothesis and learn from it
+ * @return true if the fix is explained (within the swing radius + noise)
+ */
+static bool reanchor_hypo_add(anchor_reanchor_t *r, reanchor_hypo_t *h, bool refine,
+                              float east_m, float north_m, uint32_t t_ms) {
+    float de = east_m - h->east_m;
+    float dn = north_m - h->north_m;
+    float d = sqrtf(de * de + dn * dn);
+
+    // Log-likelihood: uniform over the swing disc, Gaussian tail beyond it
+    float excess = (d > h->radius_m) ? d - h->radius_m : 0.0f;
+    float z = excess / REANCHOR_SIGMA_M;
+    float ll = -0.5f * z * z - 2.0f * logf(h->radius_m);
+    if (ll < REANCHOR_LL_FLOOR) {
+        ll = REANCHOR_LL_FLOOR;
+    }
+    h->score = h->score * (1.0f - 1.0f / REANCHOR_WINDOW) + ll;
+
+    bool explained = excess <= REANCHOR_EXPLAIN_SIGMAS * REANCHOR_SIGMA_M;
+    if (!explained) {
+        h->explained_ms = t_ms;
+    }
+
+    // Swing radius follows an opening swing quickly and a narrowing one slowly
+    if (d > h->radius_m) {
+        h->radius_m += REANCHOR_GROW * (d - h->radius_m);
+    } else {
+        h->radius_m -= REANCHOR_SHRINK * (h->radius_m - d);
+    }
+    if (h->radius_m < REANCHOR_MIN_RADIUS_M) h->radius_m = REANCHOR_MIN_RADIUS_M;
+    if (h->radius_m > r->radius_cap_m) h->radius_m = r->radius_cap_m;
+
+    // Candidates move their centre from the drop point to the fitted swing centre.
+    // The fit restarts while the boat is still falling back onto the rode.
+    h->fixes++;
+    if (h->radius_m > h->fit_radius_m + REANCHOR_SIGMA_M / 2.0f) {
+        anchor_circle_init(&h->circle);
+        h->fit_radius_m = h->radius_m;
+    }
+    if (refine && explained) {
+        anchor_circle_add(&h->circle, east_m, north_m);
+        circle_estimate_t est;
+        if (h->fixes % REANCHOR_FIT_EVERY == 0 && anchor_circle_estimate(&h->circle, &est) &&
+            est.rms_m < REANCHOR_FIT_MAX_RMS_M && est.radius_m >= REANCHOR_MIN_RADIUS_M &&
+            est.radius_m <= r->radius_cap_m &&
+            hypotf(est.east_m - h->drop_e, est.north_m - h->drop_n) <= r->radius_cap_m) {
+            h->east_m = est.east_m;
+            h->north_m = est.north_m;
+        }
+    }
+    return explained;
+}
+
+/**
+ * Update speed over ground: displacement of 10 s mean positions over 60 s
+ */
+static void reanchor_speed(anchor_reanchor_t *r, float east_m, float north_m, uint32_t t_ms) {
+    if (!r->bucket_started) {
+        r->bucket_start_ms = t_ms;
+        r->bucket_started = true;
+    }
+    r->bucket_e += east_m;
+    r->bucket_n += north_m;
+    r->bucket_count++;
+
+    uint32_t span_ms = t_ms - r->bucket_start_ms;
+    if (span_ms < REANCHOR_SPEED_BUCKET_MS) {
+        return;
+    }
+
+    const int ring = REANCHOR_SPEED_SPAN + 1;
+    r->mean_e[r->mean_head] = r->bucket_e / r->bucket_count;
+    r->mean_n[r->mean_head] = r->bucket_n / r->bucket_count;
+    int oldest = (r->mean_head + 1) % ring;
+    if (r->mean_count < ring) {
+        r->mean_count++;
+    }
+    if (r->mean_count == ring) {
+        float span_s = REANCHOR_SPEED_SPAN * (REANCHOR_SPEED_BUCKET_MS / 1000.0f);
+        r->speed_mps = hypotf(r->mean_e[r->mean_head] - r->mean_e[oldest],
+                              r->mean_n[r->mean_head] - r->mean_n[oldest]) / span_s;
+    }
+    r->mean_head = (uint8_t)oldest;
+    r->bucket_start_ms = t_ms;
+    r->bucket_e = 0.0f;
+    r->bucket_n = 0.0f;
+    r->bucket_count = 0;
+}
+
+/**
+ * Start tracking with the user's anchor at the ENU origin
+ */
+void anchor_reanchor_init(anchor_reanchor_t *r, float radius_cap_m, uint32_t t_ms) {
+    memset(r, 0, sizeof(*r));
+    r->radius_cap_m = (radius_cap_m > REANCHOR_MIN_RADIUS_M) ? radius_cap_m : REANCHOR_MIN_RADIUS_M;
+    r->last_ms = t_ms;
+    reanchor_hypo_start(&r->hypo[0], 0.0f, 0.0f, 0.0f, t_ms);
+    r->current = 0;
+}
+
+/**
+ * Add one position fix
+ */
+int anchor_reanchor_add(anchor_reanchor_t *r, float east_m, float north_m, uint32_t t_ms) {
+    uint32_t dt_ms = t_ms - r->last_ms;
+    r->last_ms = t_ms;
+    reanchor_speed(r, east_m, north_m, t_ms);
+
+    bool current_ok = false;
+    bool any_ok = false;
+    for (int i = 0; i < REANCHOR_HYPOTHESES; i++) {
+        reanchor_hypo_t *h = &r->hypo[i];
+        if (!h->used) {
+            continue;
+        }
+        bool ok = reanchor_hypo_add(r, h, i != r->current, east_m, north_m, t_ms);
+        any_ok |= ok;
+        if (i == r->current) {
+            current_ok = ok;
+        }
+    }
+
+    // Motoring away from the current swing (a dragging anchor is slower)
+    if (current_ok) {
+        r->transit_ms = 0;
+    } else if (r->speed_mps >= REANCHOR_TRANSIT_MPS) {
+        r->transit_ms += dt_ms;
+    }
+
+    // Boat has slowed where no hypothesis explains it: it may have re-anchored here
+    r->unexplained = any_ok ? 0 : (uint16_t)(r->unexplained + 1);
+    if (r->unexplained >= REANCHOR_SPAWN_FIXES && r->mean_count > REANCHOR_SPEED_SPAN &&
+        r->speed_mps < REANCHOR_SETTLED_MPS) {
+        int slot = -1;
+        for (int i = 0; i < REANCHOR_HYPOTHESES; i++) {
+            if (!r->hypo[i].used) {
+                slot = i;
+                break;
+            }
+            if (i != r->current && (slot < 0 || r->hypo[i].score < r->hypo[slot].score)) {
+                slot = i;
+            }
+        }
+        if (r->hypo[slot].used) {
+            reanchor_log(r, REANCHOR_EVENT_DISCARD, slot,
+                         r->hypo[slot].score - r->hypo[r->current].score, t_ms);
+        }
+        // Start level with the current hypothesis - the lead has to be earned
+        if (r->suggested == slot + 1) {
+            r->suggested = 0;
+        }
+        reanchor_hypo_start(&r->hypo[slot], east_m, north_m, r->hypo[r->current].score, t_ms);
+        reanchor_log(r, REANCHOR_EVENT_SPAWN, slot, 0.0f, t_ms);
+        r->unexplained = 0;
+    }
+
+    // Switch once a motored-to hypothesis has settled and clearly explains the fixes better
+    if (r->transit_ms < REANCHOR_TRANSIT_S * 1000u || r->speed_mps >= REANCHOR_SETTLED_MPS) {
+        return -1;
+    }
+    int best = -1;
+    float best_margin = REANCHOR_SWITCH_MARGIN;
+    for (int i = 0; i < REANCHOR_HYPOTHESES; i++) {
+        const reanchor_hypo_t *h = &r->hypo[i];
+        if (!h->used || i == r->current ||
+            (t_ms - h->explained_ms) < REANCHOR_SETTLE_S * 1000u) {
+            continue;
+        }
+        float margin = h->score - r->hypo[r->current].score;
+        if (margin >= best_margin) {
+            best_margin = margin;
+            best = i;
+        }
+    }
+    return best;
+}
+
+/**
+ * Make a hypothesis current and move every hypothesis into its frame
+ */
+void anchor_reanchor_switch(anchor_reanchor_t *r, int slot, uint32_t t_ms) {
+    if (slot < 0 || slot >= REANCHOR_HYPOTHESES || !r->hypo[slot].used) {
+        return;
+    }
+
+    reanchor_log(r, REANCHOR_EVENT_SWITCH, slot,
+                 r->hypo[slot].score - r->hypo[r->current].score, t_ms);
+
+    float dx = r->hypo[slot].east_m;
+    float dy = r->hypo[slot].north_m;
+    for (int i = 0; i < REANCHOR_HYPOTHESES; i++) {
+        reanchor_hypo_t *h = &r->hypo[i];
+        if (!h->used) {
+            continue;
+        }
+        h->east_m -= dx;
+        h->north_m -= dy;
+        h->drop_e -= dx;
+        h->drop_n -= dy;
+        anchor_circle_init(&h->circle);     // Moment sums are frame-dependent
+    }
+    for (int i = 0; i <= REANCHOR_SPEED_SPAN; i++) {
+        r->mean_e[i] -= dx;
+        r->mean_n[i] -= dy;
+    }
+    r->bucket_e -= dx * r->bucket_count;
+    r->bucket_n -= dy * r->bucket_count;
+
+    r->current = (uint8_t)slot;
+    r->transit_ms = 0;
+    r->unexplained = 0;
+    r->suggested = 0;
+}
+
+/**
+ * Log a switch the engine declined (once per hypothesis)
+ */
+void anchor_reanchor_suggest(anchor_reanchor_t *r, int slot, uint32_t t_ms) {
+    if (slot < 0 || slot >= REANCHOR_HYPOTHESES || !r->hypo[slot].used ||
+        r->suggested == slot + 1) {
+        return;
+    }
+    reanchor_log(r, REANCHOR_EVENT_SUGGEST, slot,
+                 r->hypo[slot].score - r->hypo[r->current].score, t_ms);
+    r->suggested = (uint8_t)(slot + 1);
+}
+
+/**
+ * Get an event from the ring
+ */
+bool anchor_reanchor_event(const anchor_reanchor_t *r, uint32_t seq, reanchor_event_t *ev) {
+    if (seq >= r->event_count || r->event_count - seq > REANCHOR_EVENTS) {
+        return false;
+    }
+    *ev = r->events[seq % REANCHOR_EVENTS];
+    return true;
+}
+
+/**
+ * Get printable event name
+ */
+const char* anchor_reanchor_event_name(reanchor_event_type_t type) {
+    switch (type) {
+        case REANCHOR_EVENT_SPAWN:   return "SPAWN";
+        case REANCHOR_EVENT_SWITCH:  return "SWITCH";
+        case REANCHOR_EVENT_DISCARD: return "DISCARD";
+        case REANCHOR_EVENT_SUGGEST: return "SUGGEST";
+        default:                     return "UNKNOWN";
+    }
+}
@@ -0,0 +1,178 @@
+/**
+ * Re-anchoring Detection (Multi-Hypothesis Anchor Tracking)
+ *
+ * Author: Colin Bitterfield
+ * Email: colin@bitterfield.com
+ * Date Created: 2026-10-18
+ * Date Updated: 2026-10-18
+ * Version: 0.2.0
+ *
+ * Changelog:
+ * - 0.2.0 (2026-10-18): REANCHOR_EVENT_SUGGEST / anchor_reanchor_suggest() for a
+ *   switch the engine declines while alarmed
+ *
+ * A skipper who weighs anchor and re-anchors without stopping the watch
+ * leaves the engine on a stale anchor point, so it alarms forever. This module
+ * tracks a fixed set of REANCHOR_HYPOTHESES anchor positions in the engine's
+ * ENU frame. Slot 0 starts as the anchor the user set. Each hypothesis has:
+ * - A centre: the drop point, refined by its own circle fit (anchor_circle.h)
+ *   once the swing arc is well conditioned
+ * - A swing radius learned from its fixes (grows fast, shrinks slowly) and
+ *   capped at the alarm radius
+ * - A log-likelihood with a REANCHOR_WINDOW-fix memory. Each fix scores
+ *   -0.5 * (excess / sigma)^2 - ln(r^2), where excess is how far the fix lies
+ *   beyond the swing radius. A compact swing that explains every fix wins.
+ *
+ * When the current hypothesis stops explaining the fixes and the boat slows
+ * down, a new hypothesis is spawned at the boat (replacing the weakest one).
+ * The engine switches to it only when:
+ * - The boat motored there: REANCHOR_TRANSIT_S at REANCHOR_TRANSIT_MPS or
+ *   more, outside the old swing. Speed is the displacement of 10 s mean
+ *   positions over 60 s, long enough that yawing on the rode largely
+ *   cancels. An anchor dragging, even one that resets, is slower, so a real
+ *   drag keeps its alarm.
+ * - The new hypothesis has explained every fix for REANCHOR_SETTLE_S.
+ * - Its likelihood leads the current one by REANCHOR_SWITCH_MARGIN.
+ *
+ * A fast drag that bites again can pass all three tests. The engine
+ * therefore never switches while it is alarmed. It logs a suggestion
+ * instead, and the crew decides whether to re-set the anchor.
+ *
+ * Spawns, switches, suggestions and discards go into a small event ring. The
+ * cost per fix is O(REANCHOR_HYPOTHESES).
+ * Pure C (no ESP-IDF dependencies) so it can be compiled on the host.
+ */
+
+#ifndef ANCHOR_REANCHOR_H
+#define ANCHOR_REANCHOR_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "anchor_circle.h"
+
+#define REANCHOR_HYPOTHESES     3       // Anchor hypotheses tracked (slot 0 = user's anchor)
+#define REANCHOR_WINDOW         60      // Likelihood memory (fixes)
+#define REANCHOR_SIGMA_M        3.0f    // Position noise beyond the swing radius
+#define REANCHOR_EXPLAIN_SIGMAS 3.0f    // Fix is explained within radius + 3 sigma
+#define REANCHOR_LL_FLOOR       (-20.0f) // Per-fix log-likelihood floor (outlier robustness)
+#define REANCHOR_MIN_RADIUS_M   5.0f    // Smallest swing radius
+#define REANCHOR_GROW           0.2f    // Swing radius growth gain (per fix beyond it)
+#define REANCHOR_SHRINK         0.002f  // Swing radius decay gain (per fix inside it)
+#define REANCHOR_SPAWN_FIXES    20      // Unexplained fixes before a new hypothesis is spawned
+#define REANCHOR_SPEED_BUCKET_MS 10000  // Mean position every 10 s
+#define REANCHOR_SPEED_SPAN     6       // Speed = displacement over 6 buckets (60 s)
+#define REANCHOR_SETTLED_MPS    0.4f    // Below this the boat is swinging, not under way
+#define REANCHOR_TRANSIT_MPS    1.0f    // Motoring (~2 kn) - faster than a dragging anchor
+#define REANCHOR_TRANSIT_S      30      // Motoring needed before a switch is allowed
+#define REANCHOR_SETTLE_S       300     // New swing explained this long before a switch
+#define REANCHOR_SWITCH_MARGIN  50.0f   // Log-likelihood lead needed to switch
+#define REANCHOR_FIT_EVERY      10      // Circle-fit refresh interval (fixes)
+#define REANCHOR_FIT_MAX_RMS_M  3.0f    // Circle fit accepted below this residual
+#define REANCHOR_EVENTS         8       // Event ring size
+
+typedef enum {
+    REANCHOR_EVENT_SPAWN = 0,   // New hypothesis at the boat
+    REANCHOR_EVENT_SWITCH,      // Engine moved to a new anchor
+    REANCHOR_EVENT_DISCARD,     // Weakest hypothesis replaced
+    REANCHOR_EVENT_SUGGEST      // Would switch, but the watch is alarmed
+} reanchor_event_type_t;
+
+typedef struct {
+    uint32_t t_ms;
+    uint8_t type;               // reanchor_event_type_t
+    uint8_t hypo;               // Hypothesis slot
+    float east_m;               // Hypothesis centre at the time (ENU frame of the time)
+    float north_m;
+    float margin;               // Log-likelihood lead over the current hypothesis
+} reanchor_event_t;
+
+typedef struct {
+    bool used;
+    float east_m;               // Anchor estimate (ENU)
+    float north_m;
+    float drop_e;               // Where the boat settled when spawned
+    float drop_n;
+    float radius_m;             // Learned swing radius
+    float fit_radius_m;         // Swing radius when the circle fit was restarted
+    float score;                // Log-likelihood (REANCHOR_WINDOW memory)
+    uint32_t fixes;
+    uint32_t explained_ms;      // Start of the current run of explained fixes
+    anchor_circle_t circle;     // Circle fit of this hypothesis's fixes
+} reanchor_hypo_t;
+
+typedef struct {
+    reanchor_hypo_t hypo[REANCHOR_HYPOTHESES];
+    uint8_t current;            // Hypothesis the engine is anchored on
+    float radius_cap_m;         // Alarm radius (caps every swing radius)
+    uint16_t unexplained;       // Consecutive fixes no hypothesis explains
+    uint32_t last_ms;           // Previous fix
+    // Speed over ground from bucketed mean positions
+    bool bucket_started;
+    uint32_t bucket_start_ms;
+    float bucket_e, bucket_n;
+    uint16_t bucket_count;
+    float mean_e[REANCHOR_SPEED_SPAN + 1];  // Ring of bucket means
+    float mean_n[REANCHOR_SPEED_SPAN + 1];
+    uint8_t mean_head;
+    uint8_t mean_count;
+    float speed_mps;
+    uint32_t transit_ms;        // Motoring time outside the current swing
+    uint8_t suggested;          // Slot + 1 of the hypothesis already suggested (0 = none)
+    // Event ring
+    reanchor_event_t events[REANCHOR_EVENTS];
+    uint32_t event_count;       // Total events (ring index = count % REANCHOR_EVENTS)
+} anchor_reanchor_t;
+
+/**
+ * Start tracking with the user's anchor at the ENU origin
+ * @param r Tracker
+ * @param radius_cap_m Alarm radius (largest swing a hypothesis may explain)
+ * @param t_ms Timestamp (milliseconds)
+ */
+void anchor_reanchor_init(anchor_reanchor_t *r, float radius_cap_m, uint32_t t_ms);
+
+/**
+ * Add one position fix - O(REANCHOR_HYPOTHESES)
+ * @param r Tracker
+ * @param east_m East offset (metres, engine frame)
+ * @param north_m North offset (metres, engine frame)
+ * @param t_ms Timestamp (milliseconds)
+ * @return Hypothesis slot to switch to, or -1 to stay
+ */
+int anchor_reanchor_add(anchor_reanchor_t *r, float east_m, float north_m, uint32_t t_ms);
+
+/**
+ * Make a hypothesis current and move every hypothesis into a new frame whose
+ * origin is that hypothesis's centre
+ * @param r Tracker
+ * @param slot Hypothesis slot (from anchor_reanchor_add)
+ * @param t_ms Timestamp (milliseconds)
+ */
+void anchor_reanchor_switch(anchor_reanchor_t *r, int slot, uint32_t t_ms);
+
+/**
+ * Log that a hypothesis qualifies for a switch the engine will not make
+ * (once per hypothesis; the current anchor is unchanged)
+ * @param r Tracker
+ * @param slot Hypothesis slot (from anchor_reanchor_add)
+ * @param t_ms Timestamp (milliseconds)
+ */
+void anchor_reanchor_suggest(anchor_reanchor_t *r, int slot, uint32_t t_ms);
+
+/**
+ * Get an event from the ring
+ * @param r Tracker
+ * @param seq Event sequence number (0 .. event_count - 1)
+ * @param ev Output event
+ * @return false if the event has been overwritten or does not exist yet
+ */
+bool anchor_reanchor_event(const anchor_reanchor_t *r, uint32_t seq, reanchor_event_t *ev);
+
+/**
+ * Get printable event name
+ * @param type Event type
+ * @return Static string ("SPAWN", "SWITCH", "DISCARD", "SUGGEST")
+ */
+const char* anchor_reanchor_event_name(reanchor_event_type_t type);
+
+#endif // ANCHOR_REANCHOR_H
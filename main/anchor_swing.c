@@ -0,0 +1,265 @@
+/**
+ * Swing Period Analyzer Implementation
+ *
+ * Author: Colin Bitterfield
+ * Email: colin@bitterfield.com
+ * Date Created: 2026-10-18
+ * Version: 0.1.0
+ */
+
+#include "anchor_swing.h"
+#include <string.h>
+#include <math.h>
+
+#if defined(ESP_PLATFORM)
+#include "board_config.h"
+#endif
+
+#if defined(ESP_PLATFORM) && ENABLE_ESP_DSP
+#include "dsps_fft2r.h"
+#define SWING_USE_ESP_DSP 1
+#else
+#define SWING_USE_ESP_DSP 0
+#endif
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+// Twiddle table for the portable FFT: cos/sin(2*pi*k/SWING_FFT_N), k < SWING_FFT_N/2
+static float s_twiddle[SWING_FFT_N];
+static bool s_twiddle_ready = false;
+
+#if SWING_USE_ESP_DSP
+static bool s_dsp_ready = false;
+#endif
+
+/**
+ * In-place complex FFT, portable radix-2 C implementation
+ */
+void anchor_swing_fft_c(float *z, int n) {
+    if (!s_twiddle_ready) {
+        for (int k = 0; k < SWING_FFT_N / 2; k++) {
+            double a = 2.0 * M_PI * k / SWING_FFT_N;
+            s_twiddle[2 * k] = (float)cos(a);
+            s_twiddle[2 * k + 1] = (float)sin(a);
+        }
+        s_twiddle_ready = true;
+    }
+
+    // Bit-reverse permutation
+    for (int i = 1, j = 0; i < n; i++) {
+        int bit = n >> 1;
+        for (; j & bit; bit >>= 1) {
+            j ^= bit;
+        }
+        j ^= bit;
+        if (i < j) {
+            float tr = z[2 * i], ti = z[2 * i + 1];
+            z[2 * i] = z[2 * j];
+            z[2 * i + 1] = z[2 * j + 1];
+            z[2 * j] = tr;
+            z[2 * j + 1] = ti;
+        }
+    }
+
+    // Butterflies, W = exp(-j*2*pi*k/len)
+    for (int len = 2; len <= n; len <<= 1) {
+        int half = len >> 1;
+        int step = SWING_FFT_N / len;
+        for (int i = 0; i < n; i += len) {
+            for (int k = 0; k < half; k++) {
+                float wr = s_twiddle[2 * k * step];
+                float wi = -s_twiddle[2 * k * step + 1];
+                float *a = &z[2 * (i + k)];
+                float *b = &z[2 * (i + k + half)];
+                float br = b[0] * wr - b[1] * wi;
+                float bi = b[0] * wi + b[1] * wr;
+                b[0] = a[0] - br;
+                b[1] = a[1] - bi;
+                a[0] += br;
+                a[1] += bi;
+            }
+        }
+    }
+}
+
+/**
+ * In-place complex FFT using the fastest path available
+ */
+void anchor_swing_fft(float *z, int n) {
+#if SWING_USE_ESP_DSP
+    if (!s_dsp_ready) {
+        s_dsp_ready = (dsps_fft2r_init_fc32(NULL, SWING_FFT_N) == ESP_OK);
+    }
+    if (s_dsp_ready) {
+        dsps_fft2r_fc32(z, n);
+        dsps_bit_rev_fc32(z, n);
+        return;
+    }
+#endif
+    anchor_swing_fft_c(z, n);
+}
+
+/**
+ * Power at bin k, summed over +f and -f
+ */
+static float swing_power(const float *z, int k) {
+    int m = SWING_FFT_N - k;
+    return z[2 * k] * z[2 * k] + z[2 * k + 1] * z[2 * k + 1] +
+           z[2 * m] * z[2 * m] + z[2 * m + 1] * z[2 * m + 1];
+}
+
+/**
+ * Detrend, window and transform the trail, then classify it
+ */
+static void swing_analyse(anchor_swing_t *swing) {
+    const int n = SWING_N;
+    const float dt = SWING_SAMPLE_MS / 1000.0f;
+    int oldest = (swing->head + SWING_N - n) % SWING_N;
+
+    // Least-squares linear trend per axis (x = sample index)
+    float sx = 0.0f, sxx = 0.0f, se = 0.0f, sxe = 0.0f, sn = 0.0f, sxn = 0.0f;
+    for (int i = 0; i < n; i++) {
+        int idx = (oldest + i) % SWING_N;
+        float x = (float)i;
+        sx += x;
+        sxx += x * x;
+        se += swing->east[idx];
+        sxe += x * swing->east[idx];
+        sn += swing->north[idx];
+        sxn += x * swing->north[idx];
+    }
+    float den = n * sxx - sx * sx;
+    float be = (n * sxe - sx * se) / den;
+    float bn = (n * sxn - sx * sn) / den;
+    float ae = (se - be * sx) / n;
+    float an = (sn - bn * sx) / n;
+
+    // Hann-windowed complex trail, zero-padded
+    float wsum = 0.0f;
+    memset(swing->fft, 0, sizeof(swing->fft));
+    for (int i = 0; i < n; i++) {
+        int idx = (oldest + i) % SWING_N;
+        float w = 0.5f - 0.5f * cosf(2.0f * (float)M_PI * i / (n - 1));
+        wsum += w;
+        swing->fft[2 * i] = w * (swing->east[idx] - (ae + be * i));
+        swing->fft[2 * i + 1] = w * (swing->north[idx] - (an + bn * i));
+    }
+    anchor_swing_fft(swing->fft, SWING_FFT_N);
+
+    // Strongest bin in the swing band
+    float span_s = SWING_FFT_N * dt;
+    int k_lo = (int)ceilf(span_s / SWING_PERIOD_MAX_S);
+    int k_hi = (int)floorf(span_s / SWING_PERIOD_MIN_S);
+    if (k_lo < 2) k_lo = 2;
+    if (k_hi > SWING_FFT_N / 2 - 2) k_hi = SWING_FFT_N / 2 - 2;
+
+    int k_peak = k_lo;
+    float p_peak = 0.0f;
+    for (int k = k_lo; k <= k_hi; k++) {
+        float p = swing_power(swing->fft, k);
+        if (p > p_peak) {
+            p_peak = p;
+            k_peak = k;
+        }
+    }
+    float p_total = 0.0f;
+    for (int k = 1; k < SWING_FFT_N / 2; k++) {
+        p_total += swing_power(swing->fft, k);
+    }
+
+    // Parabolic interpolation of the peak
+    float pm = swing_power(swing->fft, k_peak - 1);
+    float pp = swing_power(swing->fft, k_peak + 1);
+    float curve = pm - 2.0f * p_peak + pp;
+    float delta = (curve < 0.0f) ? 0.5f * (pm - pp) / curve : 0.0f;
+    if (delta > 0.5f) delta = 0.5f;
+    if (delta < -0.5f) delta = -0.5f;
+
+    // A swing of amplitude A along any line gives |Z(+k)| = |Z(-k)| = A*wsum/2
+    int km = SWING_FFT_N - k_peak;
+    float mag = sqrtf(swing->fft[2 * k_peak] * swing->fft[2 * k_peak] +
+                      swing->fft[2 * k_peak + 1] * swing->fft[2 * k_peak + 1]) +
+                sqrtf(swing->fft[2 * km] * swing->fft[2 * km] +
+                      swing->fft[2 * km + 1] * swing->fft[2 * km + 1]);
+
+    swing_result_t *r = &swing->result;
+    r->period_s = span_s / ((float)k_peak + delta);
+    r->amplitude_m = mag / wsum;
+    r->dominance = (p_total > 0.0f) ? (p_peak + pm + pp) / p_total : 0.0f;
+    r->drift_mps = sqrtf(be * be + bn * bn) / dt;
+    r->drift_bearing_deg = atan2f(be, bn) * 180.0f / (float)M_PI;
+    if (r->drift_bearing_deg < 0.0f) r->drift_bearing_deg += 360.0f;
+
+    // Drift wins when the net displacement over the window exceeds the swing
+    float net_m = r->drift_mps * (n - 1) * dt;
+    if (r->drift_mps >= SWING_DRIFT_MIN_MPS && net_m > 2.0f * r->amplitude_m) {
+        r->cls = SWING_CLASS_DRIFTING;
+    } else if (r->amplitude_m >= SWING_MIN_AMPLITUDE_M && r->dominance >= SWING_MIN_DOMINANCE) {
+        r->cls = SWING_CLASS_OSCILLATING;
+    } else {
+        r->cls = SWING_CLASS_STEADY;
+    }
+    r->sailing = (r->cls == SWING_CLASS_OSCILLATING && r->amplitude_m >= SWING_SAILING_M);
+
+    swing->analyses++;
+}
+
+/**
+ * Initialise an empty analyzer
+ */
+void anchor_swing_init(anchor_swing_t *swing) {
+    memset(swing, 0, sizeof(*swing));
+}
+
+/**
+ * Add one position fix
+ */
+bool anchor_swing_add(anchor_swing_t *swing, float east_m, float north_m, uint32_t t_ms) {
+    if (!swing->started) {
+        swing->bucket_start_ms = t_ms;
+        swing->started = true;
+    }
+
+    swing->bucket_e += east_m;
+    swing->bucket_n += north_m;
+    swing->bucket_count++;
+
+    if ((t_ms - swing->bucket_start_ms) < SWING_SAMPLE_MS) {
+        return false;
+    }
+
+    swing->east[swing->head] = swing->bucket_e / (float)swing->bucket_count;
+    swing->north[swing->head] = swing->bucket_n / (float)swing->bucket_count;
+    swing->head = (uint8_t)((swing->head + 1) % SWING_N);
+    if (swing->count < SWING_N) {
+        swing->count++;
+    }
+
+    swing->bucket_start_ms = t_ms;
+    swing->bucket_e = 0.0f;
+    swing->bucket_n = 0.0f;
+    swing->bucket_count = 0;
+
+    // Analyse once the window is full, then every SWING_ANALYSE_EVERY samples
+    swing->since_analysis++;
+    if (swing->count < SWING_N || swing->since_analysis < SWING_ANALYSE_EVERY) {
+        return false;
+    }
+    swing->since_analysis = 0;
+    swing_analyse(swing);
+    return true;
+}
+
+/**
+ * Get printable class name
+ */
+const char* anchor_swing_class_name(swing_class_t cls) {
+    switch (cls) {
+        case SWING_CLASS_STEADY:      return "STEADY";
+        case SWING_CLASS_OSCILLATING: return "SWINGING";
+        case SWING_CLASS_DRIFTING:    return "DRIFTING";
+        default:                      return "UNKNOWN";
+    }
+}
@@ -0,0 +1,118 @@
+/**
+ * Swing Period Analyzer
+ *
+ * Author: Colin Bitterfield
+ * Email: colin@bitterfield.com
+ * Date Created: 2026-10-18
+ * Version: 0.1.0
+ *
+ * A boat that sails at anchor swings like a pendulum with a 30-120 s period
+ * (docs/anchoring_mode_specification.md). This analyzer keeps the last
+ * 256 s of the East/North trail, decimated to one sample every 2 s. Every
+ * 2 minutes it:
+ * - Removes the linear trend from each axis. The trend slope is the net
+ *   drift velocity.
+ * - Applies a Hann window and runs one 256-point complex FFT of
+ *   z = east + j*north (zero-padded from 128 samples). A swing along any
+ *   direction shows up at +f and -f.
+ * - Picks the strongest peak in the 30-120 s band and refines it by
+ *   parabolic interpolation.
+ *
+ * The result separates healthy oscillation from monotonic drift.
+ *
+ * On the target the FFT uses esp-dsp's S3-optimised dsps_fft2r_fc32. The
+ * host (and targets built without esp-dsp) use the portable radix-2 FFT.
+ * Pure C (no ESP-IDF dependencies on the host path).
+ */
+
+#ifndef ANCHOR_SWING_H
+#define ANCHOR_SWING_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define SWING_SAMPLE_MS         2000    // Decimated sample interval
+#define SWING_N                 128     // Samples analysed (256 s)
+#define SWING_FFT_N             256     // FFT length (zero-padded)
+#define SWING_ANALYSE_EVERY     60      // New samples between analyses (2 min)
+#define SWING_PERIOD_MIN_S      30.0f   // Swing band
+#define SWING_PERIOD_MAX_S      120.0f
+#define SWING_MIN_AMPLITUDE_M   2.0f    // Smaller oscillations are GPS noise
+#define SWING_SAILING_M         5.0f    // Amplitude reported as "sailing at anchor"
+#define SWING_MIN_DOMINANCE     0.4f    // Peak share of the detrended power
+#define SWING_DRIFT_MIN_MPS     0.02f   // Net drift below this is not a drift
+
+// Trail classification
+typedef enum {
+    SWING_CLASS_UNKNOWN = 0,    // Not enough data yet
+    SWING_CLASS_STEADY,         // No clear oscillation, no drift
+    SWING_CLASS_OSCILLATING,    // Periodic swing in the 30-120 s band
+    SWING_CLASS_DRIFTING        // Net drift exceeds the oscillation
+} swing_class_t;
+
+typedef struct {
+    swing_class_t cls;
+    float period_s;             // Dominant swing period
+    float amplitude_m;          // Swing amplitude (half the peak-to-peak arc)
+    float dominance;            // Peak share of the detrended power (0-1)
+    float drift_mps;            // Net drift speed over the window
+    float drift_bearing_deg;    // Net drift direction (true)
+    bool sailing;               // Oscillating with at least SWING_SAILING_M
+} swing_result_t;
+
+typedef struct {
+    // Decimated trail
+    float east[SWING_N];
+    float north[SWING_N];
+    uint8_t head;
+    uint8_t count;
+    uint8_t since_analysis;
+    bool started;
+    uint32_t bucket_start_ms;
+    float bucket_e, bucket_n;
+    uint16_t bucket_count;
+    // FFT work buffer (interleaved re/im, 16-byte aligned for esp-dsp)
+    float fft[2 * SWING_FFT_N] __attribute__((aligned(16)));
+    swing_result_t result;
+    uint32_t analyses;          // Completed analyses
+} anchor_swing_t;
+
+/**
+ * Initialise an empty analyzer
+ * @param swing Analyzer
+ */
+void anchor_swing_init(anchor_swing_t *swing);
+
+/**
+ * Add one position fix - O(1) except every SWING_ANALYSE_EVERY samples,
+ * when one FFT is run
+ * @param swing Analyzer
+ * @param east_m East offset from anchor (metres)
+ * @param north_m North offset from anchor (metres)
+ * @param t_ms Timestamp (milliseconds)
+ * @return true if a new result is available
+ */
+bool anchor_swing_add(anchor_swing_t *swing, float east_m, float north_m, uint32_t t_ms);
+
+/**
+ * In-place complex FFT, portable radix-2 C implementation
+ * @param z Interleaved re/im data, n complex points
+ * @param n Length (power of two)
+ */
+void anchor_swing_fft_c(float *z, int n);
+
+/**
+ * In-place complex FFT using the fastest path available (esp-dsp on target)
+ * @param z Interleaved re/im data, n complex points
+ * @param n Length (power of two, at most SWING_FFT_N)
+ */
+void anchor_swing_fft(float *z, int n);
+
+/**
+ * Get printable class name
+ * @param cls Classification
+ * @return Static string
+ */
+const char* anchor_swing_class_name(swing_class_t cls);
+
+#endif // ANCHOR_SWING_H
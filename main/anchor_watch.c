@@ -0,0 +1,744 @@
+/**
+ * Anchor Watch Service Implementation
+ *
+ * Author: Colin Bitterfield
+ * Email: colin@bitterfield.com
+ * Date Created: 2026-10-18
+ * Date Updated: 2026-10-18
+ * Version: 0.2.3
+ *
+ * Changelog:
+ * - 0.2.3 (2026-10-18): Rode length stored in NVS (NVS_KEY_RODE_LENGTH) and set from CONFIGURATION
+ * - 0.2.2 (2026-10-18): Re-anchor suggestions (declined while alarmed) logged as warnings
+ * - 0.2.1 (2026-10-18): Log values are copied under the lock instead of read after it
+ * - 0.2.0 (2026-10-18): GPS source taken from the ingest path (priority arbitration), calibration bound to its source
+ */
+
+#include "anchor_watch.h"
+#include "board_config.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "esp_timer.h"
+#include "esp_log.h"
+#include "nvs.h"
+#include <string.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <math.h>
+
+static const char *TAG = "anchor_watch";
+
+static anchor_engine_t s_engine;
+static SemaphoreHandle_t s_mutex = NULL;
+
+// Latest fix (kept even while OFF so the anchor can be set at it)
+static bool s_fix_valid = false;
+static double s_lat = 0.0;
+static double s_lon = 0.0;
+static uint32_t s_fix_ms = 0;
+static uint32_t s_last_alarm_flags = 0;
+static uint32_t s_reanchor_seen = 0;        // Re-anchor events already logged
+
+// Noise profiles and calibration
+static anchor_config_t s_base_cfg;          // User configuration before noise tuning
+static anchor_source_t s_source = ANCHOR_SOURCE_N2K;    // Source feeding the engine
+static bool s_source_seen[ANCHOR_SOURCE_COUNT];
+static uint32_t s_source_ms[ANCHOR_SOURCE_COUNT];       // Latest fix per source
+static noise_profile_t s_profiles[ANCHOR_SOURCE_COUNT];
+static anchor_noise_t s_noise;
+static bool s_calibrating = false;
+static anchor_source_t s_calib_source = ANCHOR_SOURCE_N2K;
+static uint32_t s_calib_start_ms = 0;
+static uint32_t s_calib_len_ms = 0;
+
+static const char *s_noise_keys[ANCHOR_SOURCE_COUNT] = {
+    NVS_KEY_NOISE_N2K, NVS_KEY_NOISE_0183, NVS_KEY_NOISE_EXT
+};
+
+// Ingest sink contexts (one per source, so the sink knows where a fix came from)
+static const anchor_source_t s_sink_sources[ANCHOR_SOURCE_COUNT] = {
+    ANCHOR_SOURCE_N2K, ANCHOR_SOURCE_NMEA0183, ANCHOR_SOURCE_EXTERNAL
+};
+
+// User geofences (compiled zones; only the definitions are stored)
+static anchor_geofence_t s_geofence;
+
+// AIS targets around the anchorage (not stored)
+static anchor_neighbors_t s_neighbors;
+static uint8_t s_last_neighbor_flags = 0;
+
+typedef struct {
+    uint16_t version;           // GEOFENCE_BLOB_VERSION
+    uint8_t count;
+    double origin_lat;
+    double origin_lon;
+    geofence_def_t def[GEOFENCE_MAX_ZONES];     // Only count entries are stored
+} geofence_blob_t;
+
+/**
+ * Monotonic milliseconds
+ */
+static uint32_t anchor_watch_now_ms(void) {
+    return (uint32_t)(esp_timer_get_time() / 1000);
+}
+
+/**
+ * Load the stored noise profiles (missing or outdated blobs are ignored)
+ */
+static void anchor_watch_load_profiles(void) {
+    nvs_handle_t nvs_handle;
+    memset(s_profiles, 0, sizeof(s_profiles));
+    if (nvs_open(NVS_NAMESPACE, NVS_READONLY, &nvs_handle) != ESP_OK) {
+        ESP_LOGI(TAG, "No stored noise profiles");
+        return;
+    }
+
+    for (int i = 0; i < ANCHOR_SOURCE_COUNT; i++) {
+        noise_profile_t profile;
+        size_t len = sizeof(profile);
+        if (nvs_get_blob(nvs_handle, s_noise_keys[i], &profile, &len) == ESP_OK &&
+            len == sizeof(profile) && profile.version == NOISE_PROFILE_VERSION && profile.valid) {
+            s_profiles[i] = profile;
+            ESP_LOGI(TAG, "Noise profile %s: r95 %.1f m, min radius %.1f m, best tau %.0f s",
+                     s_noise_keys[i], profile.radius95_m, profile.min_radius_m, profile.tau_best_s);
+        }
+    }
+    nvs_close(nvs_handle);
+}
+
+/**
+ * Store one noise profile
+ */
+static void anchor_watch_save_profile(anchor_source_t source, const noise_profile_t *profile) {
+    nvs_handle_t nvs_handle;
+    esp_err_t err = nvs_open(NVS_NAMESPACE, NVS_READWRITE, &nvs_handle);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to open NVS: %s", esp_err_to_name(err));
+        return;
+    }
+
+    err = nvs_set_blob(nvs_handle, s_noise_keys[source], profile, sizeof(*profile));
+    if (err == ESP_OK) {
+        err = nvs_commit(nvs_handle);
+    }
+    nvs_close(nvs_handle);
+
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to save noise profile: %s", esp_err_to_name(err));
+    }
+}
+
+/**
+ * Load and compile the stored geofences
+ */
+static void anchor_watch_load_geofences(void) {
+    anchor_geofence_init(&s_geofence);
+
+    nvs_handle_t nvs_handle;
+    if (nvs_open(NVS_NAMESPACE, NVS_READONLY, &nvs_handle) != ESP_OK) {
+        return;
+    }
+    geofence_blob_t *blob = malloc(sizeof(*blob));
+    size_t len = sizeof(*blob);
+    if (blob != NULL && nvs_get_blob(nvs_handle, NVS_KEY_GEOFENCES, blob, &len) == ESP_OK &&
+        blob->version == GEOFENCE_BLOB_VERSION && blob->count <= GEOFENCE_MAX_ZONES &&
+        len == offsetof(geofence_blob_t, def) + blob->count * sizeof(geofence_def_t)) {
+        anchor_geofence_set_origin(&s_geofence, blob->origin_lat, blob->origin_lon);
+        for (int i = 0; i < blob->count; i++) {
+            if (anchor_geofence_add(&s_geofence, &blob->def[i]) < 0) {
+                ESP_LOGW(TAG, "Geofence %d is invalid - dropped", i);
+            }
+        }
+        ESP_LOGI(TAG, "Loaded %d geofence zone(s)", s_geofence.count);
+    }
+    free(blob);
+    nvs_close(nvs_handle);
+}
+
+/**
+ * Load the stored rode length (0 = unknown, no scope radius)
+ */
+static void anchor_watch_load_rode(void) {
+    nvs_handle_t nvs_handle;
+    if (nvs_open(NVS_NAMESPACE, NVS_READONLY, &nvs_handle) != ESP_OK) {
+        return;
+    }
+    uint16_t rode_m = 0;
+    if (nvs_get_u16(nvs_handle, NVS_KEY_RODE_LENGTH, &rode_m) == ESP_OK &&
+        (rode_m == 0 || (rode_m >= RODE_LENGTH_MIN_M && rode_m <= RODE_LENGTH_MAX_M))) {
+        s_base_cfg.rode_m = (float)rode_m;
+        s_engine.cfg.rode_m = (float)rode_m;
+        ESP_LOGI(TAG, "Rode length %u m", (unsigned)rode_m);
+    }
+    nvs_close(nvs_handle);
+}
+
+/**
+ * Initialise the anchor watch
+ */
+esp_err_t anchor_watch_init(void) {
+    if (s_mutex == NULL) {
+        s_mutex = xSemaphoreCreateMutex();
+        if (s_mutex == NULL) {
+            ESP_LOGE(TAG, "Failed to create mutex");
+            return ESP_ERR_NO_MEM;
+        }
+    }
+
+    anchor_engine_default_config(&s_base_cfg);
+    anchor_engine_init(&s_engine, &s_base_cfg);
+    anchor_watch_load_rode();
+    anchor_watch_load_profiles();
+    anchor_watch_load_geofences();
+    anchor_engine_set_geofence(&s_engine, &s_geofence);
+    anchor_neighbors_init(&s_neighbors);
+    anchor_engine_set_neighbors(&s_engine, &s_neighbors);
+    ESP_LOGI(TAG, "Anchor watch initialized (radius %.1f m, arming %lu s, horizon %lu s)",
+             s_engine.cfg.radius_m, (unsigned long)s_engine.cfg.arming_time_s,
+             (unsigned long)s_engine.cfg.drag_horizon_s);
+    return ESP_OK;
+}
+
+/**
+ * Feed one GPS position fix
+ */
+void anchor_watch_feed_fix(anchor_source_t source, double lat, double lon) {
+    if (s_mutex == NULL || source >= ANCHOR_SOURCE_COUNT) return;
+
+    uint32_t now = anchor_watch_now_ms();
+    xSemaphoreTake(s_mutex, portMAX_DELAY);
+
+    // Calibration: every fix of the source being calibrated is noise while the boat is made fast
+    bool calib_done = false;
+    noise_profile_t profile;
+    anchor_source_t calib_source = s_calib_source;
+    if (s_calibrating && source == s_calib_source) {
+        anchor_noise_add(&s_noise, lat, lon, now);
+        if ((now - s_calib_start_ms) >= s_calib_len_ms) {
+            anchor_noise_profile(&s_noise, &profile);
+            s_calibrating = false;
+            calib_done = true;
+            if (profile.valid) {
+                s_profiles[source] = profile;
+            }
+        }
+    }
+
+    // One source feeds the engine: a higher-priority source takes over at once,
+    // a lower one only once the active source has gone quiet
+    bool switched = false;
+    if (source != s_source &&
+        (source < s_source || !s_source_seen[s_source] ||
+         (now - s_source_ms[s_source]) > ANCHOR_SOURCE_TIMEOUT_MS)) {
+        s_source = source;
+        switched = true;
+    }
+    bool source_stored = s_profiles[source].valid;
+    s_source_seen[source] = true;
+    s_source_ms[source] = now;
+    bool active = (source == s_source);
+
+    uint32_t new_flags = 0;
+    float dist_m = 0.0f;
+    uint8_t new_neighbor = 0;
+    uint32_t neighbor_mmsi = 0;
+    float neighbor_m = 0.0f;
+    reanchor_event_t events[REANCHOR_EVENTS];
+    int event_count = 0;
+
+    if (active) {
+        s_fix_valid = true;
+        s_lat = lat;
+        s_lon = lon;
+        s_fix_ms = now;
+
+        anchor_fix_t fix = { .lat = lat, .lon = lon, .t_ms = now };
+        uint32_t flags = anchor_engine_update(&s_engine, &fix);
+        new_flags = flags & ~s_last_alarm_flags;
+        s_last_alarm_flags = flags;
+        dist_m = s_engine.dist_m;
+        new_neighbor = s_engine.neighbor_flags & ~s_last_neighbor_flags;
+        s_last_neighbor_flags = s_engine.neighbor_flags;
+        neighbor_mmsi = s_neighbors.closest_mmsi;
+        neighbor_m = s_neighbors.closest_m;
+
+        // Re-anchor events since the last fix (logged outside the lock)
+        for (; s_reanchor_seen < s_engine.reanchor.event_count; s_reanchor_seen++) {
+            if (anchor_reanchor_event(&s_engine.reanchor, s_reanchor_seen, &events[event_count])) {
+                event_count++;
+            }
+        }
+    }
+
+    xSemaphoreGive(s_mutex);
+
+    if (switched) {
+        ESP_LOGI(TAG, "GPS source: %s (noise profile %s)", s_noise_keys[source],
+                 source_stored ? "stored" : "none");
+    }
+
+    if (new_flags != 0) {
+        ESP_LOGW(TAG, "ALARM raised: flags=0x%02lx dist=%.1f m", (unsigned long)new_flags, dist_m);
+    }
+    if (new_neighbor != 0) {
+        ESP_LOGW(TAG, "AIS %s: MMSI %lu at %.0f m",
+                 (new_neighbor & NEIGHBOR_FLAG_OVERLAP) ? "swing circles overlap" : "close approach",
+                 (unsigned long)neighbor_mmsi, neighbor_m);
+    }
+    for (int i = 0; i < event_count; i++) {
+        const reanchor_event_t *ev = &events[i];
+        if (ev->type == REANCHOR_EVENT_SWITCH) {
+            ESP_LOGW(TAG, "Re-anchored: hypothesis %u at %.1f m E, %.1f m N (lead %.0f) - ARMING",
+                     ev->hypo, ev->east_m, ev->north_m, ev->margin);
+        } else if (ev->type == REANCHOR_EVENT_SUGGEST) {
+            ESP_LOGW(TAG, "Anchor holding again at %.1f m E, %.1f m N (hypothesis %u) - "
+                     "still alarmed, set the anchor to re-arm there",
+                     ev->east_m, ev->north_m, ev->hypo);
+        } else {
+            ESP_LOGI(TAG, "Anchor hypothesis %u %s at %.1f m E, %.1f m N",
+                     ev->hypo, anchor_reanchor_event_name(ev->type), ev->east_m, ev->north_m);
+        }
+    }
+    if (calib_done) {
+        if (profile.valid) {
+            ESP_LOGI(TAG, "Calibration done: %lu fixes, sigma %.2f m, r95 %.1f m, "
+                     "best tau %.0f s (ADEV %.2f m), min radius %.1f m",
+                     (unsigned long)profile.fixes, profile.sigma_m, profile.radius95_m,
+                     profile.tau_best_s, profile.adev_best_m, profile.min_radius_m);
+            anchor_watch_save_profile(calib_source, &profile);
+        } else {
+            ESP_LOGW(TAG, "Calibration failed: only %lu fixes", (unsigned long)profile.fixes);
+        }
+    }
+}
+
+/**
+ * Feed one true heading sample
+ */
+void anchor_watch_feed_heading(float heading_deg) {
+    if (s_mutex == NULL) return;
+
+    uint32_t now = anchor_watch_now_ms();
+    xSemaphoreTake(s_mutex, portMAX_DELAY);
+    anchor_engine_update_heading(&s_engine, heading_deg, now);
+    xSemaphoreGive(s_mutex);
+}
+
+/**
+ * Feed one wind sample
+ */
+void anchor_watch_feed_wind(float speed_mps, float angle_deg, bool relative) {
+    if (s_mutex == NULL) return;
+
+    uint32_t now = anchor_watch_now_ms();
+    xSemaphoreTake(s_mutex, portMAX_DELAY);
+    anchor_engine_update_wind(&s_engine, speed_mps, angle_deg, relative, now);
+    xSemaphoreGive(s_mutex);
+}
+
+/**
+ * Feed one water depth sample
+ */
+void anchor_watch_feed_depth(float depth_m) {
+    if (s_mutex == NULL) return;
+
+    uint32_t now = anchor_watch_now_ms();
+    xSemaphoreTake(s_mutex, portMAX_DELAY);
+    anchor_engine_update_depth(&s_engine, depth_m, now);
+    xSemaphoreGive(s_mutex);
+}
+
+/**
+ * Feed one decoded AIS position report
+ */
+void anchor_watch_feed_ais(uint32_t mmsi, double lat, double lon, float sog_mps, float cog_deg) {
+    if (s_mutex == NULL) return;
+
+    uint32_t now = anchor_watch_now_ms();
+    xSemaphoreTake(s_mutex, portMAX_DELAY);
+    anchor_neighbors_report(&s_neighbors, mmsi, lat, lon, sog_mps, cog_deg, now);
+    xSemaphoreGive(s_mutex);
+}
+
+static void watch_sink_fix(void *ctx, double lat, double lon, uint32_t t_ms) {
+    anchor_watch_feed_fix(*(const anchor_source_t *)ctx, lat, lon);
+}
+
+static void watch_sink_heading(void *ctx, float heading_deg, uint32_t t_ms) {
+    anchor_watch_feed_heading(heading_deg);
+}
+
+static void watch_sink_wind(void *ctx, float speed_mps, float angle_deg, bool relative, uint32_t t_ms) {
+    anchor_watch_feed_wind(speed_mps, angle_deg, relative);
+}
+
+static void watch_sink_depth(void *ctx, float depth_m, uint32_t t_ms) {
+    anchor_watch_feed_depth(depth_m);
+}
+
+/**
+ * Fill an ingest sink that feeds this service
+ */
+void anchor_watch_ingest_sink(ingest_sink_t *sink, anchor_source_t source) {
+    if (source >= ANCHOR_SOURCE_COUNT) source = ANCHOR_SOURCE_EXTERNAL;
+    sink->fix = watch_sink_fix;
+    sink->heading = watch_sink_heading;
+    sink->wind = watch_sink_wind;
+    sink->depth = watch_sink_depth;
+    sink->ctx = (void *)&s_sink_sources[source];
+}
+
+/**
+ * Set the anchor at the latest position fix
+ */
+bool anchor_watch_set_anchor_here(void) {
+    if (s_mutex == NULL) return false;
+
+    uint32_t now = anchor_watch_now_ms();
+    bool armed = false;
+    double lat = 0.0;
+    double lon = 0.0;
+    float radius_m = 0.0f;
+
+    xSemaphoreTake(s_mutex, portMAX_DELAY);
+    if (s_fix_valid && (now - s_fix_ms) <= GPS_TIMEOUT_SEC * 1000u) {
+        // Tune thresholds to the noise floor of the GPS in use
+        s_engine.cfg = s_base_cfg;
+        anchor_engine_apply_noise(&s_engine.cfg, &s_profiles[s_source]);
+        s_calibrating = false;
+        anchor_engine_set_anchor(&s_engine, s_lat, s_lon, now);
+        s_last_alarm_flags = 0;
+        s_reanchor_seen = 0;
+        s_last_neighbor_flags = 0;
+        lat = s_lat;
+        lon = s_lon;
+        radius_m = s_engine.cfg.radius_m;
+        armed = true;
+    }
+    xSemaphoreGive(s_mutex);
+
+    if (armed) {
+        ESP_LOGI(TAG, "Anchor set at %.6f, %.6f - ARMING (radius %.1f m)", lat, lon, radius_m);
+    } else {
+        ESP_LOGW(TAG, "Cannot set anchor - no recent GPS fix");
+    }
+    return armed;
+}
+
+/**
+ * Stop the anchor watch
+ */
+void anchor_watch_stop(void) {
+    if (s_mutex == NULL) return;
+
+    xSemaphoreTake(s_mutex, portMAX_DELAY);
+    anchor_engine_stop(&s_engine);
+    s_last_alarm_flags = 0;
+    xSemaphoreGive(s_mutex);
+
+    ESP_LOGI(TAG, "Anchor watch stopped");
+}
+
+/**
+ * Start "calibrate at dock"
+ */
+esp_err_t anchor_watch_calibrate_start(uint32_t minutes) {
+    if (s_mutex == NULL) return ESP_ERR_INVALID_STATE;
+
+    if (minutes < CALIBRATION_MIN_MINUTES) minutes = CALIBRATION_MIN_MINUTES;
+    if (minutes > CALIBRATION_MAX_MINUTES) minutes = CALIBRATION_MAX_MINUTES;
+
+    esp_err_t ret = ESP_OK;
+    anchor_source_t calib_source = ANCHOR_SOURCE_N2K;
+    xSemaphoreTake(s_mutex, portMAX_DELAY);
+    if (s_engine.state != ANCHOR_STATE_OFF) {
+        ret = ESP_ERR_INVALID_STATE;
+    } else {
+        anchor_noise_init(&s_noise);
+        s_calib_source = s_source;
+        s_calib_start_ms = anchor_watch_now_ms();
+        s_calib_len_ms = minutes * 60u * 1000u;
+        s_calibrating = true;
+        calib_source = s_calib_source;
+    }
+    xSemaphoreGive(s_mutex);
+
+    if (ret == ESP_OK) {
+        ESP_LOGI(TAG, "Calibrating %s for %lu min", s_noise_keys[calib_source], (unsigned long)minutes);
+    } else {
+        ESP_LOGW(TAG, "Cannot calibrate while the anchor watch is on");
+    }
+    return ret;
+}
+
+/**
+ * Abandon a calibration in progress
+ */
+void anchor_watch_calibrate_cancel(void) {
+    if (s_mutex == NULL) return;
+
+    xSemaphoreTake(s_mutex, portMAX_DELAY);
+    s_calibrating = false;
+    xSemaphoreGive(s_mutex);
+}
+
+/**
+ * Get the stored noise profile of a GPS source
+ */
+bool anchor_watch_get_noise_profile(anchor_source_t source, noise_profile_t *profile) {
+    memset(profile, 0, sizeof(*profile));
+    if (s_mutex == NULL || source >= ANCHOR_SOURCE_COUNT) return false;
+
+    xSemaphoreTake(s_mutex, portMAX_DELAY);
+    *profile = s_profiles[source];
+    xSemaphoreGive(s_mutex);
+    return profile->valid;
+}
+
+/**
+ * Get the ENU frame the geofences are drawn in
+ */
+bool anchor_watch_geofence_origin(geo_ref_t *ref) {
+    if (s_mutex == NULL) return false;
+
+    uint32_t now = anchor_watch_now_ms();
+    bool ok = true;
+    xSemaphoreTake(s_mutex, portMAX_DELAY);
+    if (!s_geofence.origin_valid) {
+        // First zone: centre the frame on the anchor, or on the boat if not anchored
+        if (s_engine.state != ANCHOR_STATE_OFF) {
+            anchor_geofence_set_origin(&s_geofence, s_engine.anchor.lat0, s_engine.anchor.lon0);
+        } else if (s_fix_valid && (now - s_fix_ms) <= GPS_TIMEOUT_SEC * 1000u) {
+            anchor_geofence_set_origin(&s_geofence, s_lat, s_lon);
+        } else {
+            ok = false;
+        }
+    }
+    if (ok) {
+        *ref = s_geofence.origin;
+    }
+    xSemaphoreGive(s_mutex);
+    return ok;
+}
+
+/**
+ * Compile and add a geofence zone
+ */
+int anchor_watch_geofence_add(const geofence_def_t *def) {
+    if (s_mutex == NULL) return -1;
+
+    xSemaphoreTake(s_mutex, portMAX_DELAY);
+    int index = s_geofence.origin_valid ? anchor_geofence_add(&s_geofence, def) : -1;
+    xSemaphoreGive(s_mutex);
+
+    if (index < 0) {
+        ESP_LOGW(TAG, "Geofence rejected (full, invalid, or no frame)");
+    }
+    return index;
+}
+
+/**
+ * Remove a geofence zone
+ */
+bool anchor_watch_geofence_remove(int index) {
+    if (s_mutex == NULL) return false;
+
+    xSemaphoreTake(s_mutex, portMAX_DELAY);
+    bool removed = anchor_geofence_remove(&s_geofence, index);
+    s_engine.geofence_hits = 0;
+    xSemaphoreGive(s_mutex);
+    return removed;
+}
+
+/**
+ * Get the number of geofence zones
+ */
+int anchor_watch_geofence_count(void) {
+    if (s_mutex == NULL) return 0;
+
+    xSemaphoreTake(s_mutex, portMAX_DELAY);
+    int count = s_geofence.count;
+    xSemaphoreGive(s_mutex);
+    return count;
+}
+
+/**
+ * Get one geofence zone definition
+ */
+bool anchor_watch_geofence_get(int index, geofence_def_t *def) {
+    if (s_mutex == NULL) return false;
+
+    bool ok = false;
+    xSemaphoreTake(s_mutex, portMAX_DELAY);
+    if (index >= 0 && index < s_geofence.count) {
+        *def = s_geofence.zone[index].def;
+        ok = true;
+    }
+    xSemaphoreGive(s_mutex);
+    return ok;
+}
+
+/**
+ * Store the geofence zones in NVS
+ */
+esp_err_t anchor_watch_geofence_save(void) {
+    if (s_mutex == NULL) return ESP_ERR_INVALID_STATE;
+
+    geofence_blob_t *blob = malloc(sizeof(*blob));
+    if (blob == NULL) {
+        return ESP_ERR_NO_MEM;
+    }
+
+    xSemaphoreTake(s_mutex, portMAX_DELAY);
+    blob->version = GEOFENCE_BLOB_VERSION;
+    blob->count = s_geofence.count;
+    blob->origin_lat = s_geofence.origin.lat0;
+    blob->origin_lon = s_geofence.origin.lon0;
+    for (int i = 0; i < s_geofence.count; i++) {
+        blob->def[i] = s_geofence.zone[i].def;
+    }
+    xSemaphoreGive(s_mutex);
+
+    nvs_handle_t nvs_handle;
+    esp_err_t err = nvs_open(NVS_NAMESPACE, NVS_READWRITE, &nvs_handle);
+    if (err == ESP_OK) {
+        err = nvs_set_blob(nvs_handle, NVS_KEY_GEOFENCES, blob,
+                           offsetof(geofence_blob_t, def) + blob->count * sizeof(geofence_def_t));
+        if (err == ESP_OK) {
+            err = nvs_commit(nvs_handle);
+        }
+        nvs_close(nvs_handle);
+    }
+
+    if (err == ESP_OK) {
+        ESP_LOGI(TAG, "Saved %d geofence zone(s)", blob->count);
+    } else {
+        ESP_LOGE(TAG, "Failed to save geofences: %s", esp_err_to_name(err));
+    }
+    free(blob);
+    return err;
+}
+
+/**
+ * Set the rode length and store it in NVS
+ */
+esp_err_t anchor_watch_set_rode_length(float rode_m) {
+    if (s_mutex == NULL) return ESP_ERR_INVALID_STATE;
+
+    if (!(rode_m >= 0.0f && rode_m <= RODE_LENGTH_MAX_M)) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    uint16_t rode = (uint16_t)lroundf(rode_m);
+    if (rode != 0 && rode < RODE_LENGTH_MIN_M) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    nvs_handle_t nvs_handle;
+    esp_err_t err = nvs_open(NVS_NAMESPACE, NVS_READWRITE, &nvs_handle);
+    if (err == ESP_OK) {
+        err = nvs_set_u16(nvs_handle, NVS_KEY_RODE_LENGTH, rode);
+        if (err == ESP_OK) {
+            err = nvs_commit(nvs_handle);
+        }
+        nvs_close(nvs_handle);
+    }
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to save rode length: %s", esp_err_to_name(err));
+        return err;
+    }
+
+    // The engine keeps the scope it anchored with; the new rode is used from the next anchor
+    xSemaphoreTake(s_mutex, portMAX_DELAY);
+    s_base_cfg.rode_m = (float)rode;
+    bool off = (s_engine.state == ANCHOR_STATE_OFF);
+    if (off) {
+        s_engine.cfg.rode_m = (float)rode;
+    }
+    xSemaphoreGive(s_mutex);
+
+    ESP_LOGI(TAG, "Rode length %u m%s", (unsigned)rode, off ? "" : " (applies when the anchor is next set)");
+    return ESP_OK;
+}
+
+/**
+ * Get a consistent snapshot of the anchor watch
+ */
+void anchor_watch_get_status(anchor_status_t *status) {
+    memset(status, 0, sizeof(*status));
+    status->ttb_s = -1.0f;
+    if (s_mutex == NULL) return;
+
+    uint32_t now = anchor_watch_now_ms();
+    xSemaphoreTake(s_mutex, portMAX_DELAY);
+
+    status->state = s_engine.state;
+    status->alarm_flags = s_engine.alarm_flags;
+    status->fix_valid = s_fix_valid && (now - s_fix_ms) <= GPS_TIMEOUT_SEC * 1000u;
+    status->lat = s_lat;
+    status->lon = s_lon;
+    status->anchor_lat = s_engine.anchor.lat0;
+    status->anchor_lon = s_engine.anchor.lon0;
+    status->fix_ms = s_fix_ms;
+    status->heading_valid = s_engine.heading_valid &&
+                            (now - s_engine.heading_ms) <= ANCHOR_HEADING_MAX_AGE_MS;
+    status->heading_deg = s_engine.heading_deg;
+    status->wind_valid = s_engine.wind.wind_valid &&
+                         (now - s_engine.wind.wind_ms) <= WIND_MAX_AGE_MS;
+    if (status->wind_valid) {
+        // Smoothed vector is the direction the wind blows to
+        status->wind_mps = sqrtf(s_engine.wind.we * s_engine.wind.we +
+                                 s_engine.wind.wn * s_engine.wind.wn);
+        float from_deg = atan2f(-s_engine.wind.we, -s_engine.wind.wn) * (180.0f / (float)M_PI);
+        status->wind_from_deg = (from_deg < 0.0f) ? from_deg + 360.0f : from_deg;
+    }
+    status->rode_m = s_engine.cfg.rode_m;
+    status->dist_m = s_engine.dist_m;
+    status->radius_m = s_engine.radius_m;
+    status->drag_rate_valid = s_engine.dragrate.valid;
+    status->drag_rate_mps = s_engine.dragrate.rate_mps;
+    status->ttb_s = s_engine.ttb_s;
+    status->horizon_s = s_engine.cfg.drag_horizon_s;
+    status->check = s_engine.check;
+    status->depth_valid = s_engine.depth.valid &&
+                          (now - s_engine.depth.depth_ms) <= DEPTH_MAX_AGE_MS;
+    status->depth_m = s_engine.depth.depth_m;
+    status->swing_class = s_engine.swing.result.cls;
+    status->swing_period_s = s_engine.swing.result.period_s;
+    status->swing_amplitude_m = s_engine.swing.result.amplitude_m;
+    status->sailing = s_engine.swing.result.sailing;
+    status->source = s_source;
+    status->calibrating = s_calibrating;
+    status->calib_source = s_calib_source;
+    if (s_calibrating && s_calib_len_ms > 0) {
+        uint32_t pct = (uint32_t)((uint64_t)(now - s_calib_start_ms) * 100u / s_calib_len_ms);
+        status->calib_percent = (uint8_t)(pct > 100u ? 100u : pct);
+    }
+    status->noise_valid = s_profiles[s_source].valid;
+    status->noise_r95_m = s_profiles[s_source].radius95_m;
+    status->noise_min_radius_m = s_profiles[s_source].min_radius_m;
+    status->geofence_count = s_geofence.count;
+    status->geofence_hits = s_engine.geofence_hits;
+    status->reanchors = s_engine.reanchors;
+    status->swing_radius_m = s_engine.swing_radius_m;
+    status->neighbor_count = s_neighbors.count;
+    status->neighbor_alerts = (s_engine.neighbor_flags != 0) ? s_neighbors.alerts : 0;
+    status->neighbor_flags = s_engine.neighbor_flags;
+    if (s_engine.neighbor_flags != 0) {
+        status->neighbor_mmsi = s_neighbors.closest_mmsi;
+        status->neighbor_m = s_neighbors.closest_m;
+    }
+
+    xSemaphoreGive(s_mutex);
+}
+
+/**
+ * Get the drawn state of every AIS target slot
+ */
+int anchor_watch_get_neighbors(neighbor_view_t *out, int max) {
+    if (s_mutex == NULL) return 0;
+
+    xSemaphoreTake(s_mutex, portMAX_DELAY);
+    int n = anchor_neighbors_view(&s_neighbors, out, max);
+    xSemaphoreGive(s_mutex);
+    return n;
+}
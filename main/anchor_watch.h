@@ -0,0 +1,235 @@
+/**
+ * Anchor Watch Service
+ *
+ * Author: Colin Bitterfield
+ * Email: colin@bitterfield.com
+ * Date Created: 2026-10-18
+ * Date Updated: 2026-10-18
+ * Version: 0.2.1
+ *
+ * Changelog:
+ * - 0.2.1 (2026-10-18): anchor_watch_set_rode_length
+ *
+ * Owns the single anchor_engine_t instance on the target and serialises
+ * access to it. Data sources (GPS, compass, wind, depth) feed it; consumers (UI screens,
+ * NMEA 2000 / NMEA 0183 / WiFi outputs, alarm outputs) read a consistent
+ * anchor_status_t snapshot and never touch the engine directly.
+ */
+
+#ifndef ANCHOR_WATCH_H
+#define ANCHOR_WATCH_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "esp_err.h"
+#include "anchor_engine.h"
+#include "anchor_ingest.h"
+
+// GPS sources (priority order, see splash_screen.h) - each has its own noise profile
+typedef enum {
+    ANCHOR_SOURCE_N2K = 0,      // NMEA 2000
+    ANCHOR_SOURCE_NMEA0183,     // NMEA 0183
+    ANCHOR_SOURCE_EXTERNAL,     // External GPS module
+    ANCHOR_SOURCE_COUNT
+} anchor_source_t;
+
+#define ANCHOR_SOURCE_TIMEOUT_MS    5000    // Active source silent this long: a lower-priority one takes over
+
+// Snapshot of the anchor watch for displays and remote outputs
+typedef struct {
+    anchor_state_t state;       // OFF / ARMING / ARMED / ALARM
+    uint32_t alarm_flags;       // ANCHOR_ALARM_* reasons
+    bool fix_valid;             // A recent position fix is available
+    double lat;                 // Latest position (degrees)
+    double lon;
+    double anchor_lat;          // Anchor position (degrees, valid when state != OFF)
+    double anchor_lon;
+    uint32_t fix_ms;            // Time of the latest fix (changes with every fix)
+    bool heading_valid;         // heading_deg is recent
+    float heading_deg;          // True heading
+    bool wind_valid;            // wind_mps / wind_from_deg are recent
+    float wind_mps;             // Smoothed true wind speed
+    float wind_from_deg;        // True direction the wind blows from
+    float rode_m;               // Rode paid out (0 = unknown)
+    float dist_m;               // Distance from anchor
+    float radius_m;             // Alarm radius (tide-adjusted)
+    bool drag_rate_valid;       // drag_rate_mps is available
+    float drag_rate_mps;        // Radial drift velocity (+ = away from anchor)
+    float ttb_s;                // Predicted seconds to alarm radius (-1 = none)
+    uint32_t horizon_s;         // Escalation horizon for ttb_s (0 = off)
+    anchor_check_t check;       // Anchor position cross-check
+    bool depth_valid;           // depth_m is available
+    float depth_m;              // Filtered water depth
+    swing_class_t swing_class;  // Oscillating / drifting (UNKNOWN until 256 s of trail)
+    float swing_period_s;       // Dominant swing period
+    float swing_amplitude_m;    // Swing amplitude
+    bool sailing;               // Sailing at anchor
+    anchor_source_t source;     // GPS source feeding the engine
+    bool calibrating;           // Noise calibration in progress
+    anchor_source_t calib_source;   // Source being (or last) calibrated
+    uint8_t calib_percent;      // Calibration progress (0-100)
+    bool noise_valid;           // Active source has a noise profile
+    float noise_r95_m;          // 95% position scatter of the active source
+    float noise_min_radius_m;   // Minimum safe radius from the profile
+    uint8_t geofence_count;     // User zones defined
+    uint32_t geofence_hits;     // Zones violated (bit per zone index)
+    uint32_t reanchors;         // Automatic anchor moves since the anchor was set
+    float swing_radius_m;       // Predicted swing radius (neighbor check)
+    uint16_t neighbor_count;    // AIS targets tracked
+    uint16_t neighbor_alerts;   // Targets overlapping our swing or closing under the CPA limit
+    uint8_t neighbor_flags;     // NEIGHBOR_FLAG_ALERT bits
+    uint32_t neighbor_mmsi;     // Closest flagged target (0 = none)
+    float neighbor_m;           // Its circle gap or closest approach
+} anchor_status_t;
+
+/**
+ * Initialise the anchor watch (engine in OFF state with default configuration)
+ * @return ESP_OK on success
+ */
+esp_err_t anchor_watch_init(void);
+
+/**
+ * Feed one GPS position fix (any task)
+ * Only the highest-priority source heard within ANCHOR_SOURCE_TIMEOUT_MS feeds
+ * the engine; its noise profile tunes the next arming. A calibration takes the
+ * fixes of the source that was active when it started.
+ * @param source Source the fix came from
+ * @param lat Latitude (degrees)
+ * @param lon Longitude (degrees)
+ */
+void anchor_watch_feed_fix(anchor_source_t source, double lat, double lon);
+
+/**
+ * Feed one true heading sample (any task)
+ * @param heading_deg True heading (degrees)
+ */
+void anchor_watch_feed_heading(float heading_deg);
+
+/**
+ * Feed one wind sample (any task)
+ * @param speed_mps Wind speed (m/s)
+ * @param angle_deg Wind angle (degrees)
+ * @param relative true if angle_deg is relative to the bow (PGN 130306 reference 2/3, $WIMWV R)
+ */
+void anchor_watch_feed_wind(float speed_mps, float angle_deg, bool relative);
+
+/**
+ * Feed one water depth sample (any task)
+ * @param depth_m Water depth (metres, transducer offset already applied)
+ */
+void anchor_watch_feed_depth(float depth_m);
+
+/**
+ * Feed one decoded AIS position report (any task)
+ * @param mmsi Target MMSI
+ * @param lat Latitude (degrees)
+ * @param lon Longitude (degrees)
+ * @param sog_mps Speed over ground (m/s, negative = not available)
+ * @param cog_deg Course over ground (degrees true)
+ */
+void anchor_watch_feed_ais(uint32_t mmsi, double lat, double lon, float sog_mps, float cog_deg);
+
+/**
+ * Fill an ingest sink that feeds this service (the watch clock replaces the frame time)
+ * @param sink Sink to fill - pass it to anchor_ingest_init() for a CAN or UART reader task
+ * @param source GPS source of the reader's bus or port (tags its position fixes)
+ */
+void anchor_watch_ingest_sink(ingest_sink_t *sink, anchor_source_t source);
+
+/**
+ * Set the anchor at the latest position fix and start ARMING
+ * @return true if armed, false if there is no recent fix
+ */
+bool anchor_watch_set_anchor_here(void);
+
+/**
+ * Stop the anchor watch (OFF)
+ */
+void anchor_watch_stop(void);
+
+/**
+ * Start "calibrate at dock": collect fixes with the boat made fast and store
+ * the resulting noise profile in NVS for the active source (one profile per source)
+ * @param minutes Duration (clamped to CALIBRATION_MIN/MAX_MINUTES)
+ * @return ESP_OK, or ESP_ERR_INVALID_STATE while the anchor watch is on
+ */
+esp_err_t anchor_watch_calibrate_start(uint32_t minutes);
+
+/**
+ * Abandon a calibration in progress (the stored profile is kept)
+ */
+void anchor_watch_calibrate_cancel(void);
+
+/**
+ * Get the stored noise profile of a GPS source
+ * @param source GPS source
+ * @param profile Output profile
+ * @return true if the source has a valid profile
+ */
+bool anchor_watch_get_noise_profile(anchor_source_t source, noise_profile_t *profile);
+
+/**
+ * Get the ENU frame the geofences are drawn in. The first call fixes it at
+ * the anchor (or the latest fix if not anchored); saved zones keep theirs.
+ * @param ref Output frame
+ * @return false if no frame is set and there is no recent fix
+ */
+bool anchor_watch_geofence_origin(geo_ref_t *ref);
+
+/**
+ * Compile and add a geofence zone (coordinates in the origin frame)
+ * @param def Zone definition
+ * @return Zone index, or -1 if full, invalid, or no frame yet
+ */
+int anchor_watch_geofence_add(const geofence_def_t *def);
+
+/**
+ * Remove a geofence zone (not stored until anchor_watch_geofence_save)
+ * @param index Zone index
+ * @return true if removed
+ */
+bool anchor_watch_geofence_remove(int index);
+
+/**
+ * Get the number of geofence zones
+ * @return Zone count
+ */
+int anchor_watch_geofence_count(void);
+
+/**
+ * Get one geofence zone definition
+ * @param index Zone index
+ * @param def Output definition
+ * @return true if the zone exists
+ */
+bool anchor_watch_geofence_get(int index, geofence_def_t *def);
+
+/**
+ * Store the geofence zones in NVS
+ * @return ESP_OK on success
+ */
+esp_err_t anchor_watch_geofence_save(void);
+
+/**
+ * Set the rode length and store it in NVS. Used for the scope radius from
+ * the next time the anchor is set.
+ * @param rode_m Rode length (metres, 0 = unknown, else RODE_LENGTH_MIN_M..MAX_M)
+ * @return ESP_OK, ESP_ERR_INVALID_ARG if out of range, or the NVS error
+ */
+esp_err_t anchor_watch_set_rode_length(float rode_m);
+
+/**
+ * Get the drawn state of every AIS target slot (for a chart layer)
+ * @param out Output array (slot order; free slots have mmsi = 0)
+ * @param max Entries available in out (NEIGHBOR_MAX_TARGETS for all)
+ * @return Entries written
+ */
+int anchor_watch_get_neighbors(neighbor_view_t *out, int max);
+
+/**
+ * Get a consistent snapshot of the anchor watch
+ * @param status Output snapshot
+ */
+void anchor_watch_get_status(anchor_status_t *status);
+
+#endif // ANCHOR_WATCH_H
@@ -0,0 +1,218 @@
+/**
+ * Wind-Aware Swing Model Implementation
+ *
+ * Author: Colin Bitterfield
+ * Email: colin@bitterfield.com
+ * Date Created: 2026-10-18
+ * Date Updated: 2026-10-18
+ * Version: 0.2.0
+ *
+ * Changelog:
+ * - 0.2.0 (2026-10-18): Cross-wind spread keeps learning from explained fixes;
+ *   anchor_wind_relearn() follows a shifted lie
+ */
+
+#include "anchor_wind.h"
+#include <string.h>
+#include <math.h>
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+#define WIND_DEG_TO_RAD     ((float)M_PI / 180.0f)
+#define WIND_MIN_SPEED_VAR  0.25f   // Wind speed variance needed to fit the slope (m/s)^2
+
+/**
+ * Current r = a + b*w coefficients from the running sums
+ */
+static void wind_fit(const anchor_wind_t *wind, float *a, float *b) {
+    if (wind->n == 0) {
+        *a = 0.0f;
+        *b = 0.0f;
+        return;
+    }
+
+    double n = (double)wind->n;
+    double den = n * wind->sww - wind->sw * wind->sw;
+    double slope = 0.0;
+
+    // Only fit a slope once the wind has actually varied
+    if (den > n * n * WIND_MIN_SPEED_VAR) {
+        slope = (n * wind->swr - wind->sw * wind->sr) / den;
+        if (slope < 0.0) slope = 0.0;   // More wind never pulls the boat closer
+    }
+
+    *b = (float)slope;
+    *a = (float)((wind->sr - slope * wind->sw) / n);
+}
+
+/**
+ * Initialise an empty model
+ */
+void anchor_wind_init(anchor_wind_t *wind, uint32_t t_ms) {
+    memset(wind, 0, sizeof(*wind));
+    wind->bias_c = 1.0f;
+    wind->learn_until_ms = t_ms + WIND_LEARN_MS;
+    wind->lie_until_ms = wind->learn_until_ms;
+}
+
+/**
+ * Learn the lie again after it has shifted
+ */
+void anchor_wind_relearn(anchor_wind_t *wind, float east_m, float north_m, uint32_t t_ms) {
+    wind->lie_until_ms = t_ms + WIND_LEARN_MS;
+    if (wind->var_n > WIND_RELEARN_PRIOR) {
+        wind->var_n = WIND_RELEARN_PRIOR;
+    }
+    float speed = hypotf(wind->we, wind->wn);
+    float r = hypotf(east_m, north_m);
+    if (speed >= WIND_MIN_SPEED_MPS && r > WIND_FLOOR_M) {
+        float ux = wind->we / speed;
+        float uy = wind->wn / speed;
+        wind->bias_c = (east_m * ux + north_m * uy) / r;
+        wind->bias_s = (east_m * uy - north_m * ux) / r;
+    }
+}
+
+/**
+ * Feed one true wind sample
+ */
+void anchor_wind_update(anchor_wind_t *wind, float speed_mps, float from_deg, uint32_t t_ms) {
+    // Wind blows towards from + 180 deg
+    float from = from_deg * WIND_DEG_TO_RAD;
+    float te = -speed_mps * sinf(from);
+    float tn = -speed_mps * cosf(from);
+
+    if (!wind->wind_valid || (t_ms - wind->wind_ms) > WIND_MAX_AGE_MS) {
+        wind->we = te;
+        wind->wn = tn;
+        wind->gust_mps = speed_mps;
+    } else {
+        float dt = (float)(t_ms - wind->wind_ms) / 1000.0f;
+        float alpha = dt / (WIND_SMOOTH_S + dt);
+        wind->we += alpha * (te - wind->we);
+        wind->wn += alpha * (tn - wind->wn);
+
+        // Gust peak: jumps up instantly, relaxes towards the mean
+        float mean = hypotf(wind->we, wind->wn);
+        float decay = dt / WIND_GUST_HOLD_S;
+        if (decay > 1.0f) decay = 1.0f;
+        wind->gust_mps -= (wind->gust_mps - mean) * decay;
+        if (speed_mps > wind->gust_mps) {
+            wind->gust_mps = speed_mps;
+        }
+    }
+
+    wind->wind_ms = t_ms;
+    wind->wind_valid = true;
+}
+
+/**
+ * Evaluate (and optionally learn from) one position fix
+ */
+uint32_t anchor_wind_observe(anchor_wind_t *wind, float east_m, float north_m,
+                             uint32_t t_ms, bool learn) {
+    float speed = hypotf(wind->we, wind->wn);
+
+    wind->residual_valid = false;
+    wind->flags = 0;
+    if (!wind->wind_valid || (t_ms - wind->wind_ms) > WIND_MAX_AGE_MS ||
+        speed < WIND_MIN_SPEED_MPS) {
+        wind->cross_run = 0;
+        return 0;
+    }
+
+    // Predicted lie: downwind, rotated by the learned bias
+    float bias_norm = hypotf(wind->bias_c, wind->bias_s);
+    float bc = wind->bias_c / bias_norm;
+    float bs = wind->bias_s / bias_norm;
+    float ux = wind->we / speed;
+    float uy = wind->wn / speed;
+    // Rotate the bearing clockwise by the bias angle
+    float lx = ux * bc + uy * bs;
+    float ly = uy * bc - ux * bs;
+
+    float a, b;
+    wind_fit(wind, &a, &b);
+    float r_pred = a + b * speed;
+
+    wind->pred_e = lx * r_pred;
+    wind->pred_n = ly * r_pred;
+    float de = east_m - wind->pred_e;
+    float dn = north_m - wind->pred_n;
+    wind->along_m = de * lx + dn * ly;
+    wind->cross_m = de * ly - dn * lx;
+    wind->residual_valid = true;
+
+    uint32_t flags = 0;
+    bool mature = anchor_wind_is_mature(wind);
+    if (mature) {
+        float lim_a = WIND_SIGMA_K * sqrtf(wind->var_along) + WIND_FLOOR_M;
+        float lim_c = WIND_SIGMA_K * sqrtf(wind->var_cross) + WIND_FLOOR_M;
+        float gust_allow = b * (wind->gust_mps - speed);
+
+        bool cross_ok = fabsf(wind->cross_m) <= lim_c;
+        if (cross_ok && wind->along_m <= gust_allow + lim_a) {
+            flags |= WIND_FLAG_EXPLAINED;
+        }
+
+        if (!cross_ok) {
+            if (wind->cross_run < UINT16_MAX) wind->cross_run++;
+        } else {
+            wind->cross_run = 0;
+        }
+        if (wind->cross_run >= WIND_CROSS_FIXES) {
+            flags |= WIND_FLAG_CROSS;
+        }
+    }
+
+    // Learn from this fix (first hours only, never while alarmed). Once mature
+    // the along-wind limit is frozen and only inliers refine the lie and the
+    // distance fit, so a slow drag cannot teach the model its own track. The
+    // cross-wind spread keeps learning from explained fixes: ten minutes of
+    // swinging understate it.
+    bool inlier = learn;
+    if (learn && mature) {
+        float in_a = WIND_LEARN_SIGMA * sqrtf(wind->var_along) + WIND_FLOOR_M;
+        float in_c = WIND_LEARN_SIGMA * sqrtf(wind->var_cross) + WIND_FLOOR_M;
+        inlier = fabsf(wind->along_m) <= in_a && fabsf(wind->cross_m) <= in_c;
+    }
+    if (learn && (int32_t)(wind->lie_until_ms - t_ms) > 0) {
+        if (!mature || (flags & WIND_FLAG_EXPLAINED)) {
+            wind->var_n++;
+            float k = 1.0f / (float)wind->var_n;
+            if (!mature) {
+                wind->var_along += k * (wind->along_m * wind->along_m - wind->var_along);
+            }
+            wind->var_cross += k * (wind->cross_m * wind->cross_m - wind->var_cross);
+        }
+        float r = hypotf(east_m, north_m);
+        if (inlier && r > WIND_FLOOR_M) {
+            // Bearing residual as a unit vector relative to the wind-to direction
+            float oc = (east_m * ux + north_m * uy) / r;
+            float os = (east_m * uy - north_m * ux) / r;
+            float k = 1.0f / WIND_VAR_WINDOW;
+            wind->bias_c += k * (oc - wind->bias_c);
+            wind->bias_s += k * (os - wind->bias_s);
+        }
+    }
+    if (inlier && (int32_t)(wind->learn_until_ms - t_ms) > 0) {
+        float r = hypotf(east_m, north_m);
+        wind->n++;
+        wind->sw += speed;
+        wind->sww += (double)speed * speed;
+        wind->sr += r;
+        wind->swr += (double)speed * r;
+    }
+
+    wind->flags = flags;
+    return flags;
+}
+
+/**
+ * Check whether the model has learned enough to be used
+ */
+bool anchor_wind_is_mature(const anchor_wind_t *wind) {
+    return wind->n >= WIND_MIN_SAMPLES;
+}
@@ -0,0 +1,128 @@
+/**
+ * Wind-Aware Swing Model
+ *
+ * Author: Colin Bitterfield
+ * Email: colin@bitterfield.com
+ * Date Created: 2026-10-18
+ * Date Updated: 2026-10-18
+ * Version: 0.2.0
+ *
+ * Changelog:
+ * - 0.2.0 (2026-10-18): Cross-wind spread keeps learning from explained fixes;
+ *   anchor_wind_relearn() follows a shifted lie
+ *
+ * A boat lying to its anchor sits downwind of it, further out as the wind
+ * straightens the rode (docs/anchoring_mode_specification.md). This model
+ * learns that relationship online during the first hours at anchor:
+ * - Lie direction = wind-to bearing + learned bias (current, windage)
+ * - Distance r = a + b * wind speed (running least-squares sums)
+ * - Spread of the along-wind residual (frozen once mature) and of the
+ *   cross-wind residual (kept learning from explained fixes)
+ *
+ * Each position fix is then split into along-wind and cross-wind residuals
+ * against the prediction. A gust that pushes the boat out along the wind
+ * vector is "explained"; a cross-wind excursion the model has never seen is
+ * flagged - the signature of a drag, not a gust.
+ *
+ * Updates are O(1) and the state is about 100 bytes.
+ * Pure C (no ESP-IDF dependencies) so it can be compiled on the host.
+ */
+
+#ifndef ANCHOR_WIND_H
+#define ANCHOR_WIND_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define WIND_LEARN_MS           (3u * 3600u * 1000u)    // Learning period after the anchor is set
+#define WIND_MAX_AGE_MS         10000   // Wind older than this is ignored
+#define WIND_SMOOTH_S           30.0f   // Boat response time constant to wind changes
+#define WIND_GUST_HOLD_S        60.0f   // Gust peak decays to the mean over this time
+#define WIND_MIN_SAMPLES        600     // Learned fixes before the model is used (10 min)
+#define WIND_MIN_SPEED_MPS      1.0f    // Below this the lie direction is undefined
+#define WIND_VAR_WINDOW         300.0f  // Lie-direction bias EMA length (fixes)
+#define WIND_SIGMA_K            4.0f    // Residual limit in standard deviations
+#define WIND_LEARN_SIGMA        2.0f    // Inlier gate for learning once mature
+#define WIND_FLOOR_M            3.0f    // Residual limit floor (GPS noise)
+#define WIND_CROSS_FIXES        15      // Consecutive cross-wind excursions before flagging
+#define WIND_RELEARN_PRIOR      60      // Weight (fixes) of the old spread after a relearn
+
+// Result flags from anchor_wind_observe()
+#define WIND_FLAG_EXPLAINED     (1u << 0)   // Position consistent with wind (incl. gusts)
+#define WIND_FLAG_CROSS         (1u << 1)   // Sustained unexplained cross-wind excursion
+
+typedef struct {
+    // Wind input
+    bool wind_valid;
+    uint32_t wind_ms;           // Time of latest wind sample
+    float we, wn;               // Smoothed wind-to vector (m/s, ENU)
+    float gust_mps;             // Decaying gust peak
+    // Distance regression r = a + b*w
+    uint32_t n;                 // Learned fixes
+    double sw, sww, sr, swr;    // Running sums
+    // Lie-direction bias (unit-vector EMA of bearing residual)
+    float bias_c, bias_s;
+    // Residual spread
+    float var_along, var_cross;
+    uint32_t var_n;             // Fixes in the residual spread
+    uint32_t learn_until_ms;
+    uint32_t lie_until_ms;      // Lie and cross spread learning (reopened by a relearn)
+    uint16_t cross_run;
+    // Latest prediction and residual
+    bool residual_valid;
+    float pred_e, pred_n;       // Predicted position (ENU, metres)
+    float along_m;              // Residual along the wind (+ = further downwind)
+    float cross_m;              // Residual across the wind
+    uint32_t flags;
+} anchor_wind_t;
+
+/**
+ * Initialise an empty model
+ * @param wind Model
+ * @param t_ms Time the anchor was set (start of learning)
+ */
+void anchor_wind_init(anchor_wind_t *wind, uint32_t t_ms);
+
+/**
+ * Learn the lie again after it has shifted (turn of the tide, wind shift)
+ *
+ * The lie bias restarts from the boat's bearing, and the old cross-wind
+ * spread counts for only WIND_RELEARN_PRIOR fixes. Both learn for another
+ * WIND_LEARN_MS. The distance fit and the along-wind limit are kept, so the
+ * model stays mature and keeps explaining gusts.
+ * @param wind Model
+ * @param east_m East offset of the boat from the anchor (metres)
+ * @param north_m North offset of the boat from the anchor (metres)
+ * @param t_ms Time the boat took up its new lie (start of learning)
+ */
+void anchor_wind_relearn(anchor_wind_t *wind, float east_m, float north_m, uint32_t t_ms);
+
+/**
+ * Feed one true wind sample - O(1)
+ * @param wind Model
+ * @param speed_mps Wind speed (m/s)
+ * @param from_deg True direction the wind blows from (degrees)
+ * @param t_ms Timestamp (milliseconds)
+ */
+void anchor_wind_update(anchor_wind_t *wind, float speed_mps, float from_deg, uint32_t t_ms);
+
+/**
+ * Evaluate (and optionally learn from) one position fix - O(1)
+ * @param wind Model
+ * @param east_m East offset from anchor (metres)
+ * @param north_m North offset from anchor (metres)
+ * @param t_ms Timestamp (milliseconds)
+ * @param learn Allow learning (false while alarmed)
+ * @return WIND_FLAG_* bitmask
+ */
+uint32_t anchor_wind_observe(anchor_wind_t *wind, float east_m, float north_m,
+                             uint32_t t_ms, bool learn);
+
+/**
+ * Check whether the model has learned enough to be used
+ * @param wind Model
+ * @return true after WIND_MIN_SAMPLES learned fixes
+ */
+bool anchor_wind_is_mature(const anchor_wind_t *wind);
+
+#endif // ANCHOR_WIND_H
@@ -51,6 +51,10 @@
 // Bounce buffer to prevent display drift
 #define LCD_BOUNCE_BUFFER_SIZE  (LCD_WIDTH * 10)
 
+// Frame buffer sync: dirty areas at least this wide are copied to the other
+// buffer as whole rows by GDMA, narrower ones row by row on the CPU
+#define LCD_SYNC_DMA_MIN_WIDTH  (LCD_WIDTH / 2)
+
 // ============================================================================
 // RGB LCD Pins (16-bit parallel interface)
 // ============================================================================
@@ -125,7 +129,9 @@
 // ============================================================================
 // CH422G I/O Expander Configuration (ESP IO Expander Library)
 // ============================================================================
+#ifdef ESP_PLATFORM    // Host builds of the pure-C anchor modules have no ESP-IDF
 #include "esp_io_expander.h"
+#endif
 
 // Pin bit masks for esp_io_expander library
 #define TP_RST              IO_EXPANDER_PIN_NUM_1   // Touch reset
@@ -211,6 +217,19 @@
 #define ARMING_TIME_MAX_SEC         300     // Maximum arming time
 #define ARMING_TIME_DEFAULT_SEC     60      // Default arming time
 
+#define DRAG_HORIZON_MIN_SEC        60      // Minimum time-to-boundary warning horizon
+#define DRAG_HORIZON_MAX_SEC        900     // Maximum time-to-boundary warning horizon
+#define DRAG_HORIZON_DEFAULT_SEC    240     // Alarm when boundary predicted within 4 min
+
+#define RODE_LENGTH_MIN_M           10      // Minimum rode length for the scope radius
+#define RODE_LENGTH_MAX_M           300     // Maximum rode length for the scope radius
+#define RODE_LENGTH_DEFAULT_M       0       // Unknown - alarm radius is not tide-adjusted
+#define BOW_HEIGHT_DEFAULT_M        1.0f    // Bow roller height above the waterline
+
+#define CALIBRATION_MIN_MINUTES     5       // Minimum GPS noise calibration ("calibrate at dock")
+#define CALIBRATION_MAX_MINUTES     60      // Maximum GPS noise calibration
+#define CALIBRATION_DEFAULT_MINUTES 30      // Default GPS noise calibration
+
 #define GPS_TIMEOUT_SEC             60      // GPS signal timeout
 
 // Button debounce
@@ -231,6 +250,13 @@
 #define ENABLE_SD_CARD              0       // Disable SD card (not used yet)
 #define ENABLE_WIFI                 0       // Disable WiFi (not used yet)
 #define ENABLE_BLUETOOTH            0       // Disable Bluetooth (not used yet)
+#define ENABLE_ESP_DSP              1       // esp-dsp S3-optimised FFT (swing analysis)
+#define ENABLE_DSP_BENCHMARK        0       // Benchmark esp-dsp vs plain C FFT at boot
+#define ENABLE_ROTATE_TILED         0       // Tiled frame rotation kernel (per-pixel loop otherwise)
+#define ENABLE_ROTATE_BENCHMARK     0       // Benchmark tiled vs per-pixel frame rotation at boot
+#define ENABLE_BLEND_HOOKS          1       // LVGL fill/copy/glyph blends via lvgl_blend (esp-dsp memset/memcpy)
+#define ENABLE_BLEND_BENCHMARK      0       // Benchmark blend kernels and START/INFO redraws at boot
+#define ENABLE_RENDER_BENCHMARK     0       // Run the render mode benchmark screen at boot (~45 s)
 
 // ============================================================================
 // NVS (Non-Volatile Storage) Configuration
@@ -240,6 +266,12 @@
 // NVS Keys
 #define NVS_KEY_ALARM_DISTANCE  "alarm_dist"
 #define NVS_KEY_ARMING_TIME     "arming_time"
+#define NVS_KEY_DRAG_HORIZON    "drag_horizon"
+#define NVS_KEY_RODE_LENGTH     "rode_len"
+#define NVS_KEY_NOISE_N2K       "noise_n2k"     // GPS noise profile per source (blob)
+#define NVS_KEY_NOISE_0183      "noise_0183"
+#define NVS_KEY_NOISE_EXT       "noise_ext"
+#define NVS_KEY_GEOFENCES       "geofences"     // User geofence zones (blob)
 #define NVS_KEY_GPS_SOURCE      "gps_source"
 #define NVS_KEY_BRIGHTNESS      "brightness"
 #define NVS_KEY_BUZZER_VOL      "buzzer_vol"
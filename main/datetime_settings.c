@@ -4,15 +4,22 @@
  * Author: Colin Bitterfield
  * Email: colin@bitterfield.com
  * Date Created: 2025-12-25
- * Version: 0.1.0
+ * Date Updated: 2026-10-18
+ * Version: 0.2.0
+ *
+ * Changelog:
+ * - 0.2.0 (2026-10-18): Built by the screen manager; destroy hook stops the clock timer
  */
 
 #include "datetime_settings.h"
+#include "screens.h"
 #include "ui_header.h"
 #include "board_config.h"
 #include "rtc_pcf85063a.h"
 #include "fonts/custom_fonts.h"
 #include "esp_log.h"
+#include <time.h>
+#include <sys/time.h>
 
 static const char *TAG = "datetime_settings";
 
@@ -25,6 +32,7 @@ static lv_obj_t *minute_roller;
 static lv_obj_t *second_roller;
 static lv_obj_t *timezone_roller;
 static lv_obj_t *current_time_label;
+static lv_timer_t *current_time_timer;
 
 // Timezone offset in hours (-12 to +14)
 static int8_t timezone_offset = 0;
@@ -110,10 +118,18 @@ static void gps_sync_changed(lv_event_t *e) {
 static void msgbox_auto_close_timer(lv_timer_t *timer) {
     lv_obj_t *mbox = (lv_obj_t *)timer->user_data;
     if (mbox != NULL) {
-        lv_obj_del(mbox);
+        lv_obj_del(mbox);   // Deletes this timer through msgbox_delete_cb
     }
 }
 
+/**
+ * Stop the auto-close timer when the msgbox goes (X button, timer or screen deleted)
+ */
+static void msgbox_delete_cb(lv_event_t *e) {
+    lv_timer_t *timer = (lv_timer_t *)lv_event_get_user_data(e);
+    lv_timer_del(timer);
+}
+
 /**
  * Save button callback - apply changes to RTC (stores UTC time)
  */
@@ -181,6 +197,22 @@ static void save_clicked(lv_event_t *e) {
     // Set RTC time (always stores UTC)
     PCF85063A_Set_Time(utc_time);
 
+    // System time follows, so the header clock picks it up without reading the RTC
+    struct tm utc_tm = {
+        .tm_year = utc_year - 1900,
+        .tm_mon = utc_month - 1,
+        .tm_mday = utc_day,
+        .tm_hour = utc_hour,
+        .tm_min = local_minute,
+        .tm_sec = local_second,
+        .tm_isdst = -1
+    };
+    struct timeval tv = {
+        .tv_sec = mktime(&utc_tm),
+        .tv_usec = 0
+    };
+    settimeofday(&tv, NULL);
+
     // Save timezone offset to NVS
     // TODO: Add NVS storage for timezone
 
@@ -192,7 +224,8 @@ static void save_clicked(lv_event_t *e) {
     lv_obj_center(mbox);
 
     // Auto-close msgbox after 5 seconds (keep X button for manual close)
-    lv_timer_create(msgbox_auto_close_timer, 5000, mbox);
+    lv_timer_t *close_timer = lv_timer_create(msgbox_auto_close_timer, 5000, mbox);
+    lv_obj_add_event_cb(mbox, msgbox_delete_cb, LV_EVENT_DELETE, close_timer);
 }
 
 /**
@@ -200,26 +233,41 @@ static void save_clicked(lv_event_t *e) {
  */
 static void cancel_clicked(lv_event_t *e) {
     ESP_LOGI(TAG, "Back button clicked");
-    // Get tools screen from user data
-    lv_obj_t *tools_screen = (lv_obj_t *)lv_event_get_user_data(e);
-    if (tools_screen != NULL) {
-        lv_scr_load(tools_screen);
+    // Volatile screen: the manager deletes it once TOOLS is loaded
+    ui_screen_load(SCREEN_TOOLS);
+}
+
+/**
+ * Stop the clock timer and forget the widgets before the screen is deleted
+ */
+void datetime_settings_destroy(lv_obj_t *screen, void *ctx) {
+    if (current_time_timer != NULL) {
+        lv_timer_del(current_time_timer);
+        current_time_timer = NULL;
     }
+    year_roller = NULL;
+    month_roller = NULL;
+    day_roller = NULL;
+    hour_roller = NULL;
+    minute_roller = NULL;
+    second_roller = NULL;
+    timezone_roller = NULL;
+    current_time_label = NULL;
+    gps_sync_checkbox = NULL;
 }
 
 /**
  * Create date/time settings screen
  */
-lv_obj_t* create_datetime_settings_screen(lv_obj_t *tools_screen_ref, ui_footer_page_cb_t page_callback, lv_obj_t **footer_out) {
+lv_obj_t* create_datetime_settings_screen(void *ctx) {
     ESP_LOGI(TAG, "Creating date/time settings screen");
 
     // Create screen
     lv_obj_t *screen = lv_obj_create(NULL);
     lv_obj_set_style_bg_color(screen, lv_color_hex(0x1A1A2E), 0);
 
-    // Create header
-    lv_obj_t *header = ui_header_create(screen);
-    ui_header_set_gps_status(header, false);
+    // Shared header bar (top layer)
+    ui_header_attach(screen);
 
     // Title
     lv_obj_t *title = lv_label_create(screen);
@@ -235,8 +283,11 @@ lv_obj_t* create_datetime_settings_screen(lv_obj_t *tools_screen_ref, ui_footer_
     lv_obj_set_style_text_font(current_time_label, &lv_font_montserrat_14, 0);
     lv_obj_align(current_time_label, LV_ALIGN_TOP_MID, 0, 115);
 
-    // Create timer to update current time every second
-    lv_timer_create(update_current_time_display, 1000, NULL);
+    // Create timer to update current time every second (deleted by datetime_settings_destroy)
+    if (current_time_timer != NULL) {
+        lv_timer_del(current_time_timer);
+    }
+    current_time_timer = lv_timer_create(update_current_time_display, 1000, NULL);
     update_current_time_display(NULL);  // Initial update
 
     // Date section label
@@ -353,21 +404,14 @@ lv_obj_t* create_datetime_settings_screen(lv_obj_t *tools_screen_ref, ui_footer_
     lv_obj_set_size(cancel_btn, 150, 50);
     lv_obj_align(cancel_btn, LV_ALIGN_BOTTOM_RIGHT, -100, -20);
     lv_obj_set_style_bg_color(cancel_btn, lv_color_hex(0xCC3333), 0);
-    lv_obj_add_event_cb(cancel_btn, cancel_clicked, LV_EVENT_CLICKED, tools_screen_ref);
+    lv_obj_add_event_cb(cancel_btn, cancel_clicked, LV_EVENT_CLICKED, NULL);
 
     lv_obj_t *cancel_label = lv_label_create(cancel_btn);
     lv_label_set_text(cancel_label, "BACK");
     lv_obj_set_style_text_color(cancel_label, lv_color_white(), 0);
     lv_obj_center(cancel_label);
 
-    // Create footer (hidden by default for more space)
-    lv_obj_t *footer = ui_footer_create(screen, PAGE_TOOLS, page_callback);
-    if (footer != NULL) {
-        ui_footer_hide(footer);  // Hide footer for more screen space
-    }
-    if (footer_out != NULL) {
-        *footer_out = footer;
-    }
+    // No footer: the shared footer stays hidden on this screen for more space
 
     // Initialize rollers to current RTC time
     datetime_t current;
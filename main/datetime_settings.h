@@ -4,28 +4,36 @@
  * Author: Colin Bitterfield
  * Email: colin@bitterfield.com
  * Date Created: 2025-12-25
- * Version: 0.1.0
+ * Date Updated: 2026-10-18
+ * Version: 0.2.0
  *
  * Screen for setting date, time, and timezone:
  * - Manual date/time entry (year, month, day, hour, minute, second)
  * - GPS time sync button
  * - Timezone selector (GMT offset -12 to +14)
  * - Save/Cancel buttons
+ *
+ * Changelog:
+ * - 0.2.0 (2026-10-18): Screen manager factory and destroy hook
  */
 
 #ifndef DATETIME_SETTINGS_H
 #define DATETIME_SETTINGS_H
 
 #include "lvgl.h"
-#include "ui_footer.h"
 
 /**
- * Create date/time settings screen
- * @param tools_screen_ref Reference to tools screen for back button
- * @param page_callback Callback for page navigation
- * @param footer_out Pointer to store footer object
+ * Create date/time settings screen (screen manager factory, BACK loads TOOLS)
+ * @param ctx Unused
  * @return Screen object
  */
-lv_obj_t* create_datetime_settings_screen(lv_obj_t *tools_screen_ref, ui_footer_page_cb_t page_callback, lv_obj_t **footer_out);
+lv_obj_t* create_datetime_settings_screen(void *ctx);
+
+/**
+ * Stop the clock timer before the screen is deleted (screen manager destroy hook)
+ * @param screen Screen returned from create_datetime_settings_screen()
+ * @param ctx Unused
+ */
+void datetime_settings_destroy(lv_obj_t *screen, void *ctx);
 
 #endif // DATETIME_SETTINGS_H
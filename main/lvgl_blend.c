@@ -0,0 +1,197 @@
+/**
+ * RGB565 Blend Kernels Implementation
+ *
+ * Author: Colin Bitterfield
+ * Email: colin@bitterfield.com
+ * Date Created: 2026-10-18
+ * Date Updated: 2026-10-18
+ * Version: 0.1.1
+ *
+ * Changelog:
+ * - 0.1.1 (2026-10-18): LVGL_BLEND_DSP_MIN_PX (was LVGL_BLEND_DSP_MIN_PX)
+ */
+
+#include "lvgl_blend.h"
+#include <stddef.h>
+#include <string.h>
+
+#if defined(ESP_PLATFORM)
+#include "board_config.h"
+#include "esp_attr.h"
+#else
+#define IRAM_ATTR
+#endif
+
+#if defined(ESP_PLATFORM) && ENABLE_ESP_DSP
+#include "dsps_mem.h"
+#define BLEND_MEMCPY    dsps_memcpy     // esp-dsp picks its S3 build (dsps_memcpy_aes3)
+#define BLEND_MEMSET    dsps_memset
+#else
+#define BLEND_MEMCPY    memcpy
+#define BLEND_MEMSET    memset
+#endif
+
+/**
+ * One row of a solid fill (lv_color_fill(): 32-bit stores once aligned)
+ */
+static inline void fill_row(uint16_t *buf, int px, uint16_t color) {
+    if (((uintptr_t)buf & 0x3) && px > 0) {
+        *buf++ = color;
+        px--;
+    }
+    uint32_t c32 = (uint32_t)color | ((uint32_t)color << 16);
+    uint32_t *buf32 = (uint32_t *)buf;
+    while (px > 16) {
+        buf32[0] = c32;
+        buf32[1] = c32;
+        buf32[2] = c32;
+        buf32[3] = c32;
+        buf32[4] = c32;
+        buf32[5] = c32;
+        buf32[6] = c32;
+        buf32[7] = c32;
+        buf32 += 8;
+        px -= 16;
+    }
+    buf = (uint16_t *)buf32;
+    while (px > 0) {
+        *buf++ = color;
+        px--;
+    }
+}
+
+/**
+ * Fill a rectangle with one color
+ */
+IRAM_ATTR void lvgl_blend_fill(uint16_t *dest, int dest_stride, int w, int h, uint16_t color) {
+    if (w < LVGL_BLEND_DSP_MIN_PX) {
+        lvgl_blend_fill_c(dest, dest_stride, w, h, color);
+        return;
+    }
+
+    size_t bytes = (size_t)w * sizeof(uint16_t);
+    if ((color >> 8) == (color & 0xFF)) {
+        // Black, white and greys like 0x2121: a byte fill
+        for (int y = 0; y < h; y++) {
+            BLEND_MEMSET(dest, color & 0xFF, bytes);
+            dest += dest_stride;
+        }
+        return;
+    }
+
+    // One row in C, then copy it down (the source row stays in the cache)
+    const uint16_t *first = dest;
+    fill_row(dest, w, color);
+    for (int y = 1; y < h; y++) {
+        dest += dest_stride;
+        BLEND_MEMCPY(dest, first, bytes);
+    }
+}
+
+/**
+ * Copy an opaque rectangle
+ */
+IRAM_ATTR void lvgl_blend_copy(uint16_t *dest, int dest_stride, const uint16_t *src, int src_stride,
+                               int w, int h) {
+    size_t bytes = (size_t)w * sizeof(uint16_t);
+    if (dest_stride == w && src_stride == w) {
+        BLEND_MEMCPY(dest, src, bytes * h);
+        return;
+    }
+    if (w < LVGL_BLEND_DSP_MIN_PX) {
+        lvgl_blend_copy_c(dest, dest_stride, src, src_stride, w, h);
+        return;
+    }
+    for (int y = 0; y < h; y++) {
+        BLEND_MEMCPY(dest, src, bytes);
+        dest += dest_stride;
+        src += src_stride;
+    }
+}
+
+/**
+ * Fill through an A8 mask: skip transparent words, store opaque ones, reuse the last mix
+ */
+IRAM_ATTR void lvgl_blend_fill_a8(uint16_t *dest, int dest_stride, const uint8_t *mask, int mask_stride,
+                                  int w, int h, uint16_t color) {
+    uint16_t last_dest = 0;
+    uint8_t last_mask = 0;
+    uint16_t last_res = 0;
+
+    for (int y = 0; y < h; y++) {
+        int x = 0;
+        while (x < w) {
+            if (x + 4 <= w) {
+                uint32_t m32;
+                memcpy(&m32, &mask[x], sizeof(m32));
+                if (m32 == 0) {
+                    x += 4;
+                    continue;
+                }
+                if (m32 == 0xFFFFFFFFu) {
+                    dest[x] = color;
+                    dest[x + 1] = color;
+                    dest[x + 2] = color;
+                    dest[x + 3] = color;
+                    x += 4;
+                    continue;
+                }
+            }
+
+            uint8_t m = mask[x];
+            if (m == 255) {
+                dest[x] = color;
+            } else if (m != 0) {
+                if (m != last_mask || dest[x] != last_dest) {
+                    last_mask = m;
+                    last_dest = dest[x];
+                    last_res = lvgl_blend_mix(color, last_dest, m);
+                }
+                dest[x] = last_res;
+            }
+            x++;
+        }
+        dest += dest_stride;
+        mask += mask_stride;
+    }
+}
+
+/**
+ * LVGL's solid fill: lv_color_fill() per row
+ */
+void lvgl_blend_fill_c(uint16_t *dest, int dest_stride, int w, int h, uint16_t color) {
+    for (int y = 0; y < h; y++) {
+        fill_row(dest, w, color);
+        dest += dest_stride;
+    }
+}
+
+/**
+ * LVGL's opaque copy: memcpy per row
+ */
+void lvgl_blend_copy_c(uint16_t *dest, int dest_stride, const uint16_t *src, int src_stride,
+                       int w, int h) {
+    for (int y = 0; y < h; y++) {
+        memcpy(dest, src, (size_t)w * sizeof(uint16_t));
+        dest += dest_stride;
+        src += src_stride;
+    }
+}
+
+/**
+ * LVGL's masked fill at full opacity (FILL_NORMAL_MASK_PX)
+ */
+void lvgl_blend_fill_a8_c(uint16_t *dest, int dest_stride, const uint8_t *mask, int mask_stride,
+                          int w, int h, uint16_t color) {
+    for (int y = 0; y < h; y++) {
+        for (int x = 0; x < w; x++) {
+            if (mask[x] == 255) {
+                dest[x] = color;
+            } else {
+                dest[x] = lvgl_blend_mix(color, dest[x], mask[x]);
+            }
+        }
+        dest += dest_stride;
+        mask += mask_stride;
+    }
+}
@@ -0,0 +1,101 @@
+/**
+ * RGB565 Blend Kernels
+ *
+ * Author: Colin Bitterfield
+ * Email: colin@bitterfield.com
+ * Date Created: 2026-10-18
+ * Date Updated: 2026-10-18
+ * Version: 0.1.1
+ *
+ * Changelog:
+ * - 0.1.1 (2026-10-18): Described as esp-dsp wrappers; LVGL_BLEND_DSP_MIN_PX
+ *
+ * The three primitives most of a frame is drawn with, for LVGL's software
+ * renderer (hooked in by lvgl_draw_hooks.c):
+ * - Solid fill: backgrounds, panels, buttons
+ * - Opaque copy: images and snapshot blits
+ * - Color fill through an A8 mask: glyphs (LVGL expands the 4 bpp font
+ *   bitmaps to one opacity byte per pixel) and anti-aliased edges
+ *
+ * On the target, fills and copies call esp-dsp's dsps_memset and
+ * dsps_memcpy. The vector code is esp-dsp's own (its S3 builds of the two);
+ * this file has no PIE instructions. A fill whose two color bytes differ is
+ * done as one C row, then copied down the other rows. The host (and
+ * targets built without esp-dsp) use libc.
+ *
+ * The masked fill stays scalar C. It must round exactly like
+ * lv_color_mix() (LV_COLOR_MIX_ROUND_OFS 128: a divide by 255 per
+ * channel), which esp-dsp has no routine for. It skips transparent
+ * mask words, stores opaque runs directly and reuses the last mix result.
+ *
+ * Each kernel has a _c twin with the plain loop LVGL 8.4 runs: an
+ * lv_color_fill() row, a memcpy row, or an lv_color_mix() per pixel. Both
+ * give identical pixels, so benchmarks compare like with like.
+ * Pure C (host-compilable).
+ */
+
+#ifndef LVGL_BLEND_H
+#define LVGL_BLEND_H
+
+#include <stdint.h>
+
+#define LVGL_BLEND_DSP_MIN_PX   16      // Shorter rows stay on the C loop (call overhead)
+
+/**
+ * Mix two RGB565 colors exactly like lv_color_mix() (LV_COLOR_MIX_ROUND_OFS 128)
+ * @param fg Foreground color
+ * @param bg Background color
+ * @param mix Foreground weight (0-255)
+ * @return Mixed color
+ */
+static inline uint16_t lvgl_blend_mix(uint16_t fg, uint16_t bg, uint8_t mix) {
+    uint32_t inv = 255u - mix;
+    uint32_t r = ((((fg >> 11) & 0x1F) * mix + ((bg >> 11) & 0x1F) * inv + 128u) * 0x8081u) >> 23;
+    uint32_t g = ((((fg >> 5) & 0x3F) * mix + ((bg >> 5) & 0x3F) * inv + 128u) * 0x8081u) >> 23;
+    uint32_t b = (((fg & 0x1F) * mix + (bg & 0x1F) * inv + 128u) * 0x8081u) >> 23;
+    return (uint16_t)((r << 11) | (g << 5) | b);
+}
+
+/**
+ * Fill a rectangle with one color
+ * @param dest First pixel of the rectangle
+ * @param dest_stride Destination row length in pixels
+ * @param w Width in pixels
+ * @param h Height in rows
+ * @param color RGB565 color
+ */
+void lvgl_blend_fill(uint16_t *dest, int dest_stride, int w, int h, uint16_t color);
+
+/**
+ * Copy an opaque RGB565 rectangle
+ * @param dest First destination pixel
+ * @param dest_stride Destination row length in pixels
+ * @param src First source pixel
+ * @param src_stride Source row length in pixels
+ * @param w Width in pixels
+ * @param h Height in rows
+ */
+void lvgl_blend_copy(uint16_t *dest, int dest_stride, const uint16_t *src, int src_stride,
+                     int w, int h);
+
+/**
+ * Fill a rectangle with one color through an A8 opacity mask
+ * @param dest First pixel of the rectangle
+ * @param dest_stride Destination row length in pixels
+ * @param mask First mask byte (0 = keep, 255 = color)
+ * @param mask_stride Mask row length in bytes
+ * @param w Width in pixels
+ * @param h Height in rows
+ * @param color RGB565 color
+ */
+void lvgl_blend_fill_a8(uint16_t *dest, int dest_stride, const uint8_t *mask, int mask_stride,
+                        int w, int h, uint16_t color);
+
+/** The plain loops (same parameters; reference for tests and benchmarks) */
+void lvgl_blend_fill_c(uint16_t *dest, int dest_stride, int w, int h, uint16_t color);
+void lvgl_blend_copy_c(uint16_t *dest, int dest_stride, const uint16_t *src, int src_stride,
+                       int w, int h);
+void lvgl_blend_fill_a8_c(uint16_t *dest, int dest_stride, const uint8_t *mask, int mask_stride,
+                          int w, int h, uint16_t color);
+
+#endif // LVGL_BLEND_H
@@ -0,0 +1,155 @@
+/**
+ * Dirty Rectangle Tracker Implementation
+ *
+ * Author: Colin Bitterfield
+ * Email: colin@bitterfield.com
+ * Date Created: 2026-10-18
+ * Version: 0.1.0
+ */
+
+#include "lvgl_dirty.h"
+#include <string.h>
+
+static uint32_t rect_size(const lvgl_dirty_rect_t *r) {
+    return (uint32_t)(r->x2 - r->x1 + 1) * (uint32_t)(r->y2 - r->y1 + 1);
+}
+
+static lvgl_dirty_rect_t rect_union(const lvgl_dirty_rect_t *a, const lvgl_dirty_rect_t *b) {
+    lvgl_dirty_rect_t u;
+    u.x1 = a->x1 < b->x1 ? a->x1 : b->x1;
+    u.y1 = a->y1 < b->y1 ? a->y1 : b->y1;
+    u.x2 = a->x2 > b->x2 ? a->x2 : b->x2;
+    u.y2 = a->y2 > b->y2 ? a->y2 : b->y2;
+    return u;
+}
+
+static void rect_remove(lvgl_dirty_t *d, int i) {
+    d->rect[i] = d->rect[--d->count];
+}
+
+/**
+ * Initialize an empty tracker
+ */
+void lvgl_dirty_init(lvgl_dirty_t *d, int width, int height, int align) {
+    memset(d, 0, sizeof(*d));
+    d->width = (int16_t)width;
+    d->height = (int16_t)height;
+    d->align = (int16_t)(align > 0 ? align : 1);
+}
+
+/**
+ * Forget all areas
+ */
+void lvgl_dirty_clear(lvgl_dirty_t *d) {
+    d->count = 0;
+}
+
+/**
+ * Add a redrawn area: clip, align, then merge until nothing more joins
+ */
+bool lvgl_dirty_add(lvgl_dirty_t *d, int x1, int y1, int x2, int y2) {
+    if (x1 < 0) x1 = 0;
+    if (y1 < 0) y1 = 0;
+    if (x2 > d->width - 1) x2 = d->width - 1;
+    if (y2 > d->height - 1) y2 = d->height - 1;
+    if (x1 > x2 || y1 > y2) return false;
+
+    lvgl_dirty_rect_t cur = {
+        .x1 = (int16_t)(x1 - x1 % d->align),
+        .y1 = (int16_t)y1,
+        .x2 = (int16_t)(x2 - x2 % d->align + d->align - 1),
+        .y2 = (int16_t)y2,
+    };
+    if (cur.x2 > d->width - 1) cur.x2 = (int16_t)(d->width - 1);
+
+    for (;;) {
+        bool joined = false;
+        for (int i = 0; i < d->count; i++) {
+            lvgl_dirty_rect_t u = rect_union(&d->rect[i], &cur);
+            if (rect_size(&u) <= rect_size(&d->rect[i]) + rect_size(&cur)) {
+                cur = u;
+                rect_remove(d, i);
+                joined = true;
+                break;
+            }
+        }
+        if (joined) continue;
+
+        if (d->count < LVGL_DIRTY_MAX) {
+            d->rect[d->count++] = cur;
+            return true;
+        }
+
+        // List full: join the area that grows least, then look for more merges
+        int best = 0;
+        uint32_t best_growth = UINT32_MAX;
+        for (int i = 0; i < d->count; i++) {
+            lvgl_dirty_rect_t u = rect_union(&d->rect[i], &cur);
+            uint32_t growth = rect_size(&u) - rect_size(&d->rect[i]);
+            if (growth < best_growth) {
+                best = i;
+                best_growth = growth;
+            }
+        }
+        cur = rect_union(&d->rect[best], &cur);
+        rect_remove(d, best);
+    }
+}
+
+/**
+ * Pixels in the tracked areas
+ */
+uint32_t lvgl_dirty_pixels(const lvgl_dirty_t *d) {
+    uint32_t px = 0;
+    for (int i = 0; i < d->count; i++) {
+        px += rect_size(&d->rect[i]);
+    }
+    return px;
+}
+
+/**
+ * Split the tracked areas into full-width row bands and narrow areas
+ */
+void lvgl_dirty_split(const lvgl_dirty_t *d, int band_min_width,
+                      lvgl_dirty_rect_t *bands, int *band_count,
+                      lvgl_dirty_rect_t *narrow, int *narrow_count) {
+    int nb = 0;
+    int nn = 0;
+
+    // Wide areas to bands, kept sorted by first row (insertion sort, <= 16 entries)
+    for (int i = 0; i < d->count; i++) {
+        const lvgl_dirty_rect_t *r = &d->rect[i];
+        if (r->x2 - r->x1 + 1 < band_min_width) continue;
+        int j = nb++;
+        while (j > 0 && bands[j - 1].y1 > r->y1) {
+            bands[j] = bands[j - 1];
+            j--;
+        }
+        bands[j] = (lvgl_dirty_rect_t){ 0, r->y1, (int16_t)(d->width - 1), r->y2 };
+    }
+
+    // Merge bands whose rows overlap or touch
+    int merged = 0;
+    for (int i = 0; i < nb; i++) {
+        if (merged > 0 && bands[i].y1 <= bands[merged - 1].y2 + 1) {
+            if (bands[i].y2 > bands[merged - 1].y2) bands[merged - 1].y2 = bands[i].y2;
+        } else {
+            bands[merged++] = bands[i];
+        }
+    }
+    nb = merged;
+
+    // Narrow areas not already inside a band
+    for (int i = 0; i < d->count; i++) {
+        const lvgl_dirty_rect_t *r = &d->rect[i];
+        if (r->x2 - r->x1 + 1 >= band_min_width) continue;
+        bool covered = false;
+        for (int b = 0; b < nb && !covered; b++) {
+            covered = r->y1 >= bands[b].y1 && r->y2 <= bands[b].y2;
+        }
+        if (!covered) narrow[nn++] = *r;
+    }
+
+    *band_count = nb;
+    *narrow_count = nn;
+}
@@ -0,0 +1,96 @@
+/**
+ * Dirty Rectangle Tracker
+ *
+ * Author: Colin Bitterfield
+ * Email: colin@bitterfield.com
+ * Date Created: 2026-10-18
+ * Version: 0.1.0
+ *
+ * Collects the areas LVGL redrew in one direct-mode frame so lvgl_init.c
+ * can copy them into the other panel frame buffer after the swap. Areas
+ * are clipped to the screen and widened to whole DMA-aligned columns. Two
+ * areas are merged when the merged area is no larger than the two apart;
+ * this covers nesting, most overlaps and same-height neighbours, so few
+ * pixels are copied twice and few are copied that were not redrawn. When
+ * the list is full, the new area joins the one that grows least.
+ *
+ * lvgl_dirty_split() turns the result into copy jobs. Wide areas become
+ * full-width row bands, each one contiguous block of the frame buffer (a
+ * single GDMA transfer). Narrow areas stay rectangles, which are cheaper
+ * to copy row by row on the CPU.
+ * Pure C (host-compilable).
+ */
+
+#ifndef LVGL_DIRTY_H
+#define LVGL_DIRTY_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define LVGL_DIRTY_MAX          16      // Tracked areas per frame
+#define LVGL_DIRTY_ALIGN_PX     32      // Column alignment (32 RGB565 px = 64 bytes, the PSRAM DMA alignment)
+
+typedef struct {
+    int16_t x1, y1, x2, y2;             // Inclusive, like lv_area_t
+} lvgl_dirty_rect_t;
+
+typedef struct {
+    lvgl_dirty_rect_t rect[LVGL_DIRTY_MAX];
+    uint8_t count;
+    int16_t width;                      // Screen size (clip bounds)
+    int16_t height;
+    int16_t align;                      // Column alignment in pixels (1 = none)
+} lvgl_dirty_t;
+
+/**
+ * Initialize an empty tracker
+ * @param d Tracker
+ * @param width Screen width
+ * @param height Screen height
+ * @param align Column alignment in pixels (1 = none; must divide width)
+ */
+void lvgl_dirty_init(lvgl_dirty_t *d, int width, int height, int align);
+
+/**
+ * Forget all areas (start of a new frame)
+ * @param d Tracker
+ */
+void lvgl_dirty_clear(lvgl_dirty_t *d);
+
+/**
+ * Add a redrawn area (inclusive coordinates)
+ * @param d Tracker
+ * @param x1 First column
+ * @param y1 First row
+ * @param x2 Last column
+ * @param y2 Last row
+ * @return false if the area lies entirely off screen
+ */
+bool lvgl_dirty_add(lvgl_dirty_t *d, int x1, int y1, int x2, int y2);
+
+/**
+ * Pixels in the tracked areas (what a copy of every area moves)
+ * @param d Tracker
+ * @return Pixel count (crossing areas count their overlap twice)
+ */
+uint32_t lvgl_dirty_pixels(const lvgl_dirty_t *d);
+
+/**
+ * Split the tracked areas into copy jobs
+ *
+ * Areas at least band_min_width wide become full-width row bands, merged
+ * where their rows touch. Narrow areas lying entirely inside a band are
+ * dropped; the rest are returned as they are.
+ *
+ * @param d Tracker
+ * @param band_min_width Narrowest area copied as a band (width or more = never)
+ * @param bands Output, LVGL_DIRTY_MAX entries, sorted by row
+ * @param band_count Number of bands written
+ * @param narrow Output, LVGL_DIRTY_MAX entries
+ * @param narrow_count Number of narrow areas written
+ */
+void lvgl_dirty_split(const lvgl_dirty_t *d, int band_min_width,
+                      lvgl_dirty_rect_t *bands, int *band_count,
+                      lvgl_dirty_rect_t *narrow, int *narrow_count);
+
+#endif // LVGL_DIRTY_H
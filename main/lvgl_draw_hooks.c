@@ -0,0 +1,90 @@
+/**
+ * LVGL Software Renderer Blend Hooks Implementation
+ *
+ * Author: Colin Bitterfield
+ * Email: colin@bitterfield.com
+ * Date Created: 2026-10-18
+ * Version: 0.1.0
+ */
+
+#include "lvgl_draw_hooks.h"
+#include "lvgl_blend.h"
+
+// The kernels work on native RGB565 (LV_COLOR_DEPTH 16, no byte swap)
+#define DRAW_HOOKS_SUPPORTED    (LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0)
+
+static bool s_enabled = DRAW_HOOKS_SUPPORTED;
+
+/**
+ * Blend step of the software draw context (same clipping and offsets as lv_draw_sw_blend_basic)
+ */
+static void draw_hooks_blend(lv_draw_ctx_t *draw_ctx, const lv_draw_sw_blend_dsc_t *dsc) {
+    lv_disp_t *disp = _lv_refr_get_disp_refreshing();
+    if (!s_enabled || dsc->blend_mode != LV_BLEND_MODE_NORMAL || dsc->opa < LV_OPA_MAX ||
+        disp->driver->set_px_cb != NULL || disp->driver->screen_transp ||
+        (dsc->mask_buf != NULL && disp->driver->antialiasing == 0)) {
+        lv_draw_sw_blend_basic(draw_ctx, dsc);
+        return;
+    }
+
+    const lv_opa_t *mask = dsc->mask_buf;
+    if (mask != NULL && dsc->mask_res == LV_DRAW_MASK_RES_TRANSP) return;
+    if (dsc->mask_res == LV_DRAW_MASK_RES_FULL_COVER) mask = NULL;
+
+    lv_area_t blend_area;
+    if (!_lv_area_intersect(&blend_area, dsc->blend_area, draw_ctx->clip_area)) return;
+
+    int dest_stride = lv_area_get_width(draw_ctx->buf_area);
+    uint16_t *dest = (uint16_t *)draw_ctx->buf + dest_stride * (blend_area.y1 - draw_ctx->buf_area->y1) +
+                     (blend_area.x1 - draw_ctx->buf_area->x1);
+    int w = lv_area_get_width(&blend_area);
+    int h = lv_area_get_height(&blend_area);
+
+    if (dsc->src_buf != NULL) {
+        if (mask != NULL) {
+            lv_draw_sw_blend_basic(draw_ctx, dsc);      // Masked image: LVGL's loop
+            return;
+        }
+        int src_stride = lv_area_get_width(dsc->blend_area);
+        const uint16_t *src = (const uint16_t *)dsc->src_buf + src_stride * (blend_area.y1 - dsc->blend_area->y1) +
+                              (blend_area.x1 - dsc->blend_area->x1);
+        lvgl_blend_copy(dest, dest_stride, src, src_stride, w, h);
+    } else if (mask == NULL) {
+        lvgl_blend_fill(dest, dest_stride, w, h, dsc->color.full);
+    } else {
+        int mask_stride = lv_area_get_width(dsc->mask_area);
+        mask += mask_stride * (blend_area.y1 - dsc->mask_area->y1) + (blend_area.x1 - dsc->mask_area->x1);
+        lvgl_blend_fill_a8(dest, dest_stride, mask, mask_stride, w, h, dsc->color.full);
+    }
+}
+
+/**
+ * LVGL's software draw context with the blend step replaced
+ */
+static void draw_hooks_ctx_init(lv_disp_drv_t *drv, lv_draw_ctx_t *draw_ctx) {
+    lv_draw_sw_init_ctx(drv, draw_ctx);
+    ((lv_draw_sw_ctx_t *)draw_ctx)->blend = draw_hooks_blend;
+}
+
+/**
+ * Install the hooked draw context on a display driver
+ */
+void lvgl_draw_hooks_init(lv_disp_drv_t *drv) {
+    drv->draw_ctx_init = draw_hooks_ctx_init;
+    drv->draw_ctx_deinit = lv_draw_sw_deinit_ctx;
+    drv->draw_ctx_size = sizeof(lv_draw_sw_ctx_t);
+}
+
+/**
+ * Turn the hooks on or off
+ */
+void lvgl_draw_hooks_enable(bool enable) {
+    s_enabled = enable && DRAW_HOOKS_SUPPORTED;
+}
+
+/**
+ * Whether the hooks are in use
+ */
+bool lvgl_draw_hooks_enabled(void) {
+    return s_enabled;
+}
@@ -0,0 +1,42 @@
+/**
+ * LVGL Software Renderer Blend Hooks
+ *
+ * Author: Colin Bitterfield
+ * Email: colin@bitterfield.com
+ * Date Created: 2026-10-18
+ * Version: 0.1.0
+ *
+ * Replaces the blend step of LVGL 8.4's software draw context with the
+ * lvgl_blend.c kernels for the cases that cover most pixels: normal blend
+ * mode at full opacity, drawn as a solid fill, an opaque image copy, or a
+ * fill through an A8 mask (glyphs, anti-aliased edges). Everything else,
+ * and every call while the hooks are disabled, goes to
+ * lv_draw_sw_blend_basic(), so the rendered pixels do not change.
+ */
+
+#ifndef LVGL_DRAW_HOOKS_H
+#define LVGL_DRAW_HOOKS_H
+
+#include <stdbool.h>
+#include "lvgl.h"
+
+/**
+ * Install the hooked draw context on a display driver
+ * Call before lv_disp_drv_register().
+ * @param drv Display driver
+ */
+void lvgl_draw_hooks_init(lv_disp_drv_t *drv);
+
+/**
+ * Turn the hooks on or off at run time (before/after benchmarks)
+ * @param enable false routes every blend to LVGL's own code
+ */
+void lvgl_draw_hooks_enable(bool enable);
+
+/**
+ * Whether the hooks are in use
+ * @return true if blends go to the lvgl_blend.c kernels
+ */
+bool lvgl_draw_hooks_enabled(void);
+
+#endif // LVGL_DRAW_HOOKS_H
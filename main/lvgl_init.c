@@ -1,16 +1,29 @@
 /**
  * LVGL Initialization Implementation
- * Waveshare Mode 3: Direct-Mode with hardware-managed synchronization
+ * Direct (Waveshare Mode 3), partial (SRAM bands + GDMA) and full refresh render modes
  * LVGL 8.x API
  *
  * Author: Colin Bitterfield
  * Email: colin@bitterfield.com
  * Date Created: 2025-12-20
- * Date Updated: 2025-12-24
- * Version: 0.3.0
+ * Date Updated: 2026-10-18
+ * Version: 0.8.1
+ *
+ * Changelog:
+ * - 0.8.1 (2026-10-18): Compile-time check that lv_disp_t.sync_areas is the list lv_refr.c copies
+ * - 0.8.0 (2026-10-18): Rotated panel (EXAMPLE_LVGL_PORT_ROTATION_DEGREE) in partial mode, bands copied by lvgl_rotate
+ * - 0.7.0 (2026-10-18): Render mode from Kconfig (direct, partial SRAM bands, full), switchable at run time
+ * - 0.6.0 (2026-10-18): Blend hooks (lvgl_draw_hooks) for fills, image copies and A8 glyph blends
+ * - 0.5.0 (2026-10-18): Copy each frame's dirty areas into the other frame buffer (GDMA for wide areas)
+ * - 0.4.0 (2026-10-18): Frame timing (render, flush area, VSYNC wait, handler) via lvgl_perf
  */
 
 #include "lvgl_init.h"
+#include "lvgl_perf.h"
+#include "lvgl_dirty.h"
+#include "lvgl_draw_hooks.h"
+#include "lvgl_rotate.h"
+#include "lvgl_port.h"          // EXAMPLE_LVGL_PORT_ROTATION_DEGREE
 #include "display_driver.h"
 #include "touch_driver.h"
 #include "board_config.h"
@@ -19,12 +32,45 @@
 #include "esp_lcd_panel_ops.h"
 #include "esp_lcd_panel_rgb.h"
 #include "esp_lcd_touch.h"
+#include "esp_async_memcpy.h"
+#include "esp_cache.h"
+#include "esp_heap_caps.h"
+#include "sdkconfig.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 #include "freertos/semphr.h"
+#include <string.h>
+
+#ifndef CONFIG_ANCHOR_RENDER_PARTIAL_LINES
+#define CONFIG_ANCHOR_RENDER_PARTIAL_LINES 24
+#endif
+
+// LVGL's logical frame: portrait on a panel rotated by 90 or 270 degrees
+#define LVGL_ROTATION           EXAMPLE_LVGL_PORT_ROTATION_DEGREE
+#if LVGL_ROTATION == 90 || LVGL_ROTATION == 270
+#define LVGL_HOR_RES            LCD_HEIGHT
+#define LVGL_VER_RES            LCD_WIDTH
+#else
+#define LVGL_HOR_RES            LCD_WIDTH
+#define LVGL_VER_RES            LCD_HEIGHT
+#endif
+
+// Direct and full refresh draw straight into the panel's frame buffers, so a
+// rotated panel always uses partial mode (each band is rotated as it is copied)
+#if LVGL_ROTATION != 0 || defined(CONFIG_ANCHOR_RENDER_PARTIAL)
+#define LVGL_RENDER_BOOT_MODE   LVGL_RENDER_PARTIAL
+#elif defined(CONFIG_ANCHOR_RENDER_FULL)
+#define LVGL_RENDER_BOOT_MODE   LVGL_RENDER_FULL
+#else
+#define LVGL_RENDER_BOOT_MODE   LVGL_RENDER_DIRECT
+#endif
+
+#define LVGL_PARTIAL_PX         (LVGL_HOR_RES * CONFIG_ANCHOR_RENDER_PARTIAL_LINES)
 
 static const char *TAG = "lvgl_init";
 
+static const char *render_mode_names[LVGL_RENDER_MODE_COUNT] = {"DIRECT", "PARTIAL", "FULL"};
+
 // LVGL display driver
 static lv_disp_drv_t disp_drv;
 static lv_disp_draw_buf_t disp_buf;
@@ -39,6 +85,29 @@ static TaskHandle_t lvgl_task_handle = NULL;
 // LVGL tick timer
 static esp_timer_handle_t lvgl_tick_timer = NULL;
 
+// Render mode and its buffers
+static lvgl_render_mode_t render_mode = LVGL_RENDER_DIRECT;
+static void *panel_fb[2] = {NULL, NULL};            // RGB panel frame buffers (PSRAM)
+static void *front_fb = NULL;                       // Frame buffer on screen
+static lv_color_t *partial_buf[2] = {NULL, NULL};   // Partial mode row bands (internal SRAM, DMA capable)
+
+// Current frame totals for lvgl_perf (LVGL task only)
+static uint32_t frame_flush_px = 0;
+static uint32_t frame_vsync_cycles = 0;
+static uint32_t frame_dma_cycles = 0;               // Blocked on GDMA copies
+
+// Running totals for lvgl_get_render_stats() (LVGL task only)
+static lvgl_render_stats_t render_stats;
+static uint64_t render_handler_cycles = 0;
+static uint64_t render_wait_cycles = 0;
+
+// Frame buffer sync: areas redrawn this frame, copied to the back buffer after the swap
+static lvgl_dirty_t frame_dirty;
+static async_memcpy_handle_t sync_mcp = NULL;       // NULL: every copy on the CPU
+static SemaphoreHandle_t sync_done = NULL;          // Given once per finished GDMA copy
+static int sync_pending = 0;                        // GDMA copies not yet taken (LVGL task only)
+static bool sync_ran = false;                       // This refresh already synced the buffers
+
 /**
  * LVGL tick timer callback
  */
@@ -71,14 +140,154 @@ static void lvgl_touch_read_cb(lv_indev_drv_t *indev_drv, lv_indev_data_t *data)
     bool touchpad_pressed = esp_lcd_touch_get_coordinates(tp, &touchpad_x, &touchpad_y, NULL, &touchpad_cnt, 1);
 
     if (touchpad_pressed && touchpad_cnt > 0) {
+        // Panel coordinates back to LVGL's logical frame (inverse of lvgl_rotate_area)
+#if LVGL_ROTATION == 90
+        data->point.x = LCD_HEIGHT - 1 - touchpad_y;
+        data->point.y = touchpad_x;
+#elif LVGL_ROTATION == 180
+        data->point.x = LCD_WIDTH - 1 - touchpad_x;
+        data->point.y = LCD_HEIGHT - 1 - touchpad_y;
+#elif LVGL_ROTATION == 270
+        data->point.x = touchpad_y;
+        data->point.y = LCD_WIDTH - 1 - touchpad_x;
+#else
         data->point.x = touchpad_x;
         data->point.y = touchpad_y;
+#endif
         data->state = LV_INDEV_STATE_PRESSED;
     } else {
         data->state = LV_INDEV_STATE_RELEASED;
     }
 }
 
+/**
+ * GDMA copy finished (ISR context)
+ */
+static IRAM_ATTR bool lvgl_sync_done_cb(async_memcpy_handle_t mcp, async_memcpy_event_t *event, void *arg) {
+    BaseType_t need_yield = pdFALSE;
+    xSemaphoreGiveFromISR(sync_done, &need_yield);
+    return need_yield == pdTRUE;
+}
+
+/**
+ * Partial mode band copied into the frame buffer (ISR context): LVGL may reuse the band
+ */
+static IRAM_ATTR bool lvgl_band_done_cb(async_memcpy_handle_t mcp, async_memcpy_event_t *event, void *arg) {
+    lv_disp_flush_ready((lv_disp_drv_t *)arg);
+    return false;
+}
+
+/**
+ * Wait for every GDMA copy started so far
+ */
+static void lvgl_sync_wait(void) {
+    uint32_t wait_start = lvgl_perf_stamp();
+    while (sync_pending > 0) {
+        xSemaphoreTake(sync_done, portMAX_DELAY);
+        sync_pending--;
+    }
+    frame_dma_cycles += lvgl_perf_stamp() - wait_start;
+}
+
+/**
+ * Copy this frame's dirty areas from the buffer now on screen into the back buffer
+ *
+ * Wide areas become whole-row bands, each one contiguous GDMA transfer; the
+ * CPU only copies the narrow ones and returns without waiting for the DMA.
+ * GDMA reads and writes PSRAM directly, so the front rows are written back
+ * from the cache first and the back rows are written back and invalidated.
+ */
+static void lvgl_sync_start(const uint16_t *front, uint16_t *back) {
+    lvgl_dirty_rect_t bands[LVGL_DIRTY_MAX];
+    lvgl_dirty_rect_t narrow[LVGL_DIRTY_MAX];
+    int band_count;
+    int narrow_count;
+
+    lvgl_dirty_split(&frame_dirty, sync_mcp != NULL ? LCD_SYNC_DMA_MIN_WIDTH : LCD_WIDTH + 1,
+                     bands, &band_count, narrow, &narrow_count);
+
+    for (int i = 0; i < band_count; i++) {
+        size_t offset = (size_t)bands[i].y1 * LCD_WIDTH;
+        size_t bytes = (size_t)(bands[i].y2 - bands[i].y1 + 1) * LCD_WIDTH * sizeof(uint16_t);
+        esp_cache_msync((void *)(front + offset), bytes, ESP_CACHE_MSYNC_FLAG_DIR_C2M);
+        esp_cache_msync(back + offset, bytes, ESP_CACHE_MSYNC_FLAG_DIR_C2M | ESP_CACHE_MSYNC_FLAG_INVALIDATE);
+        if (esp_async_memcpy(sync_mcp, back + offset, (void *)(front + offset), bytes,
+                             lvgl_sync_done_cb, NULL) == ESP_OK) {
+            sync_pending++;
+        } else {
+            memcpy(back + offset, front + offset, bytes);
+        }
+        render_stats.psram_bytes += 2 * bytes;      // Read and write
+    }
+
+    for (int i = 0; i < narrow_count; i++) {
+        const lvgl_dirty_rect_t *r = &narrow[i];
+        size_t bytes = (size_t)(r->x2 - r->x1 + 1) * sizeof(uint16_t);
+        for (int y = r->y1; y <= r->y2; y++) {
+            size_t offset = (size_t)y * LCD_WIDTH + r->x1;
+            memcpy(back + offset, front + offset, bytes);
+        }
+        render_stats.psram_bytes += 2 * bytes * (size_t)(r->y2 - r->y1 + 1);
+    }
+
+    lvgl_dirty_clear(&frame_dirty);
+    sync_ran = true;
+}
+
+/**
+ * Wait for the back buffer copies before LVGL draws into it (render_start_cb)
+ */
+static void lvgl_render_start_cb(lv_disp_drv_t *drv) {
+    lvgl_sync_wait();
+}
+
+/**
+ * Set up the frame buffer sync (falls back to CPU copies without a GDMA channel)
+ */
+static void lvgl_sync_init(void) {
+    lvgl_dirty_init(&frame_dirty, LCD_WIDTH, LCD_HEIGHT, LVGL_DIRTY_ALIGN_PX);
+
+    sync_done = xSemaphoreCreateCounting(LVGL_DIRTY_MAX + 1, 0);    // Buffer sync bands + last partial band
+    if (sync_done == NULL) {
+        ESP_LOGW(TAG, "Frame buffer sync on CPU: no memory for semaphore");
+        return;
+    }
+
+    async_memcpy_config_t config = ASYNC_MEMCPY_DEFAULT_CONFIG();
+    config.backlog = LVGL_DIRTY_MAX;
+    config.dma_burst_size = 64;                     // Matches the panel's psram_trans_align
+    esp_err_t ret = esp_async_memcpy_install(&config, &sync_mcp);
+    if (ret != ESP_OK) {
+        sync_mcp = NULL;
+        ESP_LOGW(TAG, "Frame buffer sync on CPU: async memcpy unavailable (%s)", esp_err_to_name(ret));
+        return;
+    }
+    ESP_LOGI(TAG, "Frame buffer sync: GDMA for areas >= %d px wide", LCD_SYNC_DMA_MIN_WIDTH);
+}
+
+/**
+ * Put a finished frame buffer on screen and wait for VSYNC
+ *
+ * The panel switches to frame at the next VSYNC; waiting here keeps LVGL from
+ * drawing into the buffer still being scanned out. With sync set, the areas
+ * redrawn this frame are then copied into the other buffer.
+ */
+static void lvgl_show_frame(const lv_area_t *area, void *frame, bool sync) {
+    esp_lcd_panel_draw_bitmap(display_get_panel(), area->x1, area->y1, area->x2 + 1, area->y2 + 1, frame);
+
+    uint32_t wait_start = lvgl_perf_stamp();
+    ulTaskNotifyValueClear(NULL, ULONG_MAX);
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    frame_vsync_cycles += lvgl_perf_stamp() - wait_start;
+
+    front_fb = frame;
+    render_stats.frames++;
+    if (sync) {
+        void *back = (frame == panel_fb[0]) ? panel_fb[1] : panel_fb[0];
+        lvgl_sync_start((const uint16_t *)frame, back);
+    }
+}
+
 /**
  * LVGL flush callback - Mode 3 Direct-Mode with VSYNC synchronization (LVGL 8.x API)
  *
@@ -88,37 +297,187 @@ static void lvgl_touch_read_cb(lv_indev_drv_t *indev_drv, lv_indev_data_t *data)
  * - This prevents tearing by ensuring we don't render to a buffer being scanned out
  */
 static void lvgl_flush_cb(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t *color_map) {
-    esp_lcd_panel_handle_t panel = display_get_panel();
-
-    int offsetx1 = area->x1;
-    int offsety1 = area->y1;
-    int offsetx2 = area->x2;
-    int offsety2 = area->y2;
+    uint32_t px = (uint32_t)lv_area_get_size(area);
+    frame_flush_px += px;
+    render_stats.psram_bytes += px * sizeof(lv_color_t);
+    lvgl_dirty_add(&frame_dirty, area->x1, area->y1, area->x2, area->y2);
 
     // Check if this is the last flush area (LVGL 8.x API)
     // This matches Waveshare lvgl_port.c lines 279-285
     if (lv_disp_flush_is_last(drv)) {
-        // Switch the RGB panel to display this frame buffer
-        // In direct mode, color_map IS one of the RGB panel's frame buffers
-        esp_lcd_panel_draw_bitmap(panel, offsetx1, offsety1, offsetx2 + 1, offsety2 + 1, color_map);
+        // In direct mode, color_map IS one of the RGB panel's frame buffers:
+        // show it, then bring the other buffer up to date with this frame
+        lvgl_show_frame(area, color_map, true);
+    }
+
+    lv_disp_flush_ready(drv);
+}
+
+/**
+ * LVGL flush callback - full refresh: color_map is a whole new frame buffer
+ */
+static void lvgl_flush_full_cb(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t *color_map) {
+    uint32_t px = (uint32_t)lv_area_get_size(area);
+    frame_flush_px += px;
+    render_stats.psram_bytes += px * sizeof(lv_color_t);
+
+    if (lv_disp_flush_is_last(drv)) {
+        lvgl_show_frame(area, color_map, false);
+    }
 
-        // Wait for the frame buffer transmission to complete (VSYNC)
-        // This is the key to Mode 3: wait HERE in flush callback, not in LVGL task
-        ulTaskNotifyValueClear(NULL, ULONG_MAX);
-        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    lv_disp_flush_ready(drv);
+}
+
+/**
+ * LVGL flush callback - partial: copy one SRAM row band into the back frame buffer
+ *
+ * The band is whole rows (lvgl_rounder_cb), so it is one contiguous GDMA
+ * transfer. Bands before the last are released from the DMA interrupt while
+ * LVGL draws the next one into the other SRAM buffer; the last band is waited
+ * for, then the frame goes on screen. On a rotated panel the band lands as a
+ * strip of columns instead, and the tiled lvgl_rotate kernel copies it on
+ * the CPU.
+ */
+static void lvgl_flush_partial_cb(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t *color_map) {
+    uint16_t *back = (uint16_t *)((front_fb == panel_fb[0]) ? panel_fb[1] : panel_fb[0]);
+    uint32_t px = (uint32_t)lv_area_get_size(area);
+    size_t bytes = px * sizeof(lv_color_t);
+    bool last = lv_disp_flush_is_last(drv);
+
+    frame_flush_px += px;
+    render_stats.psram_bytes += bytes;
+
+    bool queued = false;
+#if LVGL_ROTATION != 0
+    int x1 = area->x1, y1 = area->y1, x2 = area->x2, y2 = area->y2;
+    lvgl_rotate_copy_band((const uint16_t *)color_map, back, y1, y2, LVGL_HOR_RES, LVGL_VER_RES, LVGL_ROTATION);
+    lvgl_rotate_area(&x1, &y1, &x2, &y2, LVGL_HOR_RES, LVGL_VER_RES, LVGL_ROTATION);
+    lvgl_dirty_add(&frame_dirty, x1, y1, x2, y2);
+#else
+    uint16_t *dest = back + (size_t)area->y1 * LCD_WIDTH;
+    lvgl_dirty_add(&frame_dirty, area->x1, area->y1, area->x2, area->y2);
+    if (sync_mcp != NULL) {
+        esp_cache_msync(dest, bytes, ESP_CACHE_MSYNC_FLAG_DIR_C2M | ESP_CACHE_MSYNC_FLAG_INVALIDATE);
+        queued = esp_async_memcpy(sync_mcp, dest, color_map, bytes,
+                                  last ? lvgl_sync_done_cb : lvgl_band_done_cb, drv) == ESP_OK;
+    }
+    if (!queued) {
+        memcpy(dest, color_map, bytes);
+    }
+#endif
+    if (queued && !last) {
+        return;                                     // lvgl_band_done_cb releases the band
+    }
+    if (queued) {
+        sync_pending++;
+        lvgl_sync_wait();
     }
 
+    if (last) {
+        lv_area_t frame_area = {0, 0, LCD_WIDTH - 1, LCD_HEIGHT - 1};
+        lvgl_show_frame(&frame_area, back, true);
+    }
     lv_disp_flush_ready(drv);
 }
 
 /**
- * LVGL task - Mode 3: Simple polling (matches Waveshare implementation)
+ * Partial mode: widen every invalid area to whole rows (one contiguous copy per band)
+ */
+static void lvgl_rounder_cb(lv_disp_drv_t *drv, lv_area_t *area) {
+    area->x1 = 0;
+    area->x2 = drv->hor_res - 1;
+}
+
+/**
+ * Point the driver at the buffers and callbacks of a render mode
+ *
+ * Direct and full draw into the frame buffer that is not on screen (buf1).
+ */
+static void lvgl_render_apply(lvgl_render_mode_t mode) {
+    void *back = (front_fb == panel_fb[0]) ? panel_fb[1] : panel_fb[0];
+
+    if (mode == LVGL_RENDER_PARTIAL) {
+        lv_disp_draw_buf_init(&disp_buf, partial_buf[0], partial_buf[1], LVGL_PARTIAL_PX);
+        disp_drv.flush_cb = lvgl_flush_partial_cb;
+        disp_drv.rounder_cb = lvgl_rounder_cb;
+    } else {
+        lv_disp_draw_buf_init(&disp_buf, back, front_fb, LCD_WIDTH * LCD_HEIGHT);
+        disp_drv.flush_cb = (mode == LVGL_RENDER_FULL) ? lvgl_flush_full_cb : lvgl_flush_cb;
+        disp_drv.rounder_cb = NULL;
+    }
+    disp_drv.draw_buf = &disp_buf;
+    disp_drv.direct_mode = (mode == LVGL_RENDER_DIRECT);
+    disp_drv.full_refresh = (mode == LVGL_RENDER_FULL);
+
+    lvgl_dirty_clear(&frame_dirty);
+    render_mode = mode;
+}
+
+/**
+ * Allocate the partial mode row bands (internal SRAM, DMA capable)
+ */
+static esp_err_t lvgl_partial_alloc(void) {
+    for (int i = 0; i < 2; i++) {
+        if (partial_buf[i] == NULL) {
+            partial_buf[i] = heap_caps_malloc(LVGL_PARTIAL_PX * sizeof(lv_color_t),
+                                              MALLOC_CAP_INTERNAL | MALLOC_CAP_DMA);
+        }
+    }
+    if (partial_buf[0] == NULL || partial_buf[1] == NULL) {
+        ESP_LOGE(TAG, "Failed to allocate 2 x %d byte partial render buffers",
+                 (int)(LVGL_PARTIAL_PX * sizeof(lv_color_t)));
+        heap_caps_free(partial_buf[0]);
+        heap_caps_free(partial_buf[1]);
+        partial_buf[0] = NULL;
+        partial_buf[1] = NULL;
+        return ESP_ERR_NO_MEM;
+    }
+    return ESP_OK;
+}
+
+/**
+ * Display refresh timer - wraps LVGL's refresh to time each frame
+ *
+ * Render time is the refresh run minus the VSYNC wait spent in the flush callback.
+ * Runs with nothing to redraw are not frames and are not recorded.
+ */
+static void lvgl_refr_timer_cb(lv_timer_t *timer) {
+    frame_flush_px = 0;
+    frame_vsync_cycles = 0;
+    frame_dma_cycles = 0;
+    sync_ran = false;
+
+    uint32_t start = lvgl_perf_stamp();
+    _lv_disp_refr_timer(timer);
+    uint32_t total = lvgl_perf_stamp() - start;
+
+#if LVGL_VERSION_MAJOR == 8 && LVGL_VERSION_MINOR >= 3
+    // LVGL 8.3+ would copy the same areas again on the CPU before the next frame:
+    // lv_refr.c refr_sync_areas() copies lv_disp_t.sync_areas (lv_hal_disp.h,
+    // "lv_ll_t sync_areas") in direct mode and clears the list itself
+    _Static_assert(sizeof(((lv_disp_t *)0)->sync_areas) == sizeof(lv_ll_t),
+                   "lv_disp_t.sync_areas is no longer an lv_ll_t - recheck lv_refr.c refr_sync_areas()");
+    if (sync_ran) {
+        _lv_ll_clear(&lvgl_display->sync_areas);
+    }
+#endif
+
+    render_wait_cycles += frame_vsync_cycles + frame_dma_cycles;
+    if (frame_flush_px > 0) {
+        lvgl_perf_record(LVGL_PERF_RENDER, total - frame_vsync_cycles);
+        lvgl_perf_record(LVGL_PERF_FLUSH_AREA, frame_flush_px);
+        lvgl_perf_record(LVGL_PERF_VSYNC_WAIT, frame_vsync_cycles);
+    }
+}
+
+/**
+ * LVGL task - polls lv_timer_handler() (matches Waveshare implementation)
  *
  * Note: VSYNC synchronization happens in the flush callback, NOT here.
  * This task just calls lv_timer_handler() regularly to process UI updates.
  */
 static void lvgl_task(void *arg) {
-    ESP_LOGI(TAG, "LVGL task started (Mode 3: Direct-Mode)");
+    ESP_LOGI(TAG, "LVGL task started (%s render mode)", render_mode_names[render_mode]);
 
     uint32_t task_delay_ms = 500;  // Max delay
 
@@ -127,7 +486,11 @@ static void lvgl_task(void *arg) {
         if (xSemaphoreTake(lvgl_mutex, portMAX_DELAY) == pdTRUE) {
             // Handle LVGL tasks (rendering, timers, animations)
             // This may trigger flush callback which will wait for VSYNC
+            uint32_t start = lvgl_perf_stamp();
             task_delay_ms = lv_timer_handler();
+            uint32_t handler = lvgl_perf_stamp() - start;
+            lvgl_perf_record(LVGL_PERF_HANDLER, handler);
+            render_handler_cycles += handler;
 
             // Unlock mutex
             xSemaphoreGive(lvgl_mutex);
@@ -164,7 +527,7 @@ esp_err_t lvgl_init(void) {
     lv_init();
     ESP_LOGI(TAG, "LVGL core initialized");
 
-    // Get RGB panel handle for direct-mode rendering (Waveshare Mode 3)
+    // Get RGB panel handle (its frame buffers are the targets of every render mode)
     esp_lcd_panel_handle_t panel = display_get_panel();
 
     // Get RGB panel's internal frame buffers (allocated in PSRAM by panel driver)
@@ -180,21 +543,44 @@ esp_err_t lvgl_init(void) {
     ESP_LOGI(TAG, "RGB panel frame buffers: fb1=%p, fb2=%p, size=%zu pixels each",
              fb1, fb2, buffer_size);
 
-    // Initialize LVGL draw buffer with RGB panel frame buffers (LVGL 8.x API)
-    lv_disp_draw_buf_init(&disp_buf, fb1, fb2, buffer_size);
+    panel_fb[0] = fb1;
+    panel_fb[1] = fb2;
+    front_fb = fb1;                                 // The panel starts out scanning fb1
+
+    // Dirty areas of each frame are copied into the other buffer after the swap
+    lvgl_sync_init();
 
     // Initialize display driver (LVGL 8.x API)
     lv_disp_drv_init(&disp_drv);
-    disp_drv.hor_res = LCD_WIDTH;
-    disp_drv.ver_res = LCD_HEIGHT;
-    disp_drv.flush_cb = lvgl_flush_cb;
-    disp_drv.draw_buf = &disp_buf;
+    disp_drv.hor_res = LVGL_HOR_RES;
+    disp_drv.ver_res = LVGL_VER_RES;
+    disp_drv.render_start_cb = lvgl_render_start_cb;
     disp_drv.user_data = panel;
 
-    // Enable direct mode - CRITICAL for Mode 3 (Waveshare lvgl_port.c line 424)
-    disp_drv.direct_mode = 1;
+    // Draw buffers, flush callback and direct_mode / full_refresh for the Kconfig mode
+    lvgl_render_mode_t mode = LVGL_RENDER_BOOT_MODE;
+    if (mode == LVGL_RENDER_PARTIAL && lvgl_partial_alloc() != ESP_OK) {
+#if LVGL_ROTATION != 0
+        ESP_LOGE(TAG, "Rotated panel needs partial render mode");
+        return ESP_ERR_NO_MEM;
+#else
+        ESP_LOGW(TAG, "Partial render mode unavailable, using direct mode");
+        mode = LVGL_RENDER_DIRECT;
+#endif
+    }
+    lvgl_render_apply(mode);
+
+#if ENABLE_BLEND_HOOKS
+    // Fills, image copies and glyph blends through the lvgl_blend kernels (PIE on the S3)
+    lvgl_draw_hooks_init(&disp_drv);
+#endif
 
-    ESP_LOGI(TAG, "Display driver configured for Mode 3 (direct_mode=1)");
+    if (mode == LVGL_RENDER_PARTIAL) {
+        ESP_LOGI(TAG, "Display driver configured for %s render mode (2 x %d line SRAM bands)",
+                 render_mode_names[mode], CONFIG_ANCHOR_RENDER_PARTIAL_LINES);
+    } else {
+        ESP_LOGI(TAG, "Display driver configured for %s render mode", render_mode_names[mode]);
+    }
 
     // Register display driver
     lvgl_display = lv_disp_drv_register(&disp_drv);
@@ -205,6 +591,13 @@ esp_err_t lvgl_init(void) {
 
     ESP_LOGI(TAG, "Display driver registered with LVGL");
 
+    // Time every frame: wrap the refresh timer and start the frame timing drain
+    lv_timer_set_cb(lvgl_display->refr_timer, lvgl_refr_timer_cb);
+    ret = lvgl_perf_init();
+    if (ret != ESP_OK) {
+        ESP_LOGW(TAG, "Frame timing unavailable: %s", esp_err_to_name(ret));
+    }
+
     // Create and register touch input device (LVGL 8.x API)
     esp_lcd_touch_handle_t touch_handle = touch_get_handle();
     if (touch_handle != NULL) {
@@ -266,7 +659,8 @@ esp_err_t lvgl_init(void) {
     ESP_LOGI(TAG, "LVGL task created (priority %d, stack %d bytes, core 1)",
              LVGL_TASK_PRIORITY, LVGL_TASK_STACK);
 
-    ESP_LOGI(TAG, "LVGL initialization complete - Mode 3 Direct-Mode with VSYNC synchronization");
+    ESP_LOGI(TAG, "LVGL initialization complete - %s render mode with VSYNC synchronization",
+             render_mode_names[render_mode]);
 
     return ESP_OK;
 }
@@ -278,6 +672,69 @@ lv_disp_t* lvgl_get_display(void) {
     return lvgl_display;
 }
 
+/**
+ * Switch the render mode between frames
+ */
+esp_err_t lvgl_set_render_mode(lvgl_render_mode_t mode) {
+    if (mode >= LVGL_RENDER_MODE_COUNT) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (lvgl_display == NULL) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (mode == render_mode) {
+        return ESP_OK;
+    }
+#if LVGL_ROTATION != 0
+    return ESP_ERR_NOT_SUPPORTED;                   // Only partial mode rotates
+#endif
+    if (mode == LVGL_RENDER_PARTIAL) {
+        esp_err_t ret = lvgl_partial_alloc();
+        if (ret != ESP_OK) {
+            return ret;
+        }
+    }
+
+    lvgl_sync_wait();                               // Last frame's buffer sync
+    lvgl_render_mode_t prev = render_mode;
+    lvgl_render_apply(mode);
+    if (prev == LVGL_RENDER_PARTIAL) {
+        heap_caps_free(partial_buf[0]);
+        heap_caps_free(partial_buf[1]);
+        partial_buf[0] = NULL;
+        partial_buf[1] = NULL;
+    }
+
+    // Both frame buffers are rebuilt from a full redraw in the new mode
+    lv_obj_invalidate(lv_disp_get_scr_act(lvgl_display));
+    ESP_LOGI(TAG, "Render mode %s -> %s", render_mode_names[prev], render_mode_names[mode]);
+    return ESP_OK;
+}
+
+/**
+ * Get the render mode in use
+ */
+lvgl_render_mode_t lvgl_get_render_mode(void) {
+    return render_mode;
+}
+
+/**
+ * Short name of a render mode
+ */
+const char* lvgl_render_mode_name(lvgl_render_mode_t mode) {
+    return mode < LVGL_RENDER_MODE_COUNT ? render_mode_names[mode] : "?";
+}
+
+/**
+ * Copy the running render counters
+ */
+void lvgl_get_render_stats(lvgl_render_stats_t *out) {
+    *out = render_stats;
+    // Read from a timer, this handler run may already count its waits but not its time
+    uint64_t busy = render_handler_cycles > render_wait_cycles ? render_handler_cycles - render_wait_cycles : 0;
+    out->busy_us = busy / CONFIG_ESP_DEFAULT_CPU_FREQ_MHZ;
+}
+
 /**
  * Lock LVGL mutex
  */
@@ -1,16 +1,32 @@
 /**
  * LVGL Initialization and Integration
- * Waveshare Mode 3: Direct-Mode with hardware-managed synchronization
  *
  * Author: Colin Bitterfield
  * Email: colin@bitterfield.com
  * Date Created: 2025-12-20
- * Date Updated: 2025-12-24
- * Version: 0.2.1
+ * Date Updated: 2026-10-18
+ * Version: 0.3.1
+ *
+ * Changelog:
+ * - 0.3.1 (2026-10-18): Rotated panel support (partial mode only)
+ * - 0.3.0 (2026-10-18): Render modes (direct, partial, full) chosen in Kconfig and switchable at run time
  *
  * Initializes LVGL graphics library and integrates with RGB LCD display driver.
- * Uses full-screen frame buffers from RGB panel driver with direct-mode rendering.
- * Hardware double-buffering and bounce buffer provide automatic synchronization.
+ * The RGB panel keeps two full-screen frame buffers in PSRAM; every mode draws
+ * a frame into the one not on screen, then swaps at VSYNC (no tearing):
+ * - Direct (Waveshare Mode 3): LVGL draws straight into the frame buffer.
+ *   After the swap the areas it redrew are copied into the other buffer.
+ * - Partial: LVGL draws full-width row bands into two small internal SRAM
+ *   buffers and GDMA copies each band into the frame buffer while the next
+ *   one is drawn. Areas are rounded out to whole rows so every band is one
+ *   contiguous copy; the buffers are brought level as in direct mode.
+ * - Full: LVGL redraws the whole frame (Waveshare Mode 1, no buffer copies).
+ * The boot mode comes from Kconfig (Display > LVGL render mode);
+ * lvgl_set_render_mode() switches between frames.
+ *
+ * A rotated panel (EXAMPLE_LVGL_PORT_ROTATION_DEGREE in lvgl_port.h) runs in
+ * partial mode only: LVGL draws its rotated frame in bands and lvgl_rotate
+ * copies each band into the panel frame buffer, touch points mapped back.
  */
 
 #ifndef LVGL_INIT_H
@@ -18,6 +34,20 @@
 
 #include "esp_err.h"
 #include "lvgl.h"
+#include <stdint.h>
+
+typedef enum {
+    LVGL_RENDER_DIRECT = 0,     // Draw into the panel frame buffers, copy dirty areas across
+    LVGL_RENDER_PARTIAL,        // Draw row bands in internal SRAM, GDMA them into PSRAM
+    LVGL_RENDER_FULL,           // Redraw the whole frame every time
+    LVGL_RENDER_MODE_COUNT
+} lvgl_render_mode_t;
+
+typedef struct {
+    uint32_t frames;            // Frames put on screen
+    uint64_t busy_us;           // LVGL task time not blocked on VSYNC or GDMA copies
+    uint64_t psram_bytes;       // Frame buffer bytes drawn or copied in, plus buffer sync reads and writes
+} lvgl_render_stats_t;
 
 /**
  * Initialize LVGL graphics library
@@ -42,6 +72,42 @@ esp_err_t lvgl_init(void);
  */
 lv_disp_t* lvgl_get_display(void);
 
+/**
+ * Switch the render mode (LVGL task or lvgl_lock held; takes effect on the next frame)
+ *
+ * The whole screen is redrawn in the new mode. Partial mode allocates its
+ * SRAM buffers on entry and frees them on exit.
+ *
+ * @param mode Render mode
+ * @return ESP_ERR_NO_MEM if the partial buffers cannot be allocated (mode unchanged),
+ *         ESP_ERR_NOT_SUPPORTED for direct or full on a rotated panel
+ */
+esp_err_t lvgl_set_render_mode(lvgl_render_mode_t mode);
+
+/**
+ * Get the render mode in use
+ *
+ * @return Render mode
+ */
+lvgl_render_mode_t lvgl_get_render_mode(void);
+
+/**
+ * Short name of a render mode
+ *
+ * @param mode Render mode
+ * @return "DIRECT", "PARTIAL", "FULL" (or "?")
+ */
+const char* lvgl_render_mode_name(lvgl_render_mode_t mode);
+
+/**
+ * Copy the running render counters (LVGL task or lvgl_lock held)
+ *
+ * The counters only grow; measure a period by taking the difference.
+ *
+ * @param out Counters output
+ */
+void lvgl_get_render_stats(lvgl_render_stats_t *out);
+
 /**
  * Lock LVGL mutex (for thread-safe LVGL API calls)
  *
@@ -0,0 +1,242 @@
+/**
+ * LVGL Frame Timing Implementation
+ *
+ * Author: Colin Bitterfield
+ * Email: colin@bitterfield.com
+ * Date Created: 2026-10-18
+ * Version: 0.1.0
+ */
+
+#include "lvgl_perf.h"
+#include "lvgl.h"
+#include "board_config.h"
+#include "esp_cpu.h"
+#include "esp_log.h"
+#include "sdkconfig.h"
+#include <stdio.h>
+#include <string.h>
+
+#ifndef CONFIG_ANCHOR_FRAME_STATS_LOG_S
+#define CONFIG_ANCHOR_FRAME_STATS_LOG_S 0
+#endif
+
+#define LVGL_PERF_RING_MASK     (LVGL_PERF_RING_SIZE - 1)
+#define LVGL_PERF_FULL_FRAME    ((uint32_t)LCD_WIDTH * LCD_HEIGHT)
+
+static const char *TAG = "lvgl_perf";
+
+typedef struct {
+    uint32_t value;
+    uint8_t metric;
+} lvgl_perf_sample_t;
+
+// Upper bucket edges (inclusive); the last bucket takes everything above
+static const uint32_t time_edges_us[LVGL_PERF_BUCKETS] = {
+    100, 250, 500, 1000, 2000, 4000, 6000, 8000,
+    12000, 16000, 20000, 25000, 33000, 50000, 100000, UINT32_MAX
+};
+static const uint32_t area_edges_px[LVGL_PERF_BUCKETS] = {
+    1000, 2000, 4000, 8000, 16000, 32000, 48000, 64000,
+    96000, 128000, 192000, 256000, 320000, LVGL_PERF_FULL_FRAME - 1, LVGL_PERF_FULL_FRAME, UINT32_MAX
+};
+
+static const char *metric_names[LVGL_PERF_METRIC_COUNT] = {"render", "area", "vsync", "handler"};
+static const char *metric_units[LVGL_PERF_METRIC_COUNT] = {"us", "px", "us", "us"};
+
+// Ring: written by the LVGL task hot path, drained by the drain timer
+static lvgl_perf_sample_t s_ring[LVGL_PERF_RING_SIZE];
+static uint32_t s_head = 0;                 // Producer index (release after the slot is written)
+static uint32_t s_tail = 0;                 // Consumer index (release after the slot is read)
+static uint32_t s_dropped = 0;              // Samples lost to a full ring
+
+// Histograms (drain timer only)
+static lvgl_perf_window_t s_cur;
+static lvgl_perf_window_t s_last;
+static uint32_t s_window_start_ms = 0;
+static uint32_t s_last_log_ms = 0;
+static lv_timer_t *s_drain_timer = NULL;
+
+static const uint32_t* lvgl_perf_edges(lvgl_perf_metric_t metric) {
+    return metric == LVGL_PERF_FLUSH_AREA ? area_edges_px : time_edges_us;
+}
+
+/**
+ * Add one value to a histogram
+ */
+static void lvgl_perf_hist_add(lvgl_perf_metric_t metric, lvgl_perf_hist_t *hist, uint32_t value) {
+    const uint32_t *edges = lvgl_perf_edges(metric);
+    int b = 0;
+    while (b < LVGL_PERF_BUCKETS - 1 && value > edges[b]) {
+        b++;
+    }
+    hist->bucket[b]++;
+    hist->count++;
+    hist->sum += value;
+    if (value > hist->max) {
+        hist->max = value;
+    }
+}
+
+/**
+ * Move queued samples into the current histograms
+ */
+static void lvgl_perf_drain(void) {
+    uint32_t head = __atomic_load_n(&s_head, __ATOMIC_ACQUIRE);
+    uint32_t tail = s_tail;
+
+    while (tail != head) {
+        lvgl_perf_sample_t sample = s_ring[tail & LVGL_PERF_RING_MASK];
+        tail++;
+        if (sample.metric >= LVGL_PERF_METRIC_COUNT) continue;
+
+        uint32_t value = sample.value;
+        if (sample.metric != LVGL_PERF_FLUSH_AREA) {
+            value /= CONFIG_ESP_DEFAULT_CPU_FREQ_MHZ;   // Cycles to us (fixed clock, no PM)
+        }
+        lvgl_perf_hist_add((lvgl_perf_metric_t)sample.metric, &s_cur.hist[sample.metric], value);
+    }
+    __atomic_store_n(&s_tail, tail, __ATOMIC_RELEASE);
+    s_cur.dropped += __atomic_exchange_n(&s_dropped, 0, __ATOMIC_RELAXED);
+}
+
+/**
+ * Drain, close the window when due and dump it
+ */
+static void lvgl_perf_timer_cb(lv_timer_t *timer) {
+    lvgl_perf_drain();
+
+    uint32_t now = lv_tick_get();
+    uint32_t elapsed = now - s_window_start_ms;
+    if (elapsed < LVGL_PERF_WINDOW_MS) return;
+
+    s_last = s_cur;
+    s_last.frames = s_cur.hist[LVGL_PERF_RENDER].count;
+    s_last.window_ms = elapsed;
+    memset(&s_cur, 0, sizeof(s_cur));
+    s_window_start_ms = now;
+
+#if CONFIG_ANCHOR_FRAME_STATS_LOG_S > 0
+    if (now - s_last_log_ms >= (uint32_t)CONFIG_ANCHOR_FRAME_STATS_LOG_S * 1000) {
+        s_last_log_ms = now;
+        lvgl_perf_log();
+    }
+#endif
+}
+
+/**
+ * Start the drain timer
+ */
+esp_err_t lvgl_perf_init(void) {
+    if (s_drain_timer != NULL) return ESP_OK;
+
+    s_drain_timer = lv_timer_create(lvgl_perf_timer_cb, LVGL_PERF_DRAIN_MS, NULL);
+    if (s_drain_timer == NULL) {
+        ESP_LOGE(TAG, "Failed to create drain timer");
+        return ESP_ERR_NO_MEM;
+    }
+    s_window_start_ms = lv_tick_get();
+    s_last_log_ms = s_window_start_ms;
+    ESP_LOGI(TAG, "Frame timing on (%d sample ring, %d ms window, console dump every %d s)",
+             LVGL_PERF_RING_SIZE, LVGL_PERF_WINDOW_MS, CONFIG_ANCHOR_FRAME_STATS_LOG_S);
+    return ESP_OK;
+}
+
+/**
+ * Read the CPU cycle counter
+ */
+uint32_t lvgl_perf_stamp(void) {
+    return (uint32_t)esp_cpu_get_cycle_count();
+}
+
+/**
+ * Push a sample (single producer)
+ */
+void lvgl_perf_record(lvgl_perf_metric_t metric, uint32_t value) {
+    uint32_t head = s_head;
+    if (head - __atomic_load_n(&s_tail, __ATOMIC_ACQUIRE) >= LVGL_PERF_RING_SIZE) {
+        __atomic_fetch_add(&s_dropped, 1, __ATOMIC_RELAXED);
+        return;
+    }
+    s_ring[head & LVGL_PERF_RING_MASK].value = value;
+    s_ring[head & LVGL_PERF_RING_MASK].metric = (uint8_t)metric;
+    __atomic_store_n(&s_head, head + 1, __ATOMIC_RELEASE);
+}
+
+/**
+ * Copy the last complete window
+ */
+bool lvgl_perf_get_window(lvgl_perf_window_t *out) {
+    *out = s_last;
+    return s_last.window_ms != 0;
+}
+
+/**
+ * Percentile of a histogram, interpolated inside its bucket
+ */
+uint32_t lvgl_perf_percentile(lvgl_perf_metric_t metric, const lvgl_perf_hist_t *hist,
+                              uint32_t pct) {
+    if (hist->count == 0) return 0;
+    if (pct > 100) pct = 100;
+
+    const uint32_t *edges = lvgl_perf_edges(metric);
+    uint32_t rank = (uint32_t)(((uint64_t)hist->count * pct + 99) / 100);   // Nearest rank
+    if (rank == 0) rank = 1;
+
+    uint32_t below = 0;
+    for (int b = 0; b < LVGL_PERF_BUCKETS; b++) {
+        uint32_t n = hist->bucket[b];
+        if (below + n < rank) {
+            below += n;
+            continue;
+        }
+        uint32_t lower = b > 0 ? edges[b - 1] : 0;
+        uint32_t upper = edges[b] < hist->max ? edges[b] : hist->max;
+        if (upper <= lower) return upper;
+        return lower + (uint32_t)((uint64_t)(upper - lower) * (rank - below) / n);
+    }
+    return hist->max;
+}
+
+/**
+ * Dump the last complete window to the console
+ */
+void lvgl_perf_log(void) {
+    const lvgl_perf_window_t *w = &s_last;
+    if (w->window_ms == 0) {
+        ESP_LOGI(TAG, "No frame timing window closed yet");
+        return;
+    }
+
+    ESP_LOGI(TAG, "Last %u ms: %u frames (%.1f fps), %u samples dropped",
+             (unsigned int)w->window_ms, (unsigned int)w->frames,
+             w->frames * 1000.0f / w->window_ms, (unsigned int)w->dropped);
+
+    for (int m = 0; m < LVGL_PERF_METRIC_COUNT; m++) {
+        const lvgl_perf_hist_t *h = &w->hist[m];
+        ESP_LOGI(TAG, "%-7s %s  n %u  p50 %u  p95 %u  p99 %u  max %u  mean %u",
+                 metric_names[m], metric_units[m], (unsigned int)h->count,
+                 (unsigned int)lvgl_perf_percentile(m, h, 50),
+                 (unsigned int)lvgl_perf_percentile(m, h, 95),
+                 (unsigned int)lvgl_perf_percentile(m, h, 99),
+                 (unsigned int)h->max,
+                 (unsigned int)(h->count ? h->sum / h->count : 0));
+
+        // Non-empty buckets as <=edge:count (the overflow bucket as >edge:count)
+        const uint32_t *edges = lvgl_perf_edges(m);
+        char line[256];
+        int len = 0;
+        for (int b = 0; b < LVGL_PERF_BUCKETS && len < (int)sizeof(line); b++) {
+            if (h->bucket[b] == 0) continue;
+            if (b == LVGL_PERF_BUCKETS - 1) {
+                len += snprintf(line + len, sizeof(line) - len, " >%u:%u",
+                                (unsigned int)edges[b - 1], (unsigned int)h->bucket[b]);
+            } else {
+                len += snprintf(line + len, sizeof(line) - len, " <=%u:%u",
+                                (unsigned int)edges[b], (unsigned int)h->bucket[b]);
+            }
+        }
+        if (len > 0) {
+            ESP_LOGI(TAG, "%-7s   %s", metric_names[m], line);
+        }
+    }
+}
@@ -0,0 +1,100 @@
+/**
+ * LVGL Frame Timing
+ *
+ * Author: Colin Bitterfield
+ * Email: colin@bitterfield.com
+ * Date Created: 2026-10-18
+ * Version: 0.1.0
+ *
+ * Measures where frame time goes on the LVGL task:
+ * - Render: refresh timer run minus the VSYNC wait (drawing into the frame buffer)
+ * - Flush area: pixels handed to the flush callback per frame
+ * - VSYNC wait: time blocked in the flush callback until the panel takes the buffer
+ * - Handler: one lv_timer_handler() call (timers, input, refresh)
+ *
+ * The hot path only reads the CPU cycle counter and pushes a sample into a
+ * single-producer ring (no lock, no division, never blocks: a full ring
+ * drops the sample and counts it). Once a second a timer on the LVGL task
+ * drains the ring into fixed-bucket histograms. Every LVGL_PERF_WINDOW_MS
+ * the histograms close into the window read by lvgl_perf_get_window() and
+ * start again, so percentiles always describe the last complete window.
+ * With CONFIG_ANCHOR_FRAME_STATS_LOG_S set, each closed window is also
+ * dumped to the console at that period.
+ */
+
+#ifndef LVGL_PERF_H
+#define LVGL_PERF_H
+
+#include "esp_err.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+#define LVGL_PERF_RING_SIZE         256     // Samples between drains (power of two)
+#define LVGL_PERF_BUCKETS           16      // Histogram buckets per metric (last = overflow)
+#define LVGL_PERF_DRAIN_MS          1000    // Ring drain period
+#define LVGL_PERF_WINDOW_MS         10000   // Histogram window length
+
+typedef enum {
+    LVGL_PERF_RENDER = 0,       // Frame render time (us)
+    LVGL_PERF_FLUSH_AREA,       // Pixels flushed per frame
+    LVGL_PERF_VSYNC_WAIT,       // Frame VSYNC wait (us)
+    LVGL_PERF_HANDLER,          // lv_timer_handler() duration (us)
+    LVGL_PERF_METRIC_COUNT
+} lvgl_perf_metric_t;
+
+typedef struct {
+    uint32_t count;
+    uint32_t max;
+    uint64_t sum;
+    uint32_t bucket[LVGL_PERF_BUCKETS];
+} lvgl_perf_hist_t;
+
+typedef struct {
+    lvgl_perf_hist_t hist[LVGL_PERF_METRIC_COUNT];
+    uint32_t frames;            // Frames flushed in the window
+    uint32_t dropped;           // Samples lost to a full ring in the window
+    uint32_t window_ms;         // Window length (0 = no window closed yet)
+} lvgl_perf_window_t;
+
+/**
+ * Start the drain timer (LVGL task or lvgl_lock held, after lv_init)
+ * @return ESP_OK on success
+ */
+esp_err_t lvgl_perf_init(void);
+
+/**
+ * Read the CPU cycle counter (hot path timestamp)
+ * @return Cycle count
+ */
+uint32_t lvgl_perf_stamp(void);
+
+/**
+ * Push a sample (LVGL task only: the ring has a single producer)
+ * @param metric Metric
+ * @param value Cycles (lvgl_perf_stamp() difference) for time metrics, pixels for the area
+ */
+void lvgl_perf_record(lvgl_perf_metric_t metric, uint32_t value);
+
+/**
+ * Copy the last complete window (LVGL task)
+ * @param out Window output
+ * @return false if no window has closed yet
+ */
+bool lvgl_perf_get_window(lvgl_perf_window_t *out);
+
+/**
+ * Percentile of a histogram, interpolated inside its bucket
+ * @param metric Metric the histogram belongs to (selects the bucket edges)
+ * @param hist Histogram
+ * @param pct Percentile (1-100)
+ * @return Value in the metric's unit (us or pixels), 0 for an empty histogram
+ */
+uint32_t lvgl_perf_percentile(lvgl_perf_metric_t metric, const lvgl_perf_hist_t *hist,
+                              uint32_t pct);
+
+/**
+ * Dump the last complete window to the console (LVGL task)
+ */
+void lvgl_perf_log(void);
+
+#endif // LVGL_PERF_H
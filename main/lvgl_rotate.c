@@ -0,0 +1,196 @@
+/**
+ * Frame Buffer Rotation Kernels Implementation
+ *
+ * Author: Colin Bitterfield
+ * Email: colin@bitterfield.com
+ * Date Created: 2026-10-18
+ * Date Updated: 2026-10-18
+ * Version: 0.3.0
+ *
+ * Changelog:
+ * - 0.3.0 (2026-10-18): Per-pixel loop is the default again; tiled kernel only with ENABLE_ROTATE_TILED
+ * - 0.2.0 (2026-10-18): Band copy for the rotated partial render mode, rotated area bounds
+ */
+
+#include "lvgl_rotate.h"
+#include "board_config.h"
+
+#if defined(ESP_PLATFORM)
+#include "esp_attr.h"           // Called from the flush path: keep out of flash
+#else
+#define IRAM_ATTR
+#endif
+
+/**
+ * 90 degrees: source (x, y) -> destination row (w - 1 - x), column y
+ * (from holds source rows from from_y on, as in every helper below)
+ */
+static inline void rotate_block_90(const uint16_t *from, int from_y, uint16_t *to, int x0, int y0,
+                                   int x1, int y1, int w, int h) {
+    for (int x = x0; x <= x1; x++) {
+        const uint16_t *src = from + (y0 - from_y) * w + x;
+        uint16_t *dst = to + (w - 1 - x) * h + y0;
+        for (int y = y0; y <= y1; y++) {
+            *dst++ = *src;
+            src += w;
+        }
+    }
+}
+
+/**
+ * 270 degrees: source (x, y) -> destination row x, column (h - 1 - y)
+ */
+static inline void rotate_block_270(const uint16_t *from, int from_y, uint16_t *to, int x0, int y0,
+                                    int x1, int y1, int w, int h) {
+    for (int x = x0; x <= x1; x++) {
+        const uint16_t *src = from + (y0 - from_y) * w + x;
+        uint16_t *dst = to + x * h + (h - 1 - y0);
+        for (int y = y0; y <= y1; y++) {
+            *dst-- = *src;
+            src += w;
+        }
+    }
+}
+
+/**
+ * Tiled copy of an area whose source rows start at from_y
+ */
+static inline void rotate_copy_tiled(const uint16_t *from, int from_y, uint16_t *to, int x_start, int y_start,
+                               int x_end, int y_end, int w, int h, int rotation) {
+    if (rotation == 180) {
+        // Row reversal: reads and writes are already sequential
+        for (int y = y_start; y <= y_end; y++) {
+            const uint16_t *src = from + (y - from_y) * w + x_start;
+            uint16_t *dst = to + (h - y) * w - 1 - x_start;
+            for (int x = x_start; x <= x_end; x++) {
+                *dst-- = *src++;
+            }
+        }
+        return;
+    }
+    if (rotation != 90 && rotation != 270) return;
+
+    for (int ty = y_start; ty <= y_end; ty += LVGL_ROTATE_TILE) {
+        int ty_end = ty + LVGL_ROTATE_TILE - 1;
+        if (ty_end > y_end) ty_end = y_end;
+        for (int tx = x_start; tx <= x_end; tx += LVGL_ROTATE_TILE) {
+            int tx_end = tx + LVGL_ROTATE_TILE - 1;
+            if (tx_end > x_end) tx_end = x_end;
+            if (rotation == 90) {
+                rotate_block_90(from, from_y, to, tx, ty, tx_end, ty_end, w, h);
+            } else {
+                rotate_block_270(from, from_y, to, tx, ty, tx_end, ty_end, w, h);
+            }
+        }
+    }
+}
+
+/**
+ * Per-pixel copy of an area whose source rows start at from_y (the original port loop)
+ */
+static inline void rotate_copy_pixel(const uint16_t *from, int from_y0, uint16_t *to, int x_start, int y_start,
+                                     int x_end, int y_end, int w, int h, int rotation) {
+    int step;
+    int to_index_const;
+    int to_row_step;
+
+    switch (rotation) {
+    case 90:
+        to_index_const = (w - x_start - 1) * h;
+        to_row_step = 1;
+        step = -h;
+        break;
+    case 180:
+        to_index_const = h * w - x_start - 1;
+        to_row_step = -w;
+        step = -1;
+        break;
+    case 270:
+        to_index_const = (x_start + 1) * h - 1;
+        to_row_step = -1;
+        step = h;
+        break;
+    default:
+        return;
+    }
+
+    for (int from_y = y_start; from_y <= y_end; from_y++) {
+        int from_index = (from_y - from_y0) * w + x_start;
+        int to_index = to_index_const + from_y * to_row_step;
+        for (int from_x = x_start; from_x <= x_end; from_x++) {
+            to[to_index] = from[from_index];
+            from_index += 1;
+            to_index += step;
+        }
+    }
+}
+
+/**
+ * Rotate and copy an area (flush path kernel)
+ */
+IRAM_ATTR void lvgl_rotate_copy(const uint16_t *from, uint16_t *to, int x_start, int y_start,
+                                int x_end, int y_end, int w, int h, int rotation) {
+#if ENABLE_ROTATE_TILED
+    rotate_copy_tiled(from, 0, to, x_start, y_start, x_end, y_end, w, h, rotation);
+#else
+    rotate_copy_pixel(from, 0, to, x_start, y_start, x_end, y_end, w, h, rotation);
+#endif
+}
+
+/**
+ * Rotate and copy a band of whole rows held in its own buffer
+ */
+IRAM_ATTR void lvgl_rotate_copy_band(const uint16_t *band, uint16_t *to, int y_start, int y_end,
+                                     int w, int h, int rotation) {
+#if ENABLE_ROTATE_TILED
+    rotate_copy_tiled(band, y_start, to, 0, y_start, w - 1, y_end, w, h, rotation);
+#else
+    rotate_copy_pixel(band, y_start, to, 0, y_start, w - 1, y_end, w, h, rotation);
+#endif
+}
+
+/**
+ * Rotate and copy an area, cache-blocked
+ */
+IRAM_ATTR void lvgl_rotate_copy_tiled(const uint16_t *from, uint16_t *to, int x_start, int y_start,
+                                      int x_end, int y_end, int w, int h, int rotation) {
+    rotate_copy_tiled(from, 0, to, x_start, y_start, x_end, y_end, w, h, rotation);
+}
+
+/**
+ * Rotate and copy an area one pixel at a time
+ */
+IRAM_ATTR void lvgl_rotate_copy_pixel(const uint16_t *from, uint16_t *to, int x_start, int y_start,
+                                      int x_end, int y_end, int w, int h, int rotation) {
+    rotate_copy_pixel(from, 0, to, x_start, y_start, x_end, y_end, w, h, rotation);
+}
+
+/**
+ * Bounds of an area in the destination buffer
+ */
+void lvgl_rotate_area(int *x1, int *y1, int *x2, int *y2, int w, int h, int rotation) {
+    int ax1 = *x1, ay1 = *y1, ax2 = *x2, ay2 = *y2;
+
+    switch (rotation) {
+    case 90:
+        *x1 = ay1;
+        *x2 = ay2;
+        *y1 = w - 1 - ax2;
+        *y2 = w - 1 - ax1;
+        break;
+    case 180:
+        *x1 = w - 1 - ax2;
+        *x2 = w - 1 - ax1;
+        *y1 = h - 1 - ay2;
+        *y2 = h - 1 - ay1;
+        break;
+    case 270:
+        *x1 = h - 1 - ay2;
+        *x2 = h - 1 - ay1;
+        *y1 = ax1;
+        *y2 = ax2;
+        break;
+    default:
+        break;
+    }
+}
@@ -0,0 +1,106 @@
+/**
+ * Frame Buffer Rotation Kernels
+ *
+ * Author: Colin Bitterfield
+ * Email: colin@bitterfield.com
+ * Date Created: 2026-10-18
+ * Date Updated: 2026-10-18
+ * Version: 0.3.0
+ *
+ * Changelog:
+ * - 0.3.0 (2026-10-18): lvgl_rotate_copy() / lvgl_rotate_copy_band() use the per-pixel loop
+ *   unless ENABLE_ROTATE_TILED (board_config.h); tiled kernel as lvgl_rotate_copy_tiled()
+ * - 0.2.0 (2026-10-18): lvgl_rotate_copy_band() and lvgl_rotate_area() for the rotated partial render mode
+ *
+ * Copies LVGL's RGB565 pixels into the panel frame buffer rotated by 90,
+ * 180 or 270 degrees. lvgl_init.c copies each partial-mode row band with
+ * lvgl_rotate_copy_band() when EXAMPLE_LVGL_PORT_ROTATION_DEGREE (lvgl_port.h)
+ * is not 0; the unused Waveshare port (lvgl_port_waveshare.c) calls
+ * lvgl_rotate_copy() on its full-size draw buffer.
+ *
+ * The per-pixel loop walks the source row by row. At 90 and 270 degrees
+ * every destination write then lands one panel row (h pixels) after the
+ * last, so each pixel touches a new cache line and the PSRAM cache keeps
+ * evicting lines it only wrote 2 bytes of. The tiled kernel copies
+ * LVGL_ROTATE_TILE x LVGL_ROTATE_TILE blocks instead. It walks each block
+ * column by column so the writes are sequential, and the few source lines
+ * it reads stay in the cache for the whole block. 180 degrees has no
+ * transpose: it reverses whole rows.
+ *
+ * Both kernels take the same arguments and produce identical frames. Only
+ * the pixels inside the area are written, so dirty-area copies into the
+ * other frame buffer keep working. Pure C (host-compilable).
+ *
+ * lvgl_rotate_copy() and lvgl_rotate_copy_band() are what the flush paths
+ * call. They run the per-pixel loop, the original port code, unless
+ * ENABLE_ROTATE_TILED is set in board_config.h.
+ *
+ * The cache effect is the design intent, not a measured result yet. On the
+ * host both frames sit in L2, and at 90/270 the tiled kernel lands anywhere
+ * from 0.7x to 1.9x of the per-pixel loop from run to run (host/rotate_bench).
+ * Only the boot benchmark (ENABLE_ROTATE_BENCHMARK in main.c) can show
+ * whether it wins on PSRAM.
+ */
+
+#ifndef LVGL_ROTATE_H
+#define LVGL_ROTATE_H
+
+#include <stdint.h>
+
+#define LVGL_ROTATE_TILE        16      // Block edge in pixels (16 x 2 bytes = one 32-byte cache line)
+
+/**
+ * Rotate and copy an area (per-pixel loop, tiled with ENABLE_ROTATE_TILED)
+ * @param from Source buffer (w x h pixels, LVGL's logical orientation)
+ * @param to Destination buffer (the panel frame buffer, h x w at 90/270)
+ * @param x_start First column of the area
+ * @param y_start First row of the area
+ * @param x_end Last column of the area (inclusive)
+ * @param y_end Last row of the area (inclusive)
+ * @param w Source width (LV_HOR_RES)
+ * @param h Source height (LV_VER_RES)
+ * @param rotation 90, 180 or 270 (anything else copies nothing)
+ */
+void lvgl_rotate_copy(const uint16_t *from, uint16_t *to, int x_start, int y_start,
+                      int x_end, int y_end, int w, int h, int rotation);
+
+/**
+ * Rotate and copy a band of whole rows held in its own buffer (partial render)
+ * @param band Source rows y_start..y_end, w pixels each
+ * @param to Destination buffer (the panel frame buffer, h x w at 90/270)
+ * @param y_start First row of the band in the logical frame
+ * @param y_end Last row of the band (inclusive)
+ * @param w Source width (LVGL's horizontal resolution)
+ * @param h Source height (LVGL's vertical resolution)
+ * @param rotation 90, 180 or 270 (anything else copies nothing)
+ */
+void lvgl_rotate_copy_band(const uint16_t *band, uint16_t *to, int y_start, int y_end,
+                           int w, int h, int rotation);
+
+/**
+ * Move an area's inclusive bounds to where the copy writes them in the destination
+ * @param x1 First column (in: source, out: destination)
+ * @param y1 First row
+ * @param x2 Last column
+ * @param y2 Last row
+ * @param w Source width
+ * @param h Source height
+ * @param rotation 90, 180 or 270 (anything else leaves the area unchanged)
+ */
+void lvgl_rotate_area(int *x1, int *y1, int *x2, int *y2, int w, int h, int rotation);
+
+/**
+ * Rotate and copy an area, cache-blocked, whatever ENABLE_ROTATE_TILED says
+ * Same parameters as lvgl_rotate_copy().
+ */
+void lvgl_rotate_copy_tiled(const uint16_t *from, uint16_t *to, int x_start, int y_start,
+                            int x_end, int y_end, int w, int h, int rotation);
+
+/**
+ * Rotate and copy an area one pixel at a time, whatever ENABLE_ROTATE_TILED says
+ * Same parameters as lvgl_rotate_copy().
+ */
+void lvgl_rotate_copy_pixel(const uint16_t *from, uint16_t *to, int x_start, int y_start,
+                            int x_end, int y_end, int w, int h, int rotation);
+
+#endif // LVGL_ROTATE_H
@@ -39,8 +39,19 @@
 #include "tv_test_pattern.h"
 #include "ui_footer.h"
 #include "ui_header.h"
+#include "ui_status.h"
+#include "ui_screen_mgr.h"
+#include "sd_card.h"
 #include "screens.h"
 #include "power_management.h"
+#include "anchor_watch.h"
+#include "anchor_swing.h"
+#include "esp_timer.h"
+#include "esp_heap_caps.h"
+#include "lvgl_rotate.h"
+#include "lvgl_blend.h"
+#include "lvgl_draw_hooks.h"
+#include "ui_render_bench.h"
 #include "nvs_flash.h"
 
 // External font declarations
@@ -48,14 +59,6 @@ LV_FONT_DECLARE(orbitron_variablefont_wght_24);
 
 static const char *TAG = "anchor-drag-pro";
 
-// Global footer reference for touch handler
-static lv_obj_t *g_footer = NULL;
-
-// Global screen references for navigation
-static lv_obj_t *g_screens[PAGE_COUNT] = {NULL};
-static lv_obj_t *g_footers[PAGE_COUNT] = {NULL};
-static ui_page_t g_current_page = PAGE_START;
-
 // Touch tracking for manual swipe detection
 static lv_point_t touch_start = {0, 0};
 static bool touch_started = false;
@@ -78,8 +81,9 @@ static void global_gesture_cb(lv_event_t *e) {
         ESP_LOGI(TAG, "Touch started at X=%d, Y=%d", touch_start.x, touch_start.y);
 
     } else if (code == LV_EVENT_PRESSING) {
-        // Touch moving - check for swipe gestures
+        // Touch moving - check for swipe gestures (only added to the navigation pages)
         if (touch_started) {
+            ui_page_t current_page = (ui_page_t)ui_screen_active();
             lv_point_t current;
             lv_indev_t *indev = lv_indev_get_act();
             lv_indev_get_point(indev, &current);
@@ -90,22 +94,20 @@ static void global_gesture_cb(lv_event_t *e) {
             // Swipe up - show footer
             if (delta_y > 50 && abs(delta_x) < 30) {
                 ESP_LOGI(TAG, "Swipe up detected! Delta Y=%d - showing footer", delta_y);
-                if (g_footer != NULL) {
-                    ui_footer_show(g_footer);
-                }
+                ui_footer_show(ui_footer_get());
                 touch_started = false;  // Prevent multiple triggers
             }
             // Swipe left - next screen
             else if (delta_x < -80 && abs(delta_y) < 40) {
                 ESP_LOGI(TAG, "Swipe left detected! Delta X=%d - next screen", delta_x);
-                ui_page_t next_page = (g_current_page + 1) % PAGE_COUNT;
+                ui_page_t next_page = (current_page + 1) % PAGE_COUNT;
                 footer_page_callback(next_page);
                 touch_started = false;
             }
             // Swipe right - previous screen
             else if (delta_x > 80 && abs(delta_y) < 40) {
                 ESP_LOGI(TAG, "Swipe right detected! Delta X=%d - previous screen", delta_x);
-                ui_page_t prev_page = (g_current_page + PAGE_COUNT - 1) % PAGE_COUNT;
+                ui_page_t prev_page = (current_page + PAGE_COUNT - 1) % PAGE_COUNT;
                 footer_page_callback(prev_page);
                 touch_started = false;
             }
@@ -130,18 +132,13 @@ static void bottom_touch_cb(lv_event_t *e) {
 static void footer_page_callback(ui_page_t page) {
     const char *page_names[] = {"START", "INFO", "PGN", "CONFIG", "UPDATE", "TOOLS"};
 
-    // Check if screen exists
-    if (g_screens[page] == NULL) {
-        ESP_LOGE(TAG, "Screen %s not created!", page_names[page]);
+    // Navigate to the selected screen (page ids are screen ids)
+    // Note: We're already in an LVGL context (button event callback), so no need to lock
+    if (!ui_screen_load(page)) {
+        ESP_LOGE(TAG, "Screen %s not available!", page_names[page]);
         return;
     }
 
-    // Navigate to the selected screen
-    // Note: We're already in an LVGL context (button event callback), so no need to lock
-    lv_scr_load(g_screens[page]);
-    g_current_page = page;
-    g_footer = g_footers[page];  // Update global footer reference for swipe-up
-
     ESP_LOGI(TAG, "Navigation: %s screen loaded", page_names[page]);
 }
 
@@ -272,6 +269,12 @@ static void display_libraries(void) {
 
     printf("12. RTC (PCF85063A)  [ENABLED]  - Real-time clock with battery backup\n");
 
+    #if ENABLE_ESP_DSP
+    printf("13. esp-dsp          [ENABLED]  - S3-optimised FFT for swing analysis\n");
+    #else
+    printf("13. esp-dsp          [DISABLED] - S3-optimised FFT for swing analysis\n");
+    #endif
+
     printf("\n");
 }
 
@@ -370,12 +373,269 @@ static void display_app_config(void) {
            ALARM_DISTANCE_MIN_FT, ALARM_DISTANCE_MAX_FT, ALARM_DISTANCE_DEFAULT_FT);
     printf("Arming Time:         %d-%d sec (default: %d sec)\n",
            ARMING_TIME_MIN_SEC, ARMING_TIME_MAX_SEC, ARMING_TIME_DEFAULT_SEC);
+    printf("Drag Horizon:        %d-%d sec (default: %d sec)\n",
+           DRAG_HORIZON_MIN_SEC, DRAG_HORIZON_MAX_SEC, DRAG_HORIZON_DEFAULT_SEC);
+    printf("Rode Length:         %d-%d m (default: %d m, 0 = fixed radius)\n",
+           RODE_LENGTH_MIN_M, RODE_LENGTH_MAX_M, RODE_LENGTH_DEFAULT_M);
     printf("GPS Timeout:         %d seconds\n", GPS_TIMEOUT_SEC);
     printf("Button Debounce:     %d ms\n", BUTTON_DEBOUNCE_MS);
     printf("NVS Namespace:       %s\n", NVS_NAMESPACE);
     printf("\n");
 }
 
+#if ENABLE_DSP_BENCHMARK
+/**
+ * Benchmark the swing FFT: esp-dsp (S3 SIMD) path vs the plain C loop
+ */
+static void display_dsp_benchmark(void) {
+    static float buf[2 * SWING_FFT_N] __attribute__((aligned(16)));
+    const int iterations = 1000;
+
+    print_banner_line();
+    print_centered("SWING FFT BENCHMARK");
+    print_banner_line();
+
+    for (int pass = 0; pass < 2; pass++) {
+        int64_t elapsed = 0;
+        for (int it = 0; it < iterations; it++) {
+            for (int i = 0; i < 2 * SWING_FFT_N; i++) {
+                buf[i] = (float)((i * 7 + it) % 13) - 6.0f;
+            }
+            int64_t start = esp_timer_get_time();
+            if (pass == 0) {
+                anchor_swing_fft(buf, SWING_FFT_N);
+            } else {
+                anchor_swing_fft_c(buf, SWING_FFT_N);
+            }
+            elapsed += esp_timer_get_time() - start;
+        }
+        printf("%-20s %.1f us per %d-point complex FFT\n",
+               pass == 0 ? "esp-dsp (S3 SIMD):" : "Plain C:",
+               (double)elapsed / iterations, SWING_FFT_N);
+    }
+    printf("\n");
+}
+#endif
+
+#if ENABLE_ROTATE_BENCHMARK
+#define ROTATE_BENCH_BAND_ROWS  24      // CONFIG_ANCHOR_RENDER_PARTIAL_LINES default
+
+/**
+ * Benchmark frame rotation: tiled kernel vs the per-pixel loop, PSRAM to PSRAM,
+ * and the tiled band copy from internal SRAM that the rotated partial render
+ * flush runs (lvgl_init.c)
+ */
+static void display_rotate_benchmark(void) {
+    static const int rotations[] = { 90, 180, 270 };
+    const size_t bytes = LCD_WIDTH * LCD_HEIGHT * sizeof(uint16_t);
+    const int iterations = 10;
+
+    print_banner_line();
+    print_centered("ROTATION BENCHMARK");
+    print_banner_line();
+
+    uint16_t *src = heap_caps_malloc(bytes, MALLOC_CAP_SPIRAM);
+    uint16_t *dst = heap_caps_malloc(bytes, MALLOC_CAP_SPIRAM);
+    if (src == NULL || dst == NULL) {
+        printf("Not enough PSRAM for two %dx%d frames\n\n", LCD_WIDTH, LCD_HEIGHT);
+        heap_caps_free(src);
+        heap_caps_free(dst);
+        return;
+    }
+    for (int i = 0; i < LCD_WIDTH * LCD_HEIGHT; i++) {
+        src[i] = (uint16_t)(i * 2654435761u >> 16);
+    }
+    // Partial render band (internal SRAM); its content does not matter for timing
+    uint16_t *band = heap_caps_malloc(LCD_WIDTH * ROTATE_BENCH_BAND_ROWS * sizeof(uint16_t),
+                                      MALLOC_CAP_INTERNAL | MALLOC_CAP_DMA);
+    if (band != NULL) {
+        memcpy(band, src, LCD_WIDTH * ROTATE_BENCH_BAND_ROWS * sizeof(uint16_t));
+    }
+
+    for (size_t r = 0; r < sizeof(rotations) / sizeof(rotations[0]); r++) {
+        int rotation = rotations[r];
+        int w = rotation == 180 ? LCD_WIDTH : LCD_HEIGHT;      // LVGL's logical frame
+        int h = rotation == 180 ? LCD_HEIGHT : LCD_WIDTH;
+        for (int pass = 0; pass < 3; pass++) {
+            if (pass == 2 && band == NULL) break;
+            int64_t start = esp_timer_get_time();
+            for (int it = 0; it < iterations; it++) {
+                if (pass == 0) {
+                    lvgl_rotate_copy_tiled(src, dst, 0, 0, w - 1, h - 1, w, h, rotation);
+                } else if (pass == 1) {
+                    lvgl_rotate_copy_pixel(src, dst, 0, 0, w - 1, h - 1, w, h, rotation);
+                } else {
+                    for (int y = 0; y < h; y += ROTATE_BENCH_BAND_ROWS) {
+                        int y_end = y + ROTATE_BENCH_BAND_ROWS - 1 < h ? y + ROTATE_BENCH_BAND_ROWS - 1 : h - 1;
+                        lvgl_rotate_copy_band(band, dst, y, y_end, w, h, rotation);
+                    }
+                }
+            }
+            int64_t elapsed = esp_timer_get_time() - start;
+            printf("%3d deg %-12s %.2f MPixels/s (%.1f ms per frame)\n", rotation,
+                   pass == 0 ? "tiled:" : pass == 1 ? "per-pixel:" : "SRAM band:",
+                   (double)w * h * iterations / elapsed, (double)elapsed / iterations / 1000.0);
+        }
+    }
+    printf("\n");
+
+    heap_caps_free(src);
+    heap_caps_free(dst);
+    heap_caps_free(band);
+}
+#endif
+
+#if ENABLE_BLEND_BENCHMARK
+/**
+ * Benchmark flush stand-in: no panel swap, so only rendering is timed
+ */
+static void blend_bench_flush_cb(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t *color_map) {
+    lv_disp_flush_ready(drv);
+}
+
+/**
+ * Benchmark the blend kernels (plain loops vs lvgl_blend) in PSRAM, then full
+ * START and INFO redraws with the draw hooks off and on
+ */
+static void display_blend_benchmark(void) {
+    static const int screens[] = { SCREEN_START, SCREEN_INFO };
+    const int px = LCD_WIDTH * LCD_HEIGHT;
+    const int iterations = 10;
+
+    print_banner_line();
+    print_centered("BLEND BENCHMARK");
+    print_banner_line();
+
+    uint16_t *dst = heap_caps_malloc(px * sizeof(uint16_t), MALLOC_CAP_SPIRAM);
+    uint16_t *src = heap_caps_malloc(px * sizeof(uint16_t), MALLOC_CAP_SPIRAM);
+    uint8_t *mask = heap_caps_malloc(px, MALLOC_CAP_SPIRAM);
+    if (dst == NULL || src == NULL || mask == NULL) {
+        printf("Not enough PSRAM for the %dx%d test buffers\n\n", LCD_WIDTH, LCD_HEIGHT);
+        heap_caps_free(dst);
+        heap_caps_free(src);
+        heap_caps_free(mask);
+        return;
+    }
+    for (int i = 0; i < px; i++) {
+        src[i] = (uint16_t)(i * 2654435761u >> 16);
+        mask[i] = (uint8_t)(((i * 7) >> 3) % 16 * 17);    // 4 bpp glyph levels
+    }
+
+    for (int kernel = 0; kernel < 3; kernel++) {
+        int64_t elapsed[2];
+        for (int pass = 0; pass < 2; pass++) {
+            int64_t start = esp_timer_get_time();
+            for (int it = 0; it < iterations; it++) {
+                if (kernel == 0) {
+                    (pass == 0 ? lvgl_blend_fill_c : lvgl_blend_fill)(dst, LCD_WIDTH, LCD_WIDTH, LCD_HEIGHT, 0x4A69);
+                } else if (kernel == 1) {
+                    (pass == 0 ? lvgl_blend_copy_c : lvgl_blend_copy)(dst, LCD_WIDTH, src, LCD_WIDTH,
+                                                                      LCD_WIDTH, LCD_HEIGHT);
+                } else {
+                    (pass == 0 ? lvgl_blend_fill_a8_c : lvgl_blend_fill_a8)(dst, LCD_WIDTH, mask, LCD_WIDTH,
+                                                                            LCD_WIDTH, LCD_HEIGHT, 0xFFE0);
+                }
+            }
+            elapsed[pass] = esp_timer_get_time() - start;
+        }
+        printf("%-14s %7.2f -> %7.2f MPixels/s\n",
+               kernel == 0 ? "Fill:" : kernel == 1 ? "Image copy:" : "A8 glyph fill:",
+               (double)px * iterations / elapsed[0], (double)px * iterations / elapsed[1]);
+    }
+    heap_caps_free(dst);
+    heap_caps_free(src);
+    heap_caps_free(mask);
+
+    if (!lvgl_lock(1000)) {
+        printf("LVGL busy, screen redraws skipped\n\n");
+        return;
+    }
+    lv_disp_t *disp = lvgl_get_display();
+    lv_obj_t *prev = lv_scr_act();
+    void (*flush_cb)(lv_disp_drv_t *, const lv_area_t *, lv_color_t *) = disp->driver->flush_cb;
+    bool hooks = lvgl_draw_hooks_enabled();
+    disp->driver->flush_cb = blend_bench_flush_cb;
+
+    for (size_t i = 0; i < sizeof(screens) / sizeof(screens[0]); i++) {
+        if (!ui_screen_load(screens[i])) continue;
+        int64_t elapsed[2];
+        for (int pass = 0; pass < 2; pass++) {
+            lvgl_draw_hooks_enable(pass == 1);
+            lv_refr_now(disp);                              // Settle the load
+            int64_t start = esp_timer_get_time();
+            for (int it = 0; it < iterations; it++) {
+                lv_obj_invalidate(lv_scr_act());
+                lv_refr_now(disp);
+            }
+            elapsed[pass] = esp_timer_get_time() - start;
+        }
+        printf("%-14s %7.2f -> %7.2f ms full redraw\n", ui_screen_name(screens[i]),
+               (double)elapsed[0] / iterations / 1000.0, (double)elapsed[1] / iterations / 1000.0);
+    }
+
+    lvgl_draw_hooks_enable(hooks);
+    disp->driver->flush_cb = flush_cb;
+    lv_scr_load(prev);
+    lv_obj_invalidate(prev);
+    lvgl_unlock();
+    printf("(LVGL's plain loops -> lvgl_blend kernels)\n\n");
+}
+#endif
+
+#if ENABLE_RENDER_BENCHMARK
+/**
+ * Run the render benchmark screen (trail, list scroll and screen switch in
+ * direct, partial and full render modes), then print its table
+ */
+static void display_render_benchmark(void) {
+    const int timeout_s = 90;
+
+    print_banner_line();
+    print_centered("RENDER MODE BENCHMARK");
+    print_banner_line();
+
+    lv_obj_t *bench_screen = NULL;
+    if (lvgl_lock(1000)) {
+        bench_screen = ui_render_bench_start();
+        lvgl_unlock();
+    }
+    if (bench_screen == NULL) {
+        printf("Benchmark screen could not be started\n\n");
+        return;
+    }
+
+    bool running = true;
+    for (int waited_ms = 0; running && waited_ms < timeout_s * 1000; waited_ms += 500) {
+        vTaskDelay(pdMS_TO_TICKS(500));
+        if (lvgl_lock(1000)) {
+            running = ui_render_bench_running();
+            lvgl_unlock();
+        }
+    }
+
+    printf("%-14s %-8s %7s %6s %11s\n", "Scene", "Mode", "FPS", "CPU %", "PSRAM MB/s");
+    for (int scene = 0; scene < RENDER_BENCH_SCENE_COUNT; scene++) {
+        for (int mode = 0; mode < LVGL_RENDER_MODE_COUNT; mode++) {
+            render_bench_result_t r;
+            if (!ui_render_bench_get_result((lvgl_render_mode_t)mode, (render_bench_scene_t)scene, &r)) continue;
+            if (r.valid) {
+                printf("%-14s %-8s %7.1f %6.0f %11.1f\n", ui_render_bench_scene_name(scene),
+                       lvgl_render_mode_name(mode), r.fps, r.cpu_pct, r.psram_mbps);
+            } else {
+                printf("%-14s %-8s %7s\n", ui_render_bench_scene_name(scene), lvgl_render_mode_name(mode), "n/a");
+            }
+        }
+    }
+    printf("(CPU: LVGL task on core 1; PSRAM: frame buffer writes and buffer sync, not scan-out)\n\n");
+
+    if (lvgl_lock(1000)) {
+        ui_screen_load(SCREEN_START);
+        lv_obj_del(bench_screen);                   // Stops the run if it timed out
+        lvgl_unlock();
+    }
+}
+#endif
+
 /**
  * Display system status
  */
@@ -439,6 +699,13 @@ void app_main(void)
         ESP_LOGI(TAG, "Cold boot (normal startup)");
     }
 
+    // Initialize anchor watch (drag detection engine)
+    ESP_LOGI(TAG, "Initializing anchor watch...");
+    ret = anchor_watch_init();
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "Anchor watch initialization failed: %s", esp_err_to_name(ret));
+    }
+
     // Initialize RTC (Real-Time Clock)
     ESP_LOGI(TAG, "Initializing RTC (PCF85063A)...");
     PCF85063A_Init();
@@ -554,14 +821,31 @@ void app_main(void)
         return;
     }
 
-    // Register VSYNC callback for frame synchronization (Mode 3)
+    // Register VSYNC callback for frame synchronization (every render mode swaps at VSYNC)
     ret = display_register_vsync_callback();
     if (ret != ESP_OK) {
         ESP_LOGE(TAG, "VSYNC callback registration failed: %s", esp_err_to_name(ret));
         return;
     }
 
-    ESP_LOGI(TAG, "Display and LVGL initialized successfully (Mode 3: Direct-Mode)");
+    ESP_LOGI(TAG, "Display and LVGL initialized successfully (%s render mode)",
+             lvgl_render_mode_name(lvgl_get_render_mode()));
+
+    // Status model before any header subscribes to it
+    if (lvgl_lock(1000)) {
+        ret = ui_status_init();
+        if (ret != ESP_OK) {
+            ESP_LOGE(TAG, "UI status model initialization failed: %s", esp_err_to_name(ret));
+        }
+        ret = ui_screen_mgr_init();
+        if (ret == ESP_OK) {
+            ret = screens_register(footer_page_callback);
+        }
+        lvgl_unlock();
+        if (ret != ESP_OK) {
+            ESP_LOGE(TAG, "Screen manager initialization failed: %s", esp_err_to_name(ret));
+        }
+    }
 
     // Create TV test pattern (custom image)
     ESP_LOGI(TAG, "Creating TV test pattern from image...");
@@ -632,11 +916,11 @@ void app_main(void)
         lv_obj_set_style_text_color(version_label, lv_color_hex(0x666666), 0);  // Gray color
         lv_obj_align(version_label, LV_ALIGN_BOTTOM_RIGHT, -10, -70);  // Bottom right, above footer area
 
-        // Create scrollable footer navigation bar at bottom
-        g_footer = ui_footer_create(splash_screen, PAGE_START, footer_page_callback);
-        if (g_footer == NULL) {
+        // Create the shared scrollable footer (top layer) and show it on the splash
+        if (ui_footer_init(footer_page_callback) == NULL) {
             ESP_LOGE(TAG, "Failed to create footer");
         } else {
+            ui_footer_attach(splash_screen, PAGE_START);
             ESP_LOGI(TAG, "Footer created successfully (scrollable)");
         }
 
@@ -681,20 +965,18 @@ void app_main(void)
     // Create all navigation screens
     ESP_LOGI(TAG, "Creating navigation screens...");
     if (lvgl_lock(2000)) {
-        g_screens[PAGE_START] = create_start_screen(footer_page_callback, &g_footers[PAGE_START]);
-        g_screens[PAGE_INFO] = create_info_screen(footer_page_callback, &g_footers[PAGE_INFO]);
-        g_screens[PAGE_PGN] = create_pgn_screen(footer_page_callback, &g_footers[PAGE_PGN]);
-        g_screens[PAGE_CONFIG] = create_config_screen(footer_page_callback, &g_footers[PAGE_CONFIG]);
-        g_screens[PAGE_UPDATE] = create_update_screen(footer_page_callback, &g_footers[PAGE_UPDATE]);
-        g_screens[PAGE_TOOLS] = create_tools_screen(footer_page_callback, &g_footers[PAGE_TOOLS]);
-
-        // Add gesture detection to all navigation screens
+        // Navigation pages are kept by the screen manager, so gestures are added once;
+        // sub-screens and DISPLAY are built on first use
         for (int i = 0; i < PAGE_COUNT; i++) {
+            lv_obj_t *page_screen = ui_screen_get(i);
+            if (page_screen == NULL) {
+                continue;
+            }
             // Add gesture callbacks directly to the screen (not a separate overlay)
             // This allows gestures to work while still allowing buttons to be clicked
-            lv_obj_add_event_cb(g_screens[i], global_gesture_cb, LV_EVENT_PRESSED, NULL);
-            lv_obj_add_event_cb(g_screens[i], global_gesture_cb, LV_EVENT_PRESSING, NULL);
-            lv_obj_add_event_cb(g_screens[i], global_gesture_cb, LV_EVENT_RELEASED, NULL);
+            lv_obj_add_event_cb(page_screen, global_gesture_cb, LV_EVENT_PRESSED, NULL);
+            lv_obj_add_event_cb(page_screen, global_gesture_cb, LV_EVENT_PRESSING, NULL);
+            lv_obj_add_event_cb(page_screen, global_gesture_cb, LV_EVENT_RELEASED, NULL);
         }
 
         lvgl_unlock();
@@ -703,9 +985,7 @@ void app_main(void)
         // Load the START screen
         ESP_LOGI(TAG, "Loading START screen...");
         if (lvgl_lock(100)) {
-            lv_scr_load(g_screens[PAGE_START]);
-            g_current_page = PAGE_START;
-            g_footer = g_footers[PAGE_START];  // Set footer reference for swipe-up
+            ui_screen_load(SCREEN_START);
             lvgl_unlock();
             ESP_LOGI(TAG, "START screen loaded with swipe-up enabled");
         } else {
@@ -722,6 +1002,18 @@ void app_main(void)
     display_libraries();
     display_pin_allocation();
     display_app_config();
+#if ENABLE_DSP_BENCHMARK
+    display_dsp_benchmark();
+#endif
+#if ENABLE_ROTATE_BENCHMARK
+    display_rotate_benchmark();
+#endif
+#if ENABLE_BLEND_BENCHMARK
+    display_blend_benchmark();
+#endif
+#if ENABLE_RENDER_BENCHMARK
+    display_render_benchmark();
+#endif
     display_system_status();
 
     print_banner_line();
@@ -734,74 +1026,28 @@ void app_main(void)
     ESP_LOGI(TAG, "Display: %dx%d RGB%d", LCD_WIDTH, LCD_HEIGHT, LCD_COLOR_BITS);
     ESP_LOGI(TAG, "Navigation screens ready - use footer buttons to switch between pages");
 
-    // RTC time update task - updates header time displays every second
-    ESP_LOGI(TAG, "Starting RTC time update task...");
-    datetime_t rtc_current;
+    // Status publisher - the UI picks changes up on its next frame, no LVGL lock here.
+    // System time was set from the RTC above (and again when the user sets the clock),
+    // so the clock is read without an I2C transaction.
+    ESP_LOGI(TAG, "Starting status publisher...");
     int update_count = 0;
     while (1) {
-        // Read current time from RTC
-        PCF85063A_Read_now(&rtc_current);
+        time_t now = time(NULL);
+        struct tm now_tm;
+        localtime_r(&now, &now_tm);
+        ui_status_set_time(now_tm.tm_hour, now_tm.tm_min, now_tm.tm_sec);
+
+        anchor_status_t status;
+        anchor_watch_get_status(&status);
+        ui_status_set_flag(UI_STATUS_GPS, status.fix_valid);
+        ui_status_set_flag(UI_STATUS_COMPASS, status.heading_valid);
+        ui_status_set_flag(UI_STATUS_ARMED, status.state != ANCHOR_STATE_OFF);
+        ui_status_set_flag(UI_STATUS_ALARM, status.state == ANCHOR_STATE_ALARM);
+        ui_status_set_flag(UI_STATUS_SD, sd_card_is_mounted());
 
         // Log time every 10 seconds
         if (update_count % 10 == 0) {
-            ESP_LOGI(TAG, "RTC Time: %02d:%02d:%02d", rtc_current.hour, rtc_current.min, rtc_current.sec);
-        }
-
-        // Update header time displays on all screens
-        if (lvgl_lock(50)) {
-            int headers_updated = 0;
-
-            // Update navigation screens (g_screens array)
-            for (int i = 0; i < PAGE_COUNT; i++) {
-                if (g_screens[i] != NULL) {
-                    // Find header in this screen by checking all children
-                    lv_obj_t *screen = g_screens[i];
-                    uint32_t child_count = lv_obj_get_child_cnt(screen);
-
-                    // Search through children to find the header (has valid ui_header_data_t)
-                    for (uint32_t j = 0; j < child_count; j++) {
-                        lv_obj_t *child = lv_obj_get_child(screen, j);
-                        if (child != NULL) {
-                            // Try to update time - function will validate if this is actually a header
-                            if (ui_header_set_time(child, rtc_current.hour, rtc_current.min, rtc_current.sec)) {
-                                headers_updated++;
-                                break;  // Found and updated the header for this screen
-                            }
-                        }
-                    }
-                }
-            }
-
-            // Also update the currently active screen (handles tool screens not in g_screens)
-            lv_obj_t *active_screen = lv_scr_act();
-            if (active_screen != NULL) {
-                uint32_t child_count = lv_obj_get_child_cnt(active_screen);
-                for (uint32_t j = 0; j < child_count; j++) {
-                    lv_obj_t *child = lv_obj_get_child(active_screen, j);
-                    if (child != NULL) {
-                        // Try to update time - function returns true only if this is a valid header
-                        if (ui_header_set_time(child, rtc_current.hour, rtc_current.min, rtc_current.sec)) {
-                            // Don't increment counter if we already updated this screen in g_screens
-                            bool already_counted = false;
-                            for (int i = 0; i < PAGE_COUNT; i++) {
-                                if (g_screens[i] == active_screen) {
-                                    already_counted = true;
-                                    break;
-                                }
-                            }
-                            if (!already_counted) {
-                                headers_updated++;
-                            }
-                            break;
-                        }
-                    }
-                }
-            }
-
-            if (update_count % 10 == 0) {
-                ESP_LOGI(TAG, "Updated %d headers", headers_updated);
-            }
-            lvgl_unlock();
+            ESP_LOGI(TAG, "Time: %02d:%02d:%02d", now_tm.tm_hour, now_tm.tm_min, now_tm.tm_sec);
         }
 
         update_count++;
@@ -4,13 +4,24 @@
  * Author: Colin Bitterfield
  * Email: colin@bitterfield.com
  * Date Created: 2025-12-25
- * Version: 0.2.0
+ * Date Updated: 2026-10-18
+ * Version: 0.3.5
  *
  * Screen creation functions for all app screens
  * Uses centralized ui_theme.h for colors and fonts
+ *
+ * Changelog:
+ * - 0.3.5 (2026-10-18): CONFIGURATION sets the rode length (stored in NVS by the anchor watch)
+ * - 0.3.4 (2026-10-18): DISPLAY draws AIS neighbors in the anchor view instead of a layer over the anchor button
+ * - 0.3.3 (2026-10-18): GPS CALIBRATION shows the source being calibrated
+ * - 0.3.2 (2026-10-18): DISPLAY anchor view moved clear of the anchor button; no rode label when the rode is unknown
+ * - 0.3.1 (2026-10-18): SYSTEM INFO shows frame timing percentiles from lvgl_perf
+ * - 0.3.0 (2026-10-18): Screens built and torn down by ui_screen_mgr; navigation by screen id
  */
 
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 #include <math.h>
 #include "screens.h"
 #include "ui_theme.h"
@@ -20,6 +31,9 @@
 #include "datetime_settings.h"
 #include "power_management.h"
 #include "sd_card.h"
+#include "anchor_watch.h"
+#include "ui_anchor_view.h"
+#include "lvgl_perf.h"
 #include "esp_log.h"
 #include "esp_system.h"
 #include "esp_chip_info.h"
@@ -28,7 +42,7 @@
 
 static const char *TAG = "screens";
 
-// Static storage for page callback (used for START screen button navigation)
+// Footer navigation callback for the page factories (set by screens_register)
 static ui_footer_page_cb_t g_page_callback = NULL;
 
 /**
@@ -47,35 +61,20 @@ static void btn_off_clicked(lv_event_t *e) {
 
 static void btn_ready_clicked(lv_event_t *e) {
     ESP_LOGI(TAG, "READY button clicked - Activating anchor monitoring");
-    // Navigate to DISPLAY screen (main operating screen with footer)
-    if (g_page_callback != NULL) {
-        lv_obj_t *display_screen = create_display_screen(g_page_callback, NULL);
-        lv_scr_load(display_screen);
-    } else {
-        ESP_LOGW(TAG, "Page callback not set, cannot navigate to DISPLAY screen");
-    }
+    // Navigate to DISPLAY screen (main operating screen with footer, built once)
+    ui_screen_load(SCREEN_DISPLAY);
 }
 
 static void btn_info_clicked(lv_event_t *e) {
     ESP_LOGI(TAG, "INFO button clicked - View GPS & Compass details");
     // Navigate to INFO screen (POSITION & NAVIGATION)
-    if (g_page_callback != NULL) {
-        lv_obj_t *info_screen = create_info_screen(g_page_callback, NULL);
-        lv_scr_load(info_screen);
-    } else {
-        ESP_LOGW(TAG, "Page callback not set, cannot navigate to INFO screen");
-    }
+    ui_screen_load(SCREEN_INFO);
 }
 
 static void btn_config_clicked(lv_event_t *e) {
     ESP_LOGI(TAG, "CONFIG button clicked - Configure system settings");
     // Navigate to CONFIG screen
-    if (g_page_callback != NULL) {
-        lv_obj_t *config_screen = create_config_screen(g_page_callback, NULL);
-        lv_scr_load(config_screen);
-    } else {
-        ESP_LOGW(TAG, "Page callback not set, cannot navigate to CONFIG screen");
-    }
+    ui_screen_load(SCREEN_CONFIG);
 }
 
 /**
@@ -114,13 +113,12 @@ static lv_obj_t* create_mode_button(lv_obj_t *parent, const char *icon, const ch
 /**
  * Create a base screen with header, title and footer
  */
-static lv_obj_t* create_base_screen(const char *title, ui_page_t page, ui_footer_page_cb_t page_callback, lv_obj_t **footer_out) {
+static lv_obj_t* create_base_screen(const char *title, ui_page_t page, ui_footer_page_cb_t page_callback) {
     lv_obj_t *screen = lv_obj_create(NULL);
     lv_obj_set_style_bg_color(screen, lv_color_hex(THEME_SCREEN_BG), 0);
 
-    // Create header bar with satellite icon
-    lv_obj_t *header = ui_header_create(screen);
-    ui_header_set_gps_status(header, false);  // Default to GPS not found
+    // Shared header bar (top layer)
+    ui_header_attach(screen);
 
     // Create title label (positioned below header)
     lv_obj_t *title_label = lv_label_create(screen);
@@ -128,36 +126,21 @@ static lv_obj_t* create_base_screen(const char *title, ui_page_t page, ui_footer
     THEME_STYLE_TEXT(title_label, THEME_TITLE_COLOR, FONT_TITLE);
     lv_obj_align(title_label, LV_ALIGN_TOP_MID, 0, HEADER_HEIGHT + SPACING_MARGIN_SMALL);
 
-    // Create footer navigation bar
-    lv_obj_t *footer = ui_footer_create(screen, page, page_callback);
+    // Shared footer (top layer) with this page highlighted
+    ui_footer_attach(screen, page);
 
-    // Ensure footer is visible and in foreground
-    if (footer != NULL) {
-        ui_footer_show(footer);  // Explicitly show the footer
-        lv_obj_move_foreground(footer);  // Bring to front (above all other objects)
-    }
-
-    // Return footer reference
-    if (footer_out != NULL) {
-        *footer_out = footer;
-    }
-
-    ESP_LOGI(TAG, "Created %s screen (page %d) with visible footer", title, page);
+    ESP_LOGI(TAG, "Created %s screen (page %d) with shared footer", title, page);
 
     return screen;
 }
 
-lv_obj_t* create_start_screen(ui_footer_page_cb_t page_callback, lv_obj_t **footer_out) {
-    // Store page callback for button navigation
-    g_page_callback = page_callback;
-
+lv_obj_t* create_start_screen(ui_footer_page_cb_t page_callback) {
     // Create screen with Marine Blue background (per UI spec)
     lv_obj_t *screen = lv_obj_create(NULL);
     lv_obj_set_style_bg_color(screen, lv_color_hex(THEME_START_SCREEN_BG), 0);
 
-    // Create header bar with satellite icon
-    lv_obj_t *header = ui_header_create(screen);
-    ui_header_set_gps_status(header, false);  // Default to GPS not found
+    // Shared header bar (top layer)
+    ui_header_attach(screen);
 
     // Create "SELECT MODE" title (positioned below header)
     lv_obj_t *title_label = lv_label_create(screen);
@@ -185,21 +168,10 @@ lv_obj_t* create_start_screen(ui_footer_page_cb_t page_callback, lv_obj_t **foot
     create_mode_button(screen, "", "CONFIG", "Configure System Settings",
                        COLOR_BTN_CONFIG, btn_config_clicked, 370);
 
-    // Create footer navigation bar
-    lv_obj_t *footer = ui_footer_create(screen, PAGE_START, page_callback);
+    // Shared footer (top layer) with this page highlighted
+    ui_footer_attach(screen, PAGE_START);
 
-    // Ensure footer is visible and in foreground
-    if (footer != NULL) {
-        ui_footer_show(footer);  // Explicitly show the footer
-        lv_obj_move_foreground(footer);  // Bring to front (above all other objects)
-    }
-
-    // Return footer reference
-    if (footer_out != NULL) {
-        *footer_out = footer;
-    }
-
-    ESP_LOGI(TAG, "Created START (Mode Selection) screen with 4 action buttons and visible footer");
+    ESP_LOGI(TAG, "Created START (Mode Selection) screen with 4 action buttons and shared footer");
 
     return screen;
 }
@@ -207,13 +179,12 @@ lv_obj_t* create_start_screen(ui_footer_page_cb_t page_callback, lv_obj_t **foot
 /**
  * INFO SCREEN - Compass & GPS Details
  */
-lv_obj_t* create_info_screen(ui_footer_page_cb_t page_callback, lv_obj_t **footer_out) {
+lv_obj_t* create_info_screen(ui_footer_page_cb_t page_callback) {
     lv_obj_t *screen = lv_obj_create(NULL);
     lv_obj_set_style_bg_color(screen, lv_color_hex(THEME_SCREEN_BG), 0);
 
-    // Create header bar with satellite icon
-    lv_obj_t *header = ui_header_create(screen);
-    ui_header_set_gps_status(header, false);  // Default to GPS not found
+    // Shared header bar (top layer)
+    ui_header_attach(screen);
 
     // Title (positioned below header)
     lv_obj_t *title = lv_label_create(screen);
@@ -255,15 +226,8 @@ lv_obj_t* create_info_screen(ui_footer_page_cb_t page_callback, lv_obj_t **foote
     THEME_STYLE_TEXT(gps_label, COLOR_TEXT_PRIMARY, FONT_BODY_NORMAL);
     lv_obj_align(gps_label, LV_ALIGN_TOP_LEFT, 10, 10);
 
-    // Create footer
-    lv_obj_t *footer = ui_footer_create(screen, PAGE_INFO, page_callback);
-    if (footer != NULL) {
-        ui_footer_show(footer);
-        lv_obj_move_foreground(footer);
-    }
-    if (footer_out != NULL) {
-        *footer_out = footer;
-    }
+    // Shared footer (top layer) with this page highlighted
+    ui_footer_attach(screen, PAGE_INFO);
 
     ESP_LOGI(TAG, "Created INFO screen with GPS and compass data");
     return screen;
@@ -272,13 +236,12 @@ lv_obj_t* create_info_screen(ui_footer_page_cb_t page_callback, lv_obj_t **foote
 /**
  * PGN SCREEN - NMEA 2000 Monitor
  */
-lv_obj_t* create_pgn_screen(ui_footer_page_cb_t page_callback, lv_obj_t **footer_out) {
+lv_obj_t* create_pgn_screen(ui_footer_page_cb_t page_callback) {
     lv_obj_t *screen = lv_obj_create(NULL);
     lv_obj_set_style_bg_color(screen, lv_color_hex(THEME_SCREEN_BG), 0);
 
-    // Create header bar with satellite icon
-    lv_obj_t *header = ui_header_create(screen);
-    ui_header_set_gps_status(header, false);  // Default to GPS not found
+    // Shared header bar (top layer)
+    ui_header_attach(screen);
 
     // Title (positioned below header)
     lv_obj_t *title = lv_label_create(screen);
@@ -312,15 +275,8 @@ lv_obj_t* create_pgn_screen(ui_footer_page_cb_t page_callback, lv_obj_t **footer
     THEME_STYLE_TEXT(msg_label, COLOR_TEXT_PRIMARY, FONT_BODY_NORMAL);
     lv_obj_align(msg_label, LV_ALIGN_TOP_LEFT, 10, 10);
 
-    // Create footer
-    lv_obj_t *footer = ui_footer_create(screen, PAGE_PGN, page_callback);
-    if (footer != NULL) {
-        ui_footer_show(footer);
-        lv_obj_move_foreground(footer);
-    }
-    if (footer_out != NULL) {
-        *footer_out = footer;
-    }
+    // Shared footer (top layer) with this page highlighted
+    ui_footer_attach(screen, PAGE_PGN);
 
     ESP_LOGI(TAG, "Created PGN screen with message monitor");
     return screen;
@@ -340,13 +296,12 @@ static void config_cancel_clicked(lv_event_t *e) {
 /**
  * CONFIG SCREEN - Configuration Settings
  */
-lv_obj_t* create_config_screen(ui_footer_page_cb_t page_callback, lv_obj_t **footer_out) {
+lv_obj_t* create_config_screen(ui_footer_page_cb_t page_callback) {
     lv_obj_t *screen = lv_obj_create(NULL);
     lv_obj_set_style_bg_color(screen, lv_color_hex(THEME_SCREEN_BG), 0);
 
-    // Create header bar with satellite icon
-    lv_obj_t *header = ui_header_create(screen);
-    ui_header_set_gps_status(header, false);  // Default to GPS not found
+    // Shared header bar (top layer)
+    ui_header_attach(screen);
 
     // Title (positioned below header)
     lv_obj_t *title = lv_label_create(screen);
@@ -404,15 +359,8 @@ lv_obj_t* create_config_screen(ui_footer_page_cb_t page_callback, lv_obj_t **foo
     THEME_STYLE_TEXT(cancel_label, COLOR_TEXT_PRIMARY, FONT_BUTTON_SMALL);
     lv_obj_center(cancel_label);
 
-    // Create footer
-    lv_obj_t *footer = ui_footer_create(screen, PAGE_CONFIG, page_callback);
-    if (footer != NULL) {
-        ui_footer_show(footer);
-        lv_obj_move_foreground(footer);
-    }
-    if (footer_out != NULL) {
-        *footer_out = footer;
-    }
+    // Shared footer (top layer) with this page highlighted
+    ui_footer_attach(screen, PAGE_CONFIG);
 
     ESP_LOGI(TAG, "Created CONFIG screen with settings");
     return screen;
@@ -428,13 +376,12 @@ static void update_start_clicked(lv_event_t *e) {
 /**
  * UPDATE SCREEN - Firmware Update
  */
-lv_obj_t* create_update_screen(ui_footer_page_cb_t page_callback, lv_obj_t **footer_out) {
+lv_obj_t* create_update_screen(ui_footer_page_cb_t page_callback) {
     lv_obj_t *screen = lv_obj_create(NULL);
     lv_obj_set_style_bg_color(screen, lv_color_hex(THEME_SCREEN_BG), 0);
 
-    // Create header bar with satellite icon
-    lv_obj_t *header = ui_header_create(screen);
-    ui_header_set_gps_status(header, false);  // Default to GPS not found
+    // Shared header bar (top layer)
+    ui_header_attach(screen);
 
     // Title (positioned below header)
     lv_obj_t *title = lv_label_create(screen);
@@ -478,15 +425,8 @@ lv_obj_t* create_update_screen(ui_footer_page_cb_t page_callback, lv_obj_t **foo
     THEME_STYLE_TEXT(update_btn_label, COLOR_TEXT_PRIMARY, FONT_BUTTON_LARGE);
     lv_obj_center(update_btn_label);
 
-    // Create footer
-    lv_obj_t *footer = ui_footer_create(screen, PAGE_UPDATE, page_callback);
-    if (footer != NULL) {
-        ui_footer_show(footer);
-        lv_obj_move_foreground(footer);
-    }
-    if (footer_out != NULL) {
-        *footer_out = footer;
-    }
+    // Shared footer (top layer) with this page highlighted
+    ui_footer_attach(screen, PAGE_UPDATE);
 
     ESP_LOGI(TAG, "Created UPDATE screen with firmware update");
     return screen;
@@ -495,7 +435,7 @@ lv_obj_t* create_update_screen(ui_footer_page_cb_t page_callback, lv_obj_t **foo
 /**
  * Forward declarations for file browser
  */
-static lv_obj_t* create_file_browser_screen(lv_obj_t *tools_screen_ref);
+static lv_obj_t* create_file_browser_screen(void *ctx);
 
 /**
  * Format confirmation callback
@@ -571,31 +511,25 @@ static void tfcard_contents_clicked(lv_event_t *e) {
         }
     }
 
-    // Open file browser - pass tools screen for back button
-    lv_obj_t *tools_screen = (lv_obj_t *)lv_event_get_user_data(e);
-    lv_obj_t *browser_screen = create_file_browser_screen(tools_screen);
-    lv_scr_load(browser_screen);
+    // Open file browser (rebuilt per visit so the listing is current)
+    ui_screen_load(SCREEN_FILE_BROWSER);
 }
 
 static void tfcard_back_clicked(lv_event_t *e) {
     ESP_LOGI(TAG, "TF CARD: Back to TOOLS");
     // Get tools screen from user data
-    lv_obj_t *tools_screen = (lv_obj_t *)lv_event_get_user_data(e);
-    if (tools_screen != NULL) {
-        lv_scr_load(tools_screen);
-    }
+    ui_screen_load(SCREEN_TOOLS);
 }
 
 /**
  * TF CARD SUBMENU SCREEN
  */
-static lv_obj_t* create_tfcard_screen(lv_obj_t *tools_screen_ref) {
+static lv_obj_t* create_tfcard_screen(void *ctx) {
     lv_obj_t *screen = lv_obj_create(NULL);
     lv_obj_set_style_bg_color(screen, lv_color_hex(THEME_SCREEN_BG), 0);
 
-    // Create header
-    lv_obj_t *header = ui_header_create(screen);
-    ui_header_set_gps_status(header, false);
+    // Shared header bar (top layer)
+    ui_header_attach(screen);
 
     // Title
     lv_obj_t *title = lv_label_create(screen);
@@ -620,7 +554,7 @@ static lv_obj_t* create_tfcard_screen(lv_obj_t *tools_screen_ref) {
     lv_obj_set_size(contents_btn, 300, 80);
     lv_obj_align(contents_btn, LV_ALIGN_CENTER, 0, 40);
     THEME_STYLE_BUTTON(contents_btn, THEME_BTN_PRIMARY);
-    lv_obj_add_event_cb(contents_btn, tfcard_contents_clicked, LV_EVENT_CLICKED, tools_screen_ref);
+    lv_obj_add_event_cb(contents_btn, tfcard_contents_clicked, LV_EVENT_CLICKED, NULL);
 
     lv_obj_t *contents_label = lv_label_create(contents_btn);
     lv_label_set_text(contents_label, "SHOW CONTENTS");
@@ -632,7 +566,7 @@ static lv_obj_t* create_tfcard_screen(lv_obj_t *tools_screen_ref) {
     lv_obj_set_size(back_btn, 200, 60);
     lv_obj_align(back_btn, LV_ALIGN_BOTTOM_MID, 0, -20);
     THEME_STYLE_BUTTON(back_btn, COLOR_BTN_CONFIG);
-    lv_obj_add_event_cb(back_btn, tfcard_back_clicked, LV_EVENT_CLICKED, tools_screen_ref);
+    lv_obj_add_event_cb(back_btn, tfcard_back_clicked, LV_EVENT_CLICKED, NULL);
 
     lv_obj_t *back_label = lv_label_create(back_btn);
     lv_label_set_text(back_label, "BACK TO TOOLS");
@@ -648,19 +582,16 @@ static lv_obj_t* create_tfcard_screen(lv_obj_t *tools_screen_ref) {
  */
 static void browser_back_clicked(lv_event_t *e) {
     ESP_LOGI(TAG, "FILE BROWSER: Back clicked");
-    // Get tools screen from user data and return to TF Card menu
-    lv_obj_t *tools_screen = (lv_obj_t *)lv_event_get_user_data(e);
-    lv_obj_t *tfcard_screen = create_tfcard_screen(tools_screen);
-    lv_scr_load(tfcard_screen);
+    // Return to the TF Card menu (reused, not rebuilt)
+    ui_screen_load(SCREEN_TFCARD);
 }
 
-static lv_obj_t* create_file_browser_screen(lv_obj_t *tools_screen_ref) {
+static lv_obj_t* create_file_browser_screen(void *ctx) {
     lv_obj_t *screen = lv_obj_create(NULL);
     lv_obj_set_style_bg_color(screen, lv_color_hex(THEME_SCREEN_BG), 0);
 
-    // Create header
-    lv_obj_t *header = ui_header_create(screen);
-    ui_header_set_gps_status(header, false);
+    // Shared header bar (top layer)
+    ui_header_attach(screen);
 
     // Title
     lv_obj_t *title = lv_label_create(screen);
@@ -733,7 +664,7 @@ static lv_obj_t* create_file_browser_screen(lv_obj_t *tools_screen_ref) {
     lv_obj_set_size(back_btn, 200, 60);
     lv_obj_align(back_btn, LV_ALIGN_BOTTOM_MID, 0, -20);
     THEME_STYLE_BUTTON(back_btn, COLOR_BTN_CONFIG);
-    lv_obj_add_event_cb(back_btn, browser_back_clicked, LV_EVENT_CLICKED, tools_screen_ref);
+    lv_obj_add_event_cb(back_btn, browser_back_clicked, LV_EVENT_CLICKED, NULL);
 
     lv_obj_t *back_label = lv_label_create(back_btn);
     lv_label_set_text(back_label, "BACK");
@@ -747,89 +678,79 @@ static lv_obj_t* create_file_browser_screen(lv_obj_t *tools_screen_ref) {
 /**
  * Forward declarations for tool screen creation functions
  */
-static lv_obj_t* create_sysinfo_screen(lv_obj_t *tools_screen_ref);
-static lv_obj_t* create_test_hardware_screen(lv_obj_t *tools_screen_ref);
-static lv_obj_t* create_logs_menu_screen(lv_obj_t *tools_screen_ref);
-static lv_obj_t* create_view_logs_screen(lv_obj_t *tools_screen_ref);
-static lv_obj_t* create_clear_logs_screen(lv_obj_t *tools_screen_ref);
-static lv_obj_t* create_set_log_level_screen(lv_obj_t *tools_screen_ref);
-static lv_obj_t* create_clear_gps_screen(lv_obj_t *tools_screen_ref);
-static lv_obj_t* create_system_config_screen(lv_obj_t *tools_screen_ref);
-static lv_obj_t* create_wifi_bluetooth_screen(lv_obj_t *tools_screen_ref);
-static lv_obj_t* create_save_config_screen(lv_obj_t *tools_screen_ref);
-static lv_obj_t* create_load_config_screen(lv_obj_t *tools_screen_ref);
-static lv_obj_t* create_factory_reset_screen(lv_obj_t *tools_screen_ref);
+static lv_obj_t* create_sysinfo_screen(void *ctx);
+static lv_obj_t* create_test_hardware_screen(void *ctx);
+static lv_obj_t* create_logs_menu_screen(void *ctx);
+static lv_obj_t* create_view_logs_screen(void *ctx);
+static lv_obj_t* create_clear_logs_screen(void *ctx);
+static lv_obj_t* create_set_log_level_screen(void *ctx);
+static lv_obj_t* create_clear_gps_screen(void *ctx);
+static lv_obj_t* create_system_config_screen(void *ctx);
+static lv_obj_t* create_wifi_bluetooth_screen(void *ctx);
+static lv_obj_t* create_save_config_screen(void *ctx);
+static lv_obj_t* create_load_config_screen(void *ctx);
+static lv_obj_t* create_factory_reset_screen(void *ctx);
+static lv_obj_t* create_calibrate_screen(void *ctx);
+static lv_obj_t* create_geofence_screen(void *ctx);
 
 /**
  * Button callbacks for TOOLS screen
  */
 static void tools_tfcard_clicked(lv_event_t *e) {
     ESP_LOGI(TAG, "TOOLS: TF Card clicked - opening TF Card submenu");
-    lv_obj_t *tools_screen = lv_scr_act();  // Get current (tools) screen
-    lv_obj_t *tfcard_screen = create_tfcard_screen(tools_screen);
-    lv_scr_load(tfcard_screen);
+    ui_screen_load(SCREEN_TFCARD);
 }
 
 static void tools_logs_clicked(lv_event_t *e) {
     ESP_LOGI(TAG, "TOOLS: Logs clicked");
-    lv_obj_t *tools_screen = lv_scr_act();
-    lv_obj_t *logs_menu_screen = create_logs_menu_screen(tools_screen);
-    lv_scr_load(logs_menu_screen);
+    ui_screen_load(SCREEN_LOGS_MENU);
 }
 
 static void tools_clear_clicked(lv_event_t *e) {
     ESP_LOGI(TAG, "TOOLS: Clear GPS Tracks clicked");
-    lv_obj_t *tools_screen = lv_scr_act();
-    lv_obj_t *clear_screen = create_clear_gps_screen(tools_screen);
-    lv_scr_load(clear_screen);
+    ui_screen_load(SCREEN_CLEAR_GPS);
 }
 
 static void tools_config_clicked(lv_event_t *e) {
     ESP_LOGI(TAG, "TOOLS: Configuration clicked");
-    lv_obj_t *tools_screen = lv_scr_act();
-    lv_obj_t *config_screen = create_system_config_screen(tools_screen);
-    lv_scr_load(config_screen);
+    ui_screen_load(SCREEN_SYSTEM_CONFIG);
 }
 
 static void tools_wifi_bt_clicked(lv_event_t *e) {
     ESP_LOGI(TAG, "TOOLS: WiFi/Bluetooth clicked");
-    lv_obj_t *tools_screen = lv_scr_act();
-    lv_obj_t *wifi_bt_screen = create_wifi_bluetooth_screen(tools_screen);
-    lv_scr_load(wifi_bt_screen);
+    ui_screen_load(SCREEN_WIFI_BT);
 }
 
 static void tools_sysinfo_clicked(lv_event_t *e) {
     ESP_LOGI(TAG, "TOOLS: System Info clicked");
-    lv_obj_t *tools_screen = lv_scr_act();
-    lv_obj_t *sysinfo_screen = create_sysinfo_screen(tools_screen);
-    lv_scr_load(sysinfo_screen);
+    ui_screen_load(SCREEN_SYSINFO);
 }
 
 static void tools_test_clicked(lv_event_t *e) {
     ESP_LOGI(TAG, "TOOLS: Test Hardware clicked");
-    lv_obj_t *tools_screen = lv_scr_act();
-    lv_obj_t *test_screen = create_test_hardware_screen(tools_screen);
-    lv_scr_load(test_screen);
+    ui_screen_load(SCREEN_TEST_HARDWARE);
+}
+
+static void tools_calibrate_clicked(lv_event_t *e) {
+    ESP_LOGI(TAG, "TOOLS: GPS Calibrate clicked");
+    ui_screen_load(SCREEN_CALIBRATE);
+}
+
+static void tools_geofence_clicked(lv_event_t *e) {
+    ESP_LOGI(TAG, "TOOLS: Geofence clicked");
+    ui_screen_load(SCREEN_GEOFENCE);
 }
 
 // Removed tools_load_config_clicked - consolidated with tools_config_clicked
 
 static void tools_reset_clicked(lv_event_t *e) {
     ESP_LOGI(TAG, "TOOLS: Factory Reset clicked");
-    lv_obj_t *tools_screen = lv_scr_act();
-    lv_obj_t *reset_screen = create_factory_reset_screen(tools_screen);
-    lv_scr_load(reset_screen);
+    ui_screen_load(SCREEN_FACTORY_RESET);
 }
 
 static void tools_datetime_clicked(lv_event_t *e) {
     ESP_LOGI(TAG, "TOOLS: Date/Time Settings clicked - opening datetime settings screen");
-
-    // Get current tools screen for back button
-    lv_obj_t *tools_screen = lv_scr_act();
-
-    // Create and load datetime settings screen
-    lv_obj_t *datetime_screen = create_datetime_settings_screen(tools_screen, NULL, NULL);
-    lv_scr_load(datetime_screen);
+    ui_screen_load(SCREEN_DATETIME);
 }
 
 /**
@@ -855,19 +776,74 @@ static lv_obj_t* create_tool_button(lv_obj_t *parent, const char *label, int x,
  * SYSTEM INFO SCREEN - Display system information
  */
 static void sysinfo_back_clicked(lv_event_t *e) {
-    lv_obj_t *tools_screen = (lv_obj_t *)lv_event_get_user_data(e);
-    if (tools_screen != NULL) {
-        lv_scr_load(tools_screen);
+    ui_screen_load(SCREEN_TOOLS);
+}
+
+typedef struct {
+    lv_obj_t *perf_label;
+    lv_timer_t *timer;
+    lvgl_perf_window_t shown;       // Window on screen (redraw only when a new one closes)
+} sysinfo_live_t;
+
+/**
+ * Format p50 / p95 / p99 / max of one metric, scaled down by div
+ */
+static void sysinfo_format_metric(char *buf, size_t len, lvgl_perf_metric_t metric,
+                                  const lvgl_perf_hist_t *hist, float div) {
+    snprintf(buf, len, "%.1f / %.1f / %.1f / %.1f",
+             lvgl_perf_percentile(metric, hist, 50) / div,
+             lvgl_perf_percentile(metric, hist, 95) / div,
+             lvgl_perf_percentile(metric, hist, 99) / div,
+             hist->max / div);
+}
+
+static void sysinfo_perf_timer_cb(lv_timer_t *timer) {
+    sysinfo_live_t *live = (sysinfo_live_t *)timer->user_data;
+    lvgl_perf_window_t window;
+
+    if (!lvgl_perf_get_window(&window)) {
+        lv_label_set_text(live->perf_label, "FRAME TIMING\nCollecting first window...");
+        return;
+    }
+    if (memcmp(&window, &live->shown, sizeof(window)) == 0) return;
+    live->shown = window;
+
+    char render[40], vsync[40], handler[40], area[40];
+    sysinfo_format_metric(render, sizeof(render), LVGL_PERF_RENDER,
+                          &window.hist[LVGL_PERF_RENDER], 1000.0f);
+    sysinfo_format_metric(vsync, sizeof(vsync), LVGL_PERF_VSYNC_WAIT,
+                          &window.hist[LVGL_PERF_VSYNC_WAIT], 1000.0f);
+    sysinfo_format_metric(handler, sizeof(handler), LVGL_PERF_HANDLER,
+                          &window.hist[LVGL_PERF_HANDLER], 1000.0f);
+    sysinfo_format_metric(area, sizeof(area), LVGL_PERF_FLUSH_AREA,
+                          &window.hist[LVGL_PERF_FLUSH_AREA], 1000.0f);
+
+    lv_label_set_text_fmt(live->perf_label,
+                          "FRAME TIMING (LAST %u S)\n"
+                          "p50 / p95 / p99 / max\n"
+                          "Render ms:  %s\n"
+                          "VSYNC ms:  %s\n"
+                          "Handler ms:  %s\n"
+                          "Area kpx:  %s\n"
+                          "%.1f fps, %u samples dropped",
+                          (unsigned int)(window.window_ms / 1000), render, vsync, handler, area,
+                          window.frames * 1000.0f / window.window_ms, (unsigned int)window.dropped);
+}
+
+static void sysinfo_delete_cb(lv_event_t *e) {
+    sysinfo_live_t *live = (sysinfo_live_t *)lv_event_get_user_data(e);
+    if (live != NULL) {
+        lv_timer_del(live->timer);
+        free(live);
     }
 }
 
-static lv_obj_t* create_sysinfo_screen(lv_obj_t *tools_screen_ref) {
+static lv_obj_t* create_sysinfo_screen(void *ctx) {
     lv_obj_t *screen = lv_obj_create(NULL);
     lv_obj_set_style_bg_color(screen, lv_color_hex(THEME_SCREEN_BG), 0);
 
-    // Create header
-    lv_obj_t *header = ui_header_create(screen);
-    ui_header_set_gps_status(header, false);
+    // Shared header bar (top layer)
+    ui_header_attach(screen);
 
     // Title
     lv_obj_t *title = lv_label_create(screen);
@@ -881,6 +857,18 @@ static lv_obj_t* create_sysinfo_screen(lv_obj_t *tools_screen_ref) {
     uint32_t flash_size;
     esp_flash_get_size(NULL, &flash_size);
 
+    // Screens alive (dumped to the console per screen)
+    ui_screen_log_stats();
+    uint32_t screens_alive = 0;
+    int32_t screens_bytes = 0;
+    for (int id = 0; id < SCREEN_COUNT; id++) {
+        ui_screen_stats_t stats;
+        if (ui_screen_get_stats(id, &stats) && stats.alive) {
+            screens_alive++;
+            screens_bytes += stats.heap_bytes;
+        }
+    }
+
     // Info text area
     lv_obj_t *info_label = lv_label_create(screen);
     char info_text[512];
@@ -891,10 +879,11 @@ static lv_obj_t* create_sysinfo_screen(lv_obj_t *tools_screen_ref) {
         "Chip:              %s Rev %d\n"
         "Cores:             %d\n"
         "Flash:             %u MB %s\n"
-        "PSRAM:             %s\n\n"
+        "PSRAM:             %s\n"
         "Free Heap:         %u KB\n"
         "Min Free Heap:     %u KB\n"
-        "PSRAM Free:        %u KB",
+        "PSRAM Free:        %u KB\n"
+        "Screens Alive:     %u (%ld KB)",
         FW_VERSION_STRING,
         UI_VERSION_STRING,
         esp_get_idf_version(),
@@ -906,7 +895,8 @@ static lv_obj_t* create_sysinfo_screen(lv_obj_t *tools_screen_ref) {
         (chip_info.features & CHIP_FEATURE_EMB_PSRAM) ? "Yes" : "No",
         (unsigned int)(esp_get_free_heap_size() / 1024),
         (unsigned int)(esp_get_minimum_free_heap_size() / 1024),
-        (unsigned int)(heap_caps_get_free_size(MALLOC_CAP_SPIRAM) / 1024));
+        (unsigned int)(heap_caps_get_free_size(MALLOC_CAP_SPIRAM) / 1024),
+        (unsigned int)screens_alive, (long)(screens_bytes / 1024));
 
     lv_label_set_text(info_label, info_text);
     lv_obj_set_style_text_color(info_label, lv_color_white(), 0);
@@ -918,13 +908,550 @@ static lv_obj_t* create_sysinfo_screen(lv_obj_t *tools_screen_ref) {
     lv_obj_set_size(back_btn, 150, 50);
     lv_obj_align(back_btn, LV_ALIGN_BOTTOM_LEFT, 30, -20);
     THEME_STYLE_BUTTON(back_btn, THEME_BTN_CANCEL);
-    lv_obj_add_event_cb(back_btn, sysinfo_back_clicked, LV_EVENT_CLICKED, tools_screen_ref);
+    lv_obj_add_event_cb(back_btn, sysinfo_back_clicked, LV_EVENT_CLICKED, NULL);
 
     lv_obj_t *back_label = lv_label_create(back_btn);
     lv_label_set_text(back_label, "BACK");
     THEME_STYLE_TEXT(back_label, COLOR_TEXT_PRIMARY, FONT_BUTTON_LARGE);
     lv_obj_center(back_label);
 
+    // Frame timing percentiles (right side, refreshed as each window closes)
+    lv_obj_t *perf_panel = lv_obj_create(screen);
+    lv_obj_set_size(perf_panel, 330, 200);
+    lv_obj_align(perf_panel, LV_ALIGN_TOP_RIGHT, -15, HEADER_HEIGHT + 60);
+    THEME_STYLE_PANEL(perf_panel, THEME_PANEL_BG_DARK);
+    lv_obj_clear_flag(perf_panel, LV_OBJ_FLAG_SCROLLABLE);
+
+    lv_obj_t *perf_label = lv_label_create(perf_panel);
+    lv_label_set_text(perf_label, "");
+    lv_obj_set_style_text_color(perf_label, lv_color_white(), 0);
+    lv_obj_set_style_text_font(perf_label, &lv_font_montserrat_14, 0);  // Fits the table beside the info text
+    lv_obj_align(perf_label, LV_ALIGN_TOP_LEFT, 0, 0);
+
+    sysinfo_live_t *live = calloc(1, sizeof(sysinfo_live_t));
+    if (live != NULL) {
+        live->perf_label = perf_label;
+        live->timer = lv_timer_create(sysinfo_perf_timer_cb, 1000, live);
+        lv_obj_add_event_cb(screen, sysinfo_delete_cb, LV_EVENT_DELETE, live);
+        sysinfo_perf_timer_cb(live->timer);
+    } else {
+        ESP_LOGE(TAG, "Failed to allocate SYSINFO live data");
+    }
+
+    return screen;
+}
+
+/**
+ * GPS CALIBRATE SCREEN - "Calibrate at dock" noise characterization
+ */
+typedef struct {
+    lv_obj_t *info_label;
+    lv_obj_t *start_label;
+    lv_timer_t *timer;
+} calibrate_live_t;
+
+static const char *calibrate_source_names[ANCHOR_SOURCE_COUNT] = {
+    "NMEA 2000", "NMEA 0183", "External GPS"
+};
+
+static void calibrate_live_timer_cb(lv_timer_t *timer) {
+    calibrate_live_t *live = (calibrate_live_t *)timer->user_data;
+    anchor_status_t status;
+    anchor_watch_get_status(&status);
+
+    // A calibration stays on the source it started with, even if another takes over
+    anchor_source_t source = status.calibrating ? status.calib_source : status.source;
+    noise_profile_t profile;
+    bool have = anchor_watch_get_noise_profile(source, &profile);
+
+    char profile_text[160] = "No profile - default thresholds in use";
+    if (have) {
+        snprintf(profile_text, sizeof(profile_text),
+                 "Scatter (95%%):     %.1f ft\n"
+                 "Best averaging:    %.0f s\n"
+                 "Min safe radius:   %.0f ft",
+                 profile.radius95_m / GEO_FEET_TO_METERS,
+                 profile.tau_best_s,
+                 profile.min_radius_m / GEO_FEET_TO_METERS);
+    }
+
+    if (status.calibrating) {
+        lv_label_set_text_fmt(live->info_label,
+                              "Source:            %s\n"
+                              "Calibrating...     %u%%\n\n%s",
+                              calibrate_source_names[source],
+                              (unsigned int)status.calib_percent, profile_text);
+        lv_label_set_text(live->start_label, "CANCEL");
+    } else {
+        lv_label_set_text_fmt(live->info_label,
+                              "Source:            %s\n"
+                              "Keep the boat made fast for %d min.\n\n%s",
+                              calibrate_source_names[source],
+                              CALIBRATION_DEFAULT_MINUTES, profile_text);
+        lv_label_set_text(live->start_label, "START");
+    }
+}
+
+static void calibrate_delete_cb(lv_event_t *e) {
+    calibrate_live_t *live = (calibrate_live_t *)lv_event_get_user_data(e);
+    if (live != NULL) {
+        lv_timer_del(live->timer);
+        free(live);
+    }
+}
+
+static void calibrate_start_clicked(lv_event_t *e) {
+    anchor_status_t status;
+    anchor_watch_get_status(&status);
+
+    if (status.calibrating) {
+        anchor_watch_calibrate_cancel();
+        ESP_LOGI(TAG, "GPS calibration cancelled");
+    } else if (anchor_watch_calibrate_start(CALIBRATION_DEFAULT_MINUTES) != ESP_OK) {
+        ESP_LOGW(TAG, "GPS calibration not started - stop the anchor watch first");
+    }
+
+    calibrate_live_t *live = (calibrate_live_t *)lv_event_get_user_data(e);
+    if (live != NULL) {
+        calibrate_live_timer_cb(live->timer);
+    }
+}
+
+static void calibrate_back_clicked(lv_event_t *e) {
+    // Volatile screen: the manager deletes it once TOOLS is loaded, stopping its timer
+    ui_screen_load(SCREEN_TOOLS);
+}
+
+static lv_obj_t* create_calibrate_screen(void *ctx) {
+    lv_obj_t *screen = lv_obj_create(NULL);
+    lv_obj_set_style_bg_color(screen, lv_color_hex(THEME_SCREEN_BG), 0);
+
+    // Shared header bar (top layer)
+    ui_header_attach(screen);
+
+    // Title
+    lv_obj_t *title = lv_label_create(screen);
+    lv_label_set_text(title, "GPS CALIBRATION");
+    THEME_STYLE_TEXT(title, THEME_TITLE_COLOR, FONT_TITLE);
+    lv_obj_align(title, LV_ALIGN_TOP_MID, 0, HEADER_HEIGHT + SPACING_MARGIN_SMALL);
+
+    // Status text (refreshed once per second)
+    lv_obj_t *info_label = lv_label_create(screen);
+    lv_label_set_text(info_label, "");
+    lv_obj_set_style_text_color(info_label, lv_color_white(), 0);
+    lv_obj_set_style_text_font(info_label, FONT_BODY_LARGE, 0);
+    lv_obj_align(info_label, LV_ALIGN_TOP_LEFT, 30, HEADER_HEIGHT + 60);
+
+    // START / CANCEL button
+    lv_obj_t *start_btn = lv_btn_create(screen);
+    lv_obj_set_size(start_btn, 250, 60);
+    lv_obj_align(start_btn, LV_ALIGN_BOTTOM_MID, 0, -80);
+    THEME_STYLE_BUTTON(start_btn, THEME_BTN_PRIMARY);
+
+    lv_obj_t *start_label = lv_label_create(start_btn);
+    lv_label_set_text(start_label, "START");
+    THEME_STYLE_TEXT(start_label, COLOR_TEXT_PRIMARY, FONT_BUTTON_LARGE);
+    lv_obj_center(start_label);
+
+    // Back button
+    lv_obj_t *back_btn = lv_btn_create(screen);
+    lv_obj_set_size(back_btn, 150, 50);
+    lv_obj_align(back_btn, LV_ALIGN_BOTTOM_LEFT, 30, -20);
+    THEME_STYLE_BUTTON(back_btn, THEME_BTN_CANCEL);
+    lv_obj_add_event_cb(back_btn, calibrate_back_clicked, LV_EVENT_CLICKED, NULL);
+
+    lv_obj_t *back_label = lv_label_create(back_btn);
+    lv_label_set_text(back_label, "BACK");
+    THEME_STYLE_TEXT(back_label, COLOR_TEXT_PRIMARY, FONT_BUTTON_LARGE);
+    lv_obj_center(back_label);
+
+    // Live refresh from the anchor watch
+    calibrate_live_t *live = malloc(sizeof(calibrate_live_t));
+    if (live != NULL) {
+        live->info_label = info_label;
+        live->start_label = start_label;
+        live->timer = lv_timer_create(calibrate_live_timer_cb, 1000, live);
+        lv_obj_add_event_cb(screen, calibrate_delete_cb, LV_EVENT_DELETE, live);
+        lv_obj_add_event_cb(start_btn, calibrate_start_clicked, LV_EVENT_CLICKED, live);
+        calibrate_live_timer_cb(live->timer);
+    } else {
+        ESP_LOGE(TAG, "Failed to allocate GPS calibration live data");
+    }
+
+    return screen;
+}
+
+/**
+ * GEOFENCE SCREEN - Draw exclusion / keep-in zones around the anchor
+ *
+ * Zones are drawn in the anchor watch's geofence frame (centred on the anchor,
+ * or the boat when the first zone is drawn before anchoring). North is up.
+ * POLYGON: tap the vertices, then DONE. SECTOR: tap the inner edge at the
+ * start bearing, then the outer edge at the end bearing (clockwise).
+ */
+#define GEOFENCE_EDIT_W         440     // Plot size (pixels)
+#define GEOFENCE_EDIT_H         300
+#define GEOFENCE_EDIT_PTS       (GEOFENCE_MAX_VERTICES + 1)
+#define GEOFENCE_EDIT_ARC_STEPS 24      // Points per sector arc
+
+typedef enum {
+    GEOFENCE_EDIT_IDLE = 0,
+    GEOFENCE_EDIT_POLYGON,
+    GEOFENCE_EDIT_SECTOR
+} geofence_edit_mode_t;
+
+static const float geofence_edit_scales[] = { 0.25f, 0.5f, 1.0f, 2.0f };  // Metres per pixel
+
+typedef struct {
+    lv_obj_t *plot;
+    lv_obj_t *info_label;
+    lv_obj_t *kind_label;
+    lv_obj_t *boat_dot;
+    lv_obj_t *draft_line;
+    lv_obj_t *zone_lines[GEOFENCE_MAX_ZONES];
+    lv_point_t zone_pts[GEOFENCE_MAX_ZONES][GEOFENCE_EDIT_PTS];
+    lv_point_t draft_pts[GEOFENCE_EDIT_PTS];
+    geofence_def_t draft;
+    geo_ref_t frame;
+    bool frame_valid;
+    geofence_edit_mode_t mode;
+    bool sector_first_set;
+    geofence_pt_t sector_first;
+    uint8_t kind;
+    uint8_t scale;
+    lv_timer_t *timer;
+} geofence_edit_t;
+
+static void geofence_edit_to_px(const geofence_edit_t *ed, float x, float y, lv_point_t *p) {
+    float m_per_px = geofence_edit_scales[ed->scale];
+    p->x = (lv_coord_t)lroundf(GEOFENCE_EDIT_W / 2 + x / m_per_px);
+    p->y = (lv_coord_t)lroundf(GEOFENCE_EDIT_H / 2 - y / m_per_px);
+}
+
+/**
+ * Outline of a zone as a closed polyline (sector: outer arc, then inner arc back)
+ */
+static uint16_t geofence_edit_outline(const geofence_edit_t *ed, const geofence_def_t *def,
+                                      lv_point_t *pts) {
+    uint16_t n = 0;
+    if (def->type == GEOFENCE_POLYGON) {
+        for (int i = 0; i < def->n; i++) {
+            geofence_edit_to_px(ed, def->v[i].x, def->v[i].y, &pts[n++]);
+        }
+    } else {
+        for (int pass = 0; pass < 2; pass++) {
+            float r = (pass == 0) ? def->r_out_m : def->r_in_m;
+            for (int i = 0; i <= GEOFENCE_EDIT_ARC_STEPS; i++) {
+                float s = (pass == 0) ? i : GEOFENCE_EDIT_ARC_STEPS - i;
+                float a = (def->start_deg + def->sweep_deg * s / GEOFENCE_EDIT_ARC_STEPS) *
+                          (float)M_PI / 180.0f;
+                geofence_edit_to_px(ed, def->center.x + r * sinf(a),
+                                    def->center.y + r * cosf(a), &pts[n++]);
+            }
+        }
+    }
+    if (n > 0) {
+        pts[n] = pts[0];
+        n++;
+    }
+    return n;
+}
+
+/**
+ * Rebuild every zone outline (after add/delete/zoom)
+ */
+static void geofence_edit_redraw(geofence_edit_t *ed) {
+    int count = anchor_watch_geofence_count();
+    for (int z = 0; z < GEOFENCE_MAX_ZONES; z++) {
+        geofence_def_t def;
+        if (z < count && anchor_watch_geofence_get(z, &def)) {
+            uint16_t n = geofence_edit_outline(ed, &def, ed->zone_pts[z]);
+            lv_line_set_points(ed->zone_lines[z], ed->zone_pts[z], n);
+            lv_obj_set_style_line_color(ed->zone_lines[z],
+                                        lv_color_hex(def.kind == GEOFENCE_KEEP_IN ? COLOR_SUCCESS
+                                                                                   : COLOR_WARNING), 0);
+            lv_obj_clear_flag(ed->zone_lines[z], LV_OBJ_FLAG_HIDDEN);
+        } else {
+            lv_obj_add_flag(ed->zone_lines[z], LV_OBJ_FLAG_HIDDEN);
+        }
+    }
+
+    uint16_t n = 0;
+    for (int i = 0; ed->mode == GEOFENCE_EDIT_POLYGON && i < ed->draft.n; i++) {
+        geofence_edit_to_px(ed, ed->draft.v[i].x, ed->draft.v[i].y, &ed->draft_pts[n++]);
+    }
+    lv_line_set_points(ed->draft_line, ed->draft_pts, n);
+}
+
+static void geofence_edit_timer_cb(lv_timer_t *timer) {
+    geofence_edit_t *ed = (geofence_edit_t *)timer->user_data;
+    anchor_status_t status;
+    anchor_watch_get_status(&status);
+
+    if (!ed->frame_valid) {
+        ed->frame_valid = anchor_watch_geofence_origin(&ed->frame);
+        if (ed->frame_valid) {
+            geofence_edit_redraw(ed);
+        }
+    }
+
+    // Boat position and violated zones
+    if (ed->frame_valid && status.fix_valid) {
+        float x, y;
+        lv_point_t p;
+        geo_to_enu(&ed->frame, status.lat, status.lon, &x, &y);
+        geofence_edit_to_px(ed, x, y, &p);
+        lv_obj_set_pos(ed->boat_dot, p.x - 5, p.y - 5);
+        lv_obj_clear_flag(ed->boat_dot, LV_OBJ_FLAG_HIDDEN);
+    } else {
+        lv_obj_add_flag(ed->boat_dot, LV_OBJ_FLAG_HIDDEN);
+    }
+    for (int z = 0; z < status.geofence_count && z < GEOFENCE_MAX_ZONES; z++) {
+        lv_obj_set_style_line_width(ed->zone_lines[z], (status.geofence_hits & (1u << z)) ? 5 : 2, 0);
+    }
+
+    const char *mode_text = "Tap POLYGON or SECTOR";
+    char draft_text[40];
+    if (!ed->frame_valid) {
+        mode_text = "Waiting for GPS fix";
+    } else if (ed->mode == GEOFENCE_EDIT_POLYGON) {
+        snprintf(draft_text, sizeof(draft_text), "Polygon: %u pts", (unsigned int)ed->draft.n);
+        mode_text = draft_text;
+    } else if (ed->mode == GEOFENCE_EDIT_SECTOR) {
+        mode_text = ed->sector_first_set ? "Tap outer edge / end" : "Tap inner edge / start";
+    }
+    lv_label_set_text_fmt(ed->info_label, "Zones: %u/%d  %s\n%s\nScale: %d ft across",
+                          (unsigned int)status.geofence_count, GEOFENCE_MAX_ZONES,
+                          status.geofence_hits ? "ALARM" : "",
+                          mode_text,
+                          (int)lroundf(GEOFENCE_EDIT_W * geofence_edit_scales[ed->scale] /
+                                       GEO_FEET_TO_METERS));
+    lv_label_set_text(ed->kind_label, ed->kind == GEOFENCE_KEEP_IN ? "KEEP-IN" : "EXCLUDE");
+}
+
+static void geofence_edit_delete_cb(lv_event_t *e) {
+    geofence_edit_t *ed = (geofence_edit_t *)lv_event_get_user_data(e);
+    if (ed != NULL) {
+        lv_timer_del(ed->timer);
+        free(ed);
+    }
+}
+
+static void geofence_edit_add(geofence_edit_t *ed, geofence_def_t *def) {
+    def->kind = ed->kind;
+    def->enabled = true;
+    snprintf(def->name, sizeof(def->name), "Zone %d", anchor_watch_geofence_count() + 1);
+    if (anchor_watch_geofence_add(def) >= 0) {
+        ESP_LOGI(TAG, "GEOFENCE: added %s", def->name);
+    }
+}
+
+static void geofence_plot_clicked(lv_event_t *e) {
+    geofence_edit_t *ed = (geofence_edit_t *)lv_event_get_user_data(e);
+    lv_indev_t *indev = lv_indev_get_act();
+    if (ed == NULL || indev == NULL || !ed->frame_valid || ed->mode == GEOFENCE_EDIT_IDLE) {
+        return;
+    }
+
+    lv_point_t p;
+    lv_area_t area;
+    lv_indev_get_point(indev, &p);
+    lv_obj_get_content_coords(ed->plot, &area);
+    float m_per_px = geofence_edit_scales[ed->scale];
+    geofence_pt_t pt = {
+        .x = (p.x - area.x1 - GEOFENCE_EDIT_W / 2) * m_per_px,
+        .y = (GEOFENCE_EDIT_H / 2 - (p.y - area.y1)) * m_per_px,
+    };
+
+    if (ed->mode == GEOFENCE_EDIT_POLYGON) {
+        if (ed->draft.n < GEOFENCE_MAX_VERTICES) {
+            ed->draft.v[ed->draft.n++] = pt;
+        }
+    } else if (!ed->sector_first_set) {
+        ed->sector_first = pt;
+        ed->sector_first_set = true;
+    } else {
+        // Radii and bearings from the frame origin (the anchor)
+        float r0 = sqrtf(ed->sector_first.x * ed->sector_first.x + ed->sector_first.y * ed->sector_first.y);
+        float r1 = sqrtf(pt.x * pt.x + pt.y * pt.y);
+        float b0 = atan2f(ed->sector_first.x, ed->sector_first.y) * 180.0f / (float)M_PI;
+        float b1 = atan2f(pt.x, pt.y) * 180.0f / (float)M_PI;
+        float sweep = fmodf(b1 - b0 + 720.0f, 360.0f);
+
+        geofence_def_t def = {
+            .type = GEOFENCE_SECTOR,
+            .r_in_m = fminf(r0, r1),
+            .r_out_m = fmaxf(r0, r1),
+            .start_deg = fmodf(b0 + 360.0f, 360.0f),
+            .sweep_deg = (sweep < 1.0f) ? 360.0f : sweep,
+        };
+        geofence_edit_add(ed, &def);
+        ed->mode = GEOFENCE_EDIT_IDLE;
+        ed->sector_first_set = false;
+    }
+    geofence_edit_redraw(ed);
+    geofence_edit_timer_cb(ed->timer);
+}
+
+static void geofence_polygon_clicked(lv_event_t *e) {
+    geofence_edit_t *ed = (geofence_edit_t *)lv_event_get_user_data(e);
+    memset(&ed->draft, 0, sizeof(ed->draft));
+    ed->draft.type = GEOFENCE_POLYGON;
+    ed->mode = GEOFENCE_EDIT_POLYGON;
+    geofence_edit_redraw(ed);
+    geofence_edit_timer_cb(ed->timer);
+}
+
+static void geofence_sector_clicked(lv_event_t *e) {
+    geofence_edit_t *ed = (geofence_edit_t *)lv_event_get_user_data(e);
+    ed->mode = GEOFENCE_EDIT_SECTOR;
+    ed->sector_first_set = false;
+    geofence_edit_redraw(ed);
+    geofence_edit_timer_cb(ed->timer);
+}
+
+static void geofence_done_clicked(lv_event_t *e) {
+    geofence_edit_t *ed = (geofence_edit_t *)lv_event_get_user_data(e);
+    if (ed->mode == GEOFENCE_EDIT_POLYGON && ed->draft.n >= 3) {
+        geofence_edit_add(ed, &ed->draft);
+    }
+    ed->mode = GEOFENCE_EDIT_IDLE;
+    ed->sector_first_set = false;
+    geofence_edit_redraw(ed);
+    geofence_edit_timer_cb(ed->timer);
+}
+
+static void geofence_kind_clicked(lv_event_t *e) {
+    geofence_edit_t *ed = (geofence_edit_t *)lv_event_get_user_data(e);
+    ed->kind = (ed->kind == GEOFENCE_KEEP_IN) ? GEOFENCE_EXCLUDE : GEOFENCE_KEEP_IN;
+    geofence_edit_timer_cb(ed->timer);
+}
+
+static void geofence_delete_clicked(lv_event_t *e) {
+    geofence_edit_t *ed = (geofence_edit_t *)lv_event_get_user_data(e);
+    int count = anchor_watch_geofence_count();
+    if (count > 0) {
+        anchor_watch_geofence_remove(count - 1);
+    }
+    geofence_edit_redraw(ed);
+    geofence_edit_timer_cb(ed->timer);
+}
+
+static void geofence_zoom_clicked(lv_event_t *e) {
+    geofence_edit_t *ed = (geofence_edit_t *)lv_event_get_user_data(e);
+    int scales = sizeof(geofence_edit_scales) / sizeof(geofence_edit_scales[0]);
+    ed->scale = (uint8_t)((ed->scale + 1) % scales);
+    geofence_edit_redraw(ed);
+    geofence_edit_timer_cb(ed->timer);
+}
+
+static void geofence_save_clicked(lv_event_t *e) {
+    if (anchor_watch_geofence_save() != ESP_OK) {
+        ESP_LOGW(TAG, "GEOFENCE: save failed");
+    }
+}
+
+static void geofence_back_clicked(lv_event_t *e) {
+    // Volatile screen: the manager deletes it once TOOLS is loaded, stopping its timer
+    ui_screen_load(SCREEN_TOOLS);
+}
+
+/**
+ * Create an editor button; returns its label so the text can change
+ */
+static lv_obj_t* create_geofence_button(lv_obj_t *parent, const char *text, int col, int row,
+                                        uint32_t color, lv_event_cb_t callback, void *user_data) {
+    lv_obj_t *btn = lv_btn_create(parent);
+    lv_obj_set_size(btn, 140, 50);
+    lv_obj_set_pos(btn, 490 + col * 150, HEADER_HEIGHT + 45 + row * 60);
+    THEME_STYLE_BUTTON(btn, color);
+    lv_obj_add_event_cb(btn, callback, LV_EVENT_CLICKED, user_data);
+
+    lv_obj_t *label = lv_label_create(btn);
+    lv_label_set_text(label, text);
+    THEME_STYLE_TEXT(label, COLOR_TEXT_PRIMARY, FONT_BUTTON_SMALL);
+    lv_obj_center(label);
+    return label;
+}
+
+static lv_obj_t* create_geofence_screen(void *ctx) {
+    lv_obj_t *screen = lv_obj_create(NULL);
+    lv_obj_set_style_bg_color(screen, lv_color_hex(THEME_SCREEN_BG), 0);
+
+    // Shared header bar (top layer)
+    ui_header_attach(screen);
+
+    // Title
+    lv_obj_t *title = lv_label_create(screen);
+    lv_label_set_text(title, "GEOFENCES");
+    THEME_STYLE_TEXT(title, THEME_TITLE_COLOR, FONT_TITLE);
+    lv_obj_align(title, LV_ALIGN_TOP_MID, 0, HEADER_HEIGHT + SPACING_MARGIN_SMALL);
+
+    geofence_edit_t *ed = calloc(1, sizeof(geofence_edit_t));
+    if (ed == NULL) {
+        ESP_LOGE(TAG, "Failed to allocate geofence editor");
+        return screen;
+    }
+    ed->kind = GEOFENCE_EXCLUDE;
+    ed->scale = 1;
+
+    // Plot (north up, frame origin at the centre)
+    ed->plot = lv_obj_create(screen);
+    lv_obj_set_size(ed->plot, GEOFENCE_EDIT_W, GEOFENCE_EDIT_H);
+    lv_obj_set_pos(ed->plot, 20, HEADER_HEIGHT + 45);
+    lv_obj_set_style_bg_color(ed->plot, lv_color_hex(THEME_PANEL_BG_DARK), 0);
+    lv_obj_set_style_border_color(ed->plot, lv_color_hex(THEME_PANEL_BORDER), 0);
+    lv_obj_set_style_border_width(ed->plot, BORDER_WIDTH_THIN, 0);
+    lv_obj_set_style_border_post(ed->plot, true, 0);
+    lv_obj_set_style_pad_all(ed->plot, 0, 0);
+    lv_obj_set_style_radius(ed->plot, 0, 0);
+    lv_obj_clear_flag(ed->plot, LV_OBJ_FLAG_SCROLLABLE);
+    lv_obj_add_event_cb(ed->plot, geofence_plot_clicked, LV_EVENT_CLICKED, ed);
+
+    lv_obj_t *anchor_mark = lv_label_create(ed->plot);
+    lv_label_set_text(anchor_mark, "+");
+    lv_obj_set_style_text_color(anchor_mark, lv_color_white(), 0);
+    lv_obj_align(anchor_mark, LV_ALIGN_CENTER, 0, 0);
+
+    for (int z = 0; z < GEOFENCE_MAX_ZONES; z++) {
+        ed->zone_lines[z] = lv_line_create(ed->plot);
+        lv_obj_set_style_line_width(ed->zone_lines[z], 2, 0);
+        lv_obj_add_flag(ed->zone_lines[z], LV_OBJ_FLAG_HIDDEN);
+    }
+    ed->draft_line = lv_line_create(ed->plot);
+    lv_obj_set_style_line_width(ed->draft_line, 2, 0);
+    lv_obj_set_style_line_color(ed->draft_line, lv_color_white(), 0);
+
+    ed->boat_dot = lv_obj_create(ed->plot);
+    lv_obj_set_size(ed->boat_dot, 10, 10);
+    lv_obj_set_style_radius(ed->boat_dot, LV_RADIUS_CIRCLE, 0);
+    lv_obj_set_style_bg_color(ed->boat_dot, lv_color_hex(COLOR_PRIMARY_LIGHT), 0);
+    lv_obj_set_style_border_width(ed->boat_dot, 0, 0);
+    lv_obj_clear_flag(ed->boat_dot, LV_OBJ_FLAG_CLICKABLE);
+    lv_obj_add_flag(ed->boat_dot, LV_OBJ_FLAG_HIDDEN);
+
+    // Editing buttons (two columns to the right of the plot)
+    create_geofence_button(screen, "POLYGON", 0, 0, THEME_BTN_PRIMARY, geofence_polygon_clicked, ed);
+    create_geofence_button(screen, "SECTOR", 1, 0, THEME_BTN_PRIMARY, geofence_sector_clicked, ed);
+    create_geofence_button(screen, "DONE", 0, 1, THEME_BTN_SUCCESS, geofence_done_clicked, ed);
+    ed->kind_label = create_geofence_button(screen, "EXCLUDE", 1, 1, THEME_BTN_PRIMARY,
+                                            geofence_kind_clicked, ed);
+    create_geofence_button(screen, "DELETE", 0, 2, THEME_BTN_DANGER, geofence_delete_clicked, ed);
+    create_geofence_button(screen, "ZOOM", 1, 2, THEME_BTN_PRIMARY, geofence_zoom_clicked, ed);
+    create_geofence_button(screen, "SAVE", 0, 3, THEME_BTN_SUCCESS, geofence_save_clicked, ed);
+    create_geofence_button(screen, "BACK", 1, 3, THEME_BTN_CANCEL, geofence_back_clicked, NULL);
+
+    // Status text (refreshed once per second)
+    ed->info_label = lv_label_create(screen);
+    lv_label_set_text(ed->info_label, "");
+    lv_obj_set_style_text_color(ed->info_label, lv_color_white(), 0);
+    lv_obj_set_style_text_font(ed->info_label, &lv_font_montserrat_14, 0);
+    lv_obj_set_pos(ed->info_label, 490, HEADER_HEIGHT + 45 + 4 * 60);
+
+    ed->timer = lv_timer_create(geofence_edit_timer_cb, 1000, ed);
+    lv_obj_add_event_cb(screen, geofence_edit_delete_cb, LV_EVENT_DELETE, ed);
+    geofence_edit_timer_cb(ed->timer);
+
     return screen;
 }
 
@@ -932,19 +1459,15 @@ static lv_obj_t* create_sysinfo_screen(lv_obj_t *tools_screen_ref) {
  * TEST HARDWARE SCREEN - Hardware test utilities
  */
 static void test_hw_back_clicked(lv_event_t *e) {
-    lv_obj_t *tools_screen = (lv_obj_t *)lv_event_get_user_data(e);
-    if (tools_screen != NULL) {
-        lv_scr_load(tools_screen);
-    }
+    ui_screen_load(SCREEN_TOOLS);
 }
 
-static lv_obj_t* create_test_hardware_screen(lv_obj_t *tools_screen_ref) {
+static lv_obj_t* create_test_hardware_screen(void *ctx) {
     lv_obj_t *screen = lv_obj_create(NULL);
     lv_obj_set_style_bg_color(screen, lv_color_hex(THEME_SCREEN_BG), 0);
 
-    // Create header
-    lv_obj_t *header = ui_header_create(screen);
-    ui_header_set_gps_status(header, false);
+    // Shared header bar (top layer)
+    ui_header_attach(screen);
 
     // Title
     lv_obj_t *title = lv_label_create(screen);
@@ -969,7 +1492,7 @@ static lv_obj_t* create_test_hardware_screen(lv_obj_t *tools_screen_ref) {
     lv_obj_set_size(back_btn, 150, 50);
     lv_obj_align(back_btn, LV_ALIGN_BOTTOM_LEFT, 30, -20);
     THEME_STYLE_BUTTON(back_btn, THEME_BTN_CANCEL);
-    lv_obj_add_event_cb(back_btn, test_hw_back_clicked, LV_EVENT_CLICKED, tools_screen_ref);
+    lv_obj_add_event_cb(back_btn, test_hw_back_clicked, LV_EVENT_CLICKED, NULL);
 
     lv_obj_t *back_label = lv_label_create(back_btn);
     lv_label_set_text(back_label, "BACK");
@@ -985,39 +1508,29 @@ static lv_obj_t* create_test_hardware_screen(lv_obj_t *tools_screen_ref) {
 
 static void logs_menu_view_clicked(lv_event_t *e) {
     ESP_LOGI(TAG, "LOGS MENU: View Logs clicked");
-    lv_obj_t *logs_menu_screen = lv_scr_act();
-    lv_obj_t *view_screen = create_view_logs_screen(logs_menu_screen);
-    lv_scr_load(view_screen);
+    ui_screen_load(SCREEN_VIEW_LOGS);
 }
 
 static void logs_menu_clear_clicked(lv_event_t *e) {
     ESP_LOGI(TAG, "LOGS MENU: Clear Logs clicked");
-    lv_obj_t *logs_menu_screen = lv_scr_act();
-    lv_obj_t *clear_screen = create_clear_logs_screen(logs_menu_screen);
-    lv_scr_load(clear_screen);
+    ui_screen_load(SCREEN_CLEAR_LOGS);
 }
 
 static void logs_menu_level_clicked(lv_event_t *e) {
     ESP_LOGI(TAG, "LOGS MENU: Set Log Level clicked");
-    lv_obj_t *logs_menu_screen = lv_scr_act();
-    lv_obj_t *level_screen = create_set_log_level_screen(logs_menu_screen);
-    lv_scr_load(level_screen);
+    ui_screen_load(SCREEN_LOG_LEVEL);
 }
 
 static void logs_menu_back_clicked(lv_event_t *e) {
-    lv_obj_t *tools_screen = (lv_obj_t *)lv_event_get_user_data(e);
-    if (tools_screen != NULL) {
-        lv_scr_load(tools_screen);
-    }
+    ui_screen_load(SCREEN_TOOLS);
 }
 
-static lv_obj_t* create_logs_menu_screen(lv_obj_t *tools_screen_ref) {
+static lv_obj_t* create_logs_menu_screen(void *ctx) {
     lv_obj_t *screen = lv_obj_create(NULL);
     lv_obj_set_style_bg_color(screen, lv_color_hex(THEME_SCREEN_BG), 0);
 
-    // Create header
-    lv_obj_t *header = ui_header_create(screen);
-    ui_header_set_gps_status(header, false);
+    // Shared header bar (top layer)
+    ui_header_attach(screen);
 
     // Title
     lv_obj_t *title = lv_label_create(screen);
@@ -1072,7 +1585,7 @@ static lv_obj_t* create_logs_menu_screen(lv_obj_t *tools_screen_ref) {
     lv_obj_set_size(back_btn, 150, 50);
     lv_obj_align(back_btn, LV_ALIGN_BOTTOM_LEFT, 30, -20);
     THEME_STYLE_BUTTON(back_btn, THEME_BTN_CANCEL);
-    lv_obj_add_event_cb(back_btn, logs_menu_back_clicked, LV_EVENT_CLICKED, tools_screen_ref);
+    lv_obj_add_event_cb(back_btn, logs_menu_back_clicked, LV_EVENT_CLICKED, NULL);
 
     lv_obj_t *back_label = lv_label_create(back_btn);
     lv_label_set_text(back_label, "BACK");
@@ -1086,19 +1599,15 @@ static lv_obj_t* create_logs_menu_screen(lv_obj_t *tools_screen_ref) {
  * VIEW LOGS SCREEN - Display recent log entries
  */
 static void view_logs_back_clicked(lv_event_t *e) {
-    lv_obj_t *logs_menu_screen = (lv_obj_t *)lv_event_get_user_data(e);
-    if (logs_menu_screen != NULL) {
-        lv_scr_load(logs_menu_screen);
-    }
+    ui_screen_load(SCREEN_LOGS_MENU);
 }
 
-static lv_obj_t* create_view_logs_screen(lv_obj_t *logs_menu_ref) {
+static lv_obj_t* create_view_logs_screen(void *ctx) {
     lv_obj_t *screen = lv_obj_create(NULL);
     lv_obj_set_style_bg_color(screen, lv_color_hex(THEME_SCREEN_BG), 0);
 
-    // Create header
-    lv_obj_t *header = ui_header_create(screen);
-    ui_header_set_gps_status(header, false);
+    // Shared header bar (top layer)
+    ui_header_attach(screen);
 
     // Title
     lv_obj_t *title = lv_label_create(screen);
@@ -1120,7 +1629,7 @@ static lv_obj_t* create_view_logs_screen(lv_obj_t *logs_menu_ref) {
     lv_obj_set_size(back_btn, 150, 50);
     lv_obj_align(back_btn, LV_ALIGN_BOTTOM_LEFT, 30, -20);
     THEME_STYLE_BUTTON(back_btn, THEME_BTN_CANCEL);
-    lv_obj_add_event_cb(back_btn, view_logs_back_clicked, LV_EVENT_CLICKED, logs_menu_ref);
+    lv_obj_add_event_cb(back_btn, view_logs_back_clicked, LV_EVENT_CLICKED, NULL);
 
     lv_obj_t *back_label = lv_label_create(back_btn);
     lv_label_set_text(back_label, "BACK");
@@ -1134,10 +1643,7 @@ static lv_obj_t* create_view_logs_screen(lv_obj_t *logs_menu_ref) {
  * CLEAR LOGS SCREEN - Confirmation dialog for clearing all logs
  */
 static void clear_logs_back_clicked(lv_event_t *e) {
-    lv_obj_t *logs_menu_screen = (lv_obj_t *)lv_event_get_user_data(e);
-    if (logs_menu_screen != NULL) {
-        lv_scr_load(logs_menu_screen);
-    }
+    ui_screen_load(SCREEN_LOGS_MENU);
 }
 
 static void clear_logs_confirm_clicked(lv_event_t *e) {
@@ -1146,19 +1652,15 @@ static void clear_logs_confirm_clicked(lv_event_t *e) {
     // - Clear log files from SD card
     // - Clear in-memory log buffer
     // - Reset log file counter
-    lv_obj_t *logs_menu_screen = (lv_obj_t *)lv_event_get_user_data(e);
-    if (logs_menu_screen != NULL) {
-        lv_scr_load(logs_menu_screen);
-    }
+    ui_screen_load(SCREEN_LOGS_MENU);
 }
 
-static lv_obj_t* create_clear_logs_screen(lv_obj_t *logs_menu_ref) {
+static lv_obj_t* create_clear_logs_screen(void *ctx) {
     lv_obj_t *screen = lv_obj_create(NULL);
     lv_obj_set_style_bg_color(screen, lv_color_hex(THEME_SCREEN_BG), 0);
 
-    // Create header
-    lv_obj_t *header = ui_header_create(screen);
-    ui_header_set_gps_status(header, false);
+    // Shared header bar (top layer)
+    ui_header_attach(screen);
 
     // Title
     lv_obj_t *title = lv_label_create(screen);
@@ -1180,7 +1682,7 @@ static lv_obj_t* create_clear_logs_screen(lv_obj_t *logs_menu_ref) {
     lv_obj_set_size(clear_btn, 250, 60);
     lv_obj_align(clear_btn, LV_ALIGN_BOTTOM_MID, 0, -80);
     THEME_STYLE_BUTTON(clear_btn, THEME_BTN_DANGER);
-    lv_obj_add_event_cb(clear_btn, clear_logs_confirm_clicked, LV_EVENT_CLICKED, logs_menu_ref);
+    lv_obj_add_event_cb(clear_btn, clear_logs_confirm_clicked, LV_EVENT_CLICKED, NULL);
 
     lv_obj_t *clear_label = lv_label_create(clear_btn);
     lv_label_set_text(clear_label, "CLEAR ALL LOGS");
@@ -1192,7 +1694,7 @@ static lv_obj_t* create_clear_logs_screen(lv_obj_t *logs_menu_ref) {
     lv_obj_set_size(back_btn, 150, 50);
     lv_obj_align(back_btn, LV_ALIGN_BOTTOM_LEFT, 30, -20);
     THEME_STYLE_BUTTON(back_btn, THEME_BTN_CANCEL);
-    lv_obj_add_event_cb(back_btn, clear_logs_back_clicked, LV_EVENT_CLICKED, logs_menu_ref);
+    lv_obj_add_event_cb(back_btn, clear_logs_back_clicked, LV_EVENT_CLICKED, NULL);
 
     lv_obj_t *back_label = lv_label_create(back_btn);
     lv_label_set_text(back_label, "BACK");
@@ -1208,10 +1710,7 @@ static lv_obj_t* create_clear_logs_screen(lv_obj_t *logs_menu_ref) {
 static esp_log_level_t current_log_level = ESP_LOG_INFO;  // Default log level
 
 static void log_level_back_clicked(lv_event_t *e) {
-    lv_obj_t *logs_menu_screen = (lv_obj_t *)lv_event_get_user_data(e);
-    if (logs_menu_screen != NULL) {
-        lv_scr_load(logs_menu_screen);
-    }
+    ui_screen_load(SCREEN_LOGS_MENU);
 }
 
 static void log_level_button_clicked(lv_event_t *e) {
@@ -1224,13 +1723,12 @@ static void log_level_button_clicked(lv_event_t *e) {
     }
 }
 
-static lv_obj_t* create_set_log_level_screen(lv_obj_t *logs_menu_ref) {
+static lv_obj_t* create_set_log_level_screen(void *ctx) {
     lv_obj_t *screen = lv_obj_create(NULL);
     lv_obj_set_style_bg_color(screen, lv_color_hex(THEME_SCREEN_BG), 0);
 
-    // Create header
-    lv_obj_t *header = ui_header_create(screen);
-    ui_header_set_gps_status(header, false);
+    // Shared header bar (top layer)
+    ui_header_attach(screen);
 
     // Title
     lv_obj_t *title = lv_label_create(screen);
@@ -1302,7 +1800,7 @@ static lv_obj_t* create_set_log_level_screen(lv_obj_t *logs_menu_ref) {
     lv_obj_set_size(back_btn, 150, 50);
     lv_obj_align(back_btn, LV_ALIGN_BOTTOM_LEFT, 30, -20);
     THEME_STYLE_BUTTON(back_btn, THEME_BTN_CANCEL);
-    lv_obj_add_event_cb(back_btn, log_level_back_clicked, LV_EVENT_CLICKED, logs_menu_ref);
+    lv_obj_add_event_cb(back_btn, log_level_back_clicked, LV_EVENT_CLICKED, NULL);
 
     lv_obj_t *back_label = lv_label_create(back_btn);
     lv_label_set_text(back_label, "BACK");
@@ -1316,28 +1814,21 @@ static lv_obj_t* create_set_log_level_screen(lv_obj_t *logs_menu_ref) {
  * CLEAR GPS TRACK SCREEN - Confirmation dialog
  */
 static void clear_gps_back_clicked(lv_event_t *e) {
-    lv_obj_t *tools_screen = (lv_obj_t *)lv_event_get_user_data(e);
-    if (tools_screen != NULL) {
-        lv_scr_load(tools_screen);
-    }
+    ui_screen_load(SCREEN_TOOLS);
 }
 
 static void clear_gps_confirm_clicked(lv_event_t *e) {
     ESP_LOGI(TAG, "GPS Track cleared");
     // TODO: Implement GPS track clearing
-    lv_obj_t *tools_screen = (lv_obj_t *)lv_event_get_user_data(e);
-    if (tools_screen != NULL) {
-        lv_scr_load(tools_screen);
-    }
+    ui_screen_load(SCREEN_TOOLS);
 }
 
-static lv_obj_t* create_clear_gps_screen(lv_obj_t *tools_screen_ref) {
+static lv_obj_t* create_clear_gps_screen(void *ctx) {
     lv_obj_t *screen = lv_obj_create(NULL);
     lv_obj_set_style_bg_color(screen, lv_color_hex(THEME_SCREEN_BG), 0);
 
-    // Create header
-    lv_obj_t *header = ui_header_create(screen);
-    ui_header_set_gps_status(header, false);
+    // Shared header bar (top layer)
+    ui_header_attach(screen);
 
     // Title
     lv_obj_t *title = lv_label_create(screen);
@@ -1360,7 +1851,7 @@ static lv_obj_t* create_clear_gps_screen(lv_obj_t *tools_screen_ref) {
     lv_obj_set_size(confirm_btn, 150, 50);
     lv_obj_align(confirm_btn, LV_ALIGN_BOTTOM_RIGHT, -30, -20);
     lv_obj_set_style_bg_color(confirm_btn, lv_color_hex(0xFF3333), 0);
-    lv_obj_add_event_cb(confirm_btn, clear_gps_confirm_clicked, LV_EVENT_CLICKED, tools_screen_ref);
+    lv_obj_add_event_cb(confirm_btn, clear_gps_confirm_clicked, LV_EVENT_CLICKED, NULL);
 
     lv_obj_t *confirm_label = lv_label_create(confirm_btn);
     lv_label_set_text(confirm_label, "CLEAR");
@@ -1372,7 +1863,7 @@ static lv_obj_t* create_clear_gps_screen(lv_obj_t *tools_screen_ref) {
     lv_obj_set_size(cancel_btn, 150, 50);
     lv_obj_align(cancel_btn, LV_ALIGN_BOTTOM_LEFT, 30, -20);
     THEME_STYLE_BUTTON(cancel_btn, THEME_BTN_CANCEL);
-    lv_obj_add_event_cb(cancel_btn, clear_gps_back_clicked, LV_EVENT_CLICKED, tools_screen_ref);
+    lv_obj_add_event_cb(cancel_btn, clear_gps_back_clicked, LV_EVENT_CLICKED, NULL);
 
     lv_obj_t *cancel_label = lv_label_create(cancel_btn);
     lv_label_set_text(cancel_label, "CANCEL");
@@ -1387,19 +1878,15 @@ static lv_obj_t* create_clear_gps_screen(lv_obj_t *tools_screen_ref) {
  */
 
 static void wifi_bt_back_clicked(lv_event_t *e) {
-    lv_obj_t *tools_screen = (lv_obj_t *)lv_event_get_user_data(e);
-    if (tools_screen != NULL) {
-        lv_scr_load(tools_screen);
-    }
+    ui_screen_load(SCREEN_TOOLS);
 }
 
-static lv_obj_t* create_wifi_bluetooth_screen(lv_obj_t *tools_screen_ref) {
+static lv_obj_t* create_wifi_bluetooth_screen(void *ctx) {
     lv_obj_t *screen = lv_obj_create(NULL);
     lv_obj_set_style_bg_color(screen, lv_color_hex(THEME_SCREEN_BG), 0);
 
-    // Create header
-    lv_obj_t *header = ui_header_create(screen);
-    ui_header_set_gps_status(header, false);
+    // Shared header bar (top layer)
+    ui_header_attach(screen);
 
     // Title
     lv_obj_t *title = lv_label_create(screen);
@@ -1424,7 +1911,7 @@ static lv_obj_t* create_wifi_bluetooth_screen(lv_obj_t *tools_screen_ref) {
     lv_obj_set_size(back_btn, 150, 50);
     lv_obj_align(back_btn, LV_ALIGN_BOTTOM_LEFT, 30, -20);
     THEME_STYLE_BUTTON(back_btn, THEME_BTN_CANCEL);
-    lv_obj_add_event_cb(back_btn, wifi_bt_back_clicked, LV_EVENT_CLICKED, tools_screen_ref);
+    lv_obj_add_event_cb(back_btn, wifi_bt_back_clicked, LV_EVENT_CLICKED, NULL);
 
     lv_obj_t *back_label = lv_label_create(back_btn);
     lv_label_set_text(back_label, "BACK");
@@ -1443,6 +1930,7 @@ static lv_obj_t *cfg_boat_name_ta;
 static lv_obj_t *cfg_distance_slider;
 static lv_obj_t *cfg_distance_label;
 static lv_obj_t *cfg_units_dropdown;
+static lv_obj_t *cfg_rode_ta;
 static lv_obj_t *cfg_gps_device_id_ta;
 static lv_obj_t *cfg_gps_pgn_dropdown;
 static lv_obj_t *cfg_compass_device_id_ta;
@@ -1480,7 +1968,20 @@ static void config_save_nvs_clicked(lv_event_t *e) {
     ESP_LOGI(TAG, "Compass Device ID: %s, PGN sel: %d", compass_device_id, compass_pgn_sel);
     ESP_LOGI(TAG, "Logger: %s, Freq: %s, Unit: %d", logger_enabled ? "ON" : "OFF", logger_freq, logger_unit_sel);
 
-    // TODO: Save to NVS
+    // Rode length feeds the scope radius (stored by the anchor watch)
+    int rode_m = atoi(lv_textarea_get_text(cfg_rode_ta));
+    esp_err_t err = anchor_watch_set_rode_length((float)rode_m);
+    if (err != ESP_OK) {
+        char msg[80];
+        snprintf(msg, sizeof(msg), "Rode length must be 0 (unknown)\nor %d-%d m",
+                 RODE_LENGTH_MIN_M, RODE_LENGTH_MAX_M);
+        lv_obj_t *mbox = lv_msgbox_create(lv_scr_act(), "Error",
+            err == ESP_ERR_INVALID_ARG ? msg : "Failed to save rode length", NULL, true);
+        lv_obj_center(mbox);
+        return;
+    }
+
+    // TODO: Save the remaining settings to NVS
     lv_obj_t *mbox = lv_msgbox_create(lv_scr_act(), "Saved",
         "Configuration saved to NVS", NULL, true);
     lv_obj_center(mbox);
@@ -1507,19 +2008,15 @@ static void config_save_sd_clicked(lv_event_t *e) {
 // Cancel callback
 static void system_config_cancel_clicked(lv_event_t *e) {
     ESP_LOGI(TAG, "System CONFIG: Cancel clicked");
-    lv_obj_t *tools_screen = (lv_obj_t *)lv_event_get_user_data(e);
-    if (tools_screen != NULL) {
-        lv_scr_load(tools_screen);
-    }
+    ui_screen_load(SCREEN_TOOLS);
 }
 
-static lv_obj_t* create_system_config_screen(lv_obj_t *tools_screen_ref) {
+static lv_obj_t* create_system_config_screen(void *ctx) {
     lv_obj_t *screen = lv_obj_create(NULL);
     lv_obj_set_style_bg_color(screen, lv_color_hex(THEME_SCREEN_BG), 0);
 
-    // Create header
-    lv_obj_t *header = ui_header_create(screen);
-    ui_header_set_gps_status(header, false);
+    // Shared header bar (top layer)
+    ui_header_attach(screen);
 
     // Title
     lv_obj_t *title = lv_label_create(screen);
@@ -1573,6 +2070,23 @@ static lv_obj_t* create_system_config_screen(lv_obj_t *tools_screen_ref) {
     lv_dropdown_set_selected(cfg_units_dropdown, 0);  // Feet
     lv_obj_set_width(cfg_units_dropdown, 200);
 
+    // Rode length (scope radius follows the tide when known)
+    lv_obj_t *rode_label = lv_label_create(cont);
+    lv_label_set_text(rode_label, "Rode Length (m, 0 = unknown):");
+    lv_obj_set_style_text_color(rode_label, lv_color_white(), 0);
+
+    anchor_status_t status;
+    anchor_watch_get_status(&status);
+    cfg_rode_ta = lv_textarea_create(cont);
+    lv_textarea_set_one_line(cfg_rode_ta, true);
+    lv_textarea_set_max_length(cfg_rode_ta, 3);
+    lv_textarea_set_placeholder_text(cfg_rode_ta, "0-300");
+    char rode_buf[8];
+    snprintf(rode_buf, sizeof(rode_buf), "%d", (int)lroundf(status.rode_m));
+    lv_textarea_set_text(cfg_rode_ta, rode_buf);
+    lv_obj_set_width(cfg_rode_ta, 100);
+    lv_textarea_set_accepted_chars(cfg_rode_ta, "0123456789");
+
     // 3. GPS Device ID and PGN
     lv_obj_t *gps_label = lv_label_create(cont);
     lv_label_set_text(gps_label, "GPS Device ID:");
@@ -1688,7 +2202,7 @@ static lv_obj_t* create_system_config_screen(lv_obj_t *tools_screen_ref) {
     lv_obj_set_size(cancel_btn, btn_width, 50);
     lv_obj_set_pos(cancel_btn, start_x + (btn_width + btn_spacing) * 3, btn_y);
     THEME_STYLE_BUTTON(cancel_btn, THEME_BTN_CANCEL);
-    lv_obj_add_event_cb(cancel_btn, system_config_cancel_clicked, LV_EVENT_CLICKED, tools_screen_ref);
+    lv_obj_add_event_cb(cancel_btn, system_config_cancel_clicked, LV_EVENT_CLICKED, NULL);
 
     lv_obj_t *cancel_label = lv_label_create(cancel_btn);
     lv_label_set_text(cancel_label, "CANCEL");
@@ -1702,19 +2216,15 @@ static lv_obj_t* create_system_config_screen(lv_obj_t *tools_screen_ref) {
  * SAVE CONFIG SCREEN - Save configuration to SD card
  */
 static void save_config_back_clicked(lv_event_t *e) {
-    lv_obj_t *tools_screen = (lv_obj_t *)lv_event_get_user_data(e);
-    if (tools_screen != NULL) {
-        lv_scr_load(tools_screen);
-    }
+    ui_screen_load(SCREEN_TOOLS);
 }
 
-static lv_obj_t* create_save_config_screen(lv_obj_t *tools_screen_ref) {
+static lv_obj_t* create_save_config_screen(void *ctx) {
     lv_obj_t *screen = lv_obj_create(NULL);
     lv_obj_set_style_bg_color(screen, lv_color_hex(THEME_SCREEN_BG), 0);
 
-    // Create header
-    lv_obj_t *header = ui_header_create(screen);
-    ui_header_set_gps_status(header, false);
+    // Shared header bar (top layer)
+    ui_header_attach(screen);
 
     // Title
     lv_obj_t *title = lv_label_create(screen);
@@ -1736,7 +2246,7 @@ static lv_obj_t* create_save_config_screen(lv_obj_t *tools_screen_ref) {
     lv_obj_set_size(back_btn, 150, 50);
     lv_obj_align(back_btn, LV_ALIGN_BOTTOM_LEFT, 30, -20);
     THEME_STYLE_BUTTON(back_btn, THEME_BTN_CANCEL);
-    lv_obj_add_event_cb(back_btn, save_config_back_clicked, LV_EVENT_CLICKED, tools_screen_ref);
+    lv_obj_add_event_cb(back_btn, save_config_back_clicked, LV_EVENT_CLICKED, NULL);
 
     lv_obj_t *back_label = lv_label_create(back_btn);
     lv_label_set_text(back_label, "BACK");
@@ -1750,19 +2260,15 @@ static lv_obj_t* create_save_config_screen(lv_obj_t *tools_screen_ref) {
  * LOAD CONFIG SCREEN - Load configuration from SD card
  */
 static void load_config_back_clicked(lv_event_t *e) {
-    lv_obj_t *tools_screen = (lv_obj_t *)lv_event_get_user_data(e);
-    if (tools_screen != NULL) {
-        lv_scr_load(tools_screen);
-    }
+    ui_screen_load(SCREEN_TOOLS);
 }
 
-static lv_obj_t* create_load_config_screen(lv_obj_t *tools_screen_ref) {
+static lv_obj_t* create_load_config_screen(void *ctx) {
     lv_obj_t *screen = lv_obj_create(NULL);
     lv_obj_set_style_bg_color(screen, lv_color_hex(THEME_SCREEN_BG), 0);
 
-    // Create header
-    lv_obj_t *header = ui_header_create(screen);
-    ui_header_set_gps_status(header, false);
+    // Shared header bar (top layer)
+    ui_header_attach(screen);
 
     // Title
     lv_obj_t *title = lv_label_create(screen);
@@ -1784,7 +2290,7 @@ static lv_obj_t* create_load_config_screen(lv_obj_t *tools_screen_ref) {
     lv_obj_set_size(back_btn, 150, 50);
     lv_obj_align(back_btn, LV_ALIGN_BOTTOM_LEFT, 30, -20);
     THEME_STYLE_BUTTON(back_btn, THEME_BTN_CANCEL);
-    lv_obj_add_event_cb(back_btn, load_config_back_clicked, LV_EVENT_CLICKED, tools_screen_ref);
+    lv_obj_add_event_cb(back_btn, load_config_back_clicked, LV_EVENT_CLICKED, NULL);
 
     lv_obj_t *back_label = lv_label_create(back_btn);
     lv_label_set_text(back_label, "BACK");
@@ -1798,28 +2304,21 @@ static lv_obj_t* create_load_config_screen(lv_obj_t *tools_screen_ref) {
  * FACTORY RESET SCREEN - Confirmation dialog
  */
 static void factory_reset_back_clicked(lv_event_t *e) {
-    lv_obj_t *tools_screen = (lv_obj_t *)lv_event_get_user_data(e);
-    if (tools_screen != NULL) {
-        lv_scr_load(tools_screen);
-    }
+    ui_screen_load(SCREEN_TOOLS);
 }
 
 static void factory_reset_confirm_clicked(lv_event_t *e) {
     ESP_LOGW(TAG, "Factory reset confirmed - resetting to defaults");
     // TODO: Implement factory reset
-    lv_obj_t *tools_screen = (lv_obj_t *)lv_event_get_user_data(e);
-    if (tools_screen != NULL) {
-        lv_scr_load(tools_screen);
-    }
+    ui_screen_load(SCREEN_TOOLS);
 }
 
-static lv_obj_t* create_factory_reset_screen(lv_obj_t *tools_screen_ref) {
+static lv_obj_t* create_factory_reset_screen(void *ctx) {
     lv_obj_t *screen = lv_obj_create(NULL);
     lv_obj_set_style_bg_color(screen, lv_color_hex(THEME_SCREEN_BG), 0);
 
-    // Create header
-    lv_obj_t *header = ui_header_create(screen);
-    ui_header_set_gps_status(header, false);
+    // Shared header bar (top layer)
+    ui_header_attach(screen);
 
     // Title
     lv_obj_t *title = lv_label_create(screen);
@@ -1844,7 +2343,7 @@ static lv_obj_t* create_factory_reset_screen(lv_obj_t *tools_screen_ref) {
     lv_obj_set_size(confirm_btn, 150, 50);
     lv_obj_align(confirm_btn, LV_ALIGN_BOTTOM_RIGHT, -30, -20);
     lv_obj_set_style_bg_color(confirm_btn, lv_color_hex(0xFF0000), 0);
-    lv_obj_add_event_cb(confirm_btn, factory_reset_confirm_clicked, LV_EVENT_CLICKED, tools_screen_ref);
+    lv_obj_add_event_cb(confirm_btn, factory_reset_confirm_clicked, LV_EVENT_CLICKED, NULL);
 
     lv_obj_t *confirm_label = lv_label_create(confirm_btn);
     lv_label_set_text(confirm_label, "RESET");
@@ -1856,7 +2355,7 @@ static lv_obj_t* create_factory_reset_screen(lv_obj_t *tools_screen_ref) {
     lv_obj_set_size(cancel_btn, 150, 50);
     lv_obj_align(cancel_btn, LV_ALIGN_BOTTOM_LEFT, 30, -20);
     THEME_STYLE_BUTTON(cancel_btn, THEME_BTN_CANCEL);
-    lv_obj_add_event_cb(cancel_btn, factory_reset_back_clicked, LV_EVENT_CLICKED, tools_screen_ref);
+    lv_obj_add_event_cb(cancel_btn, factory_reset_back_clicked, LV_EVENT_CLICKED, NULL);
 
     lv_obj_t *cancel_label = lv_label_create(cancel_btn);
     lv_label_set_text(cancel_label, "CANCEL");
@@ -1877,13 +2376,12 @@ typedef struct {
 /**
  * TOOLS SCREEN - System Utilities
  */
-lv_obj_t* create_tools_screen(ui_footer_page_cb_t page_callback, lv_obj_t **footer_out) {
+lv_obj_t* create_tools_screen(ui_footer_page_cb_t page_callback) {
     lv_obj_t *screen = lv_obj_create(NULL);
     lv_obj_set_style_bg_color(screen, lv_color_hex(THEME_SCREEN_BG), 0);
 
-    // Create header bar with satellite icon
-    lv_obj_t *header = ui_header_create(screen);
-    ui_header_set_gps_status(header, false);  // Default to GPS not found
+    // Shared header bar (top layer)
+    ui_header_attach(screen);
 
     // Title (positioned below header)
     lv_obj_t *title = lv_label_create(screen);
@@ -1902,6 +2400,8 @@ lv_obj_t* create_tools_screen(ui_footer_page_cb_t page_callback, lv_obj_t **foot
         {"Test\nHardware", tools_test_clicked},
         {"Factory\nReset", tools_reset_clicked},
         {"Date/Time\nSettings", tools_datetime_clicked},
+        {"GPS\nCalibrate", tools_calibrate_clicked},
+        {"Geofence\nZones", tools_geofence_clicked},
     };
     int button_count = sizeof(buttons) / sizeof(buttons[0]);
 
@@ -1946,15 +2446,8 @@ lv_obj_t* create_tools_screen(ui_footer_page_cb_t page_callback, lv_obj_t **foot
         create_tool_button(screen, buttons[i].label, x, y, buttons[i].callback);
     }
 
-    // Create footer
-    lv_obj_t *footer = ui_footer_create(screen, PAGE_TOOLS, page_callback);
-    if (footer != NULL) {
-        ui_footer_show(footer);
-        lv_obj_move_foreground(footer);
-    }
-    if (footer_out != NULL) {
-        *footer_out = footer;
-    }
+    // Shared footer (top layer) with this page highlighted
+    ui_footer_attach(screen, PAGE_TOOLS);
 
     ESP_LOGI(TAG, "Created TOOLS screen with %d utility buttons", button_count);
     return screen;
@@ -2035,8 +2528,152 @@ static void display_mode_clicked(lv_event_t *e) {
 }
 
 static void display_anchor_clicked(lv_event_t *e) {
-    ESP_LOGI(TAG, "DISPLAY: Anchor button clicked - start anchor tracking");
-    // TODO: Start anchor location process (ARMING state)
+    anchor_status_t status;
+    anchor_watch_get_status(&status);
+
+    if (status.state == ANCHOR_STATE_OFF) {
+        ESP_LOGI(TAG, "DISPLAY: Anchor button clicked - start anchor tracking");
+        anchor_watch_set_anchor_here();
+    } else {
+        ESP_LOGI(TAG, "DISPLAY: Anchor button clicked - stop anchor tracking");
+        anchor_watch_stop();
+    }
+}
+
+// Anchor view right of the anchor button (clear of it), fed at the fix rate
+#define DISPLAY_VIEW_PX             300
+#define DISPLAY_VIEW_X              (-20)   // From the right edge
+#define DISPLAY_VIEW_Y              130     // From the top, below the status bar
+#define DISPLAY_VIEW_PERIOD_MS      100     // 10 Hz fixes
+#define DISPLAY_VIEW_NEAR_LIMIT     0.8f    // Boat turns yellow past this share of the radius
+
+// Live anchor watch widgets on the DISPLAY screen (freed with the screen)
+typedef struct {
+    lv_obj_t *mode_label;
+    lv_obj_t *anchor_text;
+    lv_obj_t *drag_label;
+    neighbor_view_t views[NEIGHBOR_MAX_TARGETS];
+    lv_timer_t *timer;
+    lv_obj_t *view;
+    lv_timer_t *view_timer;
+    uint32_t view_fix_ms;       // Fix last drawn
+    double view_lat, view_lon;  // Anchor the trail is relative to
+} display_live_t;
+
+/**
+ * Feed the anchor view with each new fix (LVGL task context)
+ */
+static void display_view_timer_cb(lv_timer_t *timer) {
+    display_live_t *live = (display_live_t *)timer->user_data;
+    anchor_status_t status;
+    anchor_watch_get_status(&status);
+
+    if (status.state == ANCHOR_STATE_OFF) {
+        ui_anchor_view_clear(live->view);
+        lv_obj_add_flag(live->view, LV_OBJ_FLAG_HIDDEN);
+        return;
+    }
+    lv_obj_clear_flag(live->view, LV_OBJ_FLAG_HIDDEN);
+
+    // A moved anchor invalidates the trail
+    if (status.anchor_lat != live->view_lat || status.anchor_lon != live->view_lon) {
+        ui_anchor_view_clear(live->view);
+        live->view_lat = status.anchor_lat;
+        live->view_lon = status.anchor_lon;
+    }
+    // Unknown rode: scale to the alarm radius, but don't label it as rode
+    if (status.rode_m > 0.0f) {
+        ui_anchor_view_set_rode(live->view, status.rode_m);
+    } else {
+        ui_anchor_view_set_range(live->view, status.radius_m);
+    }
+    ui_anchor_view_set_wind(live->view, status.wind_valid ? status.wind_mps : -1.0f,
+                            status.wind_from_deg);
+
+    if (!status.fix_valid || status.fix_ms == live->view_fix_ms) {
+        return;
+    }
+    live->view_fix_ms = status.fix_ms;
+
+    geo_ref_t ref;
+    float east_m, north_m;
+    geo_ref_init(&ref, status.anchor_lat, status.anchor_lon);
+    geo_to_enu(&ref, status.lat, status.lon, &east_m, &north_m);
+    ui_anchor_view_set_boat(live->view, east_m, north_m,
+                            status.heading_valid ? status.heading_deg : -1.0f,
+                            status.dist_m > status.radius_m * DISPLAY_VIEW_NEAR_LIMIT);
+}
+
+/**
+ * Refresh DISPLAY screen from the anchor watch (1 Hz, LVGL task context)
+ */
+static void display_live_timer_cb(lv_timer_t *timer) {
+    display_live_t *live = (display_live_t *)timer->user_data;
+    anchor_status_t status;
+    anchor_watch_get_status(&status);
+
+    // Healthy oscillation is shown with its period so it is not mistaken for drift
+    if (status.state != ANCHOR_STATE_OFF && status.swing_class == SWING_CLASS_OSCILLATING) {
+        // lv_label_set_text_fmt has no float support (LV_SPRINTF_USE_FLOAT off)
+        lv_label_set_text_fmt(live->mode_label, "MODE: %s - %s %d s / %d ft",
+                              anchor_engine_state_name(status.state),
+                              status.sailing ? "SAILING" : "SWING",
+                              (int)lroundf(status.swing_period_s),
+                              (int)lroundf(status.swing_amplitude_m / GEO_FEET_TO_METERS));
+    } else {
+        lv_label_set_text_fmt(live->mode_label, "MODE: %s", anchor_engine_state_name(status.state));
+    }
+    lv_label_set_text(live->anchor_text,
+                      status.state == ANCHOR_STATE_OFF ? "SET\nANCHOR" : "STOP\nWATCH");
+
+    // Only the neighbors whose drawn state changed are redrawn in the anchor view
+    if (status.state == ANCHOR_STATE_OFF) {
+        ui_anchor_view_set_neighbors(live->view, NULL, 0, 0.0f);
+    } else {
+        int n = anchor_watch_get_neighbors(live->views, NEIGHBOR_MAX_TARGETS);
+        ui_anchor_view_set_neighbors(live->view, live->views, n, status.swing_radius_m);
+    }
+
+    if (status.state == ANCHOR_STATE_OFF) {
+        lv_label_set_text(live->drag_label, "DRIFT\n--\nBOUNDARY\n--");
+        lv_obj_set_style_text_color(live->drag_label, lv_color_hex(COLOR_TEXT_PRIMARY), 0);
+        return;
+    }
+
+    char rate_str[24] = "--";
+    if (status.drag_rate_valid) {
+        float ft_per_min = status.drag_rate_mps * 60.0f / GEO_FEET_TO_METERS;
+        snprintf(rate_str, sizeof(rate_str), "%+.1f ft/min", ft_per_min);
+    }
+
+    char ttb_str[24] = "--";
+    if (status.ttb_s >= 0.0f) {
+        uint32_t secs = (uint32_t)status.ttb_s;
+        snprintf(ttb_str, sizeof(ttb_str), "%lu:%02lu", (unsigned long)(secs / 60),
+                 (unsigned long)(secs % 60));
+    }
+
+    lv_label_set_text_fmt(live->drag_label, "DRIFT\n%s\nBOUNDARY\n%s", rate_str, ttb_str);
+
+    // Escalate colour inside the warning horizon
+    bool warn = status.ttb_s >= 0.0f && status.horizon_s > 0 &&
+                status.ttb_s < (float)status.horizon_s;
+    lv_obj_set_style_text_color(live->drag_label,
+                                lv_color_hex(warn ? COLOR_DANGER : COLOR_TEXT_PRIMARY), 0);
+}
+
+/**
+ * Stop the refresh timers when the DISPLAY screen is deleted
+ */
+static void display_live_delete_cb(lv_event_t *e) {
+    display_live_t *live = (display_live_t *)lv_event_get_user_data(e);
+    if (live != NULL) {
+        lv_timer_del(live->timer);
+        if (live->view_timer != NULL) {
+            lv_timer_del(live->view_timer);
+        }
+        free(live);
+    }
 }
 
 /**
@@ -2045,7 +2682,7 @@ static void display_anchor_clicked(lv_event_t *e) {
 static void display_screen_gesture_cb(lv_event_t *e) {
     lv_event_code_t code = lv_event_get_code(e);
     if (code == LV_EVENT_GESTURE) {
-        lv_obj_t *footer = (lv_obj_t *)lv_event_get_user_data(e);
+        lv_obj_t *footer = ui_footer_get();
         lv_dir_t dir = lv_indev_get_gesture_dir(lv_indev_get_act());
 
         if (dir == LV_DIR_TOP && footer != NULL) {
@@ -2059,13 +2696,12 @@ static void display_screen_gesture_cb(lv_event_t *e) {
 /**
  * DISPLAY SCREEN - Main Anchor Monitoring
  */
-lv_obj_t* create_display_screen(ui_footer_page_cb_t page_callback, lv_obj_t **footer_out) {
+lv_obj_t* create_display_screen(ui_footer_page_cb_t page_callback) {
     lv_obj_t *screen = lv_obj_create(NULL);
     lv_obj_set_style_bg_color(screen, lv_color_hex(0xADD8E6), 0);  // Light Blue background
 
-    // Create header bar with satellite icon
-    lv_obj_t *header = ui_header_create(screen);
-    ui_header_set_gps_status(header, false);  // Default to GPS not found
+    // Shared header bar (top layer)
+    ui_header_attach(screen);
 
     // Status bar (below header)
     lv_obj_t *status_bar = lv_obj_create(screen);
@@ -2094,21 +2730,10 @@ lv_obj_t* create_display_screen(ui_footer_page_cb_t page_callback, lv_obj_t **fo
     THEME_STYLE_TEXT(gps_data, COLOR_TEXT_PRIMARY, FONT_BODY_SMALL);
     lv_obj_align(gps_data, LV_ALIGN_TOP_LEFT, 10, 5);
 
-    // Compass panel (upper right) - Smaller
-    lv_obj_t *compass_panel = lv_obj_create(screen);
-    lv_obj_set_size(compass_panel, 100, 90);
-    lv_obj_align(compass_panel, LV_ALIGN_TOP_RIGHT, -20, 130);
-    THEME_STYLE_PANEL(compass_panel, THEME_PANEL_BG);
-
-    lv_obj_t *compass_label = lv_label_create(compass_panel);
-    lv_label_set_text(compass_label, "  N\nW+E\n  S");
-    THEME_STYLE_TEXT(compass_label, COLOR_TEXT_PRIMARY, FONT_BODY_NORMAL);
-    lv_obj_center(compass_label);
-
-    // Anchor button (center) - Smaller, screen-centered
+    // Anchor button (left of centre, clear of the anchor view)
     lv_obj_t *anchor_btn = lv_btn_create(screen);
     lv_obj_set_size(anchor_btn, 200, 200);
-    lv_obj_align(anchor_btn, LV_ALIGN_CENTER, 0, 0);
+    lv_obj_align(anchor_btn, LV_ALIGN_TOP_LEFT, 250, 150);
     THEME_STYLE_BUTTON(anchor_btn, COLOR_PRIMARY);
     lv_obj_add_event_cb(anchor_btn, display_anchor_clicked, LV_EVENT_CLICKED, NULL);
 
@@ -2118,18 +2743,61 @@ lv_obj_t* create_display_screen(ui_footer_page_cb_t page_callback, lv_obj_t **fo
     lv_obj_set_style_text_align(anchor_text, LV_TEXT_ALIGN_CENTER, 0);
     lv_obj_center(anchor_text);
 
-    // Create footer navigation bar (swipe up menu)
-    lv_obj_t *footer = ui_footer_create(screen, PAGE_START, page_callback);
-    if (footer != NULL) {
-        ui_footer_show(footer);
-        lv_obj_move_foreground(footer);
+    // Rode circle, AIS neighbors, boat and trail on the right (not clickable, hidden while off)
+    lv_obj_t *view = ui_anchor_view_create(screen, DISPLAY_VIEW_PX);
+    if (view != NULL) {
+        lv_obj_align(view, LV_ALIGN_TOP_RIGHT, DISPLAY_VIEW_X, DISPLAY_VIEW_Y);
+        lv_obj_add_flag(view, LV_OBJ_FLAG_HIDDEN);
     }
-    if (footer_out != NULL) {
-        *footer_out = footer;
+
+    // Drag rate / time-to-boundary panel (below GPS panel)
+    lv_obj_t *drag_panel = lv_obj_create(screen);
+    lv_obj_set_size(drag_panel, 200, 120);
+    lv_obj_align(drag_panel, LV_ALIGN_TOP_LEFT, 20, 230);
+    THEME_STYLE_PANEL(drag_panel, THEME_PANEL_BG);
+
+    lv_obj_t *drag_label = lv_label_create(drag_panel);
+    lv_label_set_text(drag_label, "DRIFT\n--\nBOUNDARY\n--");
+    THEME_STYLE_TEXT(drag_label, COLOR_TEXT_PRIMARY, FONT_BODY_SMALL);
+    lv_obj_align(drag_label, LV_ALIGN_TOP_LEFT, 10, 5);
+
+    // Compass panel (below drag panel; the anchor view has the upper right)
+    lv_obj_t *compass_panel = lv_obj_create(screen);
+    lv_obj_set_size(compass_panel, 100, 90);
+    lv_obj_align(compass_panel, LV_ALIGN_TOP_LEFT, 20, 360);
+    THEME_STYLE_PANEL(compass_panel, THEME_PANEL_BG);
+
+    lv_obj_t *compass_label = lv_label_create(compass_panel);
+    lv_label_set_text(compass_label, "  N\nW+E\n  S");
+    THEME_STYLE_TEXT(compass_label, COLOR_TEXT_PRIMARY, FONT_BODY_NORMAL);
+    lv_obj_center(compass_label);
+
+    // Live refresh from the anchor watch
+    display_live_t *live = malloc(sizeof(display_live_t));
+    if (live != NULL) {
+        live->mode_label = mode_label;
+        live->anchor_text = anchor_text;
+        live->drag_label = drag_label;
+        live->timer = lv_timer_create(display_live_timer_cb, 1000, live);
+        live->view = view;
+        live->view_timer = NULL;
+        live->view_fix_ms = 0;
+        live->view_lat = 0.0;
+        live->view_lon = 0.0;
+        if (view != NULL) {
+            live->view_timer = lv_timer_create(display_view_timer_cb, DISPLAY_VIEW_PERIOD_MS, live);
+        }
+        lv_obj_add_event_cb(screen, display_live_delete_cb, LV_EVENT_DELETE, live);
+        display_live_timer_cb(live->timer);
+    } else {
+        ESP_LOGE(TAG, "Failed to allocate DISPLAY live data");
     }
 
+    // Shared footer (top layer, swipe up menu)
+    ui_footer_attach(screen, PAGE_START);
+
     // Add gesture detection to screen for swipe-up to reveal footer
-    lv_obj_add_event_cb(screen, display_screen_gesture_cb, LV_EVENT_GESTURE, footer);
+    lv_obj_add_event_cb(screen, display_screen_gesture_cb, LV_EVENT_GESTURE, NULL);
     lv_obj_clear_flag(screen, LV_OBJ_FLAG_GESTURE_BUBBLE);  // Don't bubble to prevent conflicts
 
     ESP_LOGI(TAG, "Created DISPLAY screen (Ready to Anchor) with footer navigation and swipe-up gesture");
@@ -2195,9 +2863,8 @@ lv_obj_t* create_test_screen(void) {
     lv_obj_t *screen = lv_obj_create(NULL);
     lv_obj_set_style_bg_color(screen, lv_color_hex(THEME_SCREEN_BG), 0);
 
-    // Create header bar with satellite icon
-    lv_obj_t *header = ui_header_create(screen);
-    ui_header_set_gps_status(header, false);  // Default to GPS not found
+    // Shared header bar (top layer)
+    ui_header_attach(screen);
 
     // Title (positioned below header)
     lv_obj_t *title = lv_label_create(screen);
@@ -2247,3 +2914,84 @@ lv_obj_t* create_test_screen(void) {
     ESP_LOGI(TAG, "Created TEST screen with hardware controls");
     return screen;
 }
+
+/**
+ * SCREEN REGISTRY - Factories and lifetimes for the screen manager
+ */
+typedef lv_obj_t* (*page_create_fn_t)(ui_footer_page_cb_t page_callback);
+
+static const page_create_fn_t page_factories[SCREEN_DISPLAY + 1] = {
+    [SCREEN_START] = create_start_screen,
+    [SCREEN_INFO] = create_info_screen,
+    [SCREEN_PGN] = create_pgn_screen,
+    [SCREEN_CONFIG] = create_config_screen,
+    [SCREEN_UPDATE] = create_update_screen,
+    [SCREEN_TOOLS] = create_tools_screen,
+    [SCREEN_DISPLAY] = create_display_screen,
+};
+
+static lv_obj_t* page_screen_factory(void *ctx) {
+    page_create_fn_t create = *(const page_create_fn_t *)ctx;
+    return create(g_page_callback);
+}
+
+#define PAGE_DEF(id, name, next) \
+    [id] = {name, page_screen_factory, NULL, (void *)&page_factories[id], UI_SCREEN_KEEP, next}
+
+// Pages and DISPLAY are kept; sub-screens that show a snapshot or run timers are volatile
+static const ui_screen_def_t screen_defs[SCREEN_COUNT] = {
+    PAGE_DEF(SCREEN_START, "START", SCREEN_DISPLAY),
+    PAGE_DEF(SCREEN_INFO, "INFO", UI_SCREEN_NONE),
+    PAGE_DEF(SCREEN_PGN, "PGN", UI_SCREEN_NONE),
+    PAGE_DEF(SCREEN_CONFIG, "CONFIG", UI_SCREEN_NONE),
+    PAGE_DEF(SCREEN_UPDATE, "UPDATE", UI_SCREEN_NONE),
+    PAGE_DEF(SCREEN_TOOLS, "TOOLS", UI_SCREEN_NONE),
+    PAGE_DEF(SCREEN_DISPLAY, "DISPLAY", UI_SCREEN_NONE),
+    [SCREEN_TFCARD] = {"TFCARD", create_tfcard_screen, NULL, NULL,
+                       UI_SCREEN_CACHED, UI_SCREEN_NONE},
+    [SCREEN_FILE_BROWSER] = {"FILE_BROWSER", create_file_browser_screen, NULL, NULL,
+                             UI_SCREEN_VOLATILE, UI_SCREEN_NONE},
+    [SCREEN_SYSINFO] = {"SYSINFO", create_sysinfo_screen, NULL, NULL,
+                        UI_SCREEN_VOLATILE, UI_SCREEN_NONE},
+    [SCREEN_TEST_HARDWARE] = {"TEST_HARDWARE", create_test_hardware_screen, NULL, NULL,
+                              UI_SCREEN_CACHED, UI_SCREEN_NONE},
+    [SCREEN_LOGS_MENU] = {"LOGS_MENU", create_logs_menu_screen, NULL, NULL,
+                          UI_SCREEN_CACHED, SCREEN_VIEW_LOGS},
+    [SCREEN_VIEW_LOGS] = {"VIEW_LOGS", create_view_logs_screen, NULL, NULL,
+                          UI_SCREEN_CACHED, UI_SCREEN_NONE},
+    [SCREEN_CLEAR_LOGS] = {"CLEAR_LOGS", create_clear_logs_screen, NULL, NULL,
+                           UI_SCREEN_CACHED, UI_SCREEN_NONE},
+    [SCREEN_LOG_LEVEL] = {"LOG_LEVEL", create_set_log_level_screen, NULL, NULL,
+                          UI_SCREEN_VOLATILE, UI_SCREEN_NONE},
+    [SCREEN_CLEAR_GPS] = {"CLEAR_GPS", create_clear_gps_screen, NULL, NULL,
+                          UI_SCREEN_CACHED, UI_SCREEN_NONE},
+    [SCREEN_SYSTEM_CONFIG] = {"SYSTEM_CONFIG", create_system_config_screen, NULL, NULL,
+                              UI_SCREEN_VOLATILE, UI_SCREEN_NONE},
+    [SCREEN_WIFI_BT] = {"WIFI_BT", create_wifi_bluetooth_screen, NULL, NULL,
+                        UI_SCREEN_CACHED, UI_SCREEN_NONE},
+    [SCREEN_FACTORY_RESET] = {"FACTORY_RESET", create_factory_reset_screen, NULL, NULL,
+                              UI_SCREEN_CACHED, UI_SCREEN_NONE},
+    [SCREEN_CALIBRATE] = {"CALIBRATE", create_calibrate_screen, NULL, NULL,
+                          UI_SCREEN_VOLATILE, UI_SCREEN_NONE},
+    [SCREEN_GEOFENCE] = {"GEOFENCE", create_geofence_screen, NULL, NULL,
+                         UI_SCREEN_VOLATILE, UI_SCREEN_NONE},
+    [SCREEN_DATETIME] = {"DATETIME", create_datetime_settings_screen, datetime_settings_destroy,
+                         NULL, UI_SCREEN_VOLATILE, UI_SCREEN_NONE},
+};
+
+/**
+ * Register every screen with the screen manager
+ */
+esp_err_t screens_register(ui_footer_page_cb_t page_callback) {
+    g_page_callback = page_callback;
+
+    for (int id = 0; id < SCREEN_COUNT; id++) {
+        esp_err_t ret = ui_screen_register(id, &screen_defs[id]);
+        if (ret != ESP_OK) {
+            ESP_LOGE(TAG, "Failed to register screen %d: %s", id, esp_err_to_name(ret));
+            return ret;
+        }
+    }
+    ESP_LOGI(TAG, "Registered %d screens", SCREEN_COUNT);
+    return ESP_OK;
+}
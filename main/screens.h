@@ -4,9 +4,13 @@
  * Author: Colin Bitterfield
  * Email: colin@bitterfield.com
  * Date Created: 2025-12-25
- * Version: 0.1.0
+ * Date Updated: 2026-10-18
+ * Version: 0.2.0
  *
  * Screen creation functions for all app screens
+ *
+ * Changelog:
+ * - 0.2.0 (2026-10-18): Screen ids and screens_register() for the screen manager
  */
 
 #ifndef SCREENS_H
@@ -14,20 +18,55 @@
 
 #include "lvgl.h"
 #include "ui_footer.h"
+#include "ui_screen_mgr.h"
+
+// Screen ids for ui_screen_load(); navigation pages match ui_page_t
+typedef enum {
+    SCREEN_START = PAGE_START,
+    SCREEN_INFO = PAGE_INFO,
+    SCREEN_PGN = PAGE_PGN,
+    SCREEN_CONFIG = PAGE_CONFIG,
+    SCREEN_UPDATE = PAGE_UPDATE,
+    SCREEN_TOOLS = PAGE_TOOLS,
+    SCREEN_DISPLAY = PAGE_COUNT,    // Anchor monitoring
+    SCREEN_TFCARD,                  // TOOLS sub-screens
+    SCREEN_FILE_BROWSER,
+    SCREEN_SYSINFO,
+    SCREEN_TEST_HARDWARE,
+    SCREEN_LOGS_MENU,
+    SCREEN_VIEW_LOGS,
+    SCREEN_CLEAR_LOGS,
+    SCREEN_LOG_LEVEL,
+    SCREEN_CLEAR_GPS,
+    SCREEN_SYSTEM_CONFIG,
+    SCREEN_WIFI_BT,
+    SCREEN_FACTORY_RESET,
+    SCREEN_CALIBRATE,
+    SCREEN_GEOFENCE,
+    SCREEN_DATETIME,
+    SCREEN_COUNT
+} screen_id_t;
+
+/**
+ * Register every screen with the screen manager (nothing is built yet)
+ * @param page_callback Footer navigation callback for the pages with a footer
+ * @return ESP_OK on success
+ */
+esp_err_t screens_register(ui_footer_page_cb_t page_callback);
 
 // Screen creation functions
-// Each function returns the screen object and sets *footer_out to the footer reference
+// Each function returns the screen object; screens attach to the shared header/footer
 
 // Navigation screens (with footer)
-lv_obj_t* create_start_screen(ui_footer_page_cb_t page_callback, lv_obj_t **footer_out);
-lv_obj_t* create_info_screen(ui_footer_page_cb_t page_callback, lv_obj_t **footer_out);
-lv_obj_t* create_pgn_screen(ui_footer_page_cb_t page_callback, lv_obj_t **footer_out);
-lv_obj_t* create_config_screen(ui_footer_page_cb_t page_callback, lv_obj_t **footer_out);
-lv_obj_t* create_update_screen(ui_footer_page_cb_t page_callback, lv_obj_t **footer_out);
-lv_obj_t* create_tools_screen(ui_footer_page_cb_t page_callback, lv_obj_t **footer_out);
+lv_obj_t* create_start_screen(ui_footer_page_cb_t page_callback);
+lv_obj_t* create_info_screen(ui_footer_page_cb_t page_callback);
+lv_obj_t* create_pgn_screen(ui_footer_page_cb_t page_callback);
+lv_obj_t* create_config_screen(ui_footer_page_cb_t page_callback);
+lv_obj_t* create_update_screen(ui_footer_page_cb_t page_callback);
+lv_obj_t* create_tools_screen(ui_footer_page_cb_t page_callback);
 
 // Main anchor monitoring screen (now with footer navigation)
-lv_obj_t* create_display_screen(ui_footer_page_cb_t page_callback, lv_obj_t **footer_out);
+lv_obj_t* create_display_screen(ui_footer_page_cb_t page_callback);
 
 // Special screens (no footer)
 lv_obj_t* create_test_screen(void);     // Hardware testing screen
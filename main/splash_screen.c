@@ -19,6 +19,7 @@
 #include "board_config.h"
 #include "lvgl_init.h"
 #include "ui_header.h"
+#include "ui_status.h"
 #include "splash_logo.h"
 #include "esp_log.h"
 #include "esp_vfs_fat.h"
@@ -69,9 +70,7 @@ static void create_splash_ui(void) {
     lv_obj_set_style_bg_opa(splash_screen, LV_OPA_COVER, 0);  // Fully opaque
 
     // Status header (full-width bar at top with title)
-    status_header = ui_header_create(splash_screen);
-    ui_header_set_gps_status(status_header, false);
-    ui_header_set_compass_status(status_header, false);
+    status_header = ui_header_attach(splash_screen);
 
     // Splash logo image (compiled C array) - centered below header
     logo_img = lv_img_create(splash_screen);
@@ -402,7 +401,7 @@ esp_err_t run_self_test(selftest_results_t *results) {
         ESP_LOGI(TAG, "GPS source: NMEA 2000 (highest priority)");
         update_progress(100, "GPS Ready: N2K");
         // Update header GPS status
-        ui_header_set_gps_status(status_header, true);
+        ui_status_set_flag(UI_STATUS_GPS, true);
     } else {
         // Priority 2: NMEA 0183
         printf("                         NMEA 0183: ");
@@ -419,7 +418,7 @@ esp_err_t run_self_test(selftest_results_t *results) {
             ESP_LOGI(TAG, "GPS source: NMEA 0183 (secondary priority)");
             update_progress(100, "GPS Ready: NMEA 0183");
             // Update header GPS status
-            ui_header_set_gps_status(status_header, true);
+            ui_status_set_flag(UI_STATUS_GPS, true);
         } else {
             // Priority 3: External GPS
             printf("                         External GPS: ");
@@ -436,7 +435,7 @@ esp_err_t run_self_test(selftest_results_t *results) {
                 ESP_LOGI(TAG, "GPS source: External GPS (lowest priority)");
                 update_progress(100, "GPS Ready: External");
                 // Update header GPS status
-                ui_header_set_gps_status(status_header, true);
+                ui_status_set_flag(UI_STATUS_GPS, true);
             } else {
                 results->gps_ready = false;
                 strncpy(results->gps_source, "None", sizeof(results->gps_source) - 1);
@@ -11,6 +11,7 @@
 #include "start_screen.h"
 #include "ui_header.h"
 #include "ui_footer.h"
+#include "ui_status.h"
 #include "ui_version.h"
 #include "lvgl_init.h"
 #include "esp_log.h"
@@ -93,30 +94,26 @@ esp_err_t start_screen_create(void) {
     lv_obj_clear_flag(start_screen, LV_OBJ_FLAG_SCROLLABLE);
     ESP_LOGI(TAG, "Background style configured");
 
-    // Create header bar
-    ESP_LOGI(TAG, "Creating header bar...");
-    header = ui_header_create(start_screen);
+    // Attach the shared header bar (top layer, icons driven by the status model)
+    ESP_LOGI(TAG, "Attaching header bar...");
+    header = ui_header_attach(start_screen);
     if (header == NULL) {
         ESP_LOGE(TAG, "ERROR: Failed to create header");
         lvgl_unlock();
         return ESP_FAIL;
     }
-    ESP_LOGI(TAG, "Header created successfully");
+    ESP_LOGI(TAG, "Header attached successfully");
 
-    // Set initial GPS/Compass status (will be updated later)
-    ui_header_set_gps_status(header, false);
-    ui_header_set_compass_status(header, false);
-    ESP_LOGI(TAG, "Header status icons initialized");
-
-    // Create footer navigation bar (START = page 0) with callback
-    ESP_LOGI(TAG, "Creating footer navigation bar...");
-    footer = ui_footer_create(start_screen, PAGE_START, footer_page_callback);
+    // Attach the shared footer navigation bar (START = page 0)
+    ESP_LOGI(TAG, "Attaching footer navigation bar...");
+    footer = ui_footer_init(footer_page_callback);
     if (footer == NULL) {
         ESP_LOGE(TAG, "ERROR: Failed to create footer");
         lvgl_unlock();
         return ESP_FAIL;
     }
-    ESP_LOGI(TAG, "Footer created successfully");
+    ui_footer_attach(start_screen, PAGE_START);
+    ESP_LOGI(TAG, "Footer attached successfully");
 
     // Calculate content area (between header and footer)
     // Header: 80px from top
@@ -217,10 +214,8 @@ void start_screen_update_gps(bool gps_ready, const char *gps_source) {
         lv_label_set_text(gps_status_label, gps_text);
     }
 
-    // Update header GPS icon
-    if (header != NULL) {
-        ui_header_set_gps_status(header, gps_ready);
-    }
+    // Header GPS icon follows the status model
+    ui_status_set_flag(UI_STATUS_GPS, gps_ready);
 
     lvgl_unlock();
 }
@@ -0,0 +1,716 @@
+/**
+ * UI Anchor View Widget Implementation
+ *
+ * Author: Colin Bitterfield
+ * Email: colin@bitterfield.com
+ * Date Created: 2026-10-18
+ * Date Updated: 2026-10-18
+ * Version: 0.2.0
+ *
+ * Changelog:
+ * - 0.2.0 (2026-10-18): AIS neighbors and our swing circle in the static canvas
+ * - 0.1.1 (2026-10-18): Unlabelled range scale for an unknown rode
+ */
+
+#include "ui_anchor_view.h"
+#include "ui_theme.h"
+#include "esp_log.h"
+#include "esp_heap_caps.h"
+#include <string.h>
+#include <stdlib.h>
+#include <math.h>
+
+static const char *TAG = "ui_anchor_view";
+
+#define VIEW_MARGIN             1.2f        // Half-size covers the rode plus 20%
+#define VIEW_COLOR_ANCHOR       0xFFD700    // Gold
+#define VIEW_LINE_PX            2           // Circle and anchor stroke
+#define VIEW_DASH_DEG           15          // Dash period around the rode circle
+#define VIEW_DASH_ON_DEG        9           // Drawn part of each period
+#define VIEW_DOT_BOX_PX         4           // Box every dot fits in (newest dot size)
+#define VIEW_BOAT_PX            20          // Boat canvas edge
+#define VIEW_ANGLE_STEP         20          // Boat rotation step (0.1 degree units)
+#define VIEW_WIND_BOX_PX        56          // Wind arrow area (top-right corner)
+#define VIEW_WIND_FULL_MPS      20.0f       // Wind for a full-length arrow (~40 kn)
+#define VIEW_WIND_MIN_PX        8           // Shortest arrow (light air stays readable)
+#define VIEW_WIND_BARB_PX       6
+#define VIEW_NEIGHBOR_DOT_PX    8           // Moving target marker
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+// One trail dot
+typedef struct {
+    float east_m, north_m;      // Position (kept for re-projection on a new scale)
+    lv_coord_t x, y;            // Centre on the trail canvas
+    uint32_t t_ms;              // lv_tick_get() when laid
+    uint8_t level;              // Fade level last drawn
+} view_dot_t;
+
+// View data stored as user data
+typedef struct {
+    lv_coord_t size;
+    lv_area_t bounds;                       // Canvas area (0,0 .. size-1,size-1)
+    float rode_m;                           // Scale at the circle (0 = no scale yet)
+    bool rode_labelled;                     // Circle labelled with rode_m (false: rode unknown)
+    float px_per_m;
+    uint8_t *static_buf;                    // Circle, anchor and neighbors (PSRAM)
+    uint8_t *trail_buf;                     // Trail dots (PSRAM, persistent)
+    lv_obj_t *painter;                      // Hidden canvas on static_buf (see view_draw_base)
+    lv_obj_t *trail;
+    lv_obj_t *label;
+    // Trail ring (oldest at head)
+    view_dot_t dots[ANCHOR_VIEW_TRAIL_MAX];
+    uint16_t head, count;
+    lv_color_t dot_color[ANCHOR_VIEW_LEVELS];
+    lv_opa_t dot_opa[ANCHOR_VIEW_LEVELS];
+    uint8_t dot_px[ANCHOR_VIEW_LEVELS];
+    // Trail boxes waiting for invalidation (canvas coordinates)
+    lv_area_t dirty[ANCHOR_VIEW_DIRTY_MAX];
+    uint8_t dirty_count;
+    lv_timer_t *fade_timer;
+    // Boat
+    lv_obj_t *boat;
+    uint8_t boat_buf[LV_CANVAS_BUF_SIZE_TRUE_COLOR_ALPHA(VIEW_BOAT_PX, VIEW_BOAT_PX)];
+    bool boat_shown;
+    bool boat_warn;
+    // Wind arrow (lv_line keeps a pointer to the points)
+    lv_obj_t *wind;
+    lv_point_t wind_pts[5];
+    bool wind_shown;
+    // AIS neighbors as drawn on the static canvas (mmsi 0 = none)
+    neighbor_view_t neighbors[NEIGHBOR_MAX_TARGETS];
+    float own_radius_m;                     // Our swing circle (0 = none)
+} ui_anchor_view_data_t;
+
+// Trail dot k (0 = oldest)
+#define VIEW_DOT(data, k)   (&(data)->dots[((data)->head + (k)) % ANCHOR_VIEW_TRAIL_MAX])
+
+/**
+ * Stop the ageing timer and free buffers when the view is deleted
+ */
+static void view_delete_cb(lv_event_t *e) {
+    lv_obj_t *obj = lv_event_get_target(e);
+    ui_anchor_view_data_t *data = (ui_anchor_view_data_t *)lv_obj_get_user_data(obj);
+    if (data != NULL) {
+        lv_timer_del(data->fade_timer);
+        heap_caps_free(data->static_buf);
+        heap_caps_free(data->trail_buf);
+        free(data);
+        lv_obj_set_user_data(obj, NULL);
+    }
+}
+
+/**
+ * Full-size transparent canvas on a PSRAM buffer
+ */
+static lv_obj_t* view_canvas_create(lv_obj_t *view, uint8_t *buf, lv_coord_t size) {
+    lv_obj_t *canvas = lv_canvas_create(view);
+    lv_canvas_set_buffer(canvas, buf, size, size, LV_IMG_CF_TRUE_COLOR_ALPHA);
+    lv_obj_clear_flag(canvas, LV_OBJ_FLAG_CLICKABLE);
+    lv_obj_set_pos(canvas, 0, 0);
+    return canvas;
+}
+
+/**
+ * Dashed rode circle and anchor symbol (once, at creation)
+ */
+static void view_draw_static(lv_obj_t *canvas, lv_coord_t size) {
+    lv_coord_t c = size / 2;
+    lv_coord_t r = (lv_coord_t)lroundf(c / VIEW_MARGIN);
+
+    lv_draw_arc_dsc_t arc;
+    lv_draw_arc_dsc_init(&arc);
+    arc.color = lv_color_hex(COLOR_TEXT_PRIMARY);
+    arc.width = VIEW_LINE_PX;
+    for (int a = 0; a < 360; a += VIEW_DASH_DEG) {
+        lv_canvas_draw_arc(canvas, c, c, r, a, a + VIEW_DASH_ON_DEG, &arc);
+    }
+
+    // Anchor: ring, stock, shank and crown
+    arc.color = lv_color_hex(VIEW_COLOR_ANCHOR);
+    lv_canvas_draw_arc(canvas, c, c - 9, 3, 0, 360, &arc);
+    lv_canvas_draw_arc(canvas, c, c + 1, 8, 20, 160, &arc);
+
+    lv_draw_line_dsc_t line;
+    lv_draw_line_dsc_init(&line);
+    line.color = arc.color;
+    line.width = VIEW_LINE_PX;
+    const lv_point_t stock[2] = { { c - 5, c - 3 }, { c + 5, c - 3 } };
+    const lv_point_t shank[2] = { { c, c - 6 }, { c, c + 9 } };
+    lv_canvas_draw_line(canvas, stock, 2, &line);
+    lv_canvas_draw_line(canvas, shank, 2, &line);
+}
+
+/**
+ * Static canvas box of a neighbor or of our swing circle (false = off the canvas)
+ */
+static bool view_circle_box(const ui_anchor_view_data_t *data, float east_m, float north_m,
+                            float r_px, lv_area_t *box) {
+    float cx = data->size / 2 + east_m * data->px_per_m;
+    float cy = data->size / 2 - north_m * data->px_per_m;
+    if (cx + r_px < 0.0f || cx - r_px >= data->size || cy + r_px < 0.0f || cy - r_px >= data->size) {
+        return false;
+    }
+    box->x1 = (lv_coord_t)lroundf(cx - r_px);
+    box->y1 = (lv_coord_t)lroundf(cy - r_px);
+    box->x2 = (lv_coord_t)lroundf(cx + r_px);
+    box->y2 = (lv_coord_t)lroundf(cy + r_px);
+    return true;
+}
+
+static bool view_neighbor_box(const ui_anchor_view_data_t *data, const neighbor_view_t *v,
+                              lv_area_t *box) {
+    if (v->mmsi == 0 || data->px_per_m <= 0.0f) return false;
+    float r_px = (v->flags & NEIGHBOR_FLAG_ANCHORED) ? fmaxf(v->radius_m * data->px_per_m, 1.0f)
+                                                     : VIEW_NEIGHBOR_DOT_PX / 2;
+    return view_circle_box(data, v->east_m, v->north_m, r_px, box);
+}
+
+static bool view_own_box(const ui_anchor_view_data_t *data, lv_area_t *box) {
+    if (data->own_radius_m <= 0.0f || data->px_per_m <= 0.0f) return false;
+    return view_circle_box(data, 0.0f, 0.0f, data->own_radius_m * data->px_per_m, box);
+}
+
+/**
+ * Redraw the static canvas: neighbors, our swing circle, then the rode circle and anchor
+ * LVGL's canvas draw calls invalidate the whole canvas. They go through a hidden canvas on
+ * the same buffer, whose invalidation is a no-op; the caller invalidates only what changed.
+ */
+static void view_draw_base(ui_anchor_view_data_t *data) {
+    memset(data->static_buf, 0, LV_CANVAS_BUF_SIZE_TRUE_COLOR_ALPHA(data->size, data->size));
+
+    lv_draw_rect_dsc_t rect;
+    lv_draw_rect_dsc_init(&rect);
+    rect.radius = LV_RADIUS_CIRCLE;
+    for (int s = 0; s < NEIGHBOR_MAX_TARGETS; s++) {
+        const neighbor_view_t *v = &data->neighbors[s];
+        lv_area_t box;
+        if (!view_neighbor_box(data, v, &box)) continue;
+
+        lv_color_t color = lv_color_hex((v->flags & NEIGHBOR_FLAG_ALERT) ? COLOR_DANGER : COLOR_WARNING);
+        bool anchored = (v->flags & NEIGHBOR_FLAG_ANCHORED) != 0;
+        rect.bg_color = color;
+        rect.bg_opa = anchored ? LV_OPA_20 : LV_OPA_COVER;
+        rect.border_color = color;
+        rect.border_width = anchored ? VIEW_LINE_PX : 0;
+        lv_canvas_draw_rect(data->painter, box.x1, box.y1, lv_area_get_width(&box),
+                            lv_area_get_height(&box), &rect);
+    }
+
+    lv_area_t own;
+    if (view_own_box(data, &own)) {
+        lv_draw_arc_dsc_t arc;
+        lv_draw_arc_dsc_init(&arc);
+        arc.color = lv_color_hex(COLOR_SUCCESS);
+        arc.opa = LV_OPA_70;
+        arc.width = VIEW_LINE_PX;
+        lv_canvas_draw_arc(data->painter, data->size / 2, data->size / 2,
+                           (lv_coord_t)lroundf(data->own_radius_m * data->px_per_m), 0, 360, &arc);
+    }
+
+    view_draw_static(data->painter, data->size);
+}
+
+/**
+ * Boat triangle, bow up (rotated by the image angle)
+ */
+static void view_draw_boat(ui_anchor_view_data_t *data) {
+    lv_canvas_fill_bg(data->boat, lv_color_black(), LV_OPA_TRANSP);
+
+    lv_draw_rect_dsc_t rect;
+    lv_draw_rect_dsc_init(&rect);
+    rect.bg_color = lv_color_hex(data->boat_warn ? COLOR_WARNING : COLOR_SUCCESS);
+    rect.bg_opa = LV_OPA_COVER;
+    const lv_point_t hull[3] = {
+        { VIEW_BOAT_PX / 2, 1 },
+        { VIEW_BOAT_PX / 2 + 6, VIEW_BOAT_PX - 3 },
+        { VIEW_BOAT_PX / 2 - 6, VIEW_BOAT_PX - 3 },
+    };
+    lv_canvas_draw_polygon(data->boat, hull, 3, &rect);
+}
+
+/**
+ * Metres to trail canvas pixels (north up, anchor at the centre)
+ */
+static void view_project(const ui_anchor_view_data_t *data, float east_m, float north_m,
+                         lv_coord_t *x, lv_coord_t *y) {
+    // Clamp far positions so they stay off the canvas without overflowing lv_coord_t
+    float lim = (float)data->size;
+    float dx = fmaxf(-lim, fminf(lim, east_m * data->px_per_m));
+    float dy = fmaxf(-lim, fminf(lim, north_m * data->px_per_m));
+    *x = (lv_coord_t)lroundf(data->size / 2 + dx);
+    *y = (lv_coord_t)lroundf(data->size / 2 - dy);
+}
+
+/**
+ * Queue a trail box for invalidation, merging so LVGL gets only a few areas
+ */
+static void view_mark_dirty(ui_anchor_view_data_t *data, const lv_area_t *a) {
+    for (int i = 0; i < data->dirty_count; i++) {
+        lv_area_t *d = &data->dirty[i];
+        if (a->x1 <= d->x2 + 1 && a->x2 >= d->x1 - 1 && a->y1 <= d->y2 + 1 && a->y2 >= d->y1 - 1) {
+            _lv_area_join(d, d, a);
+            return;
+        }
+    }
+    if (data->dirty_count < ANCHOR_VIEW_DIRTY_MAX) {
+        data->dirty[data->dirty_count++] = *a;
+        return;
+    }
+
+    // List full: grow the area that grows least
+    int best = 0;
+    uint32_t best_growth = UINT32_MAX;
+    for (int i = 0; i < ANCHOR_VIEW_DIRTY_MAX; i++) {
+        lv_area_t u;
+        _lv_area_join(&u, &data->dirty[i], a);
+        uint32_t growth = lv_area_get_size(&u) - lv_area_get_size(&data->dirty[i]);
+        if (growth < best_growth) {
+            best = i;
+            best_growth = growth;
+        }
+    }
+    _lv_area_join(&data->dirty[best], &data->dirty[best], a);
+}
+
+/**
+ * Hand the queued trail boxes to LVGL (screen coordinates)
+ */
+static void view_flush_dirty(ui_anchor_view_data_t *data) {
+    if (data->dirty_count == 0) return;
+
+    lv_area_t coords;
+    lv_obj_get_coords(data->trail, &coords);
+    for (int i = 0; i < data->dirty_count; i++) {
+        lv_area_t a = data->dirty[i];
+        lv_area_move(&a, coords.x1, coords.y1);
+        lv_obj_invalidate_area(data->trail, &a);
+    }
+    data->dirty_count = 0;
+}
+
+static void view_dot_box(const view_dot_t *dot, lv_area_t *box) {
+    box->x1 = dot->x - VIEW_DOT_BOX_PX / 2;
+    box->y1 = dot->y - VIEW_DOT_BOX_PX / 2;
+    box->x2 = box->x1 + VIEW_DOT_BOX_PX - 1;
+    box->y2 = box->y1 + VIEW_DOT_BOX_PX - 1;
+}
+
+/**
+ * Write one dot's pixels inside clip (no blending: later dots overwrite)
+ */
+static void view_dot_draw(ui_anchor_view_data_t *data, const view_dot_t *dot, const lv_area_t *clip) {
+    lv_img_dsc_t *img = lv_canvas_get_img(data->trail);
+    int d = data->dot_px[dot->level];
+    lv_coord_t x0 = dot->x - d / 2;
+    lv_coord_t y0 = dot->y - d / 2;
+
+    for (int j = 0; j < d; j++) {
+        lv_coord_t y = y0 + j;
+        if (y < clip->y1 || y > clip->y2) continue;
+        for (int i = 0; i < d; i++) {
+            lv_coord_t x = x0 + i;
+            if (x < clip->x1 || x > clip->x2) continue;
+            if (d >= 4 && (i == 0 || i == d - 1) && (j == 0 || j == d - 1)) continue;   // Round corners
+            lv_img_buf_set_px_color(img, x, y, data->dot_color[dot->level]);
+            lv_img_buf_set_px_alpha(img, x, y, data->dot_opa[dot->level]);
+        }
+    }
+}
+
+/**
+ * Rebuild a box of the trail from the dots still in it (oldest first)
+ */
+static void view_repaint(ui_anchor_view_data_t *data, const lv_area_t *box) {
+    lv_area_t clip;
+    if (!_lv_area_intersect(&clip, box, &data->bounds)) return;
+
+    lv_img_dsc_t *img = lv_canvas_get_img(data->trail);
+    for (lv_coord_t y = clip.y1; y <= clip.y2; y++) {
+        for (lv_coord_t x = clip.x1; x <= clip.x2; x++) {
+            lv_img_buf_set_px_alpha(img, x, y, LV_OPA_TRANSP);
+        }
+    }
+    for (int k = 0; k < data->count; k++) {
+        const view_dot_t *dot = VIEW_DOT(data, k);
+        lv_area_t b;
+        view_dot_box(dot, &b);
+        if (_lv_area_is_on(&b, &clip)) {
+            view_dot_draw(data, dot, &clip);
+        }
+    }
+    view_mark_dirty(data, &clip);
+}
+
+static void view_drop_oldest(ui_anchor_view_data_t *data) {
+    lv_area_t box;
+    view_dot_box(VIEW_DOT(data, 0), &box);
+    data->head = (data->head + 1) % ANCHOR_VIEW_TRAIL_MAX;
+    data->count--;
+    view_repaint(data, &box);
+}
+
+/**
+ * Lay a new dot on top of the trail
+ */
+static void view_add_dot(ui_anchor_view_data_t *data, float east_m, float north_m,
+                         lv_coord_t x, lv_coord_t y) {
+    if (data->count == ANCHOR_VIEW_TRAIL_MAX) {
+        view_drop_oldest(data);
+    }
+    view_dot_t *dot = VIEW_DOT(data, data->count);
+    data->count++;
+    dot->east_m = east_m;
+    dot->north_m = north_m;
+    dot->x = x;
+    dot->y = y;
+    dot->t_ms = lv_tick_get();
+    dot->level = 0;
+
+    lv_area_t box, clip;
+    view_dot_box(dot, &box);
+    if (_lv_area_intersect(&clip, &box, &data->bounds)) {
+        view_dot_draw(data, dot, &clip);
+        view_mark_dirty(data, &clip);
+    }
+}
+
+/**
+ * Ageing pass: expire and fade up to ANCHOR_VIEW_FADE_BATCH dots
+ */
+static void view_fade_timer_cb(lv_timer_t *timer) {
+    ui_anchor_view_data_t *data = (ui_anchor_view_data_t *)timer->user_data;
+    uint32_t now = lv_tick_get();
+    int budget = ANCHOR_VIEW_FADE_BATCH;
+
+    // The oldest dots expire first
+    while (data->count > 0 && budget > 0 &&
+           now - VIEW_DOT(data, 0)->t_ms >= ANCHOR_VIEW_LEVELS * ANCHOR_VIEW_LEVEL_MS) {
+        view_drop_oldest(data);
+        budget--;
+    }
+
+    // A dot fades with age or as newer dots push it down the ring, whichever is
+    // further. Both fall from oldest to newest, so the walk ends at the first level-0 dot.
+    for (int k = 0; k < data->count && budget > 0; k++) {
+        view_dot_t *dot = VIEW_DOT(data, k);
+        uint32_t level = (now - dot->t_ms) / ANCHOR_VIEW_LEVEL_MS;
+        uint32_t rank = (uint32_t)(data->count - 1 - k) * ANCHOR_VIEW_LEVELS / ANCHOR_VIEW_TRAIL_MAX;
+        if (rank > level) level = rank;
+        if (level == 0) break;
+        if (level >= ANCHOR_VIEW_LEVELS) level = ANCHOR_VIEW_LEVELS - 1;  // Expires next pass
+        if (level == dot->level) continue;
+
+        dot->level = (uint8_t)level;
+        lv_area_t box;
+        view_dot_box(dot, &box);
+        view_repaint(data, &box);
+        budget--;
+    }
+
+    view_flush_dirty(data);
+}
+
+/**
+ * Create anchor view
+ */
+lv_obj_t* ui_anchor_view_create(lv_obj_t *parent, lv_coord_t size_px) {
+    ui_anchor_view_data_t *data = malloc(sizeof(ui_anchor_view_data_t));
+    if (data == NULL) {
+        ESP_LOGE(TAG, "Failed to allocate anchor view data");
+        return NULL;
+    }
+    memset(data, 0, sizeof(ui_anchor_view_data_t));
+    data->size = size_px;
+    data->bounds.x2 = size_px - 1;
+    data->bounds.y2 = size_px - 1;
+
+    // Both layers start transparent
+    size_t buf_size = LV_CANVAS_BUF_SIZE_TRUE_COLOR_ALPHA(size_px, size_px);
+    data->static_buf = heap_caps_calloc(1, buf_size, MALLOC_CAP_SPIRAM);
+    data->trail_buf = heap_caps_calloc(1, buf_size, MALLOC_CAP_SPIRAM);
+    if (data->static_buf == NULL || data->trail_buf == NULL) {
+        ESP_LOGE(TAG, "Failed to allocate anchor view canvases (2 x %u bytes PSRAM)",
+                 (unsigned int)buf_size);
+        heap_caps_free(data->static_buf);
+        heap_caps_free(data->trail_buf);
+        free(data);
+        return NULL;
+    }
+
+    // Fade levels: 4 px bright green at 0.8 down to 2 px dim gray at 0.2
+    for (int l = 0; l < ANCHOR_VIEW_LEVELS; l++) {
+        int last = ANCHOR_VIEW_LEVELS - 1;
+        data->dot_color[l] = lv_color_mix(lv_color_hex(COLOR_DISABLED), lv_color_hex(COLOR_SUCCESS),
+                                          (uint8_t)((255 * l) / last));
+        data->dot_opa[l] = (lv_opa_t)(204 - (153 * l) / last);
+        data->dot_px[l] = (uint8_t)(4 - (2 * l + last / 2) / last);
+    }
+
+    lv_obj_t *view = lv_obj_create(parent);
+    lv_obj_remove_style_all(view);
+    lv_obj_set_size(view, size_px, size_px);
+    lv_obj_clear_flag(view, LV_OBJ_FLAG_CLICKABLE | LV_OBJ_FLAG_SCROLLABLE);
+
+    lv_obj_t *base = view_canvas_create(view, data->static_buf, size_px);
+    view_draw_static(base, size_px);
+    data->painter = view_canvas_create(view, data->static_buf, size_px);
+    lv_obj_add_flag(data->painter, LV_OBJ_FLAG_HIDDEN);
+    data->trail = view_canvas_create(view, data->trail_buf, size_px);
+
+    // Rode length just inside the bottom of the circle
+    data->label = lv_label_create(view);
+    lv_label_set_text(data->label, "");
+    THEME_STYLE_TEXT(data->label, COLOR_TEXT_PRIMARY, FONT_LABEL);
+    lv_obj_align(data->label, LV_ALIGN_CENTER, 0, (lv_coord_t)lroundf(size_px / 2 / VIEW_MARGIN) - 14);
+
+    data->boat = lv_canvas_create(view);
+    lv_canvas_set_buffer(data->boat, data->boat_buf, VIEW_BOAT_PX, VIEW_BOAT_PX,
+                         LV_IMG_CF_TRUE_COLOR_ALPHA);
+    lv_img_set_pivot(data->boat, VIEW_BOAT_PX / 2, VIEW_BOAT_PX / 2);
+    lv_obj_clear_flag(data->boat, LV_OBJ_FLAG_CLICKABLE);
+    lv_obj_add_flag(data->boat, LV_OBJ_FLAG_HIDDEN);
+    view_draw_boat(data);
+
+    data->wind = lv_line_create(view);
+    lv_obj_set_size(data->wind, VIEW_WIND_BOX_PX, VIEW_WIND_BOX_PX);
+    lv_obj_align(data->wind, LV_ALIGN_TOP_RIGHT, 0, 0);
+    lv_obj_set_style_line_width(data->wind, 3, 0);
+    lv_obj_set_style_line_color(data->wind, lv_color_hex(COLOR_INFO), 0);
+    lv_obj_set_style_line_rounded(data->wind, true, 0);
+    lv_obj_add_flag(data->wind, LV_OBJ_FLAG_HIDDEN);
+
+    data->fade_timer = lv_timer_create(view_fade_timer_cb, ANCHOR_VIEW_FADE_PASS_MS, data);
+
+    lv_obj_set_user_data(view, data);
+    lv_obj_add_event_cb(view, view_delete_cb, LV_EVENT_DELETE, NULL);
+
+    ESP_LOGI(TAG, "Anchor view created: %dx%d px, 2 x %u bytes PSRAM", (int)size_px,
+             (int)size_px, (unsigned int)buf_size);
+    return view;
+}
+
+/**
+ * Scale the view to scale_m at the circle, labelled with the length or not
+ */
+static void view_set_scale(lv_obj_t *view, float scale_m, bool labelled) {
+    if (view == NULL || scale_m <= 0.0f) return;
+
+    ui_anchor_view_data_t *data = (ui_anchor_view_data_t *)lv_obj_get_user_data(view);
+    if (data == NULL || (scale_m == data->rode_m && labelled == data->rode_labelled)) return;
+
+    if (labelled) {
+        lv_label_set_text_fmt(data->label, "%d m", (int)lroundf(scale_m));
+    } else {
+        lv_label_set_text(data->label, "");
+    }
+    data->rode_labelled = labelled;
+    if (scale_m == data->rode_m) return;
+
+    data->rode_m = scale_m;
+    data->px_per_m = (data->size / 2) / (scale_m * VIEW_MARGIN);
+
+    // Re-project the trail at the new scale
+    memset(data->trail_buf, 0, LV_CANVAS_BUF_SIZE_TRUE_COLOR_ALPHA(data->size, data->size));
+    for (int k = 0; k < data->count; k++) {
+        view_dot_t *dot = VIEW_DOT(data, k);
+        view_project(data, dot->east_m, dot->north_m, &dot->x, &dot->y);
+        view_dot_draw(data, dot, &data->bounds);
+    }
+    data->dirty_count = 0;
+
+    // Neighbors move and resize with the scale
+    lv_area_t box;
+    bool drawn = view_own_box(data, &box);
+    for (int s = 0; s < NEIGHBOR_MAX_TARGETS && !drawn; s++) {
+        drawn = data->neighbors[s].mmsi != 0;
+    }
+    if (drawn) {
+        view_draw_base(data);
+    }
+    lv_obj_invalidate(data->trail);
+}
+
+/**
+ * Set the rode length that scales the view
+ */
+void ui_anchor_view_set_rode(lv_obj_t *view, float rode_m) {
+    view_set_scale(view, rode_m, true);
+}
+
+/**
+ * Scale the view to a range without a rode label
+ */
+void ui_anchor_view_set_range(lv_obj_t *view, float range_m) {
+    view_set_scale(view, range_m, false);
+}
+
+/**
+ * Move the boat and extend the trail
+ */
+void ui_anchor_view_set_boat(lv_obj_t *view, float east_m, float north_m,
+                             float heading_deg, bool near_limit) {
+    if (view == NULL) return;
+
+    ui_anchor_view_data_t *data = (ui_anchor_view_data_t *)lv_obj_get_user_data(view);
+    if (data == NULL || data->rode_m <= 0.0f) return;
+
+    lv_coord_t x, y;
+    view_project(data, east_m, north_m, &x, &y);
+
+    // A dot per ANCHOR_VIEW_SPACING_PX of movement, so a quiet boat adds nothing
+    bool add = (data->count == 0);
+    if (!add) {
+        const view_dot_t *last = VIEW_DOT(data, data->count - 1);
+        int dx = x - last->x, dy = y - last->y;
+        add = dx * dx + dy * dy >= ANCHOR_VIEW_SPACING_PX * ANCHOR_VIEW_SPACING_PX;
+    }
+    if (add) {
+        view_add_dot(data, east_m, north_m, x, y);
+        view_flush_dirty(data);
+    }
+
+    if (near_limit != data->boat_warn) {
+        data->boat_warn = near_limit;
+        view_draw_boat(data);
+    }
+
+    // Unknown heading: a boat lies bow to the anchor
+    if (heading_deg < 0.0f) {
+        heading_deg = (float)(atan2(-east_m, -north_m) * 180.0 / M_PI);
+    }
+    int angle = (int)lroundf(heading_deg * 10.0f / VIEW_ANGLE_STEP) * VIEW_ANGLE_STEP;
+    angle = ((angle % 3600) + 3600) % 3600;
+
+    // LVGL skips unchanged positions and angles, so a still boat costs nothing
+    lv_obj_set_pos(data->boat, x - VIEW_BOAT_PX / 2, y - VIEW_BOAT_PX / 2);
+    lv_img_set_angle(data->boat, (int16_t)angle);
+    if (!data->boat_shown) {
+        lv_obj_clear_flag(data->boat, LV_OBJ_FLAG_HIDDEN);
+        data->boat_shown = true;
+    }
+}
+
+/**
+ * Set the wind arrow
+ */
+void ui_anchor_view_set_wind(lv_obj_t *view, float speed_mps, float from_deg) {
+    if (view == NULL) return;
+
+    ui_anchor_view_data_t *data = (ui_anchor_view_data_t *)lv_obj_get_user_data(view);
+    if (data == NULL) return;
+
+    if (speed_mps < 0.0f) {
+        if (data->wind_shown) {
+            lv_obj_add_flag(data->wind, LV_OBJ_FLAG_HIDDEN);
+            data->wind_shown = false;
+        }
+        return;
+    }
+
+    // Arrow points downwind, centred in its box, length proportional to speed
+    float len = (VIEW_WIND_BOX_PX - 8) * fminf(speed_mps / VIEW_WIND_FULL_MPS, 1.0f);
+    if (len < VIEW_WIND_MIN_PX) len = VIEW_WIND_MIN_PX;
+    float to = (from_deg + 180.0f) * (float)M_PI / 180.0f;
+    float ux = sinf(to), uy = -cosf(to);
+    float c = VIEW_WIND_BOX_PX / 2;
+    float tip_x = c + ux * len / 2, tip_y = c + uy * len / 2;
+    float back_x = tip_x - ux * VIEW_WIND_BARB_PX, back_y = tip_y - uy * VIEW_WIND_BARB_PX;
+    float side = VIEW_WIND_BARB_PX * 0.6f;
+
+    // Shaft, then out and back along each barb
+    lv_point_t pts[5];
+    pts[0].x = (lv_coord_t)lroundf(c - ux * len / 2);
+    pts[0].y = (lv_coord_t)lroundf(c - uy * len / 2);
+    pts[1].x = (lv_coord_t)lroundf(tip_x);
+    pts[1].y = (lv_coord_t)lroundf(tip_y);
+    pts[2].x = (lv_coord_t)lroundf(back_x - uy * side);
+    pts[2].y = (lv_coord_t)lroundf(back_y + ux * side);
+    pts[3] = pts[1];
+    pts[4].x = (lv_coord_t)lroundf(back_x + uy * side);
+    pts[4].y = (lv_coord_t)lroundf(back_y - ux * side);
+
+    if (memcmp(pts, data->wind_pts, sizeof(pts)) != 0) {
+        memcpy(data->wind_pts, pts, sizeof(pts));
+        lv_line_set_points(data->wind, data->wind_pts, 5);
+    }
+    if (!data->wind_shown) {
+        lv_obj_clear_flag(data->wind, LV_OBJ_FLAG_HIDDEN);
+        data->wind_shown = true;
+    }
+}
+
+/**
+ * Draw AIS neighbors and our predicted swing circle
+ */
+int ui_anchor_view_set_neighbors(lv_obj_t *view, const neighbor_view_t *views, int count,
+                                 float own_radius_m) {
+    if (view == NULL) return 0;
+
+    ui_anchor_view_data_t *data = (ui_anchor_view_data_t *)lv_obj_get_user_data(view);
+    if (data == NULL) return 0;
+
+    // Old and new boxes of everything that changed (canvas coordinates)
+    int redrawn = 0;
+    lv_area_t box;
+    if (views == NULL) {
+        own_radius_m = 0.0f;
+    }
+    if (own_radius_m != data->own_radius_m) {
+        if (view_own_box(data, &box)) view_mark_dirty(data, &box);
+        data->own_radius_m = own_radius_m;
+        if (view_own_box(data, &box)) view_mark_dirty(data, &box);
+        redrawn++;
+    }
+
+    if (views == NULL || count > NEIGHBOR_MAX_TARGETS) {
+        count = (views == NULL) ? 0 : NEIGHBOR_MAX_TARGETS;
+    }
+    for (int s = 0; s < NEIGHBOR_MAX_TARGETS; s++) {
+        neighbor_view_t *drawn = &data->neighbors[s];
+        const neighbor_view_t *v = (s < count) ? &views[s] : NULL;
+        uint32_t mmsi = (v != NULL) ? v->mmsi : 0;
+
+        if (mmsi == drawn->mmsi && (mmsi == 0 || v->version == drawn->version)) {
+            continue;   // Unchanged - no invalidation
+        }
+        if (view_neighbor_box(data, drawn, &box)) view_mark_dirty(data, &box);
+        if (mmsi == 0) {
+            drawn->mmsi = 0;
+        } else {
+            *drawn = *v;
+            if (view_neighbor_box(data, drawn, &box)) view_mark_dirty(data, &box);
+        }
+        redrawn++;
+    }
+
+    if (redrawn > 0) {
+        view_draw_base(data);
+        view_flush_dirty(data);
+    }
+    return redrawn;
+}
+
+/**
+ * Drop the trail and hide the boat
+ */
+void ui_anchor_view_clear(lv_obj_t *view) {
+    if (view == NULL) return;
+
+    ui_anchor_view_data_t *data = (ui_anchor_view_data_t *)lv_obj_get_user_data(view);
+    if (data == NULL) return;
+
+    if (data->count > 0) {
+        memset(data->trail_buf, 0, LV_CANVAS_BUF_SIZE_TRUE_COLOR_ALPHA(data->size, data->size));
+        data->head = 0;
+        data->count = 0;
+        data->dirty_count = 0;
+        lv_obj_invalidate(data->trail);
+    }
+    if (data->boat_shown) {
+        lv_obj_add_flag(data->boat, LV_OBJ_FLAG_HIDDEN);
+        data->boat_shown = false;
+    }
+}
@@ -0,0 +1,119 @@
+/**
+ * UI Anchor View Widget
+ *
+ * Author: Colin Bitterfield
+ * Email: colin@bitterfield.com
+ * Date Created: 2026-10-18
+ * Date Updated: 2026-10-18
+ * Version: 0.2.0
+ *
+ * Changelog:
+ * - 0.2.0 (2026-10-18): AIS neighbors and our swing circle drawn into the static canvas
+ * - 0.1.1 (2026-10-18): ui_anchor_view_set_range() for an unknown rode (no label)
+ *
+ * The anchor visualization from docs/anchoring_mode_specification.md: the
+ * anchor at the centre, the dashed rode circle with its length, the boat
+ * as a triangle pointing along its heading, a trail of fading dots and a
+ * wind arrow in the top-right corner. North is up and the scale follows
+ * the rode: (size / 2) / (rode * 1.2) pixels per metre, so the circle
+ * always has the same radius on screen and only its label changes. AIS
+ * neighbors (anchor_neighbors.h) and our predicted swing circle share that
+ * scale, under the rode circle.
+ *
+ * Built to be fed at the fix rate (10 Hz) without repainting the screen:
+ * - The circle and anchor are drawn into a PSRAM canvas at creation, with
+ *   the neighbors under them. The canvas is redrawn only when a neighbor's
+ *   version or our swing radius changes, and only the boxes of the
+ *   neighbors that changed are invalidated.
+ * - The trail is a second PSRAM canvas that persists between updates. A
+ *   new dot writes its few pixels and invalidates just its box; a dot that
+ *   ages or expires repaints its box from the dots still under it.
+ * - A dot fades with age and as newer dots push it along the ring. Ageing
+ *   runs in passes once a second, at most ANCHOR_VIEW_FADE_BATCH dots per
+ *   pass; the rest carry over to the next pass.
+ * - The boat and wind arrow are small objects that move or redraw only
+ *   when their rounded pixels change.
+ * Dirty boxes are merged into at most ANCHOR_VIEW_DIRTY_MAX areas before
+ * they reach LVGL, whose invalid-area list (LV_INV_BUF_SIZE, 32) falls back
+ * to refreshing the whole 800x480 screen when it overflows.
+ */
+
+#ifndef UI_ANCHOR_VIEW_H
+#define UI_ANCHOR_VIEW_H
+
+#include "lvgl.h"
+#include "anchor_neighbors.h"
+#include <stdbool.h>
+
+#define ANCHOR_VIEW_TRAIL_MAX       200     // Dots kept (oldest dropped first)
+#define ANCHOR_VIEW_SPACING_PX      3       // Boat movement before the next dot
+#define ANCHOR_VIEW_LEVELS          4       // Fade steps from bright green to dim gray
+#define ANCHOR_VIEW_LEVEL_MS        300000  // Age per fade step (trail spans 20 minutes)
+#define ANCHOR_VIEW_FADE_PASS_MS    1000    // Ageing pass period
+#define ANCHOR_VIEW_FADE_BATCH      16      // Dots repainted per ageing pass
+#define ANCHOR_VIEW_DIRTY_MAX       8       // Areas handed to LVGL per update
+
+/**
+ * Create anchor view
+ * @param parent Parent object
+ * @param size_px Edge length of the square view (pixels)
+ * @return View object, or NULL on allocation failure
+ */
+lv_obj_t* ui_anchor_view_create(lv_obj_t *parent, lv_coord_t size_px);
+
+/**
+ * Set the rode length that scales the view (no-op if unchanged)
+ * A new scale re-projects the trail, the one update that redraws the whole view.
+ * @param view Object returned from ui_anchor_view_create()
+ * @param rode_m Rode paid out (metres)
+ */
+void ui_anchor_view_set_rode(lv_obj_t *view, float rode_m);
+
+/**
+ * Scale the view to a range with no rode label (rode length unknown)
+ * Same scaling as ui_anchor_view_set_rode(), but the circle is left unlabelled
+ * so the range is not read as rode paid out.
+ * @param view Object returned from ui_anchor_view_create()
+ * @param range_m Distance drawn at the circle (metres)
+ */
+void ui_anchor_view_set_range(lv_obj_t *view, float range_m);
+
+/**
+ * Move the boat and extend the trail (call per fix)
+ * @param view Object returned from ui_anchor_view_create()
+ * @param east_m Boat east of the anchor (metres)
+ * @param north_m Boat north of the anchor (metres)
+ * @param heading_deg True heading (negative = unknown: bow towards the anchor)
+ * @param near_limit Draw the boat in the warning colour
+ */
+void ui_anchor_view_set_boat(lv_obj_t *view, float east_m, float north_m,
+                             float heading_deg, bool near_limit);
+
+/**
+ * Set the wind arrow
+ * @param view Object returned from ui_anchor_view_create()
+ * @param speed_mps Wind speed (m/s, negative = hide)
+ * @param from_deg True direction the wind blows from (degrees)
+ */
+void ui_anchor_view_set_wind(lv_obj_t *view, float speed_mps, float from_deg);
+
+/**
+ * Draw AIS neighbors and our predicted swing circle (call at 1 Hz)
+ * Anchored neighbors are circles, moving targets dots; flagged targets are drawn in
+ * the danger colour.
+ * @param view Object returned from ui_anchor_view_create()
+ * @param views Drawn state per slot (anchor_watch_get_neighbors(), NULL = hide all)
+ * @param count Entries in views
+ * @param own_radius_m Our predicted swing radius (0 = hide)
+ * @return Neighbors and circles redrawn
+ */
+int ui_anchor_view_set_neighbors(lv_obj_t *view, const neighbor_view_t *views, int count,
+                                 float own_radius_m);
+
+/**
+ * Drop the trail and hide the boat (anchor lifted or moved)
+ * @param view Object returned from ui_anchor_view_create()
+ */
+void ui_anchor_view_clear(lv_obj_t *view);
+
+#endif // UI_ANCHOR_VIEW_H
@@ -4,10 +4,11 @@
  * Author: Colin Bitterfield
  * Email: colin@bitterfield.com
  * Date Created: 2025-12-22
- * Date Updated: 2025-12-23
- * Version: 0.6.0
+ * Date Updated: 2026-10-18
+ * Version: 0.7.0
  *
  * Changelog:
+ * - 0.7.0 (2026-10-18): Single shared footer on lv_layer_top, attached per screen
  * - 0.6.0 (2025-12-23): Fixed timer - use repeating timer that pauses after hiding
  * - 0.5.0 (2025-12-23): Fixed auto-hide timer to be one-shot instead of repeating
  * - 0.4.0 (2025-12-22): Added debug control, removed visual artifacts
@@ -60,6 +61,9 @@ typedef struct {
     bool is_visible;                   // Visibility state
 } ui_footer_data_t;
 
+// Shared footer on lv_layer_top() (NULL until ui_footer_init())
+static ui_footer_data_t *s_footer = NULL;
+
 // Forward declarations
 static void auto_hide_timer_cb(lv_timer_t *timer);
 static void test_timer_cb(lv_timer_t *timer);
@@ -186,10 +190,33 @@ static void footer_gesture_event_cb(lv_event_t *e) {
 }
 
 /**
- * Create navigation footer bar
+ * Show the footer on an attached screen, hide it when that screen goes away
+ */
+static void footer_screen_event_cb(lv_event_t *e) {
+    if (s_footer == NULL) return;
+
+    if (lv_event_get_code(e) == LV_EVENT_SCREEN_LOAD_START) {
+        ui_page_t page = (ui_page_t)(intptr_t)lv_event_get_user_data(e);
+        if (page != s_footer->current_page) {
+            ui_footer_set_page(s_footer->footer_bar, page);
+        }
+        ui_footer_show(s_footer->footer_bar);
+    } else {
+        ui_footer_hide(s_footer->footer_bar);
+    }
+}
+
+/**
+ * Create the shared navigation footer on the top layer
  */
-lv_obj_t* ui_footer_create(lv_obj_t *parent, ui_page_t current_page, ui_footer_page_cb_t page_callback) {
-    ESP_LOGI(TAG, "=== CREATING FOOTER BAR ===");
+lv_obj_t* ui_footer_init(ui_footer_page_cb_t page_callback) {
+    if (s_footer != NULL) {
+        return s_footer->footer_bar;
+    }
+
+    lv_obj_t *parent = lv_layer_top();
+    ui_page_t current_page = PAGE_START;
+    ESP_LOGI(TAG, "=== CREATING SHARED FOOTER BAR (top layer) ===");
     ESP_LOGI(TAG, "    Initial page: [%s] (%d)", page_names[current_page], current_page);
     ESP_LOGI(TAG, "    Auto-hide timeout: %d ms", FOOTER_AUTO_HIDE_MS);
 
@@ -202,7 +229,7 @@ lv_obj_t* ui_footer_create(lv_obj_t *parent, ui_page_t current_page, ui_footer_p
     memset(data, 0, sizeof(ui_footer_data_t));
     data->current_page = current_page;
     data->page_callback = page_callback;
-    data->is_visible = true;  // Start visible
+    data->is_visible = false;  // Hidden until an attached screen loads
 
     // Create footer bar container (full width, clean design)
     data->footer_bar = lv_obj_create(parent);
@@ -214,6 +241,7 @@ lv_obj_t* ui_footer_create(lv_obj_t *parent, ui_page_t current_page, ui_footer_p
     lv_obj_set_style_pad_all(data->footer_bar, 10, 0);
     lv_obj_set_style_radius(data->footer_bar, 0, 0);
     lv_obj_clear_flag(data->footer_bar, LV_OBJ_FLAG_SCROLLABLE);
+    lv_obj_add_flag(data->footer_bar, LV_OBJ_FLAG_HIDDEN);
     lv_obj_set_style_shadow_width(data->footer_bar, 20, 0);
     lv_obj_set_style_shadow_color(data->footer_bar, lv_color_black(), 0);
     lv_obj_set_style_shadow_opa(data->footer_bar, LV_OPA_60, 0);
@@ -306,7 +334,8 @@ lv_obj_t* ui_footer_create(lv_obj_t *parent, ui_page_t current_page, ui_footer_p
         if (data->auto_hide_timer == NULL) {
             ESP_LOGE(TAG, "Failed to create auto-hide timer!");
         } else {
-            FOOTER_LOG_EVENT("Auto-hide timer created: will hide footer in %d ms", FOOTER_AUTO_HIDE_MS);
+            lv_timer_pause(data->auto_hide_timer);  // Started by ui_footer_show()
+            FOOTER_LOG_EVENT("Auto-hide timer created: will hide footer %d ms after shown", FOOTER_AUTO_HIDE_MS);
             FOOTER_LOG_DEBUG("    Timer address: %p", (void*)data->auto_hide_timer);
         }
     } else {
@@ -320,10 +349,33 @@ lv_obj_t* ui_footer_create(lv_obj_t *parent, ui_page_t current_page, ui_footer_p
     //     ESP_LOGI(TAG, "[TEST] Created 2-second test timer to verify timer system works");
     // }
 
-    FOOTER_LOG_DEBUG("=== FOOTER BAR CREATED (visible, timer running) ===");
+    s_footer = data;
+    FOOTER_LOG_DEBUG("=== FOOTER BAR CREATED (hidden, timer paused) ===");
     return data->footer_bar;
 }
 
+/**
+ * Get the shared footer
+ */
+lv_obj_t* ui_footer_get(void) {
+    return s_footer != NULL ? s_footer->footer_bar : NULL;
+}
+
+/**
+ * Show the footer with a page highlighted while a screen is loaded
+ */
+void ui_footer_attach(lv_obj_t *screen, ui_page_t page) {
+    if (s_footer == NULL || screen == NULL) return;
+
+    lv_obj_add_event_cb(screen, footer_screen_event_cb, LV_EVENT_SCREEN_LOAD_START, (void *)(intptr_t)page);
+    lv_obj_add_event_cb(screen, footer_screen_event_cb, LV_EVENT_SCREEN_UNLOAD_START, NULL);
+    if (screen == lv_scr_act()) {
+        ui_footer_set_page(s_footer->footer_bar, page);
+        ui_footer_show(s_footer->footer_bar);
+    }
+    FOOTER_LOG_DEBUG("    Screen %p attached to footer page [%s]", (void*)screen, page_names[page]);
+}
+
 /**
  * Update current page
  */
@@ -436,26 +488,3 @@ void ui_footer_reset_timer(lv_obj_t *footer) {
     FOOTER_LOG_EVENT("Auto-hide timer RESET - footer will hide in %d ms (10 sec)", FOOTER_AUTO_HIDE_MS);
     FOOTER_LOG_DEBUG("    Timer reset and resumed");
 }
-
-/**
- * Clean up footer resources (call before deleting footer)
- */
-void ui_footer_cleanup(lv_obj_t *footer) {
-    if (footer == NULL) return;
-
-    ui_footer_data_t *data = (ui_footer_data_t *)lv_obj_get_user_data(footer);
-    if (data == NULL) return;
-
-    // Delete auto-hide timer
-    if (data->auto_hide_timer != NULL) {
-        lv_timer_del(data->auto_hide_timer);
-        data->auto_hide_timer = NULL;
-        FOOTER_LOG_DEBUG("=== FOOTER CLEANUP: Timer deleted ===");
-    }
-
-    // Free footer data
-    free(data);
-    lv_obj_set_user_data(footer, NULL);
-
-    FOOTER_LOG_DEBUG("=== FOOTER CLEANUP: Resources freed ===");
-}
@@ -4,10 +4,11 @@
  * Author: Colin Bitterfield
  * Email: colin@bitterfield.com
  * Date Created: 2025-12-22
- * Date Updated: 2025-12-22
- * Version: 0.2.0
+ * Date Updated: 2026-10-18
+ * Version: 0.3.0
  *
  * Changelog:
+ * - 0.3.0 (2026-10-18): Single shared footer on lv_layer_top, attached per screen
  * - 0.2.0 (2025-12-22): Added auto-hide, swipe gestures, button navigation
  * - 0.1.0 (2025-12-22): Initial implementation with page indicators
  *
@@ -18,8 +19,10 @@
  * - Swipe left/right to navigate between buttons
  * - Page indicators showing current position
  *
- * Appears on navigation screens (START, INFO, PGN, CONFIG, UPDATE, TOOLS)
- * Hidden on DISPLAY and SPLASH screens
+ * One footer exists, created on lv_layer_top() by ui_footer_init(), so it
+ * survives screen loads. A screen calls ui_footer_attach() with its page:
+ * while that screen is loaded the footer is shown with the page highlighted,
+ * and it is hidden on screens that did not attach (tool sub-screens).
  */
 
 #ifndef UI_FOOTER_H
@@ -52,17 +55,29 @@ typedef enum {
 typedef void (*ui_footer_page_cb_t)(ui_page_t page);
 
 /**
- * Create navigation footer bar
- * @param parent Parent screen/container to attach footer to
- * @param current_page Current page index (0-5)
+ * Create the shared navigation footer on the top layer (first call only)
+ * The footer stays hidden until a screen attached with ui_footer_attach() loads.
  * @param page_callback Callback function when page button is clicked
- * @return Pointer to footer container object
+ * @return Shared footer object, or NULL on allocation failure
+ */
+lv_obj_t* ui_footer_init(ui_footer_page_cb_t page_callback);
+
+/**
+ * Get the shared footer
+ * @return Footer object, or NULL before ui_footer_init()
  */
-lv_obj_t* ui_footer_create(lv_obj_t *parent, ui_page_t current_page, ui_footer_page_cb_t page_callback);
+lv_obj_t* ui_footer_get(void);
+
+/**
+ * Show the footer with a page highlighted while a screen is loaded
+ * @param screen Screen object (lv_obj_create(NULL))
+ * @param page Page highlighted on that screen
+ */
+void ui_footer_attach(lv_obj_t *screen, ui_page_t page);
 
 /**
  * Update current page
- * @param footer Footer object returned from ui_footer_create()
+ * @param footer Footer object returned from ui_footer_init()
  * @param current_page Current page index (0-5)
  */
 void ui_footer_set_page(lv_obj_t *footer, ui_page_t current_page);
@@ -92,12 +107,6 @@ bool ui_footer_is_visible(lv_obj_t *footer);
  */
 void ui_footer_reset_timer(lv_obj_t *footer);
 
-/**
- * Clean up footer resources (call before deleting footer)
- * @param footer Footer object
- */
-void ui_footer_cleanup(lv_obj_t *footer);
-
 /**
  * Enable or disable debug logging
  * @param enable true to enable, false to disable
@@ -4,10 +4,11 @@
  * Author: Colin Bitterfield
  * Email: colin@bitterfield.com
  * Date Created: 2025-12-22
- * Date Updated: 2025-12-25
- * Version: 0.5.0
+ * Date Updated: 2026-10-18
+ * Version: 0.6.0
  *
  * Changelog:
+ * - 0.6.0 (2026-10-18): Single shared header on lv_layer_top, attached per screen
  * - 0.5.0 (2025-12-25): Updated icons to GPS, Compass, TF Card, Anchor (armed), WiFi, Bluetooth
  * - 0.4.0 (2025-12-25): Filled all 6 status icons (Battery, SD Card, WiFi, Alarm, Compass, GPS)
  * - 0.3.0 (2025-12-25): Changed GPS icon to satellite emoji for better visibility
@@ -17,6 +18,7 @@
 
 #include "ui_header.h"
 #include "ui_theme.h"
+#include "ui_status.h"
 #include "board_config.h"
 #include "fonts/custom_fonts.h"
 #include "esp_log.h"
@@ -40,11 +42,62 @@ typedef struct {
     lv_obj_t *icon_labels[6];  // Labels for each icon
 } ui_header_data_t;
 
+// Shared header on lv_layer_top() (NULL until the first screen attaches)
+static ui_header_data_t *s_header = NULL;
+
 /**
- * Create full-width header bar with title and icon placeholders
+ * Apply status model changes (visible header only, once per frame)
  */
-lv_obj_t* ui_header_create(lv_obj_t *parent) {
-    ESP_LOGI(TAG, "Creating full-width header bar");
+static void header_status_cb(lv_obj_t *header, const ui_status_t *status, uint32_t changed,
+                             void *user_data) {
+    if (changed & UI_STATUS_MASK(UI_STATUS_TIME)) {
+        ui_header_set_time(header, status->hour, status->min, status->sec);
+    }
+    if (changed & UI_STATUS_MASK(UI_STATUS_GPS)) {
+        ui_header_set_gps_status(header, status->flag[UI_STATUS_GPS]);
+    }
+    if (changed & UI_STATUS_MASK(UI_STATUS_COMPASS)) {
+        ui_header_set_compass_status(header, status->flag[UI_STATUS_COMPASS]);
+    }
+    if (changed & UI_STATUS_MASK(UI_STATUS_SD)) {
+        ui_header_set_tfcard_status(header, status->flag[UI_STATUS_SD]);
+    }
+    if (changed & UI_STATUS_MASK(UI_STATUS_WIFI)) {
+        ui_header_set_wifi_status(header, status->flag[UI_STATUS_WIFI]);
+    }
+    if (changed & UI_STATUS_MASK(UI_STATUS_BT)) {
+        ui_header_set_bluetooth_status(header, status->flag[UI_STATUS_BT]);
+    }
+    if (changed & (UI_STATUS_MASK(UI_STATUS_ARMED) | UI_STATUS_MASK(UI_STATUS_ALARM))) {
+        ui_header_set_anchor_armed(header, status->flag[UI_STATUS_ARMED]);
+        if (status->flag[UI_STATUS_ALARM]) {
+            // Alarm overrides armed: red anchor icon
+            ui_header_data_t *data = (ui_header_data_t *)lv_obj_get_user_data(header);
+            lv_obj_set_style_bg_color(data->right_icons[2], lv_color_hex(COLOR_DANGER), 0);
+            lv_obj_set_style_border_color(data->right_icons[2], lv_color_hex(0xAA0000), 0);
+        }
+    }
+}
+
+/**
+ * Show the header on an attached screen, hide it when that screen goes away
+ */
+static void header_screen_event_cb(lv_event_t *e) {
+    if (s_header == NULL) return;
+
+    if (lv_event_get_code(e) == LV_EVENT_SCREEN_LOAD_START) {
+        lv_obj_clear_flag(s_header->header_bar, LV_OBJ_FLAG_HIDDEN);
+    } else {
+        lv_obj_add_flag(s_header->header_bar, LV_OBJ_FLAG_HIDDEN);
+    }
+}
+
+/**
+ * Create the shared header bar on the top layer (hidden until a screen loads)
+ */
+static lv_obj_t* header_create(void) {
+    lv_obj_t *parent = lv_layer_top();
+    ESP_LOGI(TAG, "Creating shared header bar on top layer");
 
     // Allocate header data (LVGL 8.x)
     ui_header_data_t *data = malloc(sizeof(ui_header_data_t));
@@ -64,6 +117,7 @@ lv_obj_t* ui_header_create(lv_obj_t *parent) {
     lv_obj_set_style_pad_all(data->header_bar, 0, 0);
     lv_obj_set_style_radius(data->header_bar, 0, 0);
     lv_obj_clear_flag(data->header_bar, LV_OBJ_FLAG_SCROLLABLE);
+    lv_obj_add_flag(data->header_bar, LV_OBJ_FLAG_HIDDEN);
 
     // Title label: "ANCHOR DRAG ALARM" (center, top)
     data->title_label = lv_label_create(data->header_bar);
@@ -152,10 +206,33 @@ lv_obj_t* ui_header_create(lv_obj_t *parent) {
     // Store data as user data (use header_bar as the handle)
     lv_obj_set_user_data(data->header_bar, data);
 
+    // Clock and icons follow the status model (top layer: always delivered)
+    ui_status_subscribe(data->header_bar, UI_STATUS_ALL, header_status_cb, NULL);
+
+    s_header = data;
     ESP_LOGI(TAG, "Header bar created: %dx%d at top", HEADER_WIDTH, HEADER_HEIGHT);
     return data->header_bar;
 }
 
+/**
+ * Show the shared header while a screen is loaded (created on first use)
+ */
+lv_obj_t* ui_header_attach(lv_obj_t *screen) {
+    if (s_header == NULL && header_create() == NULL) {
+        return NULL;
+    }
+    if (screen == NULL) {
+        return s_header->header_bar;
+    }
+
+    lv_obj_add_event_cb(screen, header_screen_event_cb, LV_EVENT_SCREEN_LOAD_START, NULL);
+    lv_obj_add_event_cb(screen, header_screen_event_cb, LV_EVENT_SCREEN_UNLOAD_START, NULL);
+    if (screen == lv_scr_act()) {
+        lv_obj_clear_flag(s_header->header_bar, LV_OBJ_FLAG_HIDDEN);
+    }
+    return s_header->header_bar;
+}
+
 /**
  * Update GPS status icon (right side, position 1)
  */
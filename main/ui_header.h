@@ -4,8 +4,8 @@
  * Author: Colin Bitterfield
  * Email: colin@bitterfield.com
  * Date Created: 2025-12-22
- * Date Updated: 2025-12-25
- * Version: 0.5.0
+ * Date Updated: 2026-10-18
+ * Version: 0.6.0
  *
  * Full-width header bar (800x80px) with:
  * - "ANCHOR DRAG ALARM" title (center)
@@ -17,9 +17,15 @@
  * - Blue: Connected (WiFi, Bluetooth, Compass found)
  * - Gray: Inactive/Off/Not found (default state)
  *
- * Appears on all screens as a persistent header
+ * One header exists, created on lv_layer_top() the first time a screen is
+ * attached, so it survives screen loads: a screen calls ui_header_attach()
+ * and the header is shown while that screen is loaded and hidden on screens
+ * that did not attach (splash, test pattern). A screen switch re-renders
+ * only the screen content. The clock and icons subscribe to the status
+ * model (ui_status.h), which is the only writer of the icons.
  *
  * Changelog:
+ * - 0.6.0 (2026-10-18): Single shared header on lv_layer_top, attached per screen
  * - 0.5.0 (2025-12-25): Updated icons to GPS, Compass, TF Card, Anchor (armed), WiFi, Bluetooth
  * - 0.4.0 (2025-12-25): Filled all 6 status icons (Battery, SD Card, WiFi, Alarm, Compass, GPS)
  * - 0.3.0 (2025-12-25): Changed GPS icon to satellite emoji for better visibility
@@ -38,57 +44,57 @@
 #define HEADER_WIDTH  800
 
 /**
- * Create full-width header bar with title and icon placeholders
- * @param parent Parent screen/container to attach header to
- * @return Pointer to header container object
+ * Show the shared header while a screen is loaded (created on first use)
+ * @param screen Screen object (lv_obj_create(NULL))
+ * @return Shared header object, or NULL on allocation failure
  */
-lv_obj_t* ui_header_create(lv_obj_t *parent);
+lv_obj_t* ui_header_attach(lv_obj_t *screen);
 
 /**
  * Update GPS status icon (right side, position 1)
- * @param header Header object returned from ui_header_create()
+ * @param header Header object returned from ui_header_attach()
  * @param found true = GPS found (green), false = GPS not found (gray)
  */
 void ui_header_set_gps_status(lv_obj_t *header, bool found);
 
 /**
  * Update Compass status icon (right side, position 0)
- * @param header Header object returned from ui_header_create()
+ * @param header Header object returned from ui_header_attach()
  * @param found true = Compass found (blue), false = Compass not found (gray)
  */
 void ui_header_set_compass_status(lv_obj_t *header, bool found);
 
 /**
  * Update Anchor Armed status icon (right side, position 2)
- * @param header Header object returned from ui_header_create()
+ * @param header Header object returned from ui_header_attach()
  * @param armed true = Anchor armed (green), false = Not armed (gray)
  */
 void ui_header_set_anchor_armed(lv_obj_t *header, bool armed);
 
 /**
  * Update TF Card (SD Card) status icon (left side, position 2)
- * @param header Header object returned from ui_header_create()
+ * @param header Header object returned from ui_header_attach()
  * @param detected true = TF card detected (green), false = Not detected (gray)
  */
 void ui_header_set_tfcard_status(lv_obj_t *header, bool detected);
 
 /**
  * Update WiFi status icon (left side, position 1)
- * @param header Header object returned from ui_header_create()
+ * @param header Header object returned from ui_header_attach()
  * @param connected true = WiFi connected (blue), false = Disconnected (gray)
  */
 void ui_header_set_wifi_status(lv_obj_t *header, bool connected);
 
 /**
  * Update Bluetooth status icon (left side, position 0)
- * @param header Header object returned from ui_header_create()
+ * @param header Header object returned from ui_header_attach()
  * @param connected true = Bluetooth connected (blue), false = Disconnected (gray)
  */
 void ui_header_set_bluetooth_status(lv_obj_t *header, bool connected);
 
 /**
  * Update time display in header
- * @param header Header object returned from ui_header_create()
+ * @param header Header object returned from ui_header_attach()
  * @param hour Hour (0-23)
  * @param min Minute (0-59)
  * @param sec Second (0-59)
@@ -0,0 +1,123 @@
+/**
+ * UI Swing Envelope Heatmap Layer Implementation
+ *
+ * Author: Colin Bitterfield
+ * Email: colin@bitterfield.com
+ * Date Created: 2026-10-18
+ * Version: 0.1.0
+ */
+
+#include "ui_heatmap.h"
+#include "ui_theme.h"
+#include "esp_log.h"
+#include <string.h>
+#include <stdlib.h>
+
+static const char *TAG = "ui_heatmap";
+
+// Opacity ramp for occupied cells (empty cells are fully transparent)
+#define HEATMAP_OPA_MIN     LV_OPA_20
+#define HEATMAP_OPA_MAX     LV_OPA_80
+
+// Heatmap data stored as user data
+typedef struct {
+    uint8_t *buf;           // Canvas pixel buffer (TRUE_COLOR_ALPHA)
+    uint32_t last_fixes;    // Envelope fix count at last redraw
+    uint32_t last_total;    // Envelope total at last redraw
+} ui_heatmap_data_t;
+
+/**
+ * Free canvas buffer and user data when the object is deleted
+ */
+static void heatmap_delete_cb(lv_event_t *e) {
+    lv_obj_t *obj = lv_event_get_target(e);
+    ui_heatmap_data_t *data = (ui_heatmap_data_t *)lv_obj_get_user_data(obj);
+    if (data != NULL) {
+        free(data->buf);
+        free(data);
+        lv_obj_set_user_data(obj, NULL);
+    }
+}
+
+/**
+ * Create heatmap layer
+ */
+lv_obj_t* ui_heatmap_create(lv_obj_t *parent, lv_coord_t size_px) {
+    ui_heatmap_data_t *data = malloc(sizeof(ui_heatmap_data_t));
+    if (data == NULL) {
+        ESP_LOGE(TAG, "Failed to allocate heatmap data");
+        return NULL;
+    }
+    memset(data, 0, sizeof(ui_heatmap_data_t));
+
+    size_t buf_size = LV_CANVAS_BUF_SIZE_TRUE_COLOR_ALPHA(ENVELOPE_GRID_DIM, ENVELOPE_GRID_DIM);
+    data->buf = malloc(buf_size);
+    if (data->buf == NULL) {
+        ESP_LOGE(TAG, "Failed to allocate heatmap buffer (%u bytes)", (unsigned int)buf_size);
+        free(data);
+        return NULL;
+    }
+    memset(data->buf, 0, buf_size);  // All cells transparent
+
+    lv_obj_t *canvas = lv_canvas_create(parent);
+    lv_canvas_set_buffer(canvas, data->buf, ENVELOPE_GRID_DIM, ENVELOPE_GRID_DIM,
+                         LV_IMG_CF_TRUE_COLOR_ALPHA);
+
+    // Nearest-neighbour upscale keeps cell edges crisp and is cheapest to draw
+    lv_img_set_antialias(canvas, false);
+    lv_img_set_size_mode(canvas, LV_IMG_SIZE_MODE_REAL);
+    lv_img_set_pivot(canvas, ENVELOPE_GRID_DIM / 2, ENVELOPE_GRID_DIM / 2);
+    lv_img_set_zoom(canvas, (uint16_t)((size_px * LV_IMG_ZOOM_NONE) / ENVELOPE_GRID_DIM));
+    lv_obj_clear_flag(canvas, LV_OBJ_FLAG_CLICKABLE);
+
+    lv_obj_set_user_data(canvas, data);
+    lv_obj_add_event_cb(canvas, heatmap_delete_cb, LV_EVENT_DELETE, NULL);
+
+    ESP_LOGI(TAG, "Heatmap layer created: %dx%d cells at %dpx", ENVELOPE_GRID_DIM,
+             ENVELOPE_GRID_DIM, (int)size_px);
+    return canvas;
+}
+
+/**
+ * Redraw heatmap from envelope counts
+ */
+void ui_heatmap_update(lv_obj_t *heatmap, const anchor_envelope_t *env) {
+    if (heatmap == NULL || env == NULL) return;
+
+    ui_heatmap_data_t *data = (ui_heatmap_data_t *)lv_obj_get_user_data(heatmap);
+    if (data == NULL) return;
+
+    // Nothing new since the last redraw
+    if (data->last_fixes == env->fixes && data->last_total == env->total) {
+        return;
+    }
+    data->last_fixes = env->fixes;
+    data->last_total = env->total;
+
+    // Normalise against the busiest cell so the ramp survives decay passes
+    uint8_t peak = 1;
+    for (int i = 0; i < ENVELOPE_CELL_COUNT; i++) {
+        if (env->cells[i] > peak) peak = env->cells[i];
+    }
+
+    lv_img_dsc_t *img = lv_canvas_get_img(heatmap);
+    lv_color_t cold = lv_color_hex(COLOR_PRIMARY);
+    lv_color_t hot = lv_color_hex(COLOR_WARNING);
+
+    for (int row = 0; row < ENVELOPE_GRID_DIM; row++) {
+        const uint8_t *line = &env->cells[row * ENVELOPE_GRID_DIM];
+        for (int col = 0; col < ENVELOPE_GRID_DIM; col++) {
+            uint8_t count = line[col];
+            if (count == 0) {
+                lv_img_buf_set_px_alpha(img, col, row, LV_OPA_TRANSP);
+                continue;
+            }
+            uint8_t level = (uint8_t)(((uint32_t)count * 255u) / peak);
+            lv_img_buf_set_px_color(img, col, row, lv_color_mix(hot, cold, level));
+            lv_img_buf_set_px_alpha(img, col, row,
+                HEATMAP_OPA_MIN + (((HEATMAP_OPA_MAX - HEATMAP_OPA_MIN) * level) >> 8));
+        }
+    }
+
+    lv_obj_invalidate(heatmap);
+}
@@ -0,0 +1,39 @@
+/**
+ * UI Swing Envelope Heatmap Layer
+ *
+ * Author: Colin Bitterfield
+ * Email: colin@bitterfield.com
+ * Date Created: 2026-10-18
+ * Version: 0.1.0
+ *
+ * Renders the anchor_envelope_t occupancy grid as a translucent heatmap.
+ * The grid is drawn into a 64x64 ARGB canvas (one pixel per cell, ~12 KB)
+ * and scaled by LVGL to the requested size, so an update is a single pass
+ * over 4096 bytes plus one invalidation - cheap enough for the 1 Hz loop.
+ *
+ * Intended as a layer of the anchor view: create it centred on the anchor
+ * with size = 2 * grid half-extent in pixels.
+ */
+
+#ifndef UI_HEATMAP_H
+#define UI_HEATMAP_H
+
+#include "lvgl.h"
+#include "anchor_envelope.h"
+
+/**
+ * Create heatmap layer
+ * @param parent Parent object (anchor view)
+ * @param size_px On-screen edge length of the full grid (pixels)
+ * @return Heatmap object, or NULL on allocation failure
+ */
+lv_obj_t* ui_heatmap_create(lv_obj_t *parent, lv_coord_t size_px);
+
+/**
+ * Redraw heatmap from envelope counts (skipped if nothing changed)
+ * @param heatmap Object returned from ui_heatmap_create()
+ * @param env Envelope to render
+ */
+void ui_heatmap_update(lv_obj_t *heatmap, const anchor_envelope_t *env);
+
+#endif // UI_HEATMAP_H
@@ -0,0 +1,338 @@
+/**
+ * UI Render Mode Benchmark Screen Implementation
+ *
+ * Author: Colin Bitterfield
+ * Email: colin@bitterfield.com
+ * Date Created: 2026-10-18
+ * Version: 0.1.0
+ */
+
+#include "ui_render_bench.h"
+#include "ui_anchor_view.h"
+#include "ui_theme.h"
+#include "screens.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+static const char *TAG = "ui_render_bench";
+
+#define RENDER_BENCH_VIEW_PX        360     // Anchor view edge
+#define RENDER_BENCH_RODE_M         40.0f   // Rode that scales the anchor view
+
+static const char *scene_names[RENDER_BENCH_SCENE_COUNT] = {"Trail", "List scroll", "Screen switch"};
+
+typedef struct {
+    lv_obj_t *screen;
+    lv_obj_t *view;                 // Trail scene
+    lv_obj_t *list;                 // List scroll scene
+    lv_obj_t *status_label;
+    lv_obj_t *table_label;
+    lv_timer_t *timer;
+    lvgl_render_mode_t restore_mode;
+    int mode;                       // Mode being run
+    int scene;                      // Scene being run
+    int64_t scene_start_us;
+    bool measuring;                 // Past the settle time
+    lvgl_render_stats_t start;      // Counters when the measurement began
+    int64_t start_us;
+    int scroll_dir;                 // -1 scrolls the list down, +1 up
+    int switch_screen;              // Screen shown in the switch scene
+    int64_t switch_us;              // Last switch
+} render_bench_t;
+
+static render_bench_t s_bench;
+static bool s_running = false;
+static render_bench_result_t s_results[LVGL_RENDER_MODE_COUNT][RENDER_BENCH_SCENE_COUNT];
+static bool s_measured[LVGL_RENDER_MODE_COUNT][RENDER_BENCH_SCENE_COUNT];
+
+/**
+ * Show the results so far as a table
+ */
+static void render_bench_show_table(void) {
+    char text[512];
+    int len = snprintf(text, sizeof(text), "%-14s %-8s %7s %6s %8s\n",
+                       "Scene", "Mode", "FPS", "CPU %", "PSRAM MB/s");
+    for (int scene = 0; scene < RENDER_BENCH_SCENE_COUNT; scene++) {
+        for (int mode = 0; mode < LVGL_RENDER_MODE_COUNT && len < (int)sizeof(text); mode++) {
+            const render_bench_result_t *r = &s_results[mode][scene];
+            if (!s_measured[mode][scene]) continue;
+            if (!r->valid) {
+                len += snprintf(text + len, sizeof(text) - len, "%-14s %-8s %7s\n", scene_names[scene],
+                                lvgl_render_mode_name((lvgl_render_mode_t)mode), "n/a");
+                continue;
+            }
+            len += snprintf(text + len, sizeof(text) - len, "%-14s %-8s %7.1f %6.0f %8.1f\n",
+                            scene_names[scene], lvgl_render_mode_name((lvgl_render_mode_t)mode),
+                            r->fps, r->cpu_pct, r->psram_mbps);
+        }
+    }
+    lv_label_set_text(s_bench.table_label, text);
+}
+
+/**
+ * Leave the current scene: the switch scene comes back to the benchmark screen
+ */
+static void render_bench_scene_end(void) {
+    if (s_bench.scene == RENDER_BENCH_SWITCH && lv_scr_act() != s_bench.screen) {
+        lv_scr_load(s_bench.screen);
+    }
+}
+
+/**
+ * Start the current scene in the current mode (unmeasured until the settle time is over)
+ */
+static void render_bench_scene_begin(void) {
+    s_bench.scene_start_us = esp_timer_get_time();
+    s_bench.measuring = false;
+    s_bench.switch_us = s_bench.scene_start_us;
+    s_bench.switch_screen = SCREEN_START;
+    if (s_bench.scene == RENDER_BENCH_SWITCH) {
+        ui_screen_load(SCREEN_START);
+    }
+
+    lv_label_set_text_fmt(s_bench.status_label, "%s - %s (%d/%d)",
+                          lvgl_render_mode_name((lvgl_render_mode_t)s_bench.mode), scene_names[s_bench.scene],
+                          s_bench.mode * RENDER_BENCH_SCENE_COUNT + s_bench.scene + 1,
+                          LVGL_RENDER_MODE_COUNT * RENDER_BENCH_SCENE_COUNT);
+}
+
+/**
+ * Switch to the next mode that can be set (modes that fail are marked unavailable)
+ * @return false once every mode has run
+ */
+static bool render_bench_next_mode(void) {
+    while (s_bench.mode < LVGL_RENDER_MODE_COUNT) {
+        esp_err_t ret = lvgl_set_render_mode((lvgl_render_mode_t)s_bench.mode);
+        if (ret == ESP_OK) return true;
+
+        ESP_LOGW(TAG, "%s mode unavailable: %s",
+                 lvgl_render_mode_name((lvgl_render_mode_t)s_bench.mode), esp_err_to_name(ret));
+        for (int scene = 0; scene < RENDER_BENCH_SCENE_COUNT; scene++) {
+            s_results[s_bench.mode][scene].valid = false;
+            s_measured[s_bench.mode][scene] = true;
+        }
+        s_bench.mode++;
+    }
+    return false;
+}
+
+/**
+ * Close the measurement of the current scene
+ */
+static void render_bench_record(void) {
+    lvgl_render_stats_t now;
+    lvgl_get_render_stats(&now);
+    float elapsed_us = (float)(esp_timer_get_time() - s_bench.start_us);
+
+    render_bench_result_t *r = &s_results[s_bench.mode][s_bench.scene];
+    r->valid = true;
+    r->fps = (now.frames - s_bench.start.frames) * 1e6f / elapsed_us;
+    r->cpu_pct = (now.busy_us - s_bench.start.busy_us) * 100.0f / elapsed_us;
+    r->psram_mbps = (now.psram_bytes - s_bench.start.psram_bytes) / elapsed_us;     // Bytes/us = MB/s
+    s_measured[s_bench.mode][s_bench.scene] = true;
+
+    ESP_LOGI(TAG, "%s / %s: %.1f fps, %.0f%% CPU, %.1f MB/s PSRAM",
+             lvgl_render_mode_name((lvgl_render_mode_t)s_bench.mode), scene_names[s_bench.scene],
+             r->fps, r->cpu_pct, r->psram_mbps);
+}
+
+/**
+ * Drive the current scene one tick
+ */
+static void render_bench_drive(int64_t now_us) {
+    switch (s_bench.scene) {
+        case RENDER_BENCH_TRAIL: {
+            // Swing across the wind on a slow figure eight
+            float t = now_us / 1e6f;
+            float east = 0.45f * RENDER_BENCH_RODE_M * sinf(t * 0.9f);
+            float north = 0.6f * RENDER_BENCH_RODE_M + 0.15f * RENDER_BENCH_RODE_M * sinf(t * 1.8f);
+            float de = cosf(t * 0.9f) * 0.9f;
+            float dn = cosf(t * 1.8f) * 1.8f * 0.25f;
+            ui_anchor_view_set_boat(s_bench.view, east, north, atan2f(de, dn) * 180.0f / (float)M_PI, false);
+            break;
+        }
+        case RENDER_BENCH_SCROLL:
+            if (s_bench.scroll_dir < 0 && lv_obj_get_scroll_bottom(s_bench.list) <= 0) {
+                s_bench.scroll_dir = 1;
+            } else if (s_bench.scroll_dir > 0 && lv_obj_get_scroll_top(s_bench.list) <= 0) {
+                s_bench.scroll_dir = -1;
+            }
+            lv_obj_scroll_by(s_bench.list, 0, s_bench.scroll_dir * RENDER_BENCH_SCROLL_PX, LV_ANIM_OFF);
+            break;
+        default:
+            if (now_us - s_bench.switch_us >= RENDER_BENCH_SWITCH_MS * 1000LL) {
+                s_bench.switch_us = now_us;
+                s_bench.switch_screen = (s_bench.switch_screen == SCREEN_START) ? SCREEN_INFO : SCREEN_START;
+                ui_screen_load(s_bench.switch_screen);
+            }
+            break;
+    }
+}
+
+/**
+ * Benchmark tick: settle, measure, then move on to the next scene and mode
+ */
+static void render_bench_timer_cb(lv_timer_t *timer) {
+    int64_t now_us = esp_timer_get_time();
+    int64_t elapsed_us = now_us - s_bench.scene_start_us;
+
+    if (!s_bench.measuring && elapsed_us >= RENDER_BENCH_SETTLE_MS * 1000LL) {
+        s_bench.measuring = true;
+        lvgl_get_render_stats(&s_bench.start);
+        s_bench.start_us = now_us;
+    }
+
+    if (elapsed_us < (RENDER_BENCH_SETTLE_MS + RENDER_BENCH_SCENE_MS) * 1000LL) {
+        render_bench_drive(now_us);
+        return;
+    }
+
+    render_bench_record();
+    render_bench_scene_end();
+    render_bench_show_table();
+
+    if (++s_bench.scene < RENDER_BENCH_SCENE_COUNT) {
+        render_bench_scene_begin();
+        return;
+    }
+    s_bench.scene = 0;
+    s_bench.mode++;
+    if (render_bench_next_mode()) {
+        render_bench_scene_begin();
+        return;
+    }
+
+    // Done: back to the mode in use before the run
+    lvgl_set_render_mode(s_bench.restore_mode);
+    lv_label_set_text_fmt(s_bench.status_label, "Done (%s render mode)",
+                          lvgl_render_mode_name(s_bench.restore_mode));
+    lv_timer_del(s_bench.timer);
+    s_bench.timer = NULL;
+    s_running = false;
+}
+
+/**
+ * Stop the run if the screen goes away first
+ */
+static void render_bench_delete_cb(lv_event_t *e) {
+    if (s_bench.timer != NULL) {
+        lv_timer_del(s_bench.timer);
+        s_bench.timer = NULL;
+        lvgl_set_render_mode(s_bench.restore_mode);
+    }
+    s_bench.screen = NULL;
+    s_running = false;
+}
+
+/**
+ * Build the benchmark screen, load it and start the run
+ */
+lv_obj_t* ui_render_bench_start(void) {
+    if (s_running) return NULL;
+
+    memset(&s_bench, 0, sizeof(s_bench));
+    memset(s_results, 0, sizeof(s_results));
+    memset(s_measured, 0, sizeof(s_measured));
+
+    lv_obj_t *screen = lv_obj_create(NULL);
+    lv_obj_set_style_bg_color(screen, lv_color_hex(THEME_SCREEN_BG), 0);
+    lv_obj_clear_flag(screen, LV_OBJ_FLAG_SCROLLABLE);
+
+    lv_obj_t *title = lv_label_create(screen);
+    lv_label_set_text(title, "RENDER BENCHMARK");
+    THEME_STYLE_TEXT(title, THEME_TITLE_COLOR, FONT_TITLE);
+    lv_obj_align(title, LV_ALIGN_TOP_MID, 0, SPACING_MARGIN_SMALL);
+
+    lv_obj_t *status = lv_label_create(screen);
+    lv_label_set_text(status, "");
+    THEME_STYLE_TEXT(status, COLOR_TEXT_SECONDARY, FONT_BODY_NORMAL);
+    lv_obj_align(status, LV_ALIGN_TOP_MID, 0, 44);
+
+    // Trail scene (left)
+    lv_obj_t *view = ui_anchor_view_create(screen, RENDER_BENCH_VIEW_PX);
+    if (view == NULL) {
+        ESP_LOGE(TAG, "Failed to create anchor view");
+        lv_obj_del(screen);
+        return NULL;
+    }
+    lv_obj_align(view, LV_ALIGN_TOP_LEFT, 10, 76);
+    ui_anchor_view_set_rode(view, RENDER_BENCH_RODE_M);
+    ui_anchor_view_set_wind(view, 8.0f, 20.0f);
+
+    // List scroll scene (top right)
+    lv_obj_t *list = lv_list_create(screen);
+    lv_obj_set_size(list, 410, 200);
+    lv_obj_align(list, LV_ALIGN_TOP_RIGHT, -10, 76);
+    for (int i = 0; i < RENDER_BENCH_LIST_ROWS; i++) {
+        char text[32];
+        snprintf(text, sizeof(text), "Waypoint %02d   %d.%d nm", i + 1, i / 4, (i * 7) % 10);
+        lv_list_add_btn(list, NULL, text);
+    }
+
+    // Results (bottom right)
+    lv_obj_t *table = lv_label_create(screen);
+    lv_label_set_text(table, "");
+    lv_obj_set_style_text_color(table, lv_color_white(), 0);
+    lv_obj_set_style_text_font(table, &lv_font_montserrat_14, 0);   // Fits nine rows under the list
+    lv_obj_align(table, LV_ALIGN_TOP_RIGHT, -10, 286);
+    lv_obj_set_width(table, 410);
+
+    s_bench.screen = screen;
+    s_bench.view = view;
+    s_bench.list = list;
+    s_bench.status_label = status;
+    s_bench.table_label = table;
+    s_bench.restore_mode = lvgl_get_render_mode();
+    s_bench.scroll_dir = -1;
+
+    lv_obj_add_event_cb(screen, render_bench_delete_cb, LV_EVENT_DELETE, NULL);
+    lv_scr_load(screen);
+
+    s_bench.mode = 0;
+    if (!render_bench_next_mode()) {
+        ESP_LOGE(TAG, "No render mode could be set");
+        render_bench_show_table();
+        return screen;
+    }
+    s_bench.timer = lv_timer_create(render_bench_timer_cb, RENDER_BENCH_TICK_MS, NULL);
+    if (s_bench.timer == NULL) {
+        ESP_LOGE(TAG, "Failed to create benchmark timer");
+        lvgl_set_render_mode(s_bench.restore_mode);
+        return screen;
+    }
+    s_running = true;
+    render_bench_scene_begin();
+
+    ESP_LOGI(TAG, "Render benchmark: %d scenes x %d modes, %d ms each",
+             RENDER_BENCH_SCENE_COUNT, LVGL_RENDER_MODE_COUNT, RENDER_BENCH_SETTLE_MS + RENDER_BENCH_SCENE_MS);
+    return screen;
+}
+
+/**
+ * Whether a run is in progress
+ */
+bool ui_render_bench_running(void) {
+    return s_running;
+}
+
+/**
+ * Result of one scene in one mode
+ */
+bool ui_render_bench_get_result(lvgl_render_mode_t mode, render_bench_scene_t scene,
+                                render_bench_result_t *out) {
+    if (mode >= LVGL_RENDER_MODE_COUNT || scene >= RENDER_BENCH_SCENE_COUNT || !s_measured[mode][scene]) {
+        return false;
+    }
+    *out = s_results[mode][scene];
+    return true;
+}
+
+/**
+ * Short name of a scene
+ */
+const char* ui_render_bench_scene_name(render_bench_scene_t scene) {
+    return scene < RENDER_BENCH_SCENE_COUNT ? scene_names[scene] : "?";
+}
@@ -0,0 +1,90 @@
+/**
+ * UI Render Mode Benchmark Screen
+ *
+ * Author: Colin Bitterfield
+ * Email: colin@bitterfield.com
+ * Date Created: 2026-10-18
+ * Version: 0.1.0
+ *
+ * Runs three representative scenes in each LVGL render mode (direct,
+ * partial, full; see lvgl_init.h) and shows the results as a table:
+ * - Trail: the anchor view fed a swinging boat every RENDER_BENCH_TICK_MS,
+ *   so small dots and the boat redraw each frame
+ * - List scroll: a 60-row list scrolled RENDER_BENCH_SCROLL_PX per tick
+ *   (a tall area moves every frame)
+ * - Screen switch: START and INFO loaded in turn every RENDER_BENCH_SWITCH_MS
+ *   (full-screen redraws)
+ * Each scene runs RENDER_BENCH_SETTLE_MS to absorb the mode switch redraw,
+ * then is measured for RENDER_BENCH_SCENE_MS from the lvgl_init render
+ * counters:
+ * - FPS: frames put on screen per second (VSYNC caps it near 39 Hz)
+ * - CPU: LVGL task time not blocked on VSYNC or GDMA copies, as a share of
+ *   core 1
+ * - PSRAM MB/s: frame buffer bytes drawn or copied in plus the buffer sync
+ *   reads and writes (blend reads and the panel's own scan-out, a constant
+ *   30 MB/s, are not counted)
+ * The render mode in use before the run is restored at the end.
+ *
+ * Started at boot with ENABLE_RENDER_BENCHMARK (main.c), which also prints
+ * the table to the console. All functions run on the LVGL task (lvgl_lock
+ * held).
+ */
+
+#ifndef UI_RENDER_BENCH_H
+#define UI_RENDER_BENCH_H
+
+#include "lvgl.h"
+#include "lvgl_init.h"
+#include <stdbool.h>
+
+#define RENDER_BENCH_SCENE_MS       4000    // Measured run per scene and mode
+#define RENDER_BENCH_SETTLE_MS      500     // Unmeasured run first (mode switch redraw, screen builds)
+#define RENDER_BENCH_TICK_MS        16      // Scene driver period (one trail fix, one scroll step)
+#define RENDER_BENCH_SWITCH_MS      250     // Time on each screen in the switch scene
+#define RENDER_BENCH_SCROLL_PX      8       // List scroll per tick
+#define RENDER_BENCH_LIST_ROWS      60      // Rows in the scrolled list
+
+typedef enum {
+    RENDER_BENCH_TRAIL = 0,
+    RENDER_BENCH_SCROLL,
+    RENDER_BENCH_SWITCH,
+    RENDER_BENCH_SCENE_COUNT
+} render_bench_scene_t;
+
+typedef struct {
+    bool valid;                 // false: mode unavailable (partial buffers not allocated)
+    float fps;
+    float cpu_pct;
+    float psram_mbps;
+} render_bench_result_t;
+
+/**
+ * Build the benchmark screen, load it and start the run
+ * @return Benchmark screen (deleted by the caller once the run is over), or NULL on failure
+ */
+lv_obj_t* ui_render_bench_start(void);
+
+/**
+ * Whether a run is in progress
+ * @return true until every scene has run in every mode
+ */
+bool ui_render_bench_running(void);
+
+/**
+ * Result of one scene in one mode
+ * @param mode Render mode
+ * @param scene Scene
+ * @param out Result output
+ * @return false for a bad mode or scene, or a scene not yet measured
+ */
+bool ui_render_bench_get_result(lvgl_render_mode_t mode, render_bench_scene_t scene,
+                                render_bench_result_t *out);
+
+/**
+ * Short name of a scene
+ * @param scene Scene
+ * @return "Trail", "List scroll", "Screen switch" (or "?")
+ */
+const char* ui_render_bench_scene_name(render_bench_scene_t scene);
+
+#endif // UI_RENDER_BENCH_H
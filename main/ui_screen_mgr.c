@@ -0,0 +1,298 @@
+/**
+ * UI Screen Manager Implementation
+ *
+ * Author: Colin Bitterfield
+ * Email: colin@bitterfield.com
+ * Date Created: 2026-10-18
+ * Date Updated: 2026-10-18
+ * Version: 0.1.1
+ */
+
+#include "ui_screen_mgr.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "esp_heap_caps.h"
+#include <string.h>
+
+static const char *TAG = "ui_screen";
+
+typedef struct {
+    bool registered;
+    ui_screen_def_t def;
+    lv_obj_t *screen;           // NULL until built and after teardown
+    uint32_t last_use;          // LRU stamp (s_use_clock)
+    ui_screen_stats_t stats;
+} ui_screen_slot_t;
+
+static const char *policy_names[] = {"keep", "cached", "volatile"};
+
+static ui_screen_slot_t s_slots[UI_SCREEN_MAX];
+static uint32_t s_use_clock = 0;
+static lv_timer_t *s_idle_timer = NULL;
+static lv_obj_t *s_idle_checked_scr = NULL;     // Active screen the idle hint was tried for
+
+/**
+ * Count a screen's objects (the screen included)
+ */
+static uint32_t ui_screen_count_objects(lv_obj_t *obj) {
+    uint32_t count = 1;
+    uint32_t child_cnt = lv_obj_get_child_cnt(obj);
+    for (uint32_t i = 0; i < child_cnt; i++) {
+        count += ui_screen_count_objects(lv_obj_get_child(obj, (int32_t)i));
+    }
+    return count;
+}
+
+static ui_screen_slot_t* ui_screen_slot(int id) {
+    if (id < 0 || id >= UI_SCREEN_MAX || !s_slots[id].registered) return NULL;
+    return &s_slots[id];
+}
+
+/**
+ * Delete a built screen (never the active one)
+ */
+static void ui_screen_teardown(ui_screen_slot_t *slot) {
+    lv_obj_t *screen = slot->screen;
+    if (screen == NULL || screen == lv_scr_act()) return;
+
+    if (slot->def.destroy != NULL) {
+        slot->def.destroy(screen, slot->def.ctx);
+    }
+    slot->screen = NULL;
+    slot->stats.alive = false;
+
+    // Async: teardown can run from an event of an object on this screen
+    lv_obj_del_async(screen);
+    ESP_LOGD(TAG, "Deleted %s", slot->def.name);
+}
+
+/**
+ * Delete least recently used cached screens beyond UI_SCREEN_CACHE_MAX
+ */
+static void ui_screen_evict(ui_screen_slot_t *keep) {
+    while (true) {
+        int cached = 0;
+        ui_screen_slot_t *oldest = NULL;
+        lv_obj_t *active = lv_scr_act();
+
+        for (int i = 0; i < UI_SCREEN_MAX; i++) {
+            ui_screen_slot_t *slot = &s_slots[i];
+            if (slot->screen == NULL || slot->def.policy != UI_SCREEN_CACHED) continue;
+            cached++;
+            if (slot == keep || slot->screen == active) continue;
+            if (oldest == NULL || slot->last_use < oldest->last_use) {
+                oldest = slot;
+            }
+        }
+        if (cached <= UI_SCREEN_CACHE_MAX || oldest == NULL) return;
+
+        ESP_LOGI(TAG, "Cache full (%d), evicting %s", UI_SCREEN_CACHE_MAX, oldest->def.name);
+        ui_screen_teardown(oldest);
+    }
+}
+
+/**
+ * Screen events: forget deleted screens, drop volatile screens once left
+ */
+static void ui_screen_event_cb(lv_event_t *e) {
+    ui_screen_slot_t *slot = (ui_screen_slot_t *)lv_event_get_user_data(e);
+    lv_obj_t *screen = lv_event_get_target(e);
+    if (slot->screen != screen) return;     // Stale instance already replaced
+
+    if (lv_event_get_code(e) == LV_EVENT_DELETE) {
+        // Deleted outside the manager
+        slot->screen = NULL;
+        slot->stats.alive = false;
+    } else if (slot->def.policy == UI_SCREEN_VOLATILE) {
+        ui_screen_teardown(slot);
+    }
+}
+
+/**
+ * Run a screen's factory and record what it cost
+ */
+static lv_obj_t* ui_screen_build(ui_screen_slot_t *slot) {
+    size_t heap_before = heap_caps_get_free_size(MALLOC_CAP_8BIT);
+    int64_t start_us = esp_timer_get_time();
+
+    lv_obj_t *screen = slot->def.create(slot->def.ctx);
+
+    int64_t elapsed_us = esp_timer_get_time() - start_us;
+    size_t heap_after = heap_caps_get_free_size(MALLOC_CAP_8BIT);
+
+    if (screen == NULL) {
+        ESP_LOGE(TAG, "Failed to create %s", slot->def.name);
+        return NULL;
+    }
+
+    slot->screen = screen;
+    slot->stats.alive = true;
+    slot->stats.creations++;
+    slot->stats.objects = ui_screen_count_objects(screen);
+    slot->stats.heap_bytes = (int32_t)heap_before - (int32_t)heap_after;
+    slot->stats.create_us = (uint32_t)elapsed_us;
+
+    lv_obj_add_event_cb(screen, ui_screen_event_cb, LV_EVENT_SCREEN_UNLOADED, slot);
+    lv_obj_add_event_cb(screen, ui_screen_event_cb, LV_EVENT_DELETE, slot);
+
+    ESP_LOGI(TAG, "Created %s: %u objects, %ld bytes, %u us (build #%u)",
+             slot->def.name, (unsigned int)slot->stats.objects, (long)slot->stats.heap_bytes,
+             (unsigned int)slot->stats.create_us, (unsigned int)slot->stats.creations);
+    return screen;
+}
+
+/**
+ * Build the active screen's next hint once the touch panel is idle
+ */
+static void ui_screen_idle_cb(lv_timer_t *timer) {
+    lv_obj_t *active = lv_scr_act();
+    if (active == s_idle_checked_scr || lv_disp_get_inactive_time(NULL) < UI_SCREEN_IDLE_MS) {
+        return;
+    }
+    s_idle_checked_scr = active;    // One attempt per visit
+
+    ui_screen_slot_t *slot = ui_screen_slot(ui_screen_active());
+    if (slot == NULL) return;
+
+    // A volatile screen built ahead would never be unloaded, so it is never built ahead
+    ui_screen_slot_t *next = ui_screen_slot(slot->def.next);
+    if (next == NULL || next->screen != NULL || next->def.policy == UI_SCREEN_VOLATILE) return;
+
+    ESP_LOGI(TAG, "Idle on %s, building %s ahead", slot->def.name, next->def.name);
+    ui_screen_get(slot->def.next);
+}
+
+/**
+ * Initialise the manager and start the idle timer
+ */
+esp_err_t ui_screen_mgr_init(void) {
+    if (s_idle_timer != NULL) return ESP_OK;
+
+    s_idle_timer = lv_timer_create(ui_screen_idle_cb, UI_SCREEN_IDLE_POLL_MS, NULL);
+    if (s_idle_timer == NULL) {
+        ESP_LOGE(TAG, "Failed to create idle timer");
+        return ESP_ERR_NO_MEM;
+    }
+    return ESP_OK;
+}
+
+/**
+ * Register a screen
+ */
+esp_err_t ui_screen_register(int id, const ui_screen_def_t *def) {
+    if (id < 0 || id >= UI_SCREEN_MAX || def == NULL || def->create == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    ui_screen_slot_t *slot = &s_slots[id];
+    if (slot->screen != NULL) {
+        ESP_LOGW(TAG, "Re-registering %s while it exists", def->name);
+    }
+    slot->def = *def;
+    if (slot->def.name == NULL) {
+        slot->def.name = "?";
+    }
+    slot->registered = true;
+    return ESP_OK;
+}
+
+/**
+ * Get a screen, building it if needed
+ */
+lv_obj_t* ui_screen_get(int id) {
+    ui_screen_slot_t *slot = ui_screen_slot(id);
+    if (slot == NULL) {
+        ESP_LOGE(TAG, "Screen %d not registered", id);
+        return NULL;
+    }
+
+    slot->last_use = ++s_use_clock;
+    if (slot->screen == NULL) {
+        if (ui_screen_build(slot) == NULL) return NULL;
+        if (slot->def.policy == UI_SCREEN_CACHED) {
+            ui_screen_evict(slot);
+        }
+    }
+    return slot->screen;
+}
+
+/**
+ * Get a screen and load it
+ */
+bool ui_screen_load(int id) {
+    lv_obj_t *screen = ui_screen_get(id);
+    if (screen == NULL) return false;
+
+    s_slots[id].stats.loads++;
+    lv_scr_load(screen);
+    return true;
+}
+
+/**
+ * Delete a screen now
+ */
+void ui_screen_drop(int id) {
+    ui_screen_slot_t *slot = ui_screen_slot(id);
+    if (slot != NULL) {
+        ui_screen_teardown(slot);
+    }
+}
+
+/**
+ * Id of the loaded screen
+ */
+int ui_screen_active(void) {
+    lv_obj_t *active = lv_scr_act();
+    for (int i = 0; i < UI_SCREEN_MAX; i++) {
+        if (s_slots[i].screen != NULL && s_slots[i].screen == active) return i;
+    }
+    return UI_SCREEN_NONE;
+}
+
+/**
+ * Log name of a screen
+ */
+const char* ui_screen_name(int id) {
+    ui_screen_slot_t *slot = ui_screen_slot(id);
+    return slot != NULL ? slot->def.name : NULL;
+}
+
+/**
+ * Copy the statistics of one screen
+ */
+bool ui_screen_get_stats(int id, ui_screen_stats_t *out) {
+    ui_screen_slot_t *slot = ui_screen_slot(id);
+    if (slot == NULL) {
+        memset(out, 0, sizeof(*out));
+        return false;
+    }
+    *out = slot->stats;
+    return true;
+}
+
+/**
+ * Log one line per registered screen and the totals
+ */
+void ui_screen_log_stats(void) {
+    uint32_t alive = 0;
+    uint32_t objects = 0;
+    int32_t heap_bytes = 0;
+
+    for (int i = 0; i < UI_SCREEN_MAX; i++) {
+        ui_screen_slot_t *slot = &s_slots[i];
+        if (!slot->registered) continue;
+
+        const ui_screen_stats_t *st = &slot->stats;
+        ESP_LOGI(TAG, "%-14s %-8s %-5s built %3u loaded %3u  %4u objs %7ld B %6u us",
+                 slot->def.name, policy_names[slot->def.policy], st->alive ? "alive" : "-",
+                 (unsigned int)st->creations, (unsigned int)st->loads,
+                 (unsigned int)st->objects, (long)st->heap_bytes, (unsigned int)st->create_us);
+        if (st->alive) {
+            alive++;
+            objects += st->objects;
+            heap_bytes += st->heap_bytes;
+        }
+    }
+    ESP_LOGI(TAG, "%u screens alive: %u objects, %ld bytes",
+             (unsigned int)alive, (unsigned int)objects, (long)heap_bytes);
+}
@@ -0,0 +1,133 @@
+/**
+ * UI Screen Manager
+ *
+ * Author: Colin Bitterfield
+ * Email: colin@bitterfield.com
+ * Date Created: 2026-10-18
+ * Date Updated: 2026-10-18
+ * Version: 0.1.1
+ *
+ * Changelog:
+ * - 0.1.1 (2026-10-18): ui_screen_name() for tools that address screens by name
+ *
+ * Owns the lifetime of every screen. Each screen is registered once with a
+ * factory and a policy; nothing is built until it is first needed:
+ * - UI_SCREEN_KEEP: built on first use and never deleted (navigation pages,
+ *   DISPLAY). Back buttons and the footer always return to the same object.
+ * - UI_SCREEN_CACHED: kept after it is left, at most UI_SCREEN_CACHE_MAX at
+ *   once; creating one more deletes the least recently used.
+ * - UI_SCREEN_VOLATILE: built for each visit and deleted once another screen
+ *   is loaded (screens that show a snapshot or run their own timers).
+ * Teardown calls the optional destroy hook first, then deletes the screen
+ * asynchronously, so the LV_EVENT_DELETE handlers already on each screen
+ * still free its timers and user data. The active screen is never deleted.
+ *
+ * When the touch panel has been idle for UI_SCREEN_IDLE_MS, the screen named
+ * as the active screen's next hint is built ahead of time (kept or cached
+ * screens only).
+ *
+ * Every creation records the objects built, the heap it took and how long
+ * the factory ran, so leaks and slow screens show up in ui_screen_log_stats().
+ * All functions run on the LVGL task (event callbacks or lvgl_lock held).
+ */
+
+#ifndef UI_SCREEN_MGR_H
+#define UI_SCREEN_MGR_H
+
+#include "lvgl.h"
+#include "esp_err.h"
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#define UI_SCREEN_MAX               32      // Registry slots (screen ids 0 .. UI_SCREEN_MAX-1)
+#define UI_SCREEN_CACHE_MAX         4       // UI_SCREEN_CACHED screens kept alive at once
+#define UI_SCREEN_IDLE_MS           2000    // Touch idle time before the next hint is built
+#define UI_SCREEN_IDLE_POLL_MS      500     // Idle check period
+#define UI_SCREEN_NONE              (-1)    // No screen (next hint, ui_screen_active())
+
+typedef enum {
+    UI_SCREEN_KEEP = 0,         // Never deleted
+    UI_SCREEN_CACHED,           // Kept, least recently used deleted first
+    UI_SCREEN_VOLATILE          // Deleted when left
+} ui_screen_policy_t;
+
+typedef struct {
+    const char *name;                               // Log name
+    lv_obj_t* (*create)(void *ctx);                 // Factory: returns a new screen or NULL
+    void (*destroy)(lv_obj_t *screen, void *ctx);   // Optional hook before deletion (NULL = none)
+    void *ctx;                                      // Passed to create and destroy
+    ui_screen_policy_t policy;
+    int next;                                       // Screen to build while idle here (UI_SCREEN_NONE)
+} ui_screen_def_t;
+
+typedef struct {
+    bool alive;                 // Screen currently exists
+    uint32_t creations;         // Times the factory ran
+    uint32_t loads;             // Times the screen was loaded
+    uint32_t objects;           // Objects in the screen when last built
+    int32_t heap_bytes;         // Heap taken by the last build
+    uint32_t create_us;         // Factory run time of the last build
+} ui_screen_stats_t;
+
+/**
+ * Initialise the manager and start the idle timer
+ * @return ESP_OK on success
+ */
+esp_err_t ui_screen_mgr_init(void);
+
+/**
+ * Register a screen (the definition is copied)
+ * @param id Screen id (0 .. UI_SCREEN_MAX-1)
+ * @param def Factory, hooks and policy
+ * @return ESP_ERR_INVALID_ARG for a bad id or missing factory
+ */
+esp_err_t ui_screen_register(int id, const ui_screen_def_t *def);
+
+/**
+ * Get a screen, building it if it does not exist
+ * @param id Screen id
+ * @return Screen object, or NULL if unregistered or the factory failed
+ */
+lv_obj_t* ui_screen_get(int id);
+
+/**
+ * Get a screen (building it if needed) and load it
+ * @param id Screen id
+ * @return false if the screen could not be built
+ */
+bool ui_screen_load(int id);
+
+/**
+ * Delete a screen now (no-op if it is the active screen or does not exist)
+ * @param id Screen id
+ */
+void ui_screen_drop(int id);
+
+/**
+ * Id of the loaded screen
+ * @return Screen id, or UI_SCREEN_NONE if the loaded screen is not managed
+ */
+int ui_screen_active(void);
+
+/**
+ * Log name of a screen
+ * @param id Screen id
+ * @return Name given at registration, or NULL for an unregistered id
+ */
+const char* ui_screen_name(int id);
+
+/**
+ * Copy the statistics of one screen
+ * @param id Screen id
+ * @param out Statistics output
+ * @return false for an unregistered id
+ */
+bool ui_screen_get_stats(int id, ui_screen_stats_t *out);
+
+/**
+ * Log one line per registered screen and the totals
+ */
+void ui_screen_log_stats(void);
+
+#endif // UI_SCREEN_MGR_H
@@ -0,0 +1,181 @@
+/**
+ * UI Status Model Implementation
+ *
+ * Author: Colin Bitterfield
+ * Email: colin@bitterfield.com
+ * Date Created: 2026-10-18
+ * Version: 0.1.0
+ */
+
+#include "ui_status.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "esp_log.h"
+#include <string.h>
+
+static const char *TAG = "ui_status";
+
+typedef struct {
+    lv_obj_t *owner;            // NULL = free slot
+    uint32_t mask;
+    ui_status_cb_t cb;
+    void *user_data;
+    uint32_t seen;              // Sequence delivered up to
+} ui_status_sub_t;
+
+// Published state (guarded by s_mutex)
+static SemaphoreHandle_t s_mutex = NULL;
+static ui_status_t s_status;
+static uint32_t s_seq = 0;                  // Bumped on every change
+
+// Dispatch state (LVGL task only)
+static ui_status_sub_t s_subs[UI_STATUS_MAX_SUBSCRIBERS];
+static uint32_t s_dispatched_seq = 0;
+static lv_obj_t *s_dispatched_scr = NULL;
+
+/**
+ * Record a change of one field (s_mutex held)
+ */
+static void ui_status_bump(ui_status_field_t field) {
+    s_seq++;
+    s_status.version[field] = s_seq;
+}
+
+/**
+ * Owner on the loaded screen or on a layer drawn over every screen
+ */
+static bool ui_status_visible(lv_obj_t *owner, lv_obj_t *scr) {
+    lv_obj_t *owner_scr = lv_obj_get_screen(owner);
+    return owner_scr == scr || owner_scr == lv_layer_top() || owner_scr == lv_layer_sys();
+}
+
+/**
+ * Deliver changes to visible subscribers (once per frame, LVGL task)
+ */
+static void ui_status_dispatch_cb(lv_timer_t *timer) {
+    lv_obj_t *scr = lv_scr_act();
+    ui_status_t snap;
+
+    xSemaphoreTake(s_mutex, portMAX_DELAY);
+    uint32_t seq = s_seq;
+    if (seq == s_dispatched_seq && scr == s_dispatched_scr) {
+        xSemaphoreGive(s_mutex);
+        return;     // Nothing new and the same screen: one compare per frame
+    }
+    snap = s_status;
+    xSemaphoreGive(s_mutex);
+
+    for (int i = 0; i < UI_STATUS_MAX_SUBSCRIBERS; i++) {
+        ui_status_sub_t *sub = &s_subs[i];
+        if (sub->owner == NULL || sub->seen == seq || !ui_status_visible(sub->owner, scr)) {
+            continue;
+        }
+        uint32_t changed = 0;
+        for (int f = 0; f < UI_STATUS_FIELD_COUNT; f++) {
+            if ((sub->mask & UI_STATUS_MASK(f)) && snap.version[f] > sub->seen) {
+                changed |= UI_STATUS_MASK(f);
+            }
+        }
+        sub->seen = seq;
+        if (changed != 0) {
+            sub->cb(sub->owner, &snap, changed, sub->user_data);
+        }
+    }
+    s_dispatched_seq = seq;
+    s_dispatched_scr = scr;
+}
+
+/**
+ * Free the subscription when its owner is deleted
+ */
+static void ui_status_owner_delete_cb(lv_event_t *e) {
+    ui_status_sub_t *sub = (ui_status_sub_t *)lv_event_get_user_data(e);
+    memset(sub, 0, sizeof(*sub));
+}
+
+/**
+ * Initialise the model and start the dispatch timer
+ */
+esp_err_t ui_status_init(void) {
+    if (s_mutex != NULL) return ESP_OK;
+
+    s_mutex = xSemaphoreCreateMutex();
+    if (s_mutex == NULL) {
+        ESP_LOGE(TAG, "Failed to create status mutex");
+        return ESP_ERR_NO_MEM;
+    }
+
+    if (lv_timer_create(ui_status_dispatch_cb, LV_DISP_DEF_REFR_PERIOD, NULL) == NULL) {
+        ESP_LOGE(TAG, "Failed to create dispatch timer");
+        return ESP_ERR_NO_MEM;
+    }
+    ESP_LOGI(TAG, "Status model ready (%d fields, dispatch every %d ms)",
+             UI_STATUS_FIELD_COUNT, LV_DISP_DEF_REFR_PERIOD);
+    return ESP_OK;
+}
+
+/**
+ * Publish the clock
+ */
+void ui_status_set_time(int hour, int min, int sec) {
+    if (s_mutex == NULL) return;
+
+    xSemaphoreTake(s_mutex, portMAX_DELAY);
+    if (s_status.hour != hour || s_status.min != min || s_status.sec != sec ||
+        s_status.version[UI_STATUS_TIME] == 0) {
+        s_status.hour = (uint8_t)hour;
+        s_status.min = (uint8_t)min;
+        s_status.sec = (uint8_t)sec;
+        ui_status_bump(UI_STATUS_TIME);
+    }
+    xSemaphoreGive(s_mutex);
+}
+
+/**
+ * Publish an on/off field
+ */
+void ui_status_set_flag(ui_status_field_t field, bool on) {
+    if (s_mutex == NULL || field <= UI_STATUS_TIME || field >= UI_STATUS_FIELD_COUNT) return;
+
+    xSemaphoreTake(s_mutex, portMAX_DELAY);
+    if (s_status.flag[field] != on || s_status.version[field] == 0) {
+        s_status.flag[field] = on;
+        ui_status_bump(field);
+    }
+    xSemaphoreGive(s_mutex);
+}
+
+/**
+ * Copy the current status
+ */
+void ui_status_get(ui_status_t *out) {
+    memset(out, 0, sizeof(*out));
+    if (s_mutex == NULL) return;
+
+    xSemaphoreTake(s_mutex, portMAX_DELAY);
+    *out = s_status;
+    xSemaphoreGive(s_mutex);
+}
+
+/**
+ * Subscribe an object to fields
+ */
+bool ui_status_subscribe(lv_obj_t *owner, uint32_t mask, ui_status_cb_t cb, void *user_data) {
+    if (owner == NULL || cb == NULL) return false;
+
+    for (int i = 0; i < UI_STATUS_MAX_SUBSCRIBERS; i++) {
+        ui_status_sub_t *sub = &s_subs[i];
+        if (sub->owner != NULL) continue;
+
+        sub->owner = owner;
+        sub->mask = mask & UI_STATUS_ALL;
+        sub->cb = cb;
+        sub->user_data = user_data;
+        sub->seen = 0;
+        lv_obj_add_event_cb(owner, ui_status_owner_delete_cb, LV_EVENT_DELETE, sub);
+        s_dispatched_scr = NULL;    // Deliver published fields on the next frame
+        return true;
+    }
+    ESP_LOGE(TAG, "No free subscriber slot (%d in use)", UI_STATUS_MAX_SUBSCRIBERS);
+    return false;
+}
@@ -0,0 +1,101 @@
+/**
+ * UI Status Model
+ *
+ * Author: Colin Bitterfield
+ * Email: colin@bitterfield.com
+ * Date Created: 2026-10-18
+ * Version: 0.1.0
+ *
+ * One place for the status shown across screens: clock, GPS fix, compass,
+ * SD card, WiFi, Bluetooth, anchor armed and alarm. Any task publishes a
+ * field with ui_status_set_*(); only a real change bumps the field's
+ * version, and publishing never takes the LVGL lock.
+ *
+ * Widgets subscribe from the LVGL task with a field mask. A dispatch timer
+ * runs once per frame (LV_DISP_DEF_REFR_PERIOD) and, when something has
+ * changed or another screen was loaded, calls each subscriber whose owner
+ * is on the visible screen (or on the top/system layer) once, with every
+ * field that changed since that subscriber last ran. Subscribers on hidden
+ * screens are skipped and catch up when their screen is loaded. A
+ * subscription ends when its owner object is deleted.
+ */
+
+#ifndef UI_STATUS_H
+#define UI_STATUS_H
+
+#include "lvgl.h"
+#include "esp_err.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+typedef enum {
+    UI_STATUS_TIME = 0,         // Clock (hour, min, sec)
+    UI_STATUS_GPS,              // Recent position fix
+    UI_STATUS_COMPASS,          // Recent heading
+    UI_STATUS_SD,               // SD card mounted
+    UI_STATUS_WIFI,             // WiFi connected
+    UI_STATUS_BT,               // Bluetooth connected
+    UI_STATUS_ARMED,            // Anchor watch on
+    UI_STATUS_ALARM,            // Anchor alarm latched
+    UI_STATUS_FIELD_COUNT
+} ui_status_field_t;
+
+#define UI_STATUS_MASK(field)       (1u << (field))
+#define UI_STATUS_ALL               ((1u << UI_STATUS_FIELD_COUNT) - 1u)
+#define UI_STATUS_MAX_SUBSCRIBERS   32
+
+typedef struct {
+    uint8_t hour, min, sec;
+    bool flag[UI_STATUS_FIELD_COUNT];           // On/off fields (GPS .. ALARM)
+    uint32_t version[UI_STATUS_FIELD_COUNT];    // Change sequence of each field (0 = never set)
+} ui_status_t;
+
+/**
+ * Subscriber callback (LVGL task, at most once per frame)
+ * @param owner Object the subscription belongs to
+ * @param status Snapshot of every field
+ * @param changed UI_STATUS_MASK() bits changed since this subscriber last ran
+ * @param user_data Pointer given to ui_status_subscribe()
+ */
+typedef void (*ui_status_cb_t)(lv_obj_t *owner, const ui_status_t *status, uint32_t changed,
+                               void *user_data);
+
+/**
+ * Initialise the model and start the dispatch timer (LVGL task or lvgl_lock held)
+ * @return ESP_OK on success
+ */
+esp_err_t ui_status_init(void);
+
+/**
+ * Publish the clock (any task)
+ * @param hour Hour (0-23)
+ * @param min Minute (0-59)
+ * @param sec Second (0-59)
+ */
+void ui_status_set_time(int hour, int min, int sec);
+
+/**
+ * Publish an on/off field (any task)
+ * @param field UI_STATUS_GPS .. UI_STATUS_ALARM
+ * @param on New value
+ */
+void ui_status_set_flag(ui_status_field_t field, bool on);
+
+/**
+ * Copy the current status (any task)
+ * @param out Snapshot output
+ */
+void ui_status_get(ui_status_t *out);
+
+/**
+ * Subscribe an object to fields (LVGL task)
+ * Fields already published are delivered on the next frame the owner is visible.
+ * @param owner Object whose deletion ends the subscription
+ * @param mask UI_STATUS_MASK() bits of interest
+ * @param cb Callback
+ * @param user_data Passed to cb
+ * @return false if all UI_STATUS_MAX_SUBSCRIBERS slots are taken
+ */
+bool ui_status_subscribe(lv_obj_t *owner, uint32_t mask, ui_status_cb_t cb, void *user_data);
+
+#endif // UI_STATUS_H